@@ -1,11 +1,14 @@
 #!/bin/bash
 # SPDX-License-Identifier: GPL-3.0-or-later
 #
-# helix-launcher.sh - Launch HelixScreen with early splash screen
+# helix-launcher.sh - Launch HelixScreen
 #
-# This script starts the splash screen immediately for instant visual feedback,
-# then launches the main application in parallel. The splash automatically exits
-# when the main app takes over the display.
+# helix-screen shows its own splash as soon as the display is up and builds the UI
+# beneath it. With --splash=process, this script instead starts the separate
+# helix-splash binary first and launches the main application in parallel; the splash
+# exits when the main app takes over the display. Both report their time to first
+# frame ("helix-splash: first frame after N ms", and "first_pixel" in helix-screen's
+# "[Startup]" log line) for comparison.
 #
 # Usage:
 #   ./helix-launcher.sh [options]
@@ -14,11 +17,13 @@
 #   --debug              Enable debug-level logging (-vv)
 #   --log-dest=<dest>    Log destination: auto, journal, syslog, file, console
 #   --log-file=<path>    Log file path (when --log-dest=file)
+#   --splash=<mode>      inprocess (default) or process (separate helix-splash binary)
 #
 # Environment variables:
 #   HELIX_DEBUG=1        Same as --debug
 #   HELIX_LOG_DEST=<d>   Same as --log-dest (auto|journal|syslog|file|console)
 #   HELIX_LOG_FILE=<f>   Same as --log-file
+#   HELIX_SPLASH=<mode>  Same as --splash
 #
 # All other options are passed through to helix-screen.
 #
@@ -38,6 +43,7 @@ set -e
 DEBUG_MODE="${HELIX_DEBUG:-0}"
 LOG_DEST="${HELIX_LOG_DEST:-auto}"
 LOG_FILE="${HELIX_LOG_FILE:-}"
+SPLASH_MODE="${HELIX_SPLASH:-inprocess}"
 
 # Parse launcher-specific arguments
 PASSTHROUGH_ARGS=()
@@ -52,6 +58,9 @@ for arg in "$@"; do
         --log-file=*)
             LOG_FILE="${arg#--log-file=}"
             ;;
+        --splash=*)
+            SPLASH_MODE="${arg#--splash=}"
+            ;;
         *)
             PASSTHROUGH_ARGS+=("$arg")
             ;;
@@ -62,17 +71,17 @@ done
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 
 # Support installed, deployed, and development layouts
-if [ -x "${SCRIPT_DIR}/helix-splash" ]; then
+if [ -x "${SCRIPT_DIR}/helix-screen" ]; then
     # Installed: binaries in same directory as script
     BIN_DIR="${SCRIPT_DIR}"
-elif [ -x "${SCRIPT_DIR}/../helix-splash" ]; then
+elif [ -x "${SCRIPT_DIR}/../helix-screen" ]; then
     # Deployed: binaries in parent directory (rsync deployment layout)
     BIN_DIR="${SCRIPT_DIR}/.."
-elif [ -x "${SCRIPT_DIR}/../build/bin/helix-splash" ]; then
+elif [ -x "${SCRIPT_DIR}/../build/bin/helix-screen" ]; then
     # Development: binaries in build/bin relative to config/
     BIN_DIR="${SCRIPT_DIR}/../build/bin"
 else
-    echo "Error: Cannot find helix-splash binary" >&2
+    echo "Error: Cannot find helix-screen binary" >&2
     echo "Looked in: ${SCRIPT_DIR}, ${SCRIPT_DIR}/.., and ${SCRIPT_DIR}/../build/bin" >&2
     exit 1
 fi
@@ -106,8 +115,12 @@ cleanup() {
 
 trap cleanup EXIT INT TERM
 
-# Start splash screen in background (if binary exists)
-if [ -x "${SPLASH_BIN}" ]; then
+# Start the separate splash process in background (if requested and the binary exists)
+SPLASH_PID=""
+SPLASH_ARGS=""
+if [ "${SPLASH_MODE}" != "process" ]; then
+    log "Splash shown by the main app"
+elif [ -x "${SPLASH_BIN}" ]; then
     log "Starting splash screen (${HELIX_SCREEN_WIDTH}x${HELIX_SCREEN_HEIGHT})"
     "${SPLASH_BIN}" -w "${HELIX_SCREEN_WIDTH}" -h "${HELIX_SCREEN_HEIGHT}" &
     SPLASH_PID=$!
@@ -117,8 +130,6 @@ if [ -x "${SPLASH_BIN}" ]; then
     SPLASH_ARGS="--splash-pid=${SPLASH_PID}"
 else
     log "Splash binary not found, starting main app directly"
-    SPLASH_PID=""
-    SPLASH_ARGS=""
 fi
 
 # Start main application
@@ -131,9 +131,26 @@ void app_request_restart();
  */
 void app_request_restart_for_theme();
 
+/**
+ * @brief Quit through the main loop on SIGTERM and SIGINT
+ *
+ * Instead of terminating the process, the signals end the main loop like
+ * app_request_quit(), so shutdown still writes pending config saves and
+ * notification log records (systemctl stop/restart sends SIGTERM).
+ * Call once MainLoopWaker is initialized.
+ */
+void app_install_signal_handlers();
+
+/**
+ * @brief Signal that requested quit, if any
+ * @return SIGTERM or SIGINT, or 0 if no signal was received
+ */
+int app_quit_signal();
+
 /**
  * @brief Check if quit has been requested
- * @return true if app_request_quit() or app_request_restart() was called
+ * @return true if app_request_quit() or app_request_restart() was called, or a quit
+ *         signal was received
  */
 bool app_quit_requested();
 
@@ -52,3 +52,49 @@
 bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, double z,
                                                          int canvas_width, int canvas_height,
                                                          const bed_mesh_view_state_t* view);
+
+/**
+ * @brief Projected point before FOV scaling and screen offsets
+ *
+ * Perspective scales linearly with fov_scale, so screen coordinates are
+ * canvas_center + normalized * fov_scale + offsets. Caching normalized points lets the
+ * renderer re-fit a projection to a new FOV, canvas size or layer offset without
+ * repeating the rotation and perspective divide.
+ */
+struct bed_mesh_normalized_point_t {
+    double x, y;  // View-space X/Y divided by camera depth
+    double depth; // Z-depth from camera (for sorting)
+};
+
+/**
+ * @brief Rotate and perspective-divide a 3D point, independent of FOV and offsets
+ *
+ * Uses cached trigonometric values from view_state (angles only).
+ *
+ * @param x World X coordinate
+ * @param y World Y coordinate
+ * @param z World Z coordinate
+ * @param view View/camera state (rotation)
+ * @return Normalized point with depth
+ */
+bed_mesh_normalized_point_t
+bed_mesh_projection_project_normalized(double x, double y, double z,
+                                       const bed_mesh_view_state_t* view);
+
+/**
+ * @brief Map a normalized point to screen space
+ *
+ * Applies fov_scale, canvas centering, center_offset and layer_offset exactly as
+ * bed_mesh_projection_project_3d_to_2d() does.
+ *
+ * @param point Normalized point from bed_mesh_projection_project_normalized()
+ * @param canvas_width Canvas width in pixels
+ * @param canvas_height Canvas height in pixels
+ * @param view View/camera state (FOV scale and offsets)
+ * @param[out] out_screen_x Screen X coordinate
+ * @param[out] out_screen_y Screen Y coordinate
+ */
+void bed_mesh_projection_normalized_to_screen(const bed_mesh_normalized_point_t* point,
+                                              int canvas_width, int canvas_height,
+                                              const bed_mesh_view_state_t* view, int* out_screen_x,
+                                              int* out_screen_y);
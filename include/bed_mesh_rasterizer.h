@@ -0,0 +1,105 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file bed_mesh_rasterizer.h
+ * @brief Software triangle rasterizer for the bed mesh surface
+ *
+ * Fills Gouraud-shaded triangles straight into an XRGB8888 pixel buffer, with an
+ * optional float depth buffer so triangles can be submitted in any order. The bed
+ * mesh renderer uses this to build the whole surface in a private lv_draw_buf and
+ * composite it with a single lv_draw_image, instead of one lv_draw_rect per span.
+ *
+ * Fill convention: vertices sit on pixel centers; a pixel is covered when its center
+ * lies inside the triangle, with the top and left edges inclusive and the bottom and
+ * right edges exclusive. Triangles sharing an edge therefore never touch the same
+ * pixel twice and never leave a gap between them.
+ *
+ * No LVGL dependency, so the rasterizer can be unit tested on its own.
+ */
+
+/**
+ * @brief Destination buffers for rasterization
+ */
+struct bed_mesh_raster_target_t {
+    uint32_t* pixels; ///< XRGB8888 pixels (0xFFRRGGBB)
+    float* depth;     ///< Per-pixel depth (nullptr = no depth test, painter's order)
+    int width;        ///< Width in pixels
+    int height;       ///< Height in pixels
+    int stride;       ///< Row pitch of @p pixels in pixels (>= width); depth is tightly packed
+};
+
+/**
+ * @brief Triangle vertex in target pixel coordinates
+ */
+struct bed_mesh_raster_vertex_t {
+    int x, y;        ///< Pixel coordinates relative to the target origin
+    float depth;     ///< Camera depth (larger = further away)
+    uint8_t r, g, b; ///< Vertex color
+};
+
+// Drag preview: while dragging, the surface is rasterized at 1/scale resolution and
+// upscaled on blit. The scale adapts to the previous frame's render time.
+constexpr int BED_MESH_PREVIEW_MIN_SCALE = 2;          ///< Half resolution
+constexpr int BED_MESH_PREVIEW_MAX_SCALE = 4;          ///< Quarter resolution
+constexpr double BED_MESH_PREVIEW_BUDGET_MS = 20.0;    ///< Render CPU budget per drag frame
+constexpr double BED_MESH_PREVIEW_HEADROOM_RATIO = 0.4; ///< Raise quality under 40% of budget
+
+/**
+ * @brief Pick the drag preview downscale factor from the previous frame's cost
+ *
+ * A drag starts at BED_MESH_PREVIEW_MIN_SCALE. If the previous preview frame overran
+ * BED_MESH_PREVIEW_BUDGET_MS the resolution is halved again (down to
+ * BED_MESH_PREVIEW_MAX_SCALE); once a frame uses less than BED_MESH_PREVIEW_HEADROOM_RATIO
+ * of the budget, quality steps back up. The gap between the two thresholds keeps the
+ * scale from flipping every frame, since each step changes the pixel count fourfold.
+ *
+ * @param current_scale Scale used for the previous preview frame
+ * @param preview_active Whether the previous frame was a drag preview
+ * @param last_frame_ms Render time of the previous frame
+ * @return Scale for the next preview frame
+ */
+int bed_mesh_raster_preview_scale(int current_scale, bool preview_active, double last_frame_ms);
+
+/**
+ * @brief Map a screen coordinate into a downscaled target
+ *
+ * Floor division, so coordinates left of or above the origin (clipped geometry) land on
+ * the same pixel grid as those inside it instead of being rounded toward zero.
+ *
+ * @param screen Screen coordinate
+ * @param origin Screen coordinate of the target's first column or row
+ * @param scale Downscale factor (>= 1)
+ * @return Coordinate relative to the target origin, in target pixels
+ */
+int bed_mesh_raster_scale_coord(int screen, int origin, int scale);
+
+/**
+ * @brief Fill the target with a solid color and reset the depth buffer (if any)
+ *
+ * @param target Destination buffers
+ * @param color Fill color (0x00RRGGBB)
+ */
+void bed_mesh_raster_clear(const bed_mesh_raster_target_t* target, uint32_t color);
+
+/**
+ * @brief Rasterize one triangle with per-pixel color interpolation
+ *
+ * Pass the same color on all three vertices for flat shading. When the target has a
+ * depth buffer, pixels further away than what is already there are rejected.
+ * Geometry outside the target is clipped.
+ *
+ * @param target Destination buffers
+ * @param v0, v1, v2 Triangle vertices (any winding)
+ * @param opacity Blend factor over existing pixels (255 = overwrite)
+ * @return Number of pixels written
+ */
+size_t bed_mesh_raster_triangle(const bed_mesh_raster_target_t* target,
+                                const bed_mesh_raster_vertex_t& v0,
+                                const bed_mesh_raster_vertex_t& v1,
+                                const bed_mesh_raster_vertex_t& v2, uint8_t opacity);
@@ -151,6 +151,12 @@ typedef struct {
     int layer_offset_y; // Layer's Y position on screen (from clip area)
 } bed_mesh_view_state_t;
 
+// Surface rasterization backend
+typedef enum {
+    BED_MESH_RENDER_MODE_LVGL,     // One lv_draw_rect per scanline span (legacy)
+    BED_MESH_RENDER_MODE_SOFTWARE, // Per-pixel Gouraud into a private draw buffer, one lv_draw_image
+} bed_mesh_render_mode_t;
+
 // Main renderer instance (opaque handle)
 typedef struct bed_mesh_renderer bed_mesh_renderer_t;
 
@@ -214,14 +220,49 @@ void bed_mesh_renderer_set_view_state(bed_mesh_renderer_t* renderer,
 /**
  * @brief Set dragging state (affects rendering quality)
  *
- * During drag, uses solid colors for faster rendering.
- * When static, uses gradient interpolation for higher quality.
+ * While dragging, axis labels and tick labels are skipped. The software backend rasterizes
+ * the surface at half resolution and upscales it on blit, dropping to quarter resolution
+ * if the previous frame overran its budget; the LVGL backend uses solid colors instead of
+ * gradients. The first render after dragging ends is full quality again.
  *
  * @param renderer Renderer instance
  * @param is_dragging true if user is currently dragging (fast render), false otherwise
  */
 void bed_mesh_renderer_set_dragging(bed_mesh_renderer_t* renderer, bool is_dragging);
 
+/**
+ * @brief Select the surface rasterization backend
+ *
+ * BED_MESH_RENDER_MODE_SOFTWARE (default) fills the mesh into a private draw buffer
+ * and composites it with a single lv_draw_image. BED_MESH_RENDER_MODE_LVGL issues one
+ * lv_draw_rect per scanline span. The initial mode can be overridden with the
+ * HELIX_BED_MESH_RENDERER environment variable ("software" or "lvgl").
+ *
+ * @param renderer Renderer instance
+ * @param mode Rasterization backend
+ */
+void bed_mesh_renderer_set_render_mode(bed_mesh_renderer_t* renderer, bed_mesh_render_mode_t mode);
+
+/**
+ * @brief Get the active surface rasterization backend
+ *
+ * @param renderer Renderer instance
+ * @return Current mode (BED_MESH_RENDER_MODE_LVGL if renderer is NULL)
+ */
+bed_mesh_render_mode_t bed_mesh_renderer_get_render_mode(const bed_mesh_renderer_t* renderer);
+
+/**
+ * @brief Enable per-pixel depth testing in software mode
+ *
+ * With the depth buffer enabled (default), quads are rasterized in generation order
+ * and the depth sort is skipped. Disabled, the painter's algorithm is used as in
+ * LVGL mode. Has no effect in BED_MESH_RENDER_MODE_LVGL.
+ *
+ * @param renderer Renderer instance
+ * @param enabled true to use a depth buffer instead of sorting quads
+ */
+void bed_mesh_renderer_set_depth_buffer(bed_mesh_renderer_t* renderer, bool enabled);
+
 /**
  * @brief Set Z-scale multiplier (height amplification)
  *
@@ -269,8 +310,9 @@ void bed_mesh_renderer_auto_color_range(bed_mesh_renderer_t* renderer);
  * 2. Compute projection parameters (Z-scale, FOV-scale)
  * 3. Generate 3D quads from mesh data with colors
  * 4. Project quads to 2D screen space
- * 5. Sort quads by depth (painter's algorithm)
+ * 5. Sort quads by depth (painter's algorithm, skipped when the depth buffer is used)
  * 6. Render quads (gradient or solid based on dragging state)
+ * 7. Draw grid lines and axis labels on top
  *
  * @param renderer Renderer instance
  * @param layer LVGL draw layer (from DRAW_POST event callback)
@@ -281,6 +323,43 @@ void bed_mesh_renderer_auto_color_range(bed_mesh_renderer_t* renderer);
 bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer, int canvas_width,
                               int canvas_height);
 
+/**
+ * @brief Run the geometry stages of render() without drawing
+ *
+ * Steps 2-5 of bed_mesh_renderer_render() for a canvas at the current layer offset:
+ * z-scale, projection, canvas fit (screen coordinates of every quad) and the painter's
+ * algorithm draw order. Cached work is reused exactly as render() reuses it.
+ *
+ * @param renderer Renderer instance
+ * @param canvas_width Viewport width in pixels
+ * @param canvas_height Viewport height in pixels
+ * @return true on success, false on error (NULL renderer, no mesh data, invalid size)
+ */
+bool bed_mesh_renderer_prepare(bed_mesh_renderer_t* renderer, int canvas_width,
+                               int canvas_height);
+
+/**
+ * @brief Quads with the screen coordinates of the last render() or prepare()
+ *
+ * @param renderer Renderer instance
+ * @param[out] count Number of quads
+ * @return Quads in row-major mesh cell order (valid until the next renderer call)
+ */
+const bed_mesh_quad_3d_t* bed_mesh_renderer_get_quads(const bed_mesh_renderer_t* renderer,
+                                                      size_t* count);
+
+/**
+ * @brief Painter's algorithm draw order of the last render() or prepare()
+ *
+ * Not updated by software renders that use the depth buffer.
+ *
+ * @param renderer Renderer instance
+ * @param[out] count Number of indices
+ * @return Indices into bed_mesh_renderer_get_quads(), furthest quad first
+ */
+const uint32_t* bed_mesh_renderer_get_draw_order(const bed_mesh_renderer_t* renderer,
+                                                 size_t* count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,6 +4,7 @@
 #ifndef __HELIX_CONFIG_H__
 #define __HELIX_CONFIG_H__
 
+#include "debounced_file_writer.h"
 #include "spdlog/spdlog.h"
 
 #include <string>
@@ -33,11 +34,16 @@ using json = nlohmann::json;
  * cfg->set<int>("/printers/default/port", 7125);
  * cfg->save();
  * ```
+ *
+ * save() only schedules a write: changes made in quick succession (a slider being dragged)
+ * are coalesced and written once by a background thread, atomically (temp file, fsync,
+ * rename). Call flush() before the process exits or restarts.
  */
 class Config {
   private:
     static Config* instance;
     std::string path;
+    DebouncedFileWriter writer_;
 
   protected:
     json data;
@@ -128,13 +134,29 @@ class Config {
     /**
      * @brief Save current configuration to file
      *
-     * Writes in-memory config to disk with pretty formatting.
-     * Includes error handling and validation.
+     * Snapshots the in-memory config and schedules a background write with pretty
+     * formatting once no further save() has followed for
+     * DebouncedFileWriter::DEFAULT_DELAY_MS. Write errors are reported to the user when
+     * they happen.
      *
-     * @return true if save succeeded, false on error
+     * @return true if the write was scheduled, false if no config file is set
      */
     bool save();
 
+    /**
+     * @brief Write a pending save() to disk now, on the calling thread
+     *
+     * Call before exiting or restarting the application.
+     *
+     * @return true if nothing was pending or the write succeeded
+     */
+    bool flush();
+
+    /**
+     * @brief Save requests, coalesced saves and writes so far
+     */
+    FileWriteStats get_save_stats() const;
+
     /**
      * @brief Get default printer path prefix
      *
@@ -0,0 +1,127 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief File write counters
+ */
+struct FileWriteStats {
+    uint64_t requests = 0;  ///< Calls to schedule()
+    uint64_t coalesced = 0; ///< Requests superseded by a later one before being written
+    uint64_t writes = 0;    ///< Files written successfully
+    uint64_t failures = 0;  ///< Failed writes
+};
+
+/**
+ * @brief Writes a file on a background thread, coalescing bursts of changes
+ *
+ * schedule() hands over a producer for the latest content and restarts a quiet period.
+ * Once no new request has arrived for the delay, the writer thread runs the producer and
+ * replaces the file atomically (write_atomically()), so a burst of changes (a slider being
+ * dragged) costs one write, and neither serialization nor flash I/O runs on the caller's
+ * thread. flush() writes a pending change immediately; call it before the process exits
+ * or restarts. The destructor flushes too.
+ *
+ * The producer runs on the writer thread (or in flush()), so it must own its data: capture
+ * a snapshot, not a reference to state the caller keeps modifying.
+ *
+ * Usage:
+ * @code
+ * DebouncedFileWriter writer;
+ * writer.schedule("helixconfig.json", [snapshot = data] { return snapshot.dump(2); });
+ * ...
+ * writer.flush(); // at shutdown
+ * @endcode
+ */
+class DebouncedFileWriter {
+  public:
+    using Producer = std::function<std::string()>;
+    using ErrorFn = std::function<void(const std::string& path)>;
+
+    static constexpr uint32_t DEFAULT_DELAY_MS = 1000;
+
+    /**
+     * @param delay_ms Quiet period before a scheduled write
+     */
+    explicit DebouncedFileWriter(uint32_t delay_ms = DEFAULT_DELAY_MS);
+    ~DebouncedFileWriter();
+
+    DebouncedFileWriter(const DebouncedFileWriter&) = delete;
+    DebouncedFileWriter& operator=(const DebouncedFileWriter&) = delete;
+
+    /**
+     * @brief Write @p path with the producer's output after the quiet period
+     *
+     * Replaces a pending request that has not been written yet. Starts the writer thread
+     * on first use.
+     *
+     * @param path File to replace
+     * @param producer Returns the complete file content
+     */
+    void schedule(const std::string& path, Producer producer);
+
+    /**
+     * @brief Write the pending request now, on the calling thread
+     *
+     * Waits for a write in progress on the writer thread to finish first.
+     *
+     * @return false if the pending write failed (true if nothing was pending)
+     */
+    bool flush();
+
+    /**
+     * @brief Check whether a scheduled write has not been written yet
+     */
+    bool has_pending() const;
+
+    /**
+     * @brief Called from the writing thread after a failed write
+     */
+    void set_error_callback(ErrorFn on_error);
+
+    /**
+     * @brief Current counters
+     */
+    FileWriteStats stats() const;
+
+    /**
+     * @brief Replace a file so that a crash leaves either the old or the new content
+     *
+     * Writes a temporary file next to @p path, fsyncs it, renames it over @p path and
+     * fsyncs the directory.
+     *
+     * @param path File to replace
+     * @param content Complete file content
+     * @return true on success
+     */
+    static bool write_atomically(const std::string& path, const std::string& content);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void run();
+    bool write_pending(std::unique_lock<std::mutex>& lock); // Caller holds write_mutex_
+
+    const std::chrono::milliseconds delay_;
+
+    mutable std::mutex mutex_; // Guards the fields below
+    std::condition_variable cv_;
+    std::string path_;
+    Producer pending_;
+    Clock::time_point deadline_;
+    bool stop_ = false;
+    ErrorFn on_error_;
+    FileWriteStats stats_;
+
+    std::mutex write_mutex_; // Held while taking and writing a request: one writer at a time
+    std::thread thread_;
+};
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <lvgl.h>
 #include <memory>
 #include <string>
@@ -42,6 +43,40 @@ inline const char* display_backend_type_to_string(DisplayBackendType type) {
     }
 }
 
+/**
+ * @brief Rendering options shared by the display backends
+ *
+ * Read from the "/display/..." config keys, with HELIX_* environment overrides for
+ * on-device experiments. The number of software draw threads and the NEON blend path
+ * are build-time settings (see lv_conf.h and mk/cross.mk).
+ */
+struct DisplayRenderConfig {
+    int buffer_lines = 60;                ///< Height of each partial draw buffer (fbdev)
+    bool double_buffer = true;            ///< Second partial draw buffer (fbdev)
+    bool vsync = false;                   ///< Wait for vblank before flushing a frame (fbdev)
+    uint32_t frame_stats_interval_ms = 0; ///< Log frame times this often (0 = off)
+
+    /**
+     * @brief Load from config, then apply environment overrides
+     *
+     * HELIX_RENDER_BUFFER_LINES, HELIX_DISPLAY_VSYNC (0/1) and HELIX_FRAME_STATS
+     * (interval in seconds) take precedence over the config file.
+     */
+    static DisplayRenderConfig load();
+};
+
+/**
+ * @brief Log frame render times for a display
+ *
+ * Measures each refresh (render and flush of all dirty areas) and logs the frame count,
+ * average and worst frame time, and how many frames exceeded the refresh period, once
+ * per @p interval_ms. Does nothing if @p interval_ms is 0.
+ *
+ * @param display Display to measure
+ * @param interval_ms Reporting interval
+ */
+void display_enable_frame_stats(lv_display_t* display, uint32_t interval_ms);
+
 /**
  * @brief Abstract display backend interface
  *
@@ -105,6 +140,17 @@ class DisplayBackend {
         return nullptr;
     }
 
+    /**
+     * @brief Get the device node backing the pointer input device
+     *
+     * Lets the main loop watch the device for activity instead of polling it.
+     *
+     * @return Path (e.g. "/dev/input/event0"), or empty if not file-backed (SDL)
+     */
+    virtual std::string pointer_device_path() const {
+        return {};
+    }
+
     // ========================================================================
     // Backend Information
     // ========================================================================
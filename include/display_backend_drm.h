@@ -60,6 +60,9 @@ class DisplayBackendDRM : public DisplayBackend {
 
     // Input device creation
     lv_indev_t* create_input_pointer() override;
+    std::string pointer_device_path() const override {
+        return pointer_path_;
+    }
 
     // Backend info
     DisplayBackendType type() const override {
@@ -79,6 +82,7 @@ class DisplayBackendDRM : public DisplayBackend {
     std::string drm_device_ = "/dev/dri/card0";
     lv_display_t* display_ = nullptr;
     lv_indev_t* pointer_ = nullptr;
+    std::string pointer_path_; // Device node of pointer_ (set once created)
 };
 
 #endif // HELIX_DISPLAY_DRM
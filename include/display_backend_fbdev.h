@@ -24,6 +24,8 @@
  * - Works on minimal embedded Linux systems
  * - Touch input via evdev (/dev/input/eventN)
  * - Automatic display size detection from fb0
+ * - Partial rendering into one or two cache-aligned draw buffers, optionally
+ *   flushed on vertical blank (see DisplayRenderConfig)
  *
  * Requirements:
  * - /dev/fb0 must exist and be accessible
@@ -55,6 +57,9 @@ class DisplayBackendFbdev : public DisplayBackend {
 
     // Input device creation
     lv_indev_t* create_input_pointer() override;
+    std::string pointer_device_path() const override {
+        return touch_ ? touch_path_ : std::string();
+    }
 
     // Backend info
     DisplayBackendType type() const override {
@@ -78,6 +83,18 @@ class DisplayBackendFbdev : public DisplayBackend {
     std::string touch_device_; // Empty = auto-detect
     lv_display_t* display_ = nullptr;
     lv_indev_t* touch_ = nullptr;
+    std::string touch_path_; // Device node of touch_ (resolved from touch_device_)
+
+    /**
+     * @brief Install partial draw buffers and optional vsync per DisplayRenderConfig
+     *
+     * Buffers and the vsync descriptor belong to the display and are released when it is
+     * deleted.
+     *
+     * @param render Render options
+     * @return true on success
+     */
+    bool setup_rendering(const DisplayRenderConfig& render);
 
     /**
      * @brief Auto-detect touch input device
@@ -125,6 +125,7 @@ struct RibbonGeometry {
     std::vector<uint32_t> color_palette;   ///< Unique colors in RGB format (max 256)
 
     // Layer tracking for two-pass ghost layer rendering
+    // GeometryBuilder sorts strips by layer, so each layer's strips are contiguous
     std::vector<uint16_t> strip_layer_index; ///< Layer index per strip (parallel to strips vector)
     /// Layer strip ranges: [layer_idx] -> (first_strip_idx, strip_count)
     std::vector<std::pair<size_t, size_t>> layer_strip_ranges;
@@ -232,6 +233,7 @@ class GeometryBuilder {
         size_t triangles_generated; ///< Total triangles
         size_t memory_bytes;        ///< Total memory used
         float simplification_ratio; ///< Segments removed (0.0 - 1.0)
+        size_t strips_reordered;    ///< Strips moved to make layers contiguous
 
         void log() const; ///< Log statistics via spdlog
     };
@@ -333,6 +335,9 @@ class GeometryBuilder {
     uint16_t add_to_normal_palette(RibbonGeometry& geometry, const glm::vec3& normal);
     uint8_t add_to_color_palette(RibbonGeometry& geometry, uint32_t color_rgb);
 
+    // Layer ordering: stable counting sort of strips by layer, fills layer_strip_ranges
+    void sort_strips_by_layer(RibbonGeometry& geometry, size_t layer_count);
+
     // Simplification pipeline
     std::vector<ToolpathSegment> simplify_segments(const std::vector<ToolpathSegment>& segments,
                                                    const SimplificationOptions& options);
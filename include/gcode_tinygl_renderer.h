@@ -16,6 +16,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 namespace gcode {
 
@@ -65,6 +66,23 @@ class GCodeTinyGLRenderer {
     void render(lv_layer_t* layer, const ParsedGCodeFile& gcode, const GCodeCamera& camera,
                 const lv_area_t* widget_coords);
 
+    /**
+     * @brief Render G-code into the TinyGL framebuffer without drawing it to LVGL
+     * @param gcode Parsed G-code file
+     * @param camera Camera with view/projection matrices
+     * @return false if TinyGL could not be initialized
+     *
+     * Same path as render() minus the final blit, for tests and benchmarks of the
+     * real renderer. Read the result with capture_frame().
+     */
+    bool render_offscreen(const ParsedGCodeFile& gcode, const GCodeCamera& camera);
+
+    /**
+     * @brief Copy the last rendered frame
+     * @return Raw TinyGL pixels, viewport width × height, tightly packed (empty if none)
+     */
+    std::vector<uint8_t> capture_frame() const;
+
     /**
      * @brief Set viewport size
      * @param width Viewport width in pixels
@@ -124,6 +142,26 @@ class GCodeTinyGLRenderer {
      */
     void set_debug_face_colors(bool enable);
 
+    /**
+     * @brief Select how strips are submitted to TinyGL
+     * @param enable true = retained vertex arrays, false = immediate mode (default)
+     *
+     * The vertex-array path expands positions, normals and colors to floats once
+     * per geometry and submits each run of visible strips with a single
+     * glDrawElementsBatch() call. Immediate mode re-decodes every vertex on every
+     * frame but keeps no extra copy of the geometry. Vertex arrays are off by default:
+     * on the real renderer they have not shown a frame time win worth up to
+     * kVertexArrayBudgetBytes of RAM (see the "[tinygl][.benchmark]" unit test).
+     */
+    void set_vertex_arrays_enabled(bool enable);
+
+    /**
+     * @brief Check if the vertex-array submission path is selected
+     */
+    bool is_vertex_arrays_enabled() const {
+        return use_vertex_arrays_;
+    }
+
     // ==============================================
     // Compatibility Methods (for LVGL renderer interface)
     // ==============================================
@@ -301,7 +339,7 @@ class GCodeTinyGLRenderer {
     }
 
     /**
-     * @brief Get memory usage of last rendered geometry
+     * @brief Get memory usage of last rendered geometry (including retained vertex arrays)
      * @return Memory in bytes
      */
     size_t get_memory_usage() const;
@@ -353,12 +391,21 @@ class GCodeTinyGLRenderer {
     void render_geometry(const GCodeCamera& camera);
 
     /**
-     * @brief Convert TinyGL framebuffer to LVGL image and draw to layer
+     * @brief Draw the TinyGL frame to the layer as an LVGL image
      * @param layer LVGL draw layer
      * @param widget_coords Absolute screen coordinates of the widget
+     *
+     * Zero-copy when TinyGL renders into draw_buf_; otherwise the frame is copied,
+     * or converted to RGB565 for 16-bit displays, into draw_buf_ first.
      */
     void draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widget_coords);
 
+    /**
+     * @brief (Re)create draw_buf_ unless it already has this size and format
+     * @return false if allocation failed
+     */
+    bool ensure_draw_buf(int width, int height, lv_color_format_t format);
+
     /**
      * @brief Setup lighting (two-point studio setup)
      */
@@ -378,6 +425,32 @@ class GCodeTinyGLRenderer {
      */
     void render_layer_range(int start_layer, int end_layer, float dim_factor);
 
+    /**
+     * @brief Submit strips [first, first + count) with immediate-mode calls
+     */
+    void submit_strips_immediate(size_t first, size_t count, float dim_factor);
+
+    /**
+     * @brief Submit strips [first, first + count) from the retained vertex arrays
+     */
+    void submit_strips_arrays(size_t first, size_t count);
+
+    /**
+     * @brief Expand geometry_ into float vertex arrays (no-op if already built)
+     * @return false if the arrays would exceed kVertexArrayBudgetBytes
+     */
+    bool prepare_vertex_arrays();
+
+    /**
+     * @brief Bind the retained arrays, using colors dimmed by @p dim_factor
+     */
+    void bind_vertex_arrays(float dim_factor);
+
+    /**
+     * @brief Drop the retained arrays (call whenever geometry_ is replaced)
+     */
+    void invalidate_vertex_arrays();
+
     // Configuration
     int viewport_width_{800};
     int viewport_height_{600};
@@ -408,14 +481,32 @@ class GCodeTinyGLRenderer {
 
     // TinyGL context (opaque pointer to avoid header dependency)
     void* zbuffer_{nullptr};
-    unsigned int* framebuffer_{nullptr};
+    void* framebuffer_{nullptr};          ///< TinyGL color buffer (may be draw_buf_->data)
+    bool framebuffer_is_draw_buf_{false}; ///< TinyGL renders straight into draw_buf_
 
     // Geometry
     std::unique_ptr<GeometryBuilder> geometry_builder_;
     std::optional<RibbonGeometry> geometry_;
     std::string current_gcode_filename_; // Track if we need to rebuild
 
-    // LVGL image buffer for display
+    /// Geometry pre-expanded for glDrawElementsBatch (one entry per RibbonVertex)
+    struct VertexArrays {
+        std::vector<float> positions;     ///< xyz, dequantized
+        std::vector<float> normals;       ///< xyz from normal_palette
+        std::vector<float> colors;        ///< rgb at full brightness
+        std::vector<float> dimmed_colors; ///< rgb * dimmed_factor (ghost pass)
+        float dimmed_factor{-1.0f};       ///< Factor dimmed_colors was built for
+        bool built{false};
+        bool over_budget{false}; ///< Too large; immediate mode used instead
+    };
+
+    /// Upper bound for the retained arrays (~48 bytes per vertex with ghost colors)
+    static constexpr size_t kVertexArrayBudgetBytes = 32 * 1024 * 1024;
+
+    bool use_vertex_arrays_{false};
+    VertexArrays vertex_arrays_;
+
+    // LVGL image buffer for display (persistent; TinyGL's framebuffer when formats match)
     lv_draw_buf_t* draw_buf_{nullptr};
 };
 
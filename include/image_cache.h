@@ -0,0 +1,139 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Decoded image cache budget, pre-converted assets and decode counters
+ *
+ * Three parts keep screen switches from decoding the same PNGs again:
+ *
+ * - LVGL's image cache holds decoded images up to a byte budget (least recently used
+ *   images are dropped first) and its header cache avoids re-reading image headers.
+ * - `make native-images` converts assets/images/ PNGs to LVGL binary images in the
+ *   display's color format under assets/images/native/. resolve() swaps an asset path
+ *   for its converted image when one exists, which loads without PNG decoding.
+ * - The installed image decoders are wrapped to count decodes, cache hits and time
+ *   spent decoding (stats(), logged by log_stats()).
+ *
+ * init() and resolve() are main (LVGL) thread only; the counters are updated from
+ * draw threads.
+ *
+ * Usage:
+ * @code
+ * ImageCache::instance().init(4096 * 1024);
+ * lv_image_set_src(img, ImageCache::instance().resolve("A:assets/images/folder.png").c_str());
+ * @endcode
+ */
+class ImageCache {
+  public:
+    static constexpr uint32_t DEFAULT_BUDGET_KB = 4096;
+    static constexpr uint32_t MIN_BUDGET_KB = 1024; ///< Must fit the largest image being drawn
+    static constexpr uint32_t HEADER_CACHE_COUNT = 32;
+
+    struct Stats {
+        uint64_t hits = 0;      ///< Images served from the cache
+        uint64_t decodes = 0;   ///< Images decoded (cache misses)
+        double decode_ms = 0;   ///< Total time spent decoding
+        uint32_t budget_bytes = 0;
+    };
+
+    /**
+     * @brief Get singleton instance
+     *
+     * @return Reference to the singleton instance
+     */
+    static ImageCache& instance();
+
+    /**
+     * @brief Size LVGL's image caches and start counting decodes
+     *
+     * Call after lv_init(). Can be called again to change the budget.
+     *
+     * @param budget_bytes Decoded image budget (0 = decode on every draw, otherwise at
+     *                     least MIN_BUDGET_KB)
+     */
+    void init(uint32_t budget_bytes);
+
+    /**
+     * @brief Get the pre-converted variant of an asset image if there is one
+     *
+     * "A:assets/images/printers/voron-24r2.png" becomes
+     * "A:assets/images/native/printers/voron-24r2.bin" when that file exists. Other
+     * sources are returned unchanged. Lookups are remembered.
+     *
+     * @param src LVGL image path
+     * @return Path to load
+     */
+    std::string resolve(const std::string& src);
+
+    /**
+     * @brief Forget the cached decode and header of one image file
+     *
+     * LVGL caches by source path, so call this after rewriting a file that may have been
+     * shown before (e.g. a re-downloaded thumbnail); otherwise the old image is drawn.
+     * Main (LVGL) thread only.
+     *
+     * @param src LVGL image path, as passed to lv_image_set_src()
+     */
+    void invalidate(const std::string& src);
+
+    /**
+     * @brief Forget a draw buffer used as an image source
+     *
+     * LVGL caches draw buffer sources by pointer. Call this before destroying or
+     * reallocating a buffer that was drawn with lv_draw_image()/lv_image_set_src(), so a
+     * new buffer at the same address is not drawn with the old decode or header.
+     * Main (LVGL) thread only.
+     *
+     * @param buf Draw buffer (nullptr is ignored)
+     */
+    void invalidate(const lv_draw_buf_t* buf);
+
+    /**
+     * @brief Drop every decoded image that is not being drawn
+     */
+    void drop_all();
+
+    /**
+     * @brief Current counters
+     */
+    Stats stats() const;
+
+    /**
+     * @brief Reset the counters (not the cache)
+     */
+    void reset_stats();
+
+    /**
+     * @brief Log counters and cache usage at info level
+     */
+    void log_stats() const;
+
+  private:
+    ImageCache() = default;
+    ~ImageCache() = default;
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    void install_counters();
+
+    static lv_result_t counting_open_cb(lv_image_decoder_t* decoder,
+                                        lv_image_decoder_dsc_t* dsc);
+    static void counting_close_cb(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc);
+
+    std::unordered_map<std::string, std::string> resolved_;
+    uint32_t budget_bytes_ = 0;
+    bool counters_installed_ = false;
+
+    std::atomic<uint64_t> opens_{0};
+    std::atomic<uint64_t> decodes_{0};
+    std::atomic<uint64_t> decode_us_{0};
+};
@@ -0,0 +1,125 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Main loop wakeup counters
+ *
+ * Every return from MainLoopWaker::wait() counts as one wakeup, attributed to the first
+ * source found ready (input, then signal, then timeout).
+ */
+struct MainLoopWakeStats {
+    uint64_t waits = 0;          ///< Calls to wait()
+    uint64_t timer_wakeups = 0;  ///< Slept until the timeout (next LVGL timer or app deadline)
+    uint64_t signal_wakeups = 0; ///< Woken early by wake() from another thread
+    uint64_t input_wakeups = 0;  ///< Woken early by input device activity
+    uint64_t slept_ms = 0;       ///< Total time spent sleeping
+
+    uint64_t wakeups() const {
+        return timer_wakeups + signal_wakeups + input_wakeups;
+    }
+};
+
+/**
+ * @brief Lets the main loop sleep until there is work to do
+ *
+ * The main loop sleeps in wait() until the next LVGL timer deadline instead of polling.
+ * Background threads call wake() after queueing work for the main thread (Moonraker
+ * notifications, lv_async_call), which interrupts the sleep through an eventfd (a
+ * non-blocking pipe on macOS).
+ *
+ * Input devices registered with watch_input() are watched through a second descriptor
+ * on the same device node. Their LVGL read timers are paused while the device is idle,
+ * so an untouched screen causes no wakeups, and resumed (with an immediate read) as soon
+ * as the kernel reports activity. Timers keep running while the pointer is pressed and
+ * for INPUT_IDLE_MS afterwards, so gestures, long presses and scroll throws behave as
+ * with plain polling.
+ *
+ * wait() and watch_input() must be called from the main (LVGL) thread; wake() is safe
+ * from any thread and from signal handlers.
+ */
+class MainLoopWaker {
+  public:
+    static constexpr uint32_t INPUT_IDLE_MS = 500;   ///< Keep reading input this long after use
+    static constexpr size_t MAX_WATCHED_INPUTS = 8;  ///< Input devices watched at once
+
+    /**
+     * @brief Get singleton instance
+     *
+     * @return Reference to the singleton instance
+     */
+    static MainLoopWaker& instance();
+
+    /**
+     * @brief Create the wakeup descriptor
+     *
+     * @return true on success (wait() falls back to a plain sleep otherwise)
+     */
+    bool init();
+
+    /**
+     * @brief Close all descriptors and resume any paused input read timers
+     */
+    void shutdown();
+
+    /**
+     * @brief Interrupt the current (or next) wait()
+     *
+     * Repeated calls before the main loop wakes are coalesced into one write.
+     */
+    void wake();
+
+    /**
+     * @brief Wake the main loop when an input device has activity
+     *
+     * @param indev LVGL input device reading from @p device_path
+     * @param device_path Device node (e.g. "/dev/input/event0")
+     * @return true if the device is being watched
+     */
+    bool watch_input(lv_indev_t* indev, const std::string& device_path);
+
+    /**
+     * @brief Sleep until the timeout elapses, wake() is called or input arrives
+     *
+     * @param timeout_ms Maximum sleep (LV_NO_TIMER_READY = no LVGL timer pending)
+     */
+    void wait(uint32_t timeout_ms);
+
+    /**
+     * @brief Get wakeup counters (main thread)
+     */
+    MainLoopWakeStats get_stats() const {
+        return stats_;
+    }
+
+  private:
+    MainLoopWaker() = default;
+    ~MainLoopWaker();
+    MainLoopWaker(const MainLoopWaker&) = delete;
+    MainLoopWaker& operator=(const MainLoopWaker&) = delete;
+
+    struct InputWatch {
+        int fd = -1;
+        lv_indev_t* indev = nullptr;
+        uint32_t last_activity_ms = 0;
+        bool reading = true; ///< LVGL read timer running
+    };
+
+    void set_reading(InputWatch& input, bool reading);
+    void drain_wake_fd();
+
+    int wake_read_fd_ = -1;
+    int wake_write_fd_ = -1; ///< Same as wake_read_fd_ for eventfd
+    std::atomic<bool> wake_pending_{false};
+    std::vector<InputWatch> inputs_;
+    MainLoopWakeStats stats_;
+};
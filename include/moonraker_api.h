@@ -375,6 +375,17 @@ class MoonrakerAPI {
      */
     void set_led_off(const std::string& led, SuccessCallback on_success, ErrorCallback on_error);
 
+    /**
+     * @brief Prefill TemperatureHistory from Moonraker's temperature store
+     *
+     * Imports the server.temperature_store buffers (up to 20 minutes per sensor at 1 Hz)
+     * in one request, so temperature graphs open with history instead of empty.
+     *
+     * @param on_success Success callback (after import)
+     * @param on_error Error callback
+     */
+    void load_temperature_history(SuccessCallback on_success, ErrorCallback on_error);
+
     // ========================================================================
     // System Control Operations
     // ========================================================================
@@ -26,15 +26,19 @@
 #define MOONRAKER_CLIENT_H
 
 #include "hv/WebSocketClient.h"
+#include "moonraker_discovery_snapshot.h"
 #include "moonraker_domain_service.h"
+#include "moonraker_notification_dispatch.h"
 #include "moonraker_error.h"
 #include "moonraker_events.h"
 #include "moonraker_request.h"
+#include "moonraker_request_table.h"
 #include "printer_capabilities.h"
 #include "printer_detector.h" // For BuildVolume struct
 #include "spdlog/spdlog.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <map>
 #include <mutex>
@@ -68,6 +72,17 @@ using RequestId = uint64_t;
 /** @brief Invalid request ID constant */
 constexpr RequestId INVALID_REQUEST_ID = 0;
 
+/**
+ * @brief Counters for the outgoing request queue
+ *
+ * See MoonrakerClient::configure_batching().
+ */
+struct SendQueueStats {
+    uint64_t frames_sent = 0; ///< WebSocket frames (one request each) written by flush_outgoing()
+    uint64_t flushes = 0;     ///< flush_outgoing() calls that wrote at least one frame
+    size_t largest_flush = 0; ///< Most requests written by one flush
+};
+
 /**
  * @brief Connection state for Moonraker WebSocket
  */
@@ -155,9 +170,10 @@ class MoonrakerClient : public hv::WebSocketClient {
      * (triggered by printer.objects.subscribe subscriptions).
      *
      * @param cb Callback function receiving parsed JSON notification
+     * @param name Optional name reported in get_notification_stats()
      * @return Subscription ID for later unsubscription (0 = invalid/failed)
      */
-    SubscriptionId register_notify_update(std::function<void(json)> cb);
+    SubscriptionId register_notify_update(NotificationCallback cb, const std::string& name = "");
 
     /**
      * @brief Unsubscribe from status update notifications
@@ -181,7 +197,7 @@ class MoonrakerClient : public hv::WebSocketClient {
      * @param cb Callback function receiving parsed JSON notification
      */
     void register_method_callback(const std::string& method, const std::string& handler_name,
-                                  std::function<void(json)> cb);
+                                  NotificationCallback cb);
 
     /**
      * @brief Unregister a method callback by handler name
@@ -281,10 +297,25 @@ class MoonrakerClient : public hv::WebSocketClient {
      *
      * Virtual to allow mock override for testing without real printer connection.
      *
-     * @param on_complete Callback invoked when discovery completes successfully
+     * @param on_complete Callback invoked when discovery completes successfully. After a
+     *        fast start from a snapshot it runs again if background validation finds the
+     *        printer's objects changed, so it must tolerate being called twice.
      */
     virtual void discover_printer(std::function<void()> on_complete);
 
+    /**
+     * @brief Enable persistent discovery snapshots for fast reconnects
+     *
+     * After a successful discovery, the discovered hardware, capabilities,
+     * kinematics, build volume and versions are saved keyed by host:port. The next
+     * discover_printer() for that host subscribes immediately from the snapshot and
+     * validates it against a fresh printer.objects.list in the background, re-running
+     * full discovery (and re-subscribing) only if the object list changed.
+     *
+     * @param path Snapshot cache file (empty disables fast start)
+     */
+    void set_discovery_snapshot_path(const std::string& path);
+
     /**
      * @brief Parse object list from printer.objects.list response
      *
@@ -300,9 +331,32 @@ class MoonrakerClient : public hv::WebSocketClient {
      * Extracts bed_mesh object from printer state updates (notify_status_update).
      * Updates active_bed_mesh_ with probed_matrix, bounds, and available profiles.
      *
+     * Klipper re-emits bed_mesh unchanged (initial subscription, reconnects), so the
+     * probed_matrix and profiles subtrees are hashed first and only re-parsed when
+     * their hash changes. When a different profile is loaded, the already-parsed
+     * profile from the profile cache is reused instead of parsing the matrix again.
+     * active_bed_mesh_.content_hash changes only when the matrix or bounds change,
+     * letting consumers skip re-rendering.
+     *
      * @param bed_mesh JSON object from bed_mesh subscription
+     * @return true if the active mesh, its name or the profile list changed
      */
-    void parse_bed_mesh(const json& bed_mesh);
+    bool parse_bed_mesh(const json& bed_mesh);
+
+    /**
+     * @brief Counters for bed mesh change detection
+     */
+    struct BedMeshParseStats {
+        uint64_t updates = 0;          ///< parse_bed_mesh() calls
+        uint64_t matrix_parsed = 0;    ///< probed_matrix parsed from JSON
+        uint64_t matrix_reused = 0;    ///< probed_matrix taken from the parsed profile cache
+        uint64_t matrix_unchanged = 0; ///< probed_matrix skipped (hash unchanged)
+        uint64_t profiles_parsed = 0;  ///< Profile set re-parsed (hash changed)
+    };
+
+    BedMeshParseStats get_bed_mesh_stats() const {
+        return bed_mesh_stats_;
+    }
 
     /**
      * @brief Get discovered heaters (extruders, beds, generic heaters)
@@ -632,6 +686,75 @@ class MoonrakerClient : public hv::WebSocketClient {
         check_request_timeouts();
     }
 
+    /**
+     * @brief Configure outgoing request coalescing
+     *
+     * When window_ms > 0, requests issued while connected are queued instead of
+     * written immediately. The queue is flushed, one WebSocket frame per request so
+     * each gets its own reply, once the window elapses, max_batch_size is reached,
+     * or a received message has finished dispatching. printer.emergency_stop and
+     * printer.gcode.script are never queued: they flush the queue and go out at once.
+     * Per-request callbacks and timeouts are unchanged. 0 disables coalescing.
+     *
+     * @param window_ms Coalescing window in milliseconds
+     * @param max_batch_size Flush as soon as this many requests are queued
+     */
+    void configure_batching(uint32_t window_ms, size_t max_batch_size = 32);
+
+    /**
+     * @brief Write queued requests
+     *
+     * Call periodically from the main loop. Without @p force the queue is only
+     * flushed once the coalescing window has elapsed.
+     *
+     * @param force Flush regardless of the window
+     */
+    void flush_outgoing(bool force = false);
+
+    /**
+     * @brief Get the time until flush_outgoing() would write the queued requests
+     *
+     * Lets an event-driven main loop sleep until the coalescing window elapses.
+     * Thread-safe.
+     *
+     * @return Milliseconds until the flush is due (0 = due now), UINT32_MAX if nothing is queued
+     */
+    uint32_t ms_until_flush() const;
+
+    /**
+     * @brief Get outgoing queue counters
+     *
+     * Thread-safe.
+     */
+    SendQueueStats get_send_stats() const;
+
+    /**
+     * @brief Get round-trip latency histograms keyed by JSON-RPC method
+     *
+     * Latency is measured from send_jsonrpc() to response dispatch, so it includes
+     * any time spent in the coalescing queue. Thread-safe.
+     */
+    std::map<std::string, RpcLatencyHistogram> get_method_latency() const;
+
+    /**
+     * @brief Get per-method notification counts and per-handler execution time
+     *
+     * Useful for spotting subscribers that stall the WebSocket thread. Thread-safe.
+     */
+    std::vector<NotificationMethodStats> get_notification_stats() const {
+        return notification_dispatcher_.stats();
+    }
+
+    /**
+     * @brief Get pending-request counters
+     *
+     * Reports outstanding requests, peak outstanding, completions, cancellations
+     * and timeouts. Useful for tuning moonraker_timeout_check_interval_ms.
+     *
+     * Thread-safe.
+     */
+    RequestTableStats get_request_stats() const;
+
   protected:
     /**
      * @brief Transition to new connection state
@@ -675,6 +798,25 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     void cleanup_pending_requests();
 
+    /**
+     * @brief Write a JSON-RPC request now, or queue it when coalescing is enabled
+     *
+     * @param rpc Complete JSON-RPC request object
+     * @param tracked_id Pending request ID to fail if the write fails (0 = untracked)
+     * @return send() result, or 0 if queued
+     */
+    int send_or_queue(json rpc, RequestId tracked_id = INVALID_REQUEST_ID);
+
+    /**
+     * @brief Remove a pending request whose write failed and invoke its error callback
+     */
+    void fail_pending_request(RequestId id);
+
+    /**
+     * @brief Drop queued-but-unsent requests (called on disconnect)
+     */
+    void discard_outgoing();
+
     /**
      * @brief Complete discovery by subscribing to printer objects
      *
@@ -685,6 +827,51 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     void complete_discovery_subscription(std::function<void()> on_complete);
 
+    /**
+     * @brief Full discovery: objects.list -> server.info -> printer.info -> MCUs -> subscribe
+     */
+    void run_full_discovery(std::function<void()> on_complete);
+
+    /**
+     * @brief Restore discovery from the snapshot cache and subscribe immediately
+     *
+     * @return true if a snapshot was found and used, false to fall back to full discovery
+     */
+    bool start_from_snapshot(std::function<void()> on_complete);
+
+    /**
+     * @brief Compare a fresh printer.objects.list against the snapshot (background)
+     *
+     * On a mismatch, runs full discovery and invokes @p on_complete again (after
+     * on_discovery_complete_) so callers of discover_printer() see the new hardware.
+     *
+     * @param on_complete The discover_printer() completion that the fast start already ran
+     */
+    void validate_snapshot(const std::string& key, std::vector<std::string> cached_objects,
+                           std::function<void()> on_complete);
+
+    /**
+     * @brief Refresh Klipper/Moonraker versions after a fast start
+     */
+    void refresh_versions();
+
+    /**
+     * @brief Persist current discovery state if it differs from the stored snapshot
+     *
+     * @return true if a new snapshot was written
+     */
+    bool save_discovery_snapshot();
+
+    /**
+     * @brief Snapshot cache key for the current connection URL
+     */
+    std::string snapshot_key() const;
+
+    /**
+     * @brief Log time-to-first-live-temperature once per discovery
+     */
+    void log_first_live_temperature(const json& status);
+
   protected:
     // Auto-discovered printer objects (protected to allow mock access)
     std::vector<std::string> heaters_;         // Controllable heaters (extruders, bed, etc.)
@@ -709,20 +896,30 @@ class MoonrakerClient : public hv::WebSocketClient {
     BedMeshProfile active_bed_mesh_;             // Currently active mesh profile
     std::vector<std::string> bed_mesh_profiles_; // Available profile names
 
-    // Notification callbacks (protected to allow mock to trigger notifications)
-    // Map of subscription ID -> callback for O(1) unsubscription
-    std::map<SubscriptionId, std::function<void(json)>> notify_callbacks_;
+    // Notification dispatch table (protected to allow mock to trigger notifications)
+    // Status subscribers and method-specific callbacks, published copy-on-write
+    NotificationDispatcher notification_dispatcher_;
     std::atomic<SubscriptionId> next_subscription_id_{1}; // Start at 1 (0 = invalid)
-    std::mutex callbacks_mutex_; // Protect notify_callbacks_ and method_callbacks_
 
   private:
-    // Pending requests keyed by request ID
-    std::map<uint64_t, PendingRequest> pending_requests_;
-    std::mutex requests_mutex_; // Protect pending_requests_ map
-
-    // Persistent method-specific callbacks
-    // method_name : { handler_name : callback }
-    std::map<std::string, std::map<std::string, std::function<void(json)>>> method_callbacks_;
+    // Pending requests keyed by request ID, with deadline timing wheel
+    PendingRequestTable pending_requests_;
+    mutable std::mutex requests_mutex_; // Protect pending_requests_ table
+
+    // Round-trip latency per method (protected by requests_mutex_)
+    std::map<std::string, RpcLatencyHistogram> method_latency_;
+
+    // Outgoing request coalescing
+    struct OutgoingRequest {
+        json rpc;
+        RequestId tracked_id;
+    };
+    std::vector<OutgoingRequest> outgoing_queue_;
+    std::chrono::steady_clock::time_point outgoing_first_queued_;
+    SendQueueStats send_stats_;
+    mutable std::mutex send_queue_mutex_; // Protect outgoing queue and stats
+    std::atomic<uint32_t> batch_window_ms_{0};
+    size_t max_batch_size_ = 32;
 
     // Auto-incrementing JSON-RPC request ID
     std::atomic_uint64_t request_id_;
@@ -754,6 +951,21 @@ class MoonrakerClient : public hv::WebSocketClient {
     std::function<void()> last_discovery_complete_; // Callback from last discover_printer()
     mutable std::mutex reconnect_mutex_;            // Protect stored connection info
 
+    // Bed mesh change detection
+    size_t bed_mesh_matrix_hash_ = 0;   // Hash of last parsed probed_matrix JSON
+    size_t bed_mesh_profiles_hash_ = 0; // Hash of last parsed profiles JSON
+    std::map<std::string, BedMeshProfile> bed_mesh_profile_cache_; // Parsed stored profiles
+    std::map<std::string, size_t> bed_mesh_profile_points_hash_;   // profile -> points hash
+    BedMeshParseStats bed_mesh_stats_;
+
+    // Discovery snapshot cache and fast-start timing
+    DiscoverySnapshotStore snapshot_store_;
+    json last_snapshot_json_; // Last loaded/saved snapshot (minus saved_at) to skip rewrites
+    std::atomic_bool discovery_from_snapshot_{false};
+    std::atomic_bool first_temperature_pending_{false};
+    std::chrono::steady_clock::time_point connect_started_at_;
+    std::chrono::steady_clock::time_point discovery_started_at_;
+
     // Event handler for transport events (decouples from UI layer)
     MoonrakerEventCallback event_handler_;
     mutable std::mutex event_handler_mutex_;
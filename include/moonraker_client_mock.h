@@ -385,13 +385,14 @@ class MoonrakerClientMock : public MoonrakerClient {
     void temperature_simulation_loop();
 
     /**
-     * @brief Dispatch historical temperature data at startup
+     * @brief Generate the mock server.temperature_store at startup
      *
-     * Generates 2-3 minutes of synthetic temperature readings and dispatches
-     * them rapidly to observers. This populates the temperature graph with
-     * realistic-looking data immediately upon connection.
+     * Builds 2.5 minutes of synthetic 1 Hz temperature readings in Moonraker's
+     * temperature store format. Clients import it in one request (see
+     * MoonrakerAPI::load_temperature_history), so graphs open with realistic
+     * history without replaying samples through the notification path.
      */
-    void dispatch_historical_temperatures();
+    void generate_temperature_store();
 
     /**
      * @brief Dispatch initial printer state to observers
@@ -531,6 +532,7 @@ class MoonrakerClientMock : public MoonrakerClient {
     std::atomic<double> extruder_target_{0.0}; // Target temperature (0 = off)
     std::atomic<double> bed_temp_{25.0};       // Current temperature
     std::atomic<double> bed_target_{0.0};      // Target temperature (0 = off)
+    json temperature_store_; // server.temperature_store result (generated at connect)
 
     // Position simulation state
     std::atomic<double> pos_x_{0.0};
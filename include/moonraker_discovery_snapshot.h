@@ -0,0 +1,102 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "printer_detector.h" // For BuildVolume struct
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hv/json.hpp"
+
+using json = nlohmann::json;
+
+/**
+ * @brief Result of a completed printer discovery, persisted for fast reconnects
+ *
+ * Heaters, sensors, fans, LEDs, steppers and capabilities are all derived from
+ * printer_objects by MoonrakerClient::parse_objects(), so only the raw object
+ * list is stored for them.
+ */
+struct DiscoverySnapshot {
+    std::vector<std::string> printer_objects; ///< Raw printer.objects.list result
+    std::string hostname;                     ///< From printer.info
+    std::string software_version;             ///< Klipper version from printer.info
+    std::string moonraker_version;            ///< From server.info
+    std::string kinematics;                   ///< From toolhead status
+    std::string mcu;                          ///< Primary MCU chip
+    std::vector<std::string> mcu_list;        ///< All MCU chips
+    BuildVolume build_volume;                 ///< From bed_mesh bounds
+    int64_t saved_at = 0;                     ///< Unix time the snapshot was written
+
+    json to_json() const;
+
+    /**
+     * @brief Parse a snapshot previously written by to_json()
+     *
+     * @return Snapshot, or std::nullopt if required fields are missing/invalid
+     */
+    static std::optional<DiscoverySnapshot> from_json(const json& j);
+};
+
+/**
+ * @brief On-disk store of discovery snapshots keyed by Moonraker host
+ *
+ * Snapshots live in a single small JSON file ({ "host:port": {...}, ... }).
+ * Writes go to a temp file that is renamed over the original, so a power
+ * loss never leaves a truncated cache behind. A corrupt or missing file is
+ * treated as an empty cache.
+ */
+class DiscoverySnapshotStore {
+  public:
+    /**
+     * @param path Cache file path (empty disables persistence)
+     */
+    explicit DiscoverySnapshotStore(std::string path = "") : path_(std::move(path)) {}
+
+    bool enabled() const {
+        return !path_.empty();
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+    /**
+     * @brief Load the snapshot stored for a host
+     *
+     * @param key Host key (see host_key())
+     */
+    std::optional<DiscoverySnapshot> load(const std::string& key) const;
+
+    /**
+     * @brief Store (replace) the snapshot for a host
+     *
+     * @return true if the cache file was written
+     */
+    bool store(const std::string& key, const DiscoverySnapshot& snapshot) const;
+
+    /**
+     * @brief Remove the snapshot for a host
+     *
+     * @return true if an entry was removed
+     */
+    bool remove(const std::string& key) const;
+
+    /**
+     * @brief Derive the cache key from a WebSocket URL
+     *
+     * "ws://192.168.1.10:7125/websocket" -> "192.168.1.10:7125"
+     */
+    static std::string host_key(const std::string& url);
+
+  private:
+    json read_all() const;
+    bool write_all(const json& all) const;
+
+    std::string path_;
+};
@@ -4,6 +4,7 @@
 #ifndef MOONRAKER_DOMAIN_SERVICE_H
 #define MOONRAKER_DOMAIN_SERVICE_H
 
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -23,8 +24,9 @@ struct BedMeshProfile {
     int x_count;                                   ///< Probes per row
     int y_count;                                   ///< Number of rows
     std::string algo;                              ///< Interpolation algorithm
+    uint64_t content_hash;                         ///< Hash of matrix + bounds (0 = unknown)
 
-    BedMeshProfile() : mesh_min{0, 0}, mesh_max{0, 0}, x_count(0), y_count(0) {}
+    BedMeshProfile() : mesh_min{0, 0}, mesh_max{0, 0}, x_count(0), y_count(0), content_hash(0) {}
 };
 
 /**
@@ -0,0 +1,212 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hv/json.hpp"
+
+using json = nlohmann::json;
+
+/**
+ * @brief Callback for Moonraker notifications (receives the parsed message by reference)
+ */
+using NotificationCallback = std::function<void(const json&)>;
+
+/**
+ * @brief Interned notification method identifier
+ *
+ * Built-in methods have fixed IDs so the client can branch on them without
+ * string compares; other methods are interned when a handler is registered.
+ */
+using NotificationMethodId = uint16_t;
+
+/**
+ * @brief Execution counters for one registered handler
+ */
+struct NotificationHandlerStats {
+    std::string name;        ///< Handler name ("subscriber#<id>" for unnamed status subscribers)
+    uint64_t calls = 0;      ///< Number of invocations
+    uint64_t total_us = 0;   ///< Total time spent inside the handler
+    uint32_t max_us = 0;     ///< Slowest single invocation
+    uint64_t exceptions = 0; ///< Invocations that threw
+};
+
+/**
+ * @brief Per-method notification counters
+ */
+struct NotificationMethodStats {
+    std::string method;
+    uint64_t received = 0;   ///< Notifications dispatched for this method
+    uint64_t handler_us = 0; ///< Total handler time across all handlers
+    /// Handlers bound to this method; status subscribers are listed under
+    /// notify_status_update only (their counters include filelist notifications)
+    std::vector<NotificationHandlerStats> handlers;
+};
+
+/**
+ * @brief Pre-bound dispatch table for Moonraker notifications
+ *
+ * Method names are interned to small integer IDs, and the handler lists for
+ * every method live in an immutable table that is republished copy-on-write
+ * whenever a handler is added or removed. Dispatch loads the current table via
+ * an atomic shared_ptr snapshot and walks its handler vectors directly: no
+ * registration mutex, no copying of std::function objects and no allocation
+ * per notification. Handlers receive the parsed message by const reference.
+ *
+ * Status subscribers (register_notify_update) are kept in a separate list that
+ * is fanned out for notify_status_update and notify_filelist_changed, matching
+ * the previous MoonrakerClient behavior.
+ *
+ * Handler time and call counts are accumulated in relaxed atomics shared by all
+ * table generations, so slow subscribers show up in stats() without affecting
+ * the dispatch path. Registration is thread-safe; dispatch may run concurrently
+ * with registration and observes either the old or the new table.
+ */
+class NotificationDispatcher {
+  public:
+    /// Built-in method IDs (interned by the constructor)
+    enum BuiltinMethod : NotificationMethodId {
+        STATUS_UPDATE = 0,
+        FILELIST_CHANGED,
+        KLIPPY_READY,
+        KLIPPY_DISCONNECTED,
+        KLIPPY_SHUTDOWN,
+        GCODE_RESPONSE,
+        BUILTIN_METHOD_COUNT
+    };
+
+    static constexpr NotificationMethodId UNKNOWN_METHOD = 0xFFFF;
+
+    NotificationDispatcher();
+
+    /**
+     * @brief Resolve a method name to its ID without locking
+     *
+     * @return Method ID, or UNKNOWN_METHOD if nothing was ever registered for it
+     */
+    NotificationMethodId lookup(const std::string& method) const;
+
+    /**
+     * @brief Add a status subscriber (notify_status_update / notify_filelist_changed)
+     *
+     * @param id Subscription ID chosen by the caller
+     * @param name Optional name used in stats (defaults to "subscriber#<id>")
+     */
+    void add_status_handler(uint64_t id, NotificationCallback cb, const std::string& name = "");
+
+    /**
+     * @brief Remove a status subscriber
+     *
+     * @return true if the subscriber was found
+     */
+    bool remove_status_handler(uint64_t id);
+
+    /**
+     * @brief Add a named handler for a specific method
+     *
+     * @return false if a handler with the same name already exists (the existing one is kept)
+     */
+    bool add_method_handler(const std::string& method, const std::string& name,
+                            NotificationCallback cb);
+
+    /**
+     * @brief Remove a named handler for a specific method
+     *
+     * @return true if the handler was found
+     */
+    bool remove_method_handler(const std::string& method, const std::string& name);
+
+    /**
+     * @brief Dispatch a notification to every handler bound to @p method_id
+     *
+     * Exceptions thrown by handlers are logged and swallowed.
+     *
+     * @param method_id ID from lookup() (UNKNOWN_METHOD is counted and ignored)
+     * @param message Full JSON-RPC notification
+     * @return Number of handlers invoked
+     */
+    size_t dispatch(NotificationMethodId method_id, const json& message);
+
+    /**
+     * @brief Dispatch to status subscribers only (synthesized status updates)
+     *
+     * @return Number of handlers invoked
+     */
+    size_t dispatch_status(const json& message);
+
+    /**
+     * @brief Number of registered status subscribers
+     */
+    size_t status_handler_count() const;
+
+    /**
+     * @brief Remove every handler (counters of removed handlers are discarded)
+     */
+    void clear();
+
+    /**
+     * @brief Snapshot of per-method counters and handler timings
+     *
+     * Only methods that received notifications or have handlers are reported.
+     */
+    std::vector<NotificationMethodStats> stats() const;
+
+    /**
+     * @brief Notifications whose method had no ID (nothing ever registered for it)
+     */
+    uint64_t unknown_count() const {
+        return unknown_received_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct HandlerCounters {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> total_us{0};
+        std::atomic<uint32_t> max_us{0};
+        std::atomic<uint64_t> exceptions{0};
+    };
+
+    struct Handler {
+        uint64_t id = 0; ///< Subscription ID (status subscribers only)
+        std::string name;
+        NotificationCallback cb;
+        std::shared_ptr<HandlerCounters> counters;
+    };
+
+    struct MethodCounters {
+        std::atomic<uint64_t> received{0};
+    };
+
+    struct MethodEntry {
+        std::string name;
+        bool fan_out_status = false; ///< Also invoke status subscribers
+        std::vector<Handler> handlers;
+        std::shared_ptr<MethodCounters> counters;
+    };
+
+    /// Immutable once published
+    struct Table {
+        std::unordered_map<std::string, NotificationMethodId> ids;
+        std::vector<MethodEntry> methods; ///< Indexed by NotificationMethodId
+        std::vector<Handler> status_handlers;
+    };
+
+    std::shared_ptr<const Table> load() const;
+    void publish(std::shared_ptr<const Table> table);
+    NotificationMethodId intern(Table& table, const std::string& method);
+    size_t invoke(const std::vector<Handler>& handlers, const json& message,
+                  const std::string& method);
+
+    std::shared_ptr<const Table> table_; ///< Accessed only via std::atomic_load/atomic_store
+    std::mutex write_mutex_;             ///< Serializes copy-on-write updates
+    std::atomic<uint64_t> unknown_received_{0};
+};
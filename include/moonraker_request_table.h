@@ -0,0 +1,203 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "moonraker_request.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Counters describing pending-request traffic
+ *
+ * Exposed via MoonrakerClient::get_request_stats() so that
+ * moonraker_timeout_check_interval_ms can be tuned against real workloads.
+ */
+struct RequestTableStats {
+    size_t outstanding = 0;      ///< Requests currently awaiting a response
+    size_t peak_outstanding = 0; ///< High-water mark of outstanding requests
+    uint64_t registered = 0;     ///< Total requests inserted
+    uint64_t completed = 0;      ///< Requests removed because a response arrived
+    uint64_t cancelled = 0;      ///< Requests removed via cancel()
+    uint64_t timed_out = 0;      ///< Requests expired by the timing wheel
+    uint64_t send_failed = 0;    ///< Requests removed because the write failed
+    uint64_t timeout_scans = 0;  ///< Calls to collect_expired()
+    uint64_t stale_skipped = 0;  ///< Wheel entries skipped because the request already finished
+};
+
+/**
+ * @brief Round-trip latency histogram for one JSON-RPC method
+ *
+ * Power-of-two millisecond buckets: bucket 0 is [0,1)ms, bucket i is
+ * [2^(i-1), 2^i)ms, and the last bucket collects everything slower.
+ */
+struct RpcLatencyHistogram {
+    static constexpr size_t BUCKET_COUNT = 16;
+
+    std::array<uint64_t, BUCKET_COUNT> buckets{};
+    uint64_t count = 0;
+    uint64_t total_ms = 0;
+    uint32_t max_ms = 0;
+
+    void record(uint32_t elapsed_ms);
+
+    double mean_ms() const {
+        return count > 0 ? static_cast<double>(total_ms) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Approximate percentile (upper bound of the bucket containing it)
+     *
+     * @param fraction Percentile in [0,1], e.g. 0.95
+     */
+    uint32_t percentile_ms(double fraction) const;
+};
+
+/**
+ * @brief Pending JSON-RPC request table with an O(expired) timeout wheel
+ *
+ * Requests live in a flat open-addressed table keyed on request ID (linear
+ * probing, backward-shift deletion). Moonraker request IDs are sequential, so
+ * `id & mask` spreads them with almost no collisions and lookups are O(1)
+ * without per-request node allocations.
+ *
+ * Deadlines are tracked in a three-level hierarchical timing wheel (64 slots
+ * per level). collect_expired() only advances the wheel to the current tick,
+ * so its cost is proportional to the number of requests that actually expire
+ * rather than the number outstanding. Completed or cancelled requests are
+ * removed lazily: their wheel entry is dropped when its slot fires.
+ *
+ * Not thread-safe - callers serialize access (MoonrakerClient uses requests_mutex_).
+ */
+class PendingRequestTable {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t DEFAULT_TICK_MS = 50;
+
+    /**
+     * @brief Construct an empty table
+     *
+     * @param tick_ms Timing wheel resolution (expiry is exact; this only bounds slot width)
+     * @param initial_capacity Expected number of outstanding requests
+     */
+    explicit PendingRequestTable(uint32_t tick_ms = DEFAULT_TICK_MS, size_t initial_capacity = 32);
+
+    /**
+     * @brief Register a request and schedule its deadline
+     *
+     * @return false if a request with the same ID is already pending
+     */
+    bool insert(PendingRequest request);
+
+    /**
+     * @brief Check whether a request is pending
+     */
+    bool contains(uint64_t id) const;
+
+    /**
+     * @brief Look up a pending request without removing it
+     *
+     * @return Pointer into the table (invalidated by the next mutation), or nullptr
+     */
+    const PendingRequest* find(uint64_t id) const;
+
+    /**
+     * @brief Remove a request because its response arrived
+     *
+     * @return The removed request, or std::nullopt if not pending
+     */
+    std::optional<PendingRequest> take(uint64_t id);
+
+    /**
+     * @brief Remove a request because its write failed
+     *
+     * @return The removed request, or std::nullopt if not pending
+     */
+    std::optional<PendingRequest> take_failed(uint64_t id);
+
+    /**
+     * @brief Remove a request without counting it as completed
+     *
+     * @return true if the request was pending
+     */
+    bool cancel(uint64_t id);
+
+    /**
+     * @brief Advance the wheel to @p now and remove every request that timed out
+     *
+     * Uses the same rule as PendingRequest::is_timed_out() (elapsed > timeout_ms).
+     *
+     * @param now Current time (injectable for tests)
+     * @return Expired requests, in deadline order per wheel slot
+     */
+    std::vector<PendingRequest> collect_expired(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Remove and return every pending request (used on disconnect)
+     */
+    std::vector<PendingRequest> take_all();
+
+    size_t size() const {
+        return count_;
+    }
+
+    bool empty() const {
+        return count_ == 0;
+    }
+
+    /**
+     * @brief Snapshot of the traffic counters
+     */
+    RequestTableStats stats() const {
+        RequestTableStats s = stats_;
+        s.outstanding = count_;
+        return s;
+    }
+
+  private:
+    struct Slot {
+        bool used = false;
+        uint64_t id = 0;
+        PendingRequest request;
+    };
+
+    struct WheelEntry {
+        uint64_t id;
+        uint64_t deadline_tick;
+    };
+
+    static constexpr unsigned WHEEL_BITS = 6;
+    static constexpr size_t WHEEL_SIZE = size_t{1} << WHEEL_BITS;
+    static constexpr size_t WHEEL_MASK = WHEEL_SIZE - 1;
+    static constexpr unsigned WHEEL_LEVELS = 3;
+    static constexpr uint64_t WHEEL_SPAN = uint64_t{1} << (WHEEL_BITS * WHEEL_LEVELS);
+
+    size_t find_index(uint64_t id) const;
+    PendingRequest erase_at(size_t index);
+    void grow();
+
+    uint64_t to_tick(Clock::time_point t) const;
+    uint64_t deadline_tick(const PendingRequest& request) const;
+    void schedule(const WheelEntry& entry);
+    void cascade(unsigned level);
+    void clear_wheel();
+
+    // Flat request table (capacity is always a power of two)
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    size_t count_ = 0;
+
+    // Hierarchical timing wheel: wheel_[level][slot]
+    std::array<std::array<std::vector<WheelEntry>, WHEEL_SIZE>, WHEEL_LEVELS> wheel_;
+    uint64_t current_tick_ = 0;
+    Clock::time_point origin_;
+    uint32_t tick_ms_;
+
+    RequestTableStats stats_;
+};
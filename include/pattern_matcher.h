@@ -0,0 +1,83 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Finds many substrings at once, ignoring ASCII case (Aho-Corasick)
+ *
+ * Patterns are added once and compiled by build(); find_all() then reports every pattern
+ * occurring in a text in a single pass over it, however many patterns there are. Used by
+ * PrinterDetector to test all database patterns against each hardware name together.
+ *
+ * Usage:
+ * @code
+ * PatternMatcher matcher;
+ * size_t qgl = matcher.add("quad_gantry_level");
+ * matcher.build();
+ * std::vector<bool> found;
+ * matcher.find_all("QUAD_GANTRY_LEVEL", found); // found[qgl] == true
+ * @endcode
+ */
+class PatternMatcher {
+  public:
+    /**
+     * @brief Add a pattern (before build())
+     *
+     * @return Pattern ID; patterns equal ignoring case share one ID
+     */
+    size_t add(std::string_view pattern);
+
+    /**
+     * @brief Compile the added patterns; call once before find_all()
+     */
+    void build();
+
+    /**
+     * @brief Number of distinct patterns (IDs are 0..size()-1)
+     */
+    size_t size() const {
+        return patterns_.size();
+    }
+
+    /**
+     * @brief Lower-cased pattern text for an ID
+     */
+    const std::string& pattern(size_t id) const {
+        return patterns_[id];
+    }
+
+    /**
+     * @brief Mark every pattern that occurs in @p text
+     *
+     * Sets found[id] for each match and leaves other entries alone, so calling it for
+     * several texts with the same vector collects the patterns found in any of them. The
+     * empty pattern occurs in every text.
+     *
+     * @param text Text to search (any case)
+     * @param found Resized to size() if smaller
+     */
+    void find_all(std::string_view text, std::vector<bool>& found) const;
+
+  private:
+    static constexpr int32_t NONE = -1;
+
+    struct Node {
+        std::vector<std::pair<char, int32_t>> next; ///< Children, sorted by character
+        int32_t fail = 0;                           ///< Longest proper suffix in the trie
+        int32_t output = NONE;                      ///< Pattern ending here
+        int32_t dictionary = NONE; ///< Nearest node on the fail chain with an output
+    };
+
+    int32_t child(int32_t node, char c) const;
+
+    std::vector<std::string> patterns_;
+    std::vector<Node> nodes_{Node{}};
+    int32_t empty_pattern_ = NONE;
+};
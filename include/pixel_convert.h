@@ -0,0 +1,39 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file pixel_convert.h
+ * @brief Framebuffer pixel format conversion for software renderers
+ *
+ * TinyGL's 32-bit framebuffer stores each pixel as a 0x00RRGGBB word, which is
+ * byte-for-byte LVGL's XRGB8888 layout, so it can be handed to LVGL without
+ * conversion. When the display runs at 16 bits per pixel a single conversion to
+ * RGB565 is unavoidable; these routines do it with NEON or SSE2 when available.
+ *
+ * All variants truncate each channel (same as lv_color_to_u16()) and produce
+ * bit-identical output.
+ */
+
+/**
+ * @brief Convert XRGB8888 pixels to RGB565 using the fastest available implementation
+ *
+ * @param src Source pixels (0x00RRGGBB, alpha byte ignored)
+ * @param dst Destination pixels (RRRRRGGGGGGBBBBB)
+ * @param count Number of pixels
+ */
+void pixel_convert_xrgb8888_to_rgb565(const uint32_t* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief Reference scalar implementation (used for tails and by tests)
+ */
+void pixel_convert_xrgb8888_to_rgb565_scalar(const uint32_t* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief Name of the implementation selected at compile time ("NEON", "SSE2" or "scalar")
+ */
+const char* pixel_convert_implementation();
@@ -85,7 +85,9 @@ struct PrinterHardwareData {
  * own data structures (e.g., UI dropdowns, config values).
  *
  * Detection heuristics are defined in config/printer_database.json, allowing
- * new printer types to be added without recompilation.
+ * new printer types to be added without recompilation. The database is compiled
+ * once, on first use, into a rule table shared by detection, image lookup and the
+ * roller; all rule patterns are matched against each hardware name in one pass.
  *
  * **Contract**: Returned type_name strings should match printer names in
  * PrinterTypes::PRINTER_TYPES_ROLLER for UI integration, but the detector
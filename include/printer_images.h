@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "image_cache.h"
 #include "printer_detector.h"
 
 #include <filesystem>
@@ -114,13 +115,14 @@ inline std::string get_image_path(int printer_type_index) {
  * It handles all lookup and validation logic internally.
  *
  * @param printer_type_index Index from printer type roller
- * @return Full LVGL path to printer image (guaranteed to exist or be default)
+ * @return Full LVGL path to printer image (guaranteed to exist or be default), the
+ *         pre-converted variant if there is one (ImageCache::resolve())
  *
  * @note Returns a std::string that manages its own memory. The caller
  *       must keep the string alive while using the path.
  */
 inline std::string get_validated_image_path(int printer_type_index) {
-    return get_image_path(printer_type_index);
+    return ImageCache::instance().resolve(get_image_path(printer_type_index));
 }
 
 } // namespace PrinterImages
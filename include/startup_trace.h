@@ -0,0 +1,124 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Per-phase startup timing, logged once the first frame is on screen
+ *
+ * main() brackets each startup phase with begin(); finish_on_first_frame() opens a last
+ * phase that ends when the display completes its first rendered refresh, then logs one
+ * summary line:
+ *
+ *     [Startup] fonts_images 14 ms, xml_parse 212 ms, ..., first_flush 38 ms (total 402 ms,
+ *     first_pixel at 61 ms)
+ *
+ * The total is the time to an interactive UI; mark() adds milestones such as the
+ * splash's first frame.
+ *
+ * Main (LVGL) thread only.
+ */
+class StartupTrace {
+  public:
+    struct Phase {
+        std::string name;
+        double ms = 0;
+    };
+
+    /**
+     * @brief Get singleton instance
+     *
+     * @return Reference to the singleton instance
+     */
+    static StartupTrace& instance();
+
+    /**
+     * @brief Start timing a phase, ending the previous one
+     *
+     * @param name Phase name (e.g. "xml_parse")
+     */
+    void begin(const std::string& name);
+
+    /**
+     * @brief End the current phase
+     */
+    void end();
+
+    /**
+     * @brief Record a point in time since reset() (e.g. "first_pixel")
+     *
+     * @param name Milestone name
+     */
+    void mark(const std::string& name);
+
+    /**
+     * @brief Time the first frame, then log the summary
+     *
+     * Opens a "first_flush" phase that ends after the next refresh of @p display that
+     * renders something.
+     *
+     * @param display Display showing the UI
+     */
+    void finish_on_first_frame(lv_display_t* display);
+
+    /**
+     * @brief Completed phases in order
+     */
+    const std::vector<Phase>& phases() const {
+        return phases_;
+    }
+
+    /**
+     * @brief Milestones in order
+     */
+    const std::vector<Phase>& milestones() const {
+        return milestones_;
+    }
+
+    /**
+     * @brief Time from reset() (or first use) to the end of the last phase
+     */
+    double total_ms() const;
+
+    /**
+     * @brief One-line summary of all phases and the total
+     */
+    std::string summary() const;
+
+    /**
+     * @brief true once the summary has been logged
+     */
+    bool is_finished() const {
+        return finished_;
+    }
+
+    /**
+     * @brief Forget all phases and restart the clock
+     */
+    void reset();
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    StartupTrace();
+    StartupTrace(const StartupTrace&) = delete;
+    StartupTrace& operator=(const StartupTrace&) = delete;
+
+    static void display_event_cb(lv_event_t* e);
+
+    Clock::time_point origin_;
+    Clock::time_point phase_start_;
+    Clock::time_point last_end_;
+    std::string open_phase_; ///< Empty when no phase is running
+    std::vector<Phase> phases_;
+    std::vector<Phase> milestones_; ///< ms = time since origin_
+    bool waiting_for_frame_ = false;
+    bool frame_rendering_ = false; ///< First frame refresh has dirty areas
+    bool finished_ = false;
+};
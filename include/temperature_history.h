@@ -0,0 +1,167 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "hv/json.hpp" // libhv's nlohmann json (via cpputil/)
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+/**
+ * @brief One stored temperature reading (16 bytes)
+ *
+ * Temperatures use the same centidegree (×10) scale as the PrinterState subjects.
+ */
+struct TemperatureSample {
+    int64_t timestamp_ms; ///< Wall-clock time (ms since epoch)
+    int16_t temp_centi;   ///< Measured temperature ×10
+    int16_t target_centi; ///< Target temperature ×10 (0 = off or not a heater)
+};
+
+/**
+ * @brief Min/max summary of the samples falling in one time bucket
+ *
+ * Charts draw each bucket as two points (in the order they occurred) so short spikes
+ * survive decimation instead of being averaged away.
+ */
+struct TemperatureBucket {
+    int16_t min_centi; ///< Lowest temperature in the bucket
+    int16_t max_centi; ///< Highest temperature in the bucket
+    bool min_first;    ///< true if the minimum occurred before the maximum
+    bool valid;        ///< false if no samples fell in the bucket
+};
+
+/**
+ * @brief Central per-sensor temperature history
+ *
+ * Fixed-capacity ring buffer per sensor, fed from the status pipeline (PrinterState) and
+ * prefilled in bulk from Moonraker's server.temperature_store. Temperature graphs are
+ * views over this store, so history survives panels being recreated and is never
+ * duplicated per chart.
+ *
+ * Live updates arrive several times per second; readings within the same
+ * SAMPLE_INTERVAL_MS slot are coalesced into one sample (latest wins), matching the
+ * 1 Hz resolution of Moonraker's own store.
+ *
+ * Thread-safe: status updates and the bulk import may run on the WebSocket thread.
+ */
+class TemperatureHistory {
+  public:
+    static constexpr size_t CAPACITY = 1200;            ///< Samples per sensor (20 min @ 1 Hz)
+    static constexpr size_t MAX_SENSORS = 16;           ///< Sensors tracked at once
+    static constexpr int64_t SAMPLE_INTERVAL_MS = 1000; ///< Coalescing interval
+
+    /**
+     * @brief Get singleton instance
+     *
+     * @return Reference to the singleton instance
+     */
+    static TemperatureHistory& instance();
+
+    /**
+     * @brief Record a live temperature reading
+     *
+     * @param sensor Klipper object name (e.g. "extruder", "heater_bed")
+     * @param timestamp_ms Wall-clock time of the reading
+     * @param temp_centi Temperature ×10
+     */
+    void record(const std::string& sensor, int64_t timestamp_ms, int temp_centi);
+
+    /**
+     * @brief Update the target stamped onto subsequent samples of a sensor
+     *
+     * @param sensor Klipper object name
+     * @param target_centi Target temperature ×10
+     */
+    void set_target(const std::string& sensor, int target_centi);
+
+    /**
+     * @brief Import the result of Moonraker's server.temperature_store
+     *
+     * The store holds one sample per second per sensor, the last one being current.
+     * Imported samples replace older history; live samples already recorded after the
+     * newest imported one are kept.
+     *
+     * @param result The "result" object ({"<sensor>": {"temperatures": [...], ...}})
+     * @param now_ms Wall-clock time of the newest sample in the store
+     * @return Number of samples imported
+     */
+    size_t import_temperature_store(const json& result, int64_t now_ms);
+
+    /**
+     * @brief Summarize a time window into evenly sized min/max buckets
+     *
+     * @param sensor Klipper object name
+     * @param start_ms Window start (inclusive)
+     * @param end_ms Window end (exclusive)
+     * @param out Bucket array to fill
+     * @param bucket_count Number of buckets in @p out
+     * @return Number of buckets that received samples
+     */
+    size_t decimate(const std::string& sensor, int64_t start_ms, int64_t end_ms,
+                    TemperatureBucket* out, size_t bucket_count) const;
+
+    /**
+     * @brief Get a copy of a sensor's samples, oldest first
+     *
+     * @param sensor Klipper object name
+     * @return Samples (empty if the sensor is unknown)
+     */
+    std::vector<TemperatureSample> get_samples(const std::string& sensor) const;
+
+    /**
+     * @brief Get the number of stored samples for a sensor
+     */
+    size_t sample_count(const std::string& sensor) const;
+
+    /**
+     * @brief Get the timestamps of a sensor's oldest and newest samples
+     *
+     * @return false if the sensor has no samples
+     */
+    bool get_time_range(const std::string& sensor, int64_t* oldest_ms, int64_t* newest_ms) const;
+
+    /**
+     * @brief Get a counter that changes whenever a sensor's history changes
+     *
+     * Views compare this against the revision they last drew to skip redundant work.
+     */
+    uint64_t revision(const std::string& sensor) const;
+
+    /**
+     * @brief Remove all history (sensor registrations are dropped too)
+     */
+    void clear();
+
+  private:
+    TemperatureHistory() = default;
+    ~TemperatureHistory() = default;
+    TemperatureHistory(const TemperatureHistory&) = delete;
+    TemperatureHistory& operator=(const TemperatureHistory&) = delete;
+
+    struct Series {
+        std::string name;
+        std::vector<TemperatureSample> samples; ///< Ring storage, CAPACITY once full
+        size_t head = 0;                        ///< Index of the oldest sample when full
+        int16_t target_centi = 0;
+        uint64_t revision = 0;
+
+        const TemperatureSample& at(size_t i) const; ///< i-th sample, oldest first
+        TemperatureSample& newest();
+        void push(const TemperatureSample& sample);
+    };
+
+    Series* find_series(const std::string& sensor);
+    const Series* find_series(const std::string& sensor) const;
+    Series* get_or_create_series(const std::string& sensor);
+
+    mutable std::mutex mutex_;
+    std::vector<Series> series_;
+    uint64_t revision_counter_ = 0; ///< Global so revisions never repeat after clear()
+};
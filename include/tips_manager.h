@@ -9,6 +9,9 @@
 #include <mutex>
 #include <random>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "hv/json.hpp"
@@ -38,24 +41,71 @@ struct PrintingTip {
  * from a JSON database. Supports filtering by category, tags, difficulty,
  * priority, and full-text search. Also provides random tip selection for
  * "tip of the day" features.
+ *
+ * All lookups are served from indexes built once at init(). The index-based
+ * queries (get_tip(), get_tip_indices_by_*(), search_tip_indices(),
+ * get_random_unique_tip_index()) return references or indices into the cache
+ * and allocate nothing; the PrintingTip-returning variants copy their results.
+ * References and indices stay valid until the next init().
  */
 class TipsManager {
+  public:
+    /// Returned by index queries when no tip is available
+    static constexpr size_t NO_TIP = static_cast<size_t>(-1);
+
   private:
+    /**
+     * @brief Tip indices grouped by a case-insensitive term
+     *
+     * Terms are stored lower-cased and sorted, so lookups need no temporary strings.
+     * Each term's tip indices are ascending (cache order).
+     */
+    class TermIndex {
+      public:
+        using Entry = std::pair<std::string, std::vector<size_t>>;
+
+        void add(std::string_view term, size_t tip_index);
+        void clear() {
+            entries_.clear();
+        }
+        const std::vector<size_t>& find(std::string_view term) const;
+        const std::vector<Entry>& entries() const {
+            return entries_;
+        }
+
+      private:
+        std::vector<Entry> entries_;
+    };
+
     static TipsManager* instance;
     std::string path;
     json data;
     std::vector<PrintingTip> tips_cache;
-    std::vector<std::string> viewed_tip_ids_; // Session tracking for unique tips
+    std::vector<size_t> unviewed_tips_; // Session tracking for unique tips (not yet shown)
     std::mutex tips_mutex;
     std::mt19937 random_generator;
 
+    TermIndex category_index_;
+    TermIndex tag_index_;
+    TermIndex difficulty_index_;
+    TermIndex priority_index_;
+    TermIndex keyword_index_; // Words of title, content and tags
+    std::unordered_map<std::string, size_t> id_index_;
+
     /**
      * @brief Parse JSON and build tips cache
      *
-     * Converts JSON structure to vector of PrintingTip structs for fast access.
+     * Converts JSON structure to vector of PrintingTip structs and builds the
+     * category, tag, difficulty, priority, keyword and ID indexes over it.
      */
     void build_tips_cache();
 
+    void reset_unviewed_locked();
+    size_t random_index_locked(const std::vector<size_t>& indices);
+    size_t random_unique_index_locked();
+    void search_locked(std::string_view keyword, std::vector<size_t>& results) const;
+    std::vector<PrintingTip> copy_tips_locked(const std::vector<size_t>& indices) const;
+
     /**
      * @brief Convert JSON tip object to PrintingTip struct
      */
@@ -109,6 +159,24 @@ class TipsManager {
      */
     PrintingTip get_random_unique_tip();
 
+    /**
+     * @brief Index of a random unique tip (session-aware, no repeats)
+     *
+     * Same selection as get_random_unique_tip() without copying the tip; pass the
+     * result to get_tip().
+     *
+     * @return Tip index, or NO_TIP if database is empty
+     */
+    size_t get_random_unique_tip_index();
+
+    /**
+     * @brief Get a tip by cache index
+     *
+     * @param index Index from one of the index queries
+     * @return Pointer to the cached tip (valid until next init()), or nullptr if out of range
+     */
+    const PrintingTip* get_tip(size_t index);
+
     /**
      * @brief Reset viewed tips list
      *
@@ -126,10 +194,22 @@ class TipsManager {
      */
     std::vector<PrintingTip> search_by_keyword(const std::string& keyword);
 
+    /**
+     * @brief Search tips by keyword without copying them
+     *
+     * Same matches as search_by_keyword(), answered from the keyword index. Reuse
+     * @p results across calls to avoid allocating.
+     *
+     * @param keyword Keyword to search for
+     * @param results Filled with matching tip indices in database order
+     * @return Number of matches
+     */
+    size_t search_tip_indices(const std::string& keyword, std::vector<size_t>& results);
+
     /**
      * @brief Get all tips in a category
      *
-     * @param category Category name
+     * @param category Category name (case-insensitive)
      * @return Vector of tips in category (empty if category not found)
      */
     std::vector<PrintingTip> get_tips_by_category(const std::string& category);
@@ -158,6 +238,34 @@ class TipsManager {
      */
     std::vector<PrintingTip> get_tips_by_priority(const std::string& priority);
 
+    /**
+     * @brief Indices of tips in a category (case-insensitive)
+     *
+     * @return Tip indices in database order (empty if none); valid until next init()
+     */
+    const std::vector<size_t>& get_tip_indices_by_category(const std::string& category);
+
+    /**
+     * @brief Indices of tips with a tag (case-insensitive)
+     *
+     * @return Tip indices in database order (empty if none); valid until next init()
+     */
+    const std::vector<size_t>& get_tip_indices_by_tag(const std::string& tag);
+
+    /**
+     * @brief Indices of tips with a difficulty level (case-insensitive)
+     *
+     * @return Tip indices in database order (empty if none); valid until next init()
+     */
+    const std::vector<size_t>& get_tip_indices_by_difficulty(const std::string& difficulty);
+
+    /**
+     * @brief Indices of tips with a priority level (case-insensitive)
+     *
+     * @return Tip indices in database order (empty if none); valid until next init()
+     */
+    const std::vector<size_t>& get_tip_indices_by_priority(const std::string& priority);
+
     /**
      * @brief Get a specific tip by ID
      *
@@ -12,6 +12,7 @@
 #define UI_ASYNC_CALLBACK_H
 
 #include "lvgl/lvgl.h"
+#include "main_loop_waker.h"
 
 #include <functional>
 #include <memory>
@@ -65,6 +66,9 @@ void ui_async_call_safe(std::unique_ptr<T> data, std::function<void(T*)> callbac
             // pkg and pkg->data automatically deleted when unique_ptrs go out of scope
         },
         package);
+
+    // Callers are usually background threads: don't leave the job until the next LVGL timer
+    MainLoopWaker::instance().wake();
 }
 
 #endif // UI_ASYNC_CALLBACK_H
@@ -28,12 +28,13 @@ typedef enum {
  * including display colors, temperature ranges, presets, and keypad ranges.
  */
 typedef struct {
-    heater_type_t type;   ///< Heater type (nozzle or bed)
-    const char* name;     ///< Short name (e.g., "nozzle", "bed")
-    const char* title;    ///< Display title (e.g., "Nozzle Temperature")
-    lv_color_t color;     ///< Theme color for this heater
-    float temp_range_max; ///< Maximum temperature for graph Y-axis
-    int y_axis_increment; ///< Y-axis label increment (e.g., 50°C, 100°C)
+    heater_type_t type;      ///< Heater type (nozzle or bed)
+    const char* name;        ///< Short name (e.g., "nozzle", "bed")
+    const char* object_name; ///< Klipper object for temperature history ("extruder", ...)
+    const char* title;       ///< Display title (e.g., "Nozzle Temperature")
+    lv_color_t color;        ///< Theme color for this heater
+    float temp_range_max;    ///< Maximum temperature for graph Y-axis
+    int y_axis_increment;    ///< Y-axis label increment (e.g., 50°C, 100°C)
 
     struct {
         int off;  ///< "Off" preset (0°C)
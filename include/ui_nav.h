@@ -28,7 +28,7 @@
 /**
  * @brief Navigation panel identifiers
  *
- * Order matches app_layout.xml panel children for index-based access.
+ * Index into the panel array passed to ui_nav_set_panels().
  */
 typedef enum {
     UI_PANEL_HOME,         ///< Panel 0: Home
@@ -89,6 +89,32 @@ ui_panel_id_t ui_nav_get_active();
  */
 void ui_nav_set_panels(lv_obj_t** panels);
 
+/**
+ * @brief Callback that creates a main panel on first navigation
+ *
+ * @param panel_id Panel being navigated to
+ * @return Panel widget (hidden), or NULL if it could not be created
+ */
+typedef lv_obj_t* (*ui_nav_panel_factory_t)(ui_panel_id_t panel_id);
+
+/**
+ * @brief Set the factory used for panels registered as NULL
+ *
+ * ui_nav_set_active() and the navbar buttons call the factory the first time
+ * a panel without a widget is activated, then manage it like any other panel.
+ *
+ * @param factory Panel factory, or NULL to disable lazy creation
+ */
+void ui_nav_set_panel_factory(ui_nav_panel_factory_t factory);
+
+/**
+ * @brief Check whether a panel is shown or on the navigation stack
+ *
+ * @param panel Panel or overlay widget
+ * @return true if the panel is on the stack (visible or beneath an overlay)
+ */
+bool ui_nav_is_in_stack(lv_obj_t* panel);
+
 /**
  * @brief Set app_layout widget reference
  *
@@ -5,16 +5,20 @@
 
 #include "ui_toast.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
+#include <limits>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 /**
  * @brief Single notification history entry
  */
 struct NotificationHistoryEntry {
-    uint64_t timestamp_ms;  ///< LVGL tick time when notification occurred
+    uint64_t timestamp_ms;  ///< Wall-clock time (ms since epoch), see NotificationHistory::now_ms()
     ToastSeverity severity; ///< INFO, SUCCESS, WARNING, ERROR
     char title[64];         ///< Title (empty for toasts)
     char message[256];      ///< Notification message
@@ -22,15 +26,53 @@ struct NotificationHistoryEntry {
     bool was_read;          ///< true if user viewed in history panel
 };
 
+/**
+ * @brief Selects a page of history entries (newest first)
+ *
+ * Default-constructed, it matches every entry.
+ */
+struct NotificationQuery {
+    int severity = -1;        ///< ToastSeverity value, or -1 for all
+    bool unread_only = false; ///< Skip entries the user has seen
+    uint64_t since_ms = 0;    ///< Oldest timestamp to include
+    uint64_t until_ms = std::numeric_limits<uint64_t>::max(); ///< Newest timestamp to include
+    size_t offset = 0;                                        ///< Matching entries to skip
+    size_t limit = std::numeric_limits<size_t>::max();        ///< Most entries to return
+};
+
+/**
+ * @brief Persistence counters
+ */
+struct NotificationLogStats {
+    uint64_t records = 0;     ///< Records appended to the log
+    uint64_t batches = 0;     ///< Appends (each writes one or more records)
+    uint64_t compactions = 0; ///< Log rewrites down to the current entries
+    uint64_t failures = 0;    ///< Failed appends or rewrites
+};
+
 /**
  * @brief Notification history manager
  *
  * Maintains a circular buffer of the last N notifications for user review.
  * Thread-safe for concurrent access from UI and background threads.
+ *
+ * Unread counts are kept up to date as entries are added, so the status bar badge does not
+ * scan the buffer. query() walks the buffer in place and stops after the requested page,
+ * so showing the first page costs the same however many entries there are.
+ *
+ * With open_log(), every change is also appended to a log file (one compact JSON record
+ * per line). Records are batched and written by a background thread; once the log holds
+ * more than COMPACT_RECORDS records it is rewritten atomically with just the current
+ * entries. close_log() writes what is still pending.
  */
 class NotificationHistory {
   public:
     static constexpr size_t MAX_ENTRIES = 100; ///< Circular buffer size
+    static constexpr size_t COMPACT_RECORDS = 2 * MAX_ENTRIES; ///< Log size that triggers a rewrite
+    static constexpr uint32_t DEFAULT_BATCH_MS = 500;          ///< Wait for more records
+
+    /// Called with each matching entry; the reference is only valid during the call
+    using Visitor = std::function<void(const NotificationHistoryEntry&)>;
 
     /**
      * @brief Get singleton instance
@@ -39,6 +81,16 @@ class NotificationHistory {
      */
     static NotificationHistory& instance();
 
+    /**
+     * @brief Current wall-clock time for NotificationHistoryEntry::timestamp_ms
+     *
+     * Entries outlive the process through the log, so they are not stamped with LVGL ticks
+     * (which restart at zero).
+     *
+     * @return Milliseconds since the Unix epoch
+     */
+    static uint64_t now_ms();
+
     /**
      * @brief Add notification to history
      *
@@ -61,6 +113,24 @@ class NotificationHistory {
      */
     std::vector<NotificationHistoryEntry> get_filtered(int severity) const;
 
+    /**
+     * @brief Visit the entries matching a query, newest first, without copying them
+     *
+     * The history is locked while the visitor runs, so the visitor must be quick and must
+     * not call back into it: copy out what is needed and do the real work (such as creating
+     * widgets) after the call.
+     *
+     * @param query Filter and page to visit
+     * @param visitor Called once per matching entry in the page
+     * @return Number of entries visited
+     */
+    size_t query(const NotificationQuery& query, const Visitor& visitor) const;
+
+    /**
+     * @brief Count entries matching a query's filters (offset and limit are ignored)
+     */
+    size_t count_matching(const NotificationQuery& query) const;
+
     /**
      * @brief Get count of unread notifications
      *
@@ -93,29 +163,61 @@ class NotificationHistory {
     size_t count() const;
 
     /**
-     * @brief Save history to disk (optional)
+     * @brief Load the history from a log file and append later changes to it
+     *
+     * Replaces the in-memory history with the log's content (a missing file is an empty
+     * history) and starts the writer thread. Unreadable records, such as a torn last line
+     * from a crash or a field of the wrong type, are skipped.
      *
-     * @param path File path to save to
-     * @return true on success, false on failure
+     * @param path Log file, created on first write
+     * @param batch_ms How long the writer waits for more records before appending
+     * @return false if the file exists but could not be read
      */
-    bool save_to_disk(const char* path) const;
+    bool open_log(const std::string& path, uint32_t batch_ms = DEFAULT_BATCH_MS);
 
     /**
-     * @brief Load history from disk (optional)
-     *
-     * @param path File path to load from
-     * @return true on success, false on failure
+     * @brief Write pending records, stop the writer thread and stop logging changes
+     */
+    void close_log();
+
+    /**
+     * @brief Persistence counters since open_log()
      */
-    bool load_from_disk(const char* path);
+    NotificationLogStats log_stats() const;
 
   private:
+    static constexpr size_t SEVERITY_COUNT = 4;
+
     NotificationHistory() = default;
-    ~NotificationHistory() = default;
+    ~NotificationHistory();
     NotificationHistory(const NotificationHistory&) = delete;
     NotificationHistory& operator=(const NotificationHistory&) = delete;
 
+    // Caller holds mutex_
+    void add_locked(const NotificationHistoryEntry& entry);
+    void clear_locked();
+    const NotificationHistoryEntry& newest_locked(size_t age) const;
+    void append_record_locked(std::string record);
+
+    void run_writer(std::string path);
+    bool append_to_log(const std::string& path, const std::vector<std::string>& records);
+
+    static std::string entry_record(const NotificationHistoryEntry& entry);
+    static bool matches(const NotificationHistoryEntry& entry, const NotificationQuery& query);
+
     mutable std::mutex mutex_;
     std::vector<NotificationHistoryEntry> entries_;
     size_t head_index_ = 0;    ///< Circular buffer write position
     bool buffer_full_ = false; ///< True when we've wrapped around
+    size_t unread_by_severity_[SEVERITY_COUNT] = {}; ///< Unread entries per ToastSeverity
+
+    // Log state, guarded by mutex_
+    std::string log_path_;                ///< Empty when not logging
+    std::vector<std::string> pending_;    ///< Records not yet written
+    size_t log_records_ = 0;              ///< Records in the file, including pending
+    uint32_t batch_ms_ = DEFAULT_BATCH_MS;
+    bool writer_stop_ = false;
+    NotificationLogStats log_stats_;
+    std::condition_variable writer_cv_;
+    std::thread writer_;
 };
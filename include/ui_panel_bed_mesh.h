@@ -64,6 +64,9 @@ class BedMeshPanel : public PanelBase {
     lv_obj_t* canvas_ = nullptr;
     lv_obj_t* profile_dropdown_ = nullptr;
 
+    uint64_t rendered_mesh_hash_ = 0; ///< BedMeshProfile::content_hash last uploaded to renderer
+    bool mesh_subscribed_ = false;    ///< Outlives the widgets (overlay may be recreated)
+
     void setup_profile_dropdown();
     void setup_moonraker_subscription();
     void on_mesh_update_internal(const BedMeshProfile& mesh);
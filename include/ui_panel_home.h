@@ -99,7 +99,7 @@ class HomePanel : public PanelBase {
 
     bool light_on_ = false;
     network_type_t current_network_ = NETWORK_WIFI;
-    PrintingTip current_tip_;
+    const PrintingTip* current_tip_ = nullptr; // Owned by TipsManager's cache
     std::string configured_led_;
     lv_timer_t* tip_rotation_timer_ = nullptr;
     lv_timer_t* signal_poll_timer_ = nullptr;   // Polls WiFi signal strength every 5s
@@ -8,6 +8,8 @@
 
 #include <lvgl.h>
 
+#include <vector>
+
 /**
  * @file ui_panel_notification_history.h
  * @brief Notification history overlay panel
@@ -80,11 +82,14 @@ class NotificationHistoryPanel : public PanelBase {
     // === Public API ===
     //
 
+    /// Entries created per page; more are added as the list is scrolled to the end
+    static constexpr size_t PAGE_SIZE = 20;
+
     /**
      * @brief Refresh the notification list
      *
      * Called when panel is shown, filter changes, or after clear.
-     * Rebuilds the list from NotificationHistory service.
+     * Rebuilds the list from NotificationHistory service, first page only.
      */
     void refresh();
 
@@ -118,6 +123,12 @@ class NotificationHistoryPanel : public PanelBase {
     /// Current severity filter (-1 = all)
     int current_filter_ = -1;
 
+    /// List items created so far (a multiple of PAGE_SIZE until the history runs out)
+    size_t shown_count_ = 0;
+
+    /// Entries of the page being added, copied out so widgets are built unlocked (reused)
+    std::vector<NotificationHistoryEntry> page_entries_;
+
     //
     // === Subjects ===
     //
@@ -139,11 +150,19 @@ class NotificationHistoryPanel : public PanelBase {
      */
     static std::string format_timestamp(uint64_t timestamp_ms);
 
+    /**
+     * @brief Append the next page of entries to the list
+     *
+     * @return Number of items added
+     */
+    size_t append_page(lv_obj_t* content);
+
     //
     // === Button Handlers ===
     //
 
     void handle_clear_clicked();
+    void handle_scroll_end();
     void handle_filter_all();
     void handle_filter_errors();
     void handle_filter_warnings();
@@ -154,6 +173,7 @@ class NotificationHistoryPanel : public PanelBase {
     //
 
     static void on_clear_clicked(lv_event_t* e);
+    static void on_scroll_end(lv_event_t* e);
     static void on_filter_all_clicked(lv_event_t* e);
     static void on_filter_errors_clicked(lv_event_t* e);
     static void on_filter_warnings_clicked(lv_event_t* e);
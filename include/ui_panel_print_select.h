@@ -15,6 +15,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
@@ -79,6 +81,7 @@ enum class FileSource {
  */
 struct PrintFileData {
     std::string filename;
+    std::string path; ///< Full path on the drive (USB files only; filenames can repeat)
     std::string thumbnail_path;
     size_t file_size_bytes;    ///< File size in bytes
     time_t modified_timestamp; ///< Last modified timestamp
@@ -300,6 +303,11 @@ class PrintSelectPanel : public PanelBase {
     /**
      * @brief Set UsbManager for USB file access
      *
+     * USB files are listed from the manager's catalog; the view fills in as it progresses.
+     * Replacing the manager (or passing nullptr) clears the previous catalog's progress
+     * callback; the destructor does the same, so the manager must outlive the panel or be
+     * detached before it is destroyed.
+     *
      * @param manager Pointer to UsbManager (may be nullptr)
      */
     void set_usb_manager(UsbManager* manager);
@@ -334,6 +342,7 @@ class PrintSelectPanel : public PanelBase {
         "A:assets/images/thumbnail-placeholder.png";
     static constexpr const char* FOLDER_ICON = "A:assets/images/folder.png";
     static constexpr const char* FOLDER_UP_ICON = "A:assets/images/folder-up.png";
+    static constexpr size_t USB_PRIORITY_FILES = 12; ///< About a screenful of cards
 
     //
     // === Widget References ===
@@ -377,6 +386,10 @@ class PrintSelectPanel : public PanelBase {
 
     lv_subject_t detail_view_visible_subject_;
 
+    /// USB catalog progress ("Reading USB 12/40"), empty when complete
+    lv_subject_t usb_status_subject_;
+    char usb_status_buffer_[64];
+
     /// View mode subject: 0 = CARD, 1 = LIST (XML bindings control visibility)
     lv_subject_t view_mode_subject_;
 
@@ -403,6 +416,9 @@ class PrintSelectPanel : public PanelBase {
     std::vector<UsbGcodeFile> usb_files_;             ///< USB G-code files (when USB source active)
     class UsbManager* usb_manager_ = nullptr;         ///< USB manager (injected or global)
 
+    /// Modified time and size of the file each shown USB thumbnail was made from
+    std::unordered_map<std::string, std::pair<int64_t, uint64_t>> usb_thumb_sources_;
+
     /// Command sequencer for pre-print operations (created lazily when print starts)
     std::unique_ptr<gcode::CommandSequencer> pre_print_sequencer_;
 
@@ -568,11 +584,32 @@ class PrintSelectPanel : public PanelBase {
     /**
      * @brief Refresh USB file list
      *
-     * Scans USB drives for G-code files and populates the view.
-     * Shows empty state if no USB drive detected.
+     * Lists the first drive's files from the USB catalog (without reading the drive) and
+     * asks it to fill in the first screenful next. Shows empty state if no USB drive detected.
      */
     void refresh_usb_files();
 
+    /**
+     * @brief Apply a USB catalog progress report (main thread)
+     *
+     * Refreshes the list when the drive's files changed, otherwise fills in the metadata
+     * and thumbnails read since the last report.
+     */
+    void on_usb_catalog_progress(const UsbCatalogProgress& progress);
+
+    /**
+     * @brief Copy a catalog entry's metadata and thumbnail into the display data
+     *
+     * Invalidates the cached thumbnail image when the catalog has rewritten it for a
+     * changed file.
+     */
+    void apply_usb_entry(PrintFileData& file_data, const UsbCatalogEntry& entry);
+
+    /**
+     * @brief Update the "Reading USB" status text
+     */
+    void update_usb_status(const UsbCatalogProgress& progress);
+
     /**
      * @brief Populate card view with USB files
      */
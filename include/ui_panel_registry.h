@@ -0,0 +1,156 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Creates panels and overlays from XML on first use
+ *
+ * Panels are registered at startup with the XML component to instantiate and a setup
+ * callback, but no widgets are created until get() is first called for them (typically
+ * when the user navigates there). Registered panels can also be queued for pre-warming:
+ * they are then created one per idle tick once the user has stopped touching the screen,
+ * so the first navigation is instant without slowing down startup.
+ *
+ * Overlays registered with an evict callback may be deleted again while hidden and off
+ * the navigation stack, least recently used first, when the system runs low on memory.
+ * The evict callback must drop every pointer the owner holds into the overlay's widget
+ * tree; the next get() recreates it and runs setup again.
+ *
+ * Main (LVGL) thread only.
+ *
+ * Usage:
+ * @code
+ * auto& registry = PanelRegistry::instance();
+ * registry.add("bed_mesh_panel", screen,
+ *              [screen](lv_obj_t* obj) { get_global_bed_mesh_panel().setup(obj, screen); },
+ *              [] {}); // BedMeshPanel clears its widget pointers on LV_EVENT_DELETE
+ * ui_nav_push_overlay(registry.get("bed_mesh_panel"));
+ * @endcode
+ */
+class PanelRegistry {
+  public:
+    using SetupFn = std::function<void(lv_obj_t* obj)>;
+    using EvictFn = std::function<void()>;
+
+    static constexpr uint32_t PREWARM_IDLE_MS = 1000;   ///< Input idle time before pre-warming
+    static constexpr uint32_t PREWARM_PERIOD_MS = 250;  ///< At most one panel per period
+    static constexpr uint32_t MEMORY_CHECK_MS = 10000;  ///< Memory pressure poll interval
+
+    /**
+     * @brief Get singleton instance
+     *
+     * @return Reference to the singleton instance
+     */
+    static PanelRegistry& instance();
+
+    /**
+     * @brief Register a lazily created panel
+     *
+     * Re-registering a component replaces its callbacks; an existing widget is kept.
+     *
+     * @param component XML component name (also the object name if the XML sets none)
+     * @param parent Parent for lv_xml_create()
+     * @param setup Called once after each creation (before the panel is first shown)
+     * @param on_evict Drops owner references before deletion; empty = never evicted
+     */
+    void add(const std::string& component, lv_obj_t* parent, SetupFn setup,
+             EvictFn on_evict = nullptr);
+
+    /**
+     * @brief Get a panel, creating it on first use
+     *
+     * Newly created panels are hidden; the caller shows them (ui_nav_push_overlay()).
+     *
+     * @param component Registered component name
+     * @return Panel widget, or nullptr if unregistered or creation failed
+     */
+    lv_obj_t* get(const std::string& component);
+
+    /**
+     * @brief Get a panel only if it already exists
+     */
+    lv_obj_t* find(const std::string& component) const;
+
+    /**
+     * @brief Queue panels for creation while the UI is idle
+     *
+     * Starts the pre-warm timer if needed. Already created panels are skipped.
+     *
+     * @param components Registered component names, most likely first
+     */
+    void prewarm(const std::vector<std::string>& components);
+
+    /**
+     * @brief Create the next queued panel now
+     *
+     * @return true if a panel was created
+     */
+    bool prewarm_next();
+
+    /**
+     * @brief Delete evictable overlays that are hidden and off the navigation stack
+     *
+     * @param max_count Maximum number of overlays to delete (least recently used first)
+     * @return Number of overlays deleted
+     */
+    size_t evict(size_t max_count = SIZE_MAX);
+
+    /**
+     * @brief Evict overlays whenever available memory drops below a threshold
+     *
+     * Also drops decoded images (ImageCache::drop_all()). Polls MemAvailable from
+     * /proc/meminfo every MEMORY_CHECK_MS. No effect on systems without it.
+     *
+     * @param min_available_kb Threshold in KiB (0 = stop watching)
+     */
+    void set_memory_pressure_threshold(size_t min_available_kb);
+
+    /**
+     * @brief Number of panels currently created
+     */
+    size_t created_count() const;
+
+    /**
+     * @brief Delete all created panels and forget all registrations (tests)
+     */
+    void clear();
+
+  private:
+    PanelRegistry() = default;
+    ~PanelRegistry() = default;
+    PanelRegistry(const PanelRegistry&) = delete;
+    PanelRegistry& operator=(const PanelRegistry&) = delete;
+
+    struct Entry {
+        std::string component;
+        lv_obj_t* parent = nullptr;
+        SetupFn setup;
+        EvictFn on_evict;
+        lv_obj_t* obj = nullptr;
+        uint32_t last_used_ms = 0;
+    };
+
+    Entry* lookup(const std::string& component);
+    const Entry* lookup(const std::string& component) const;
+    bool create(Entry& entry);
+
+    static void prewarm_timer_cb(lv_timer_t* timer);
+    static void memory_timer_cb(lv_timer_t* timer);
+
+    std::vector<std::unique_ptr<Entry>> entries_; // Stable addresses: setup may call add()
+    std::deque<std::string> prewarm_queue_;
+    lv_timer_t* prewarm_timer_ = nullptr;
+    lv_timer_t* memory_timer_ = nullptr;
+    size_t min_available_kb_ = 0;
+};
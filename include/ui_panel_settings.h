@@ -105,10 +105,7 @@ class SettingsPanel : public PanelBase {
     lv_obj_t* klipper_value_ = nullptr;
     lv_obj_t* moonraker_value_ = nullptr;
 
-    // Lazily-created overlay panels
-    lv_obj_t* display_settings_overlay_ = nullptr;
-    lv_obj_t* network_settings_overlay_ = nullptr;
-    lv_obj_t* bed_mesh_panel_ = nullptr;
+    // Lazily-created overlay panels (display, network and bed mesh: see register_overlays())
     lv_obj_t* zoffset_cal_panel_ = nullptr;
     lv_obj_t* pid_cal_panel_ = nullptr;
     lv_obj_t* factory_reset_dialog_ = nullptr;
@@ -122,6 +119,9 @@ class SettingsPanel : public PanelBase {
     void setup_dropdown();
     void setup_scroll_sliders();
     void setup_action_handlers();
+    void register_overlays();
+    void setup_display_settings_overlay(lv_obj_t* overlay);
+    void setup_network_settings_overlay(lv_obj_t* overlay);
     void populate_info_rows();
     void show_restart_prompt();
 
@@ -95,6 +95,11 @@ class TempControlPanel {
     void update_x_axis_labels(std::array<lv_obj_t*, X_AXIS_LABEL_COUNT>& labels,
                               int64_t start_time_ms, int point_count);
 
+    // Redraw a graph from TemperatureHistory and update its X-axis labels
+    void update_graph_from_history(ui_temp_graph_t* graph, const heater_config_t& config,
+                                   lv_subject_t* points_subject,
+                                   std::array<lv_obj_t*, X_AXIS_LABEL_COUNT>& labels);
+
     // Button callback setup
     void setup_preset_buttons(lv_obj_t* panel, heater_type_t type);
     void setup_custom_button(lv_obj_t* panel, heater_type_t type);
@@ -182,37 +187,9 @@ class TempControlPanel {
     std::array<lv_obj_t*, X_AXIS_LABEL_COUNT> nozzle_x_labels_{};
     std::array<lv_obj_t*, X_AXIS_LABEL_COUNT> bed_x_labels_{};
 
-    // Timestamp tracking for X-axis labels
-    int64_t nozzle_start_time_ms_ = 0;
-    int64_t bed_start_time_ms_ = 0;
-    int nozzle_point_count_ = 0;
-    int bed_point_count_ = 0;
-
     heater_config_t nozzle_config_;
     heater_config_t bed_config_;
 
     // Subjects initialized flag
     bool subjects_initialized_ = false;
-
-    // ─────────────────────────────────────────────────────────────────────────
-    // Background temperature history buffers
-    // Store temperature readings from app start so graphs show data immediately
-    // ─────────────────────────────────────────────────────────────────────────
-    static constexpr int TEMP_HISTORY_SIZE = 300; // Match graph point count (5 min @ 1/sec)
-
-    // Circular buffer storage (temp values + timestamps)
-    struct TempSample {
-        int temp;
-        int64_t timestamp_ms;
-    };
-    std::array<TempSample, TEMP_HISTORY_SIZE> nozzle_history_{};
-    std::array<TempSample, TEMP_HISTORY_SIZE> bed_history_{};
-
-    // Circular buffer write indices
-    int nozzle_history_count_ = 0; // Total samples received (for wrap detection)
-    int bed_history_count_ = 0;
-
-    // Helper to replay buffered history to graph when panel opens
-    void replay_nozzle_history_to_graph();
-    void replay_bed_history_to_graph();
 };
@@ -0,0 +1,82 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <cstdint>
+
+/**
+ * @brief In-process splash shown while the UI is built beneath it
+ *
+ * show() draws the logo on the top layer right after the display is created, before
+ * fonts, XML components or the theme are loaded, and hides the active screen so that
+ * building the UI on it neither invalidates nor redraws anything. pump() advances the
+ * fade-in between startup phases without running the app's timers. dismiss() reveals
+ * the finished UI and fades the splash out from the main loop.
+ *
+ * This replaces the fixed-length splash that used to run after theme init. When the
+ * launcher still starts the external helix-splash process, the app's first frame is the
+ * same logo on the same background rather than an empty screen.
+ *
+ * Main (LVGL) thread only.
+ *
+ * Usage:
+ * @code
+ * SplashScreen splash;
+ * splash.show(display, dark_mode);
+ * register_fonts_and_images();
+ * splash.pump();
+ * ...
+ * splash.dismiss();
+ * @endcode
+ */
+class SplashScreen {
+  public:
+    static constexpr uint32_t FADE_IN_MS = 300; ///< Same as helix-splash
+    static constexpr uint32_t FADE_OUT_MS = 200;
+
+    // app_bg_color_dark/light from globals.xml, which is not loaded yet when show() runs
+    static constexpr uint32_t BG_COLOR_DARK = 0x292A2D;
+    static constexpr uint32_t BG_COLOR_LIGHT = 0xFFFFFF;
+
+    /**
+     * @brief Draw the splash and hide the active screen
+     *
+     * Renders the first frame before returning.
+     *
+     * @param display Display created by the backend
+     * @param dark_mode Background matches the theme that will be loaded
+     */
+    void show(lv_display_t* display, bool dark_mode);
+
+    /**
+     * @brief Advance the fade-in and redraw the splash
+     *
+     * Call between startup phases. Only animations and the display refresh run; timers
+     * created by the code being initialized do not. No-op when the splash isn't shown.
+     */
+    void pump();
+
+    /**
+     * @brief Show the active screen again and fade the splash out
+     *
+     * The fade runs from the main loop; the splash deletes itself when it ends.
+     * No-op when the splash isn't shown.
+     */
+    void dismiss();
+
+    /**
+     * @brief true between show() and dismiss()
+     */
+    bool is_shown() const {
+        return overlay_ != nullptr;
+    }
+
+  private:
+    lv_display_t* display_ = nullptr;
+    lv_obj_t* overlay_ = nullptr; ///< Full-screen background on the top layer
+    lv_obj_t* logo_ = nullptr;
+    lv_obj_t* hidden_screen_ = nullptr;
+};
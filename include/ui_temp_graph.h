@@ -30,6 +30,9 @@
 #define UI_TEMP_GRAPH_DEFAULT_POINTS 300      // Default point count (5 min @ 1s)
 #define UI_TEMP_GRAPH_DEFAULT_MIN_TEMP 0.0f   // Default Y-axis minimum
 #define UI_TEMP_GRAPH_DEFAULT_MAX_TEMP 100.0f // Default Y-axis maximum
+#define UI_TEMP_GRAPH_DEFAULT_WINDOW_MS 300000 // History window for bound series (5 min)
+#define UI_TEMP_GRAPH_PIXELS_PER_BUCKET 4      // Min/max bucket width (2 points per bucket)
+#define UI_TEMP_GRAPH_GRADIENT_LUT_SIZE 256    // Gradient opacity steps over the chart height
 
 // Gradient opacity defaults (stock chart style: visible at line, fades to transparent)
 #define UI_TEMP_GRAPH_GRADIENT_TOP_OPA                                                             \
@@ -51,6 +54,11 @@ typedef struct {
     float target_temp;                // Target temperature for cursor
     lv_opa_t gradient_bottom_opa;     // Bottom gradient opacity
     lv_opa_t gradient_top_opa;        // Top gradient opacity
+    char history_sensor[32];          // Bound TemperatureHistory sensor ("" = push mode)
+    int32_t* history_points;          // Point buffer handed to the chart when bound
+    uint64_t history_revision;        // Store revision last drawn
+    // Fill opacity by height fraction (0 = chart top), rebuilt when the gradient changes
+    lv_opa_t gradient_lut[UI_TEMP_GRAPH_GRADIENT_LUT_SIZE];
 } ui_temp_series_meta_t;
 
 /**
@@ -65,6 +73,7 @@ typedef struct {
     int point_count;                                             // Number of points per series
     float min_temp;                                              // Y-axis minimum temperature
     float max_temp;                                              // Y-axis maximum temperature
+    int64_t history_window_ms;                                   // History-bound time span
 } ui_temp_graph_t;
 
 /**
@@ -163,6 +172,48 @@ void ui_temp_graph_clear(ui_temp_graph_t* graph);
  */
 void ui_temp_graph_clear_series(ui_temp_graph_t* graph, int series_id);
 
+/**
+ * History View API
+ *
+ * A bound series is a view over TemperatureHistory: instead of receiving pushed points it
+ * redraws the last history_window_ms of a sensor, decimated into min/max buckets sized to
+ * the chart's pixel width. The graph's point count follows the chart width.
+ *
+ * The window is aligned to whole buckets, so it only scrolls when a bucket fills up.
+ * Between scrolls a refresh invalidates just the strip of the chart whose points changed
+ * (normally the newest bucket) instead of the whole chart.
+ */
+
+/**
+ * Bind a series to a TemperatureHistory sensor and draw its current history
+ *
+ * The binding lasts for the lifetime of the series; push/array updates are ignored.
+ *
+ * @param graph Graph instance
+ * @param series_id Series ID
+ * @param sensor Klipper object name (e.g., "extruder", "heater_bed")
+ */
+void ui_temp_graph_bind_history(ui_temp_graph_t* graph, int series_id, const char* sensor);
+
+/**
+ * Redraw bound series whose history changed since the last refresh
+ *
+ * Cheap when nothing changed (one revision check per series). Only the part of the chart
+ * from the first changed point onwards is invalidated.
+ *
+ * @param graph Graph instance
+ * @return true if any visible point changed
+ */
+bool ui_temp_graph_refresh_history(ui_temp_graph_t* graph);
+
+/**
+ * Set the time span shown by history-bound series
+ *
+ * @param graph Graph instance
+ * @param window_ms Window length in milliseconds
+ */
+void ui_temp_graph_set_history_window(ui_temp_graph_t* graph, int64_t window_ms);
+
 /**
  * Target Temperature API
  */
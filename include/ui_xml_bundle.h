@@ -0,0 +1,51 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief One XML component compiled into the binary
+ */
+struct UiXmlBundleEntry {
+    const char* name; ///< Component name (file name without .xml)
+    const char* xml;  ///< Minified XML with XML-defined constants inlined
+    size_t size;      ///< Length of xml in bytes
+};
+
+/**
+ * @brief XML components compiled into the binary, sorted by name
+ *
+ * Generated by scripts/compile-xml-bundle.py (`make xml-bundle`) and only linked in
+ * builds with ENABLE_XML_BUNDLE=yes (HELIX_XML_BUNDLE defined).
+ */
+extern const UiXmlBundleEntry UI_XML_BUNDLE[];
+extern const size_t UI_XML_BUNDLE_COUNT;
+
+/**
+ * @brief Check whether XML components are compiled into this binary
+ */
+bool ui_xml_bundle_enabled();
+
+/**
+ * @brief Register an XML component from the bundle, or from ui_xml/ without one
+ *
+ * Drop-in replacement for lv_xml_register_component_from_file("A:ui_xml/<name>.xml").
+ * Falls back to the file for components missing from the bundle.
+ *
+ * @param name Component name (e.g. "home_panel")
+ * @return LV_RESULT_OK on success
+ */
+lv_result_t ui_xml_register_component(const char* name);
+
+/**
+ * @brief Get the XML source of a component (for parsing outside LVGL)
+ *
+ * @param name Component name (e.g. "globals")
+ * @return XML text, or empty string if the component can't be found
+ */
+std::string ui_xml_read_component(const char* name);
@@ -70,6 +70,7 @@ struct UsbDrive {
     std::string mount_path;   ///< Mount point path ("/media/usb0" or "/Volumes/USBDRIVE")
     std::string device;       ///< Device path ("/dev/sda1")
     std::string label;        ///< Volume label ("USBDRIVE")
+    std::string uuid;         ///< Filesystem UUID ("1234-ABCD"), empty if unknown
     uint64_t total_bytes;     ///< Total capacity in bytes
     uint64_t available_bytes; ///< Available space in bytes
 
@@ -84,6 +84,11 @@ class UsbBackendLinux : public UsbBackend {
      */
     std::string get_volume_label(const std::string& device, const std::string& mount_point);
 
+    /**
+     * @brief Get filesystem UUID for a device (via /dev/disk/by-uuid), empty if unknown
+     */
+    std::string get_volume_uuid(const std::string& device);
+
     /**
      * @brief Get capacity info for a mount point
      */
@@ -0,0 +1,223 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "gcode_parser.h"
+#include "usb_backend.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief G-code file on a USB drive with its header metadata and thumbnail
+ */
+struct UsbCatalogEntry {
+    UsbGcodeFile file;
+    bool has_metadata = false;           ///< metadata and thumbnail_path are filled in
+    gcode::GCodeHeaderMetadata metadata; ///< Slicer, print time, filament...
+    std::string thumbnail_path;          ///< Extracted PNG, empty if the file has none
+};
+
+/**
+ * @brief Catalog state of one drive
+ */
+struct UsbCatalogProgress {
+    std::string mount_path;
+    size_t files = 0;         ///< Files in the index
+    size_t metadata_done = 0; ///< Files with metadata filled in
+    bool indexing = true;     ///< Directory walk still running (files may change)
+    bool from_cache = false;  ///< Index was loaded from a previous insertion
+
+    bool complete() const {
+        return !indexing && metadata_done >= files;
+    }
+};
+
+/**
+ * @brief Background index of the G-code files on mounted USB drives
+ *
+ * open() queues a drive. A worker walks it (path, size, mtime), then fills in header
+ * metadata (gcode::extract_header_metadata()) and extracts the best thumbnail one file
+ * at a time: files passed to prioritize() first (what's on screen), then newest first.
+ * The number of workers is bounded (set_worker_count()), so a large drive never takes
+ * more than that many threads or concurrent file reads.
+ *
+ * With a cache directory set, each drive's index is saved there keyed by filesystem
+ * UUID (label and size when the UUID is unknown). Inserting the same drive again
+ * publishes the saved index immediately; the walk then only re-reads files whose size
+ * or mtime changed.
+ *
+ * close() cancels the drive's work when it is removed: workers drop results for it and
+ * move on after the file they're reading. The progress callback runs on worker threads,
+ * at most every PROGRESS_INTERVAL_MS per drive plus once when the index is loaded,
+ * walked and complete.
+ *
+ * Usage:
+ * @code
+ * UsbCatalog catalog([](const std::string& mount) { return scan(mount); });
+ * catalog.set_cache_dir("/tmp/helix_usb_catalog");
+ * catalog.set_progress_callback([](const UsbCatalogProgress& p) { ... });
+ * catalog.open(drive);          // on DRIVE_INSERTED
+ * auto files = catalog.entries(drive.mount_path);
+ * catalog.close(drive.mount_path); // on DRIVE_REMOVED
+ * @endcode
+ */
+class UsbCatalog {
+  public:
+    using Scanner = std::function<std::vector<UsbGcodeFile>(const std::string& mount_path)>;
+    using ProgressCallback = std::function<void(const UsbCatalogProgress& progress)>;
+
+    static constexpr int DEFAULT_WORKERS = 1;
+    static constexpr int MAX_WORKERS = 4;
+    static constexpr uint32_t PROGRESS_INTERVAL_MS = 1000;
+    static constexpr int CACHE_VERSION = 1;
+
+    /**
+     * @param scanner Lists the G-code files on a mounted drive (runs on a worker thread)
+     */
+    explicit UsbCatalog(Scanner scanner);
+    ~UsbCatalog();
+
+    UsbCatalog(const UsbCatalog&) = delete;
+    UsbCatalog& operator=(const UsbCatalog&) = delete;
+
+    /**
+     * @brief Directory for saved indexes and thumbnails (empty = keep nothing)
+     *
+     * Set before opening drives.
+     */
+    void set_cache_dir(const std::string& dir);
+
+    /**
+     * @brief Number of worker threads (1 to MAX_WORKERS), set before opening drives
+     */
+    void set_worker_count(int count);
+
+    /**
+     * @brief Called from worker threads as a drive's catalog fills in
+     */
+    void set_progress_callback(ProgressCallback callback);
+
+    /**
+     * @brief Start indexing a mounted drive (no-op if it is already open)
+     */
+    void open(const UsbDrive& drive);
+
+    /**
+     * @brief Cancel a removed drive's work and forget it
+     *
+     * Saves what has been catalogued so far.
+     */
+    void close(const std::string& mount_path);
+
+    /**
+     * @brief Cancel all work and stop the workers (open() starts them again)
+     */
+    void shutdown();
+
+    /**
+     * @brief Snapshot of a drive's files (empty while the first walk runs without a
+     *        saved index)
+     */
+    std::vector<UsbCatalogEntry> entries(const std::string& mount_path) const;
+
+    /**
+     * @brief Current state of a drive (files = 0 and indexing = false if not open)
+     */
+    UsbCatalogProgress progress(const std::string& mount_path) const;
+
+    /**
+     * @brief Fill in these files next, in this order
+     *
+     * @param mount_path Drive the files are on
+     * @param paths Full paths (UsbGcodeFile::path)
+     */
+    void prioritize(const std::string& mount_path, const std::vector<std::string>& paths);
+
+    /**
+     * @brief Key a drive's saved index is stored under
+     */
+    static std::string drive_key(const UsbDrive& drive);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Drive {
+        UsbDrive drive;
+        std::string key;
+        std::vector<UsbCatalogEntry> entries;
+        std::unordered_map<std::string, size_t> index_of; ///< path -> entries index
+        std::vector<size_t> order;                        ///< Newest first
+        size_t next = 0;                                  ///< Position in order
+        std::deque<size_t> urgent;                        ///< From prioritize()
+        std::vector<bool> claimed;                        ///< Taken by a worker
+        size_t metadata_done = 0;
+        uint64_t generation = 0; ///< Bumped when entries are replaced
+        bool walk_claimed = false;
+        bool indexing = true;
+        bool from_cache = false;
+        bool cancelled = false;
+        bool dirty = false; ///< Not saved since the last change
+        Clock::time_point last_report;
+    };
+
+    /// Index snapshot to write once mutex_ is released
+    struct PendingSave {
+        std::string file; ///< Empty = nothing to save
+        std::string mount_path;
+        std::vector<UsbCatalogEntry> entries;
+    };
+
+    struct Task {
+        std::shared_ptr<Drive> drive;
+        bool walk = false;
+        size_t index = 0;
+        uint64_t generation = 0;
+        std::string path;
+        std::string thumbnail; ///< Where to extract the thumbnail (empty = don't)
+    };
+
+    void start_workers();
+    void run();
+    bool next_task(Task& task); // Caller holds mutex_
+    void walk(const std::shared_ptr<Drive>& drive);
+    void fill_in(const Task& task);
+    void set_entries(Drive& drive, std::vector<UsbCatalogEntry> entries); // Caller holds mutex_
+    UsbCatalogProgress progress_of(const Drive& drive) const;             // Caller holds mutex_
+    void report(const UsbCatalogProgress& progress);
+
+    std::string cache_file(const Drive& drive) const; // Caller holds mutex_; empty = none
+    std::string thumbnail_file(const Drive& drive,
+                               const UsbGcodeFile& file) const; // Caller holds mutex_
+    void take_save(Drive& drive, PendingSave& pending);         // Caller holds mutex_
+    void write(const PendingSave& pending);
+
+    static std::vector<UsbCatalogEntry> load(const std::string& cache_file,
+                                             const std::string& mount_path);
+    static void save(const std::string& cache_file, const std::string& mount_path,
+                     const std::vector<UsbCatalogEntry>& entries);
+
+    const Scanner scanner_;
+
+    mutable std::mutex mutex_; // Guards the fields below
+    std::condition_variable cv_;
+    std::map<std::string, std::shared_ptr<Drive>> drives_; ///< By mount path
+    std::string cache_dir_;
+    int worker_count_ = DEFAULT_WORKERS;
+    ProgressCallback progress_callback_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+
+    std::mutex save_mutex_; // One index write at a time (never held with mutex_)
+};
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "usb_backend.h"
+#include "usb_catalog.h"
 
 #include <functional>
 #include <memory>
@@ -38,6 +39,7 @@
  * - Starting/stopping USB monitoring
  * - Receiving drive insert/remove notifications
  * - Querying available drives and G-code files
+ * - Cataloguing each inserted drive's G-code files in the background (catalog())
  *
  * This is the class that application code should interact with, rather than
  * using the backend directly.
@@ -134,6 +136,16 @@ class UsbManager {
     std::vector<UsbGcodeFile> scan_for_gcode(const std::string& mount_path,
                                              int max_depth = 3) const;
 
+    /**
+     * @brief Background catalog of the connected drives' G-code files
+     *
+     * Drives are opened when inserted and closed when removed. Configure it (cache
+     * directory, workers) before start().
+     */
+    UsbCatalog& catalog() {
+        return catalog_;
+    }
+
     // ========================================================================
     // Test API (for UsbBackendMock)
     // ========================================================================
@@ -152,4 +164,5 @@ class UsbManager {
     DriveCallback drive_callback_;
     mutable std::mutex mutex_;
     bool force_mock_;
+    UsbCatalog catalog_; // Shut down before backend_ is reset: its workers scan through it
 };
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -297,6 +298,20 @@ class WifiBackend {
      */
     virtual WiFiError get_scan_results(std::vector<WiFiNetwork>& networks) = 0;
 
+    /**
+     * @brief Rescan periodically on the backend's own thread
+     *
+     * Backends that support it deliver "SCAN_COMPLETE" only when the network list
+     * changed, so callers don't need to poll trigger_scan().
+     *
+     * @param interval_ms Time between scans, 0 to stop
+     * @return false if unsupported (the caller polls trigger_scan() instead)
+     */
+    virtual bool set_periodic_scan(uint32_t interval_ms) {
+        (void)interval_ms;
+        return false;
+    }
+
     // ========================================================================
     // Connection Management
     // ========================================================================
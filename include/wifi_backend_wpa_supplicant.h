@@ -24,7 +24,9 @@
 #pragma once
 
 #include "wifi_backend.h" // Base class
+#include "wifi_network_table.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <string>
@@ -55,7 +57,11 @@ struct wpa_ctrl;
  * - Inherits privately from hv::EventLoopThread for async I/O
  * - Dual wpa_ctrl connections: control (commands) + monitor (events)
  * - Event callbacks broadcast to registered handlers
- * - Commands sent synchronously via wpa_ctrl_request()
+ * - Commands sent synchronously via wpa_ctrl_request(), one at a time
+ * - Scan results fetched on the event loop thread when CTRL-EVENT-SCAN-RESULTS
+ *   arrives and merged into a WifiNetworkTable; SCAN_COMPLETE is only dispatched
+ *   when the network list changed (or a scan was requested with trigger_scan())
+ * - Periodic scans (set_periodic_scan()) run on a loop timer, not the UI thread
  *
  * Usage:
  * @code
@@ -74,8 +80,11 @@ class WifiBackendWpaSupplicant : public WifiBackend, private hv::EventLoopThread
      * @brief Construct WiFi backend
      *
      * Does NOT connect to wpa_supplicant. Call start() to initialize.
+     *
+     * @param socket_path Control socket to use instead of searching /run/wpa_supplicant
+     *                    (skips the WiFi hardware checks; used by tests)
      */
-    WifiBackendWpaSupplicant();
+    explicit WifiBackendWpaSupplicant(const std::string& socket_path = "");
 
     /**
      * @brief Destructor - ensures clean shutdown
@@ -149,7 +158,13 @@ class WifiBackendWpaSupplicant : public WifiBackend, private hv::EventLoopThread
     // ========================================================================
 
     WiFiError trigger_scan() override;
+
+    /**
+     * @brief Networks from the latest scan results (no wpa_supplicant request once the
+     *        first results have arrived)
+     */
     WiFiError get_scan_results(std::vector<WiFiNetwork>& networks) override;
+    bool set_periodic_scan(uint32_t interval_ms) override;
     WiFiError connect_network(const std::string& ssid, const std::string& password) override;
     WiFiError disconnect_network() override;
     ConnectionStatus get_status() override;
@@ -240,11 +255,13 @@ class WifiBackendWpaSupplicant : public WifiBackend, private hv::EventLoopThread
      */
     void dispatch_event(const std::string& event_name, const std::string& message);
 
-    // Helper methods for clean API (encapsulate wpa_supplicant ugliness)
-    std::vector<WiFiNetwork> parse_scan_results(const std::string& raw);
-    std::vector<std::string> split_by_tabs(const std::string& str);
-    int dbm_to_percentage(int dbm);
-    std::string detect_security_type(const std::string& flags, bool& is_secured);
+    /**
+     * @brief Fetch SCAN_RESULTS and merge them into the network table
+     *
+     * @param[out] diff What changed since the previous results
+     * @return WiFiError from the SCAN_RESULTS request
+     */
+    WiFiError refresh_networks(WifiNetworkDiff& diff);
 
     /**
      * @brief Map raw wpa_supplicant event to callback name
@@ -259,6 +276,18 @@ class WifiBackendWpaSupplicant : public WifiBackend, private hv::EventLoopThread
 
     struct wpa_ctrl* conn;     ///< Control connection for sending commands
     struct wpa_ctrl* mon_conn; ///< Monitor connection for receiving events (FIXED LEAK)
+    std::string socket_path_;  ///< Fixed control socket (empty = discover)
+
+    // wpa_ctrl_request() on one connection isn't reentrant; commands come from the UI
+    // thread and the event loop thread
+    std::mutex command_mutex_;
+
+    // Scan results
+    std::mutex networks_mutex_;            ///< Protects networks_ and networks_loaded_
+    WifiNetworkTable networks_;            ///< Latest scan results by SSID
+    bool networks_loaded_ = false;         ///< networks_ holds results since start()
+    std::atomic<bool> scan_requested_{false}; ///< Report the next results even if unchanged
+    hv::TimerID scan_timer_id_ = INVALID_TIMER_ID; ///< Periodic scan (loop thread only)
 
     // Thread safety for callbacks (accessed from multiple threads)
     std::mutex callbacks_mutex_; ///< Protects callbacks map from race conditions
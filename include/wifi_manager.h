@@ -26,6 +26,8 @@
 #include "lvgl/lvgl.h"
 #include "wifi_backend.h"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -80,12 +82,16 @@ class WiFiManager {
      * @brief Start periodic network scanning
      *
      * Scans for available networks and invokes callback with results.
-     * Scanning continues automatically every 7 seconds until stop_scan() called.
+     * Scanning continues every SCAN_INTERVAL_MS until stop_scan() is called: on the
+     * backend's thread when it supports that (the callback then only runs when the
+     * list changed), otherwise from an LVGL timer. Call it while the WiFi UI is shown.
      *
      * @param on_networks_updated Callback invoked with scan results
      */
     void start_scan(std::function<void(const std::vector<WiFiNetwork>&)> on_networks_updated);
 
+    static constexpr uint32_t SCAN_INTERVAL_MS = 7000;
+
     /**
      * @brief Stop periodic network scanning
      *
@@ -197,6 +203,7 @@ class WiFiManager {
     lv_timer_t* scan_timer_;
     std::function<void(const std::vector<WiFiNetwork>&)> scan_callback_;
     bool scan_pending_; // True when scan triggered, cleared after first SCAN_COMPLETE processed
+    std::atomic<bool> backend_scanning_{false}; // Backend rescans itself, reporting changes
 
     // Connection state
     std::function<void(bool, const std::string&)> connect_callback_;
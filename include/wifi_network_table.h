@@ -0,0 +1,80 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "wifi_backend.h"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Networks that changed between two scans
+ */
+struct WifiNetworkDiff {
+    std::vector<WiFiNetwork> added;   ///< SSIDs seen for the first time
+    std::vector<WiFiNetwork> changed; ///< Signal moved by SIGNAL_HYSTERESIS or security changed
+    std::vector<std::string> removed; ///< SSIDs no longer seen
+
+    bool empty() const {
+        return added.empty() && changed.empty() && removed.empty();
+    }
+};
+
+/**
+ * @brief Stable table of visible networks built from wpa_supplicant SCAN_RESULTS
+ *
+ * Each SSID is listed once with its strongest access point (mesh systems broadcast
+ * the same SSID from several). apply_scan_results() returns only what changed since
+ * the previous scan; lines identical to the previous scan are not parsed again.
+ * Signal changes smaller than SIGNAL_HYSTERESIS are not reported, so the list doesn't
+ * churn while nothing really changes.
+ *
+ * Not thread-safe: the owner serializes access.
+ */
+class WifiNetworkTable {
+  public:
+    static constexpr int SIGNAL_HYSTERESIS = 5; ///< Percent
+
+    /**
+     * @brief Replace the table with a SCAN_RESULTS response
+     *
+     * @param raw Response text: header line, then BSSID\\tfreq\\tsignal\\tflags\\tSSID lines
+     * @return Networks added, changed and removed
+     */
+    WifiNetworkDiff apply_scan_results(const std::string& raw);
+
+    /**
+     * @brief Current networks, strongest first
+     */
+    std::vector<WiFiNetwork> networks() const;
+
+    size_t size() const {
+        return networks_.size();
+    }
+
+    void clear();
+
+    /**
+     * @brief Convert signal level to percent (-30 dBm = 100%, -90 dBm = 0%)
+     */
+    static int dbm_to_percentage(int dbm);
+
+    /**
+     * @brief Security type from scan flags ("[WPA2-PSK-CCMP][ESS]" -> "WPA2")
+     */
+    static std::string detect_security_type(const std::string& flags, bool& is_secured);
+
+  private:
+    struct AccessPoint {
+        std::string line; ///< Raw scan line, to skip parsing it again when unchanged
+        WiFiNetwork network;
+    };
+
+    static bool parse_line(const std::string& line, WiFiNetwork& network);
+
+    std::unordered_map<std::string, AccessPoint> access_points_; ///< By BSSID
+    std::map<std::string, WiFiNetwork> networks_; ///< By SSID, as last reported
+};
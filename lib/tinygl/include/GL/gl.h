@@ -795,6 +795,11 @@ void glReadPixels(	GLint x,
 void glDrawArrays(	GLenum mode,
  					GLint first,
  					GLsizei count);
+/* TinyGL extension: independent indexed primitives from the client arrays */
+void glDrawElementsBatch(GLenum mode,
+						GLsizei vertices_per_primitive,
+						GLsizei primitive_count,
+						const GLuint* indices);
 
 void glSetEnableSpecular(GLint s);
 void glSetEnableDithering(GLint enable);  /* Enable/disable ordered dithering */
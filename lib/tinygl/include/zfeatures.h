@@ -113,8 +113,14 @@ Optimization hint- cost of branching.
 #endif
 
 
+/*Framebuffer pixel size. Override both at build time (e.g. -DTGL_FEATURE_16_BITS=1
+-DTGL_FEATURE_32_BITS=0) to render straight into an RGB565 display buffer.*/
+#ifndef TGL_FEATURE_16_BITS
 #define TGL_FEATURE_16_BITS        0
+#endif
+#ifndef TGL_FEATURE_32_BITS
 #define TGL_FEATURE_32_BITS        1
+#endif
 
 #if TGL_FEATURE_32_BITS == 1
 #define TGL_FEATURE_RENDER_BITS    32
@@ -370,6 +370,47 @@ void glDrawArrays(GLenum mode, GLint first, GLsizei count) {
 	glEnd();
 }
 
+/* TinyGL extension: draw primitive_count independent primitives of
+ * vertices_per_primitive indexed array elements each (e.g. 4-vertex
+ * GL_TRIANGLE_STRIP quads). Outside of display list compilation the
+ * begin/element/end ops run directly, avoiding per-vertex op dispatch. */
+void glDrawElementsBatch(GLenum mode, GLsizei vertices_per_primitive, GLsizei primitive_count,
+						 const GLuint* indices) {
+	GLContext* c = gl_get_context();
+	GLParam begin[2];
+	GLParam elem[2];
+	GLParam end[1];
+	GLsizei prim;
+	GLsizei k;
+#include "error_check.h"
+	begin[0].op = OP_Begin;
+	begin[1].i = mode;
+	elem[0].op = OP_ArrayElement;
+	end[0].op = OP_End;
+
+	if (c->compile_flag) {
+		/* Recording a list: queue the ops so glCallList replays them */
+		for (prim = 0; prim < primitive_count; prim++) {
+			gl_add_op(begin);
+			for (k = 0; k < vertices_per_primitive; k++) {
+				elem[1].i = (GLint)*indices++;
+				gl_add_op(elem);
+			}
+			gl_add_op(end);
+		}
+		return;
+	}
+
+	for (prim = 0; prim < primitive_count; prim++) {
+		glopBegin(begin);
+		for (k = 0; k < vertices_per_primitive; k++) {
+			elem[1].i = (GLint)*indices++;
+			glopArrayElement(elem);
+		}
+		glopEnd(end);
+	}
+}
+
 void glopEnableClientState(GLParam* p) { gl_get_context()->client_states |= p[1].i; }
 
 void glEnableClientState(GLenum array) {
@@ -155,8 +155,13 @@
 
 	/* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiple threads will render the screen in parallel */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+     * > 1 means multiple threads will render the screen in parallel
+     * HELIX: set per platform in mk/cross.mk (HELIX_DRAW_SW_UNITS), one unit elsewhere */
+    #ifdef HELIX_DRAW_SW_UNITS
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    HELIX_DRAW_SW_UNITS
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -181,7 +186,12 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /* HELIX: NEON blend routines on ARMv7 targets (mk/cross.mk sets HELIX_DRAW_SW_NEON) */
+    #ifdef HELIX_DRAW_SW_NEON
+        #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NEON
+    #else
+        #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    #endif
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
@@ -362,12 +372,13 @@
 /*Default cache size in bytes.
  *Used by image decoders such as `lv_lodepng` to keep the decoded image in the memory.
  *If size is not set to 0, the decoder will fail to decode when the cache is full.
- *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.*/
-#define LV_CACHE_DEF_SIZE       0
+ *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.
+ *HELIX: resized at startup from the `image_cache_kb` config key (ImageCache::init())*/
+#define LV_CACHE_DEF_SIZE       (4 * 1024 * 1024)
 
 /*Default number of image header cache entries. The cache is used to store the headers of images
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
-#define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
+#define LV_IMAGE_HEADER_CACHE_DEF_CNT 32
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -808,8 +819,9 @@
 #endif
 
 
-/*Decode bin images to RAM*/
-#define LV_BIN_DECODER_RAM_LOAD 0
+/*Decode bin images to RAM
+ *HELIX: pre-converted assets (make native-images) are loaded once and cached, not read per draw*/
+#define LV_BIN_DECODER_RAM_LOAD 1
 
 /*RLE decompress library*/
 #define LV_USE_RLE 0
@@ -1034,8 +1046,10 @@
 #if LV_USE_LINUX_FBDEV
     #define LV_LINUX_FBDEV_BSD           0
     #define LV_LINUX_FBDEV_RENDER_MODE   LV_DISPLAY_RENDER_MODE_PARTIAL
-    #define LV_LINUX_FBDEV_BUFFER_COUNT  2  /*Double buffering for smooth rendering*/
-    #define LV_LINUX_FBDEV_BUFFER_SIZE   60
+    /*Placeholder only: DisplayBackendFbdev replaces it with aligned buffers sized from
+     *the "/display/render_buffer_lines" and "/display/double_buffer" config keys*/
+    #define LV_LINUX_FBDEV_BUFFER_COUNT  1
+    #define LV_LINUX_FBDEV_BUFFER_SIZE   1
 #endif
 
 /*Use Nuttx to open window and handle touchscreen*/
@@ -33,6 +33,10 @@ ifeq ($(PLATFORM_TARGET),pi)
     ENABLE_SDL := no
     ENABLE_TINYGL_3D := yes
     ENABLE_EVDEV := yes
+    # Quad-core: render on two threads, leave the other cores to Klipper/Moonraker
+    DRAW_SW_UNITS := 2
+    # Register UI XML from memory (no ui_xml/ reads at startup)
+    ENABLE_XML_BUNDLE := yes
     BUILD_SUBDIR := pi
     # Strip binary for size - embedded targets don't need debug symbols
     STRIP_BINARY := yes
@@ -53,6 +57,10 @@ else ifeq ($(PLATFORM_TARGET),ad5m)
     ENABLE_SDL := no
     ENABLE_TINYGL_3D := yes
     ENABLE_EVDEV := yes
+    # LVGL's NEON blend routines are ARMv7 assembly; single draw unit (Klipper shares the CPU)
+    ENABLE_DRAW_SW_NEON := yes
+    # Register UI XML from memory (no ui_xml/ reads at startup)
+    ENABLE_XML_BUNDLE := yes
     BUILD_SUBDIR := ad5m
     # Strip binary for size on memory-constrained device
     STRIP_BINARY := yes
@@ -141,6 +149,27 @@ else ifeq ($(DISPLAY_BACKEND),sdl)
     SUBMODULE_CXXFLAGS += -DHELIX_DISPLAY_SDL
 endif
 
+# Software renderer tuning (used by lv_conf.h)
+# Must be added to SUBMODULE_*FLAGS as well so LVGL's draw code sees the same settings
+ifdef DRAW_SW_UNITS
+    CFLAGS += -DHELIX_DRAW_SW_UNITS=$(DRAW_SW_UNITS)
+    CXXFLAGS += -DHELIX_DRAW_SW_UNITS=$(DRAW_SW_UNITS)
+    SUBMODULE_CFLAGS += -DHELIX_DRAW_SW_UNITS=$(DRAW_SW_UNITS)
+    SUBMODULE_CXXFLAGS += -DHELIX_DRAW_SW_UNITS=$(DRAW_SW_UNITS)
+endif
+
+ifeq ($(ENABLE_DRAW_SW_NEON),yes)
+    CFLAGS += -DHELIX_DRAW_SW_NEON
+    CXXFLAGS += -DHELIX_DRAW_SW_NEON
+    SUBMODULE_CFLAGS += -DHELIX_DRAW_SW_NEON
+    SUBMODULE_CXXFLAGS += -DHELIX_DRAW_SW_NEON
+endif
+
+# UI XML compiled into the binary (mk/xml-bundle.mk); only app code uses it
+ifeq ($(ENABLE_XML_BUNDLE),yes)
+    CXXFLAGS += -DHELIX_XML_BUNDLE
+endif
+
 # Evdev input support
 ifeq ($(ENABLE_EVDEV),yes)
     CFLAGS += -DHELIX_INPUT_EVDEV
@@ -337,7 +366,8 @@ endif
 
 # Deploy full application to Pi using rsync (binary + assets + config + XML)
 # Uses rsync for efficient delta transfers - only changed files are sent
-deploy-pi:
+# Images are converted to LVGL's native format first (mk/images.mk) and ship in assets/
+deploy-pi: native-images
 	@test -f build/pi/bin/helix-screen || { echo "$(RED)Error: build/pi/bin/helix-screen not found. Run 'make pi-docker' first.$(RESET)"; exit 1; }
 	@test -f build/pi/bin/helix-splash || { echo "$(RED)Error: build/pi/bin/helix-splash not found. Run 'make pi-docker' first.$(RESET)"; exit 1; }
 	@echo "$(CYAN)Deploying HelixScreen to $(PI_SSH_TARGET):$(PI_DEPLOY_DIR)...$(RESET)"
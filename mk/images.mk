@@ -0,0 +1,29 @@
+# SPDX-License-Identifier: GPL-3.0-or-later
+# Pre-converted image assets
+#
+# Converts assets/images/ PNGs to LVGL binary images in the display's color format
+# (RGB565 + 8-bit alpha for LV_COLOR_DEPTH 16) under assets/images/native/. At runtime
+# ImageCache::resolve() loads the converted image when it exists, so these assets are
+# read straight into the image cache instead of being PNG-decoded. Missing or stale
+# conversions just fall back to the PNG.
+#
+# Requires the Python venv (created on demand) for scripts/LVGLImage.py. deploy-pi
+# depends on native-images, so converted images ship with every Pi deploy.
+
+NATIVE_IMAGE_CF := RGB565A8
+NATIVE_IMAGE_DIR := assets/images/native
+NATIVE_IMAGE_PNGS := $(wildcard assets/images/*.png assets/images/printers/*.png)
+NATIVE_IMAGES := $(patsubst assets/images/%.png,$(NATIVE_IMAGE_DIR)/%.bin,$(NATIVE_IMAGE_PNGS))
+
+$(NATIVE_IMAGE_DIR)/%.bin: assets/images/%.png scripts/LVGLImage.py | $(VENV_PYTHON)
+	$(Q)mkdir -p $(dir $@)
+	$(ECHO) "$(CYAN)[IMG]$(RESET) $< -> $@"
+	$(Q)$(VENV_PYTHON) scripts/LVGLImage.py --ofmt BIN --cf $(NATIVE_IMAGE_CF) \
+		-o $(dir $@) $< >/dev/null
+
+.PHONY: native-images clean-native-images
+native-images: $(NATIVE_IMAGES)
+	$(ECHO) "$(GREEN)✓ $(words $(NATIVE_IMAGES)) images converted to $(NATIVE_IMAGE_DIR)/$(RESET)"
+
+clean-native-images:
+	$(Q)rm -rf $(NATIVE_IMAGE_DIR)
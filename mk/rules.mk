@@ -199,6 +199,15 @@ endif
 		exit 1; \
 	}
 
+# Assemble LVGL NEON sources (preprocessed, so they see lv_conf.h)
+$(OBJ_DIR)/lvgl/%.S.o: $(LVGL_DIR)/%.S
+	$(Q)mkdir -p $(dir $@)
+	$(ECHO) "$(CYAN)[AS]$(RESET) $<"
+	$(Q)$(CC) $(SUBMODULE_CFLAGS) $(INCLUDES) $(LV_CONF) -c $< -o $@ || { \
+		echo "$(RED)$(BOLD)✗ Assembly failed:$(RESET) $<"; \
+		exit 1; \
+	}
+
 # Compile LVGL C++ sources (ThorVG) - use SUBMODULE_CXXFLAGS and PCH
 $(OBJ_DIR)/lvgl/%.o: $(LVGL_DIR)/%.cpp $(PCH)
 	$(Q)mkdir -p $(dir $@)
@@ -37,9 +37,10 @@ $(BUILD_DIR)/splash/%.o: src/%.cpp | $(BUILD_DIR)/splash
 	@echo "[CXX] $< (splash)"
 	$(Q)$(CXX) $(SPLASH_CXXFLAGS) -c $< -o $@
 
-# Splash needs config.o (display_backend_drm.cpp uses Config) and a UI notification stub
-# (config.cpp calls ui_notification_error on save failures)
-SPLASH_EXTRA_OBJS := $(OBJ_DIR)/config.o $(BUILD_DIR)/splash/ui_notification_stub.o
+# Splash needs config.o (display_backend_drm.cpp uses Config) with its file writer and a UI
+# notification stub (config.cpp calls ui_notification_error on save failures)
+SPLASH_EXTRA_OBJS := $(OBJ_DIR)/config.o $(OBJ_DIR)/debounced_file_writer.o \
+    $(BUILD_DIR)/splash/ui_notification_stub.o
 
 # Compile notification stub for splash
 $(BUILD_DIR)/splash/ui_notification_stub.o: tools/ui_notification_stub.cpp | $(BUILD_DIR)/splash
@@ -23,7 +23,7 @@
 # - TEST_PLATFORM_DEPS: Platform-specific (wpa_supplicant on Linux)
 
 # Core test infrastructure (always required)
-TEST_CORE_DEPS := $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) $(TEST_OBJS)
+TEST_CORE_DEPS := $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) $(FAKE_WPA_SUPPLICANT_OBJ) $(TEST_OBJS)
 
 # LVGL + Graphics stack (required for all UI tests)
 TEST_LVGL_DEPS := $(LVGL_OBJS) $(THORVG_OBJS)
@@ -51,11 +51,18 @@ TEST_UI_DEPS := \
     $(OBJ_DIR)/ui_icon.o \
     $(OBJ_DIR)/ui_nav.o \
     $(OBJ_DIR)/ui_temp_graph.o \
+    $(OBJ_DIR)/temperature_history.o \
+    $(OBJ_DIR)/main_loop_waker.o \
+    $(OBJ_DIR)/ui_panel_registry.o \
+    $(OBJ_DIR)/startup_trace.o \
+    $(OBJ_DIR)/image_cache.o \
+    $(OBJ_DIR)/ui_splash_screen.o \
     $(OBJ_DIR)/ui_keyboard.o \
     $(OBJ_DIR)/keyboard_layout_provider.o \
     $(OBJ_DIR)/ui_modal.o \
     $(OBJ_DIR)/ui_modal_base.o \
     $(OBJ_DIR)/ui_theme.o \
+    $(OBJ_DIR)/ui_xml_bundle.o \
     $(OBJ_DIR)/helix_theme.o \
     $(OBJ_DIR)/ui_utils.o \
     $(OBJ_DIR)/ui_temperature_utils.o \
@@ -87,6 +94,8 @@ TEST_WIFI_DEPS := \
     $(OBJ_DIR)/wifi_manager.o \
     $(OBJ_DIR)/wifi_backend.o \
     $(OBJ_DIR)/wifi_backend_mock.o \
+    $(OBJ_DIR)/wifi_backend_wpa_supplicant.o \
+    $(OBJ_DIR)/wifi_network_table.o \
     $(OBJ_DIR)/ethernet_manager.o \
     $(OBJ_DIR)/ethernet_backend.o \
     $(OBJ_DIR)/ethernet_backend_mock.o \
@@ -96,6 +105,7 @@ TEST_WIFI_DEPS := \
 TEST_USB_DEPS := \
     $(OBJ_DIR)/usb_backend.o \
     $(OBJ_DIR)/usb_backend_mock.o \
+    $(OBJ_DIR)/usb_catalog.o \
     $(OBJ_DIR)/usb_manager.o
 
 # Settings components (required by ui_panel_settings.o)
@@ -109,11 +119,15 @@ TEST_SETTINGS_DEPS := \
 # Note: app_globals.o excluded - ui_test_utils.o provides stub implementations
 TEST_MOONRAKER_DEPS := \
     $(OBJ_DIR)/moonraker_client.o \
+    $(OBJ_DIR)/moonraker_discovery_snapshot.o \
+    $(OBJ_DIR)/moonraker_notification_dispatch.o \
+    $(OBJ_DIR)/moonraker_request_table.o \
     $(OBJ_DIR)/moonraker_client_mock.o \
     $(OBJ_DIR)/moonraker_api.o \
     $(OBJ_DIR)/moonraker_api_mock.o \
     $(OBJ_DIR)/printer_state.o \
     $(OBJ_DIR)/printer_detector.o \
+    $(OBJ_DIR)/pattern_matcher.o \
     $(OBJ_DIR)/printer_capabilities.o \
     $(OBJ_DIR)/capability_overrides.o \
     $(OBJ_DIR)/command_sequencer.o \
@@ -122,6 +136,7 @@ TEST_MOONRAKER_DEPS := \
 # Configuration and utilities
 TEST_CONFIG_DEPS := \
     $(OBJ_DIR)/config.o \
+    $(OBJ_DIR)/debounced_file_writer.o \
     $(OBJ_DIR)/tips_manager.o
 
 # GCode parsing, geometry, rendering, and file modification (for gcode tests and bed mesh)
@@ -135,11 +150,13 @@ TEST_GCODE_DEPS := \
     $(OBJ_DIR)/gcode_camera.o \
     $(OBJ_DIR)/gcode_renderer.o \
     $(OBJ_DIR)/gcode_tinygl_renderer.o \
+    $(OBJ_DIR)/pixel_convert.o \
     $(OBJ_DIR)/ui_gcode_viewer.o \
     $(OBJ_DIR)/bed_mesh_coordinate_transform.o \
     $(OBJ_DIR)/bed_mesh_renderer.o \
     $(OBJ_DIR)/bed_mesh_gradient.o \
-    $(OBJ_DIR)/bed_mesh_projection.o
+    $(OBJ_DIR)/bed_mesh_projection.o \
+    $(OBJ_DIR)/bed_mesh_rasterizer.o
 
 # Platform-specific dependencies (Linux wpa_supplicant, macOS frameworks via LDFLAGS)
 TEST_PLATFORM_DEPS := $(WPA_DEPS)
@@ -151,7 +168,7 @@ TEST_PLATFORM_DEPS := $(WPA_DEPS)
 # Clean test artifacts
 clean-tests:
 	$(ECHO) "$(YELLOW)Cleaning test artifacts...$(RESET)"
-	$(Q)rm -f $(TEST_BIN) $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) $(TEST_OBJS)
+	$(Q)rm -f $(TEST_BIN) $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) $(FAKE_WPA_SUPPLICANT_OBJ) $(TEST_OBJS)
 	$(ECHO) "$(GREEN)✓ Test artifacts cleaned$(RESET)"
 
 # Build tests in parallel
@@ -391,6 +408,12 @@ $(TEST_FIXTURES_OBJ): $(TEST_DIR)/test_fixtures.cpp $(TEST_DIR)/test_fixtures.h
 	$(ECHO) "$(CYAN)[TEST-FIXTURE]$(RESET) $<"
 	$(Q)$(CXX) $(CXXFLAGS) -I$(TEST_DIR) $(INCLUDES) -c $< -o $@
 
+# Compile fake wpa_supplicant control socket (wpa_supplicant backend tests)
+$(FAKE_WPA_SUPPLICANT_OBJ): $(TEST_DIR)/fake_wpa_supplicant.cpp $(TEST_DIR)/fake_wpa_supplicant.h
+	$(Q)mkdir -p $(dir $@)
+	$(ECHO) "$(CYAN)[TEST-FIXTURE]$(RESET) $<"
+	$(Q)$(CXX) $(CXXFLAGS) -I$(TEST_DIR) $(INCLUDES) -c $< -o $@
+
 # Compile test sources
 $(OBJ_DIR)/tests/%.o: $(TEST_UNIT_DIR)/%.cpp
 	$(Q)mkdir -p $(dir $@)
@@ -450,7 +473,7 @@ test-responsive-theme: $(TEST_RESPONSIVE_THEME_BIN)
 	$(ECHO) "$(CYAN)Running responsive theme and breakpoint tests...$(RESET)"
 	$(Q)$(TEST_RESPONSIVE_THEME_BIN)
 
-$(TEST_RESPONSIVE_THEME_BIN): $(TEST_RESPONSIVE_THEME_OBJ) $(LVGL_OBJS) $(THORVG_OBJS) $(OBJ_DIR)/ui_theme.o
+$(TEST_RESPONSIVE_THEME_BIN): $(TEST_RESPONSIVE_THEME_OBJ) $(LVGL_OBJS) $(THORVG_OBJS) $(OBJ_DIR)/ui_theme.o $(OBJ_DIR)/ui_xml_bundle.o
 	$(Q)mkdir -p $(BIN_DIR)
 	$(ECHO) "$(MAGENTA)[LD]$(RESET) test_responsive_theme"
 	$(Q)$(CXX) $(CXXFLAGS) $^ -o $@ $(LDFLAGS)
@@ -601,9 +624,10 @@ test-tinygl-quality: $(TINYGL_TEST_FRAMEWORK_BIN)
 	$(Q)$(TINYGL_TEST_FRAMEWORK_BIN) banding
 	$(ECHO) "$(GREEN)✓ Quality tests complete$(RESET)"
 
-test-tinygl-performance: $(TINYGL_TEST_FRAMEWORK_BIN)
+test-tinygl-performance: $(TINYGL_TEST_FRAMEWORK_BIN) $(TEST_BIN)
 	$(ECHO) "$(CYAN)Benchmarking TinyGL performance...$(RESET)"
 	$(Q)$(TINYGL_TEST_FRAMEWORK_BIN) performance
+	$(Q)$(TEST_BIN) "[tinygl][.benchmark]"
 	$(ECHO) "$(GREEN)✓ Performance benchmarks complete$(RESET)"
 
 test-tinygl-reference: $(TINYGL_TEST_FRAMEWORK_BIN)
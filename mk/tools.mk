@@ -22,6 +22,9 @@ INSPECTOR_STUB_OBJ := $(OBJ_DIR)/tools/ui_notification_stub.o
 # Extract just the Moonraker-related objects (no LVGL, no UI, no SDL2)
 INSPECTOR_DEPS := \
 	$(OBJ_DIR)/moonraker_client.o \
+	$(OBJ_DIR)/moonraker_discovery_snapshot.o \
+	$(OBJ_DIR)/moonraker_notification_dispatch.o \
+	$(OBJ_DIR)/moonraker_request_table.o \
 	$(INSPECTOR_INTERACTIVE_OBJ) \
 	$(INSPECTOR_STUB_OBJ) \
 	$(CPP_TERMINAL_OBJS)
@@ -0,0 +1,33 @@
+# SPDX-License-Identifier: GPL-3.0-or-later
+# Precompiled XML component bundle
+#
+# scripts/compile-xml-bundle.py compiles ui_xml/*.xml into a generated C++ source that
+# embeds every component (minified, XML-defined constants inlined). With
+# ENABLE_XML_BUNDLE=yes the object is linked into helix-screen and ui_xml_register_component()
+# registers components from memory instead of reading ui_xml/ at startup.
+#
+# Enabled for embedded targets (see mk/cross.mk). Desktop builds keep loading ui_xml/ so
+# XML edits show up without a rebuild; `make xml-bundle` still validates every file.
+
+XML_BUNDLE_SCRIPT := scripts/compile-xml-bundle.py
+XML_BUNDLE_XMLS := $(wildcard ui_xml/*.xml)
+XML_BUNDLE_SRC := $(BUILD_DIR)/gen/ui_xml_bundle_data.cpp
+XML_BUNDLE_OBJ := $(OBJ_DIR)/gen/ui_xml_bundle_data.o
+
+$(XML_BUNDLE_SRC): $(XML_BUNDLE_XMLS) $(XML_BUNDLE_SCRIPT)
+	$(Q)mkdir -p $(dir $@)
+	$(ECHO) "$(CYAN)[XML]$(RESET) Compiling $(words $(XML_BUNDLE_XMLS)) components -> $@"
+	$(Q)python3 $(XML_BUNDLE_SCRIPT) --output $@ $(XML_BUNDLE_XMLS)
+
+$(XML_BUNDLE_OBJ): $(XML_BUNDLE_SRC) $(INC_DIR)/ui_xml_bundle.h
+	$(Q)mkdir -p $(dir $@)
+	$(ECHO) "$(BLUE)[CXX]$(RESET) $<"
+	$(Q)$(CXX) $(CXXFLAGS) $(INCLUDES) $(LV_CONF) -c $< -o $@
+
+ifeq ($(ENABLE_XML_BUNDLE),yes)
+    APP_OBJS += $(XML_BUNDLE_OBJ)
+endif
+
+# Generate (and validate) the bundle source without building the app
+.PHONY: xml-bundle
+xml-bundle: $(XML_BUNDLE_SRC)
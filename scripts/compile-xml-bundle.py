@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 356C LLC
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+"""
+Compile ui_xml/*.xml into a C++ source that embeds every component.
+
+The runtime registers components from the embedded strings (ui_xml_bundle.h)
+instead of opening and reading one file per component at startup. Each
+component is also made cheaper to parse, which LVGL does again on every
+lv_xml_create():
+
+  - comments, the XML declaration and indentation are dropped
+  - "#name" attribute values that refer to a constant defined in XML (the
+    component's own <consts>, then globals.xml) are replaced by the value
+
+Constants registered at runtime (theme colors, responsive spacing and fonts)
+are not defined in XML and stay as "#name". LVGL keeps the first registration
+of a constant, so the XML values inlined here are the ones LVGL would use.
+
+The parser is expat without namespace processing, the same as LVGL's, so
+attribute names like "style_arc_width:indicator" are kept verbatim.
+
+Usage:
+    python3 scripts/compile-xml-bundle.py --output build/gen/ui_xml_bundle_data.cpp ui_xml/*.xml
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.parsers.expat
+
+GLOBALS = 'globals'
+DELIMITER = 'HELIXXML'
+
+
+class Element:
+    def __init__(self, tag, attrs):
+        self.tag = tag
+        self.attrs = attrs  # list of (name, value), document order
+        self.children = []
+        self.text = ''
+
+
+def parse(path):
+    """Parse an XML file into an Element tree (comments and declaration dropped)"""
+    root = None
+    stack = []
+
+    def start(tag, attrs):
+        nonlocal root
+        element = Element(tag, list(zip(attrs[0::2], attrs[1::2])))
+        if stack:
+            stack[-1].children.append(element)
+        else:
+            root = element
+        stack.append(element)
+
+    def end(_tag):
+        stack.pop()
+
+    def data(text):
+        if stack:
+            stack[-1].text += text
+
+    parser = xml.parsers.expat.ParserCreate()
+    parser.ordered_attributes = True
+    parser.StartElementHandler = start
+    parser.EndElementHandler = end
+    parser.CharacterDataHandler = data
+    with open(path, 'rb') as f:
+        try:
+            parser.ParseFile(f)
+        except xml.parsers.expat.ExpatError as e:
+            sys.exit(f'{path}: {e}')
+    return root
+
+
+def collect_consts(root):
+    """Name -> value of the constants declared in a component's <consts>"""
+    consts = {}
+    for block in root.children:
+        if block.tag == 'consts':
+            for const in block.children:
+                attrs = dict(const.attrs)
+                if 'name' in attrs and 'value' in attrs:
+                    consts[attrs['name']] = attrs['value']
+    return consts
+
+
+def resolve(value, scopes, depth=0):
+    """Value of a "#name" reference, or None if it isn't defined in XML"""
+    if not value.startswith('#') or depth > 8:
+        return None
+    name = value[1:]
+    for scope in scopes:
+        if name in scope:
+            target = scope[name]
+            return resolve(target, scopes, depth + 1) or target
+    return None
+
+
+def inline_consts(element, scopes, counter, in_consts=False):
+    """Replace "#name" attribute values outside <consts> by their XML value"""
+    in_consts = in_consts or element.tag == 'consts'
+    if not in_consts:
+        for i, (name, value) in enumerate(element.attrs):
+            resolved = resolve(value, scopes)
+            if resolved is not None:
+                element.attrs[i] = (name, resolved)
+                counter[0] += 1
+    for child in element.children:
+        inline_consts(child, scopes, counter, in_consts)
+
+
+def escape(value, quote):
+    value = value.replace('&', '&amp;').replace('<', '&lt;').replace('>', '&gt;')
+    if quote:
+        value = value.replace('"', '&quot;').replace('\n', '&#10;').replace('\t', '&#9;')
+    return value
+
+
+def serialize(element):
+    out = '<' + element.tag
+    for name, value in element.attrs:
+        out += f' {name}="{escape(value, True)}"'
+    text = element.text.strip()
+    if not element.children and not text:
+        return out + '/>'
+    out += '>' + escape(text, False)
+    for child in element.children:
+        out += serialize(child)
+    return out + f'</{element.tag}>'
+
+
+def symbol(name):
+    return 'XML_' + re.sub(r'[^A-Za-z0-9_]', '_', name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--output', required=True, help='generated C++ source')
+    parser.add_argument('xml_files', nargs='+')
+    args = parser.parse_args()
+
+    components = {}
+    for path in args.xml_files:
+        name = os.path.splitext(os.path.basename(path))[0]
+        components[name] = (path, parse(path))
+
+    global_consts = collect_consts(components[GLOBALS][1]) if GLOBALS in components else {}
+
+    source_bytes = 0
+    bundle_bytes = 0
+    inlined = [0]
+    entries = []
+    for name in sorted(components):
+        path, root = components[name]
+        if name != GLOBALS:
+            inline_consts(root, [collect_consts(root), global_consts], inlined)
+        xml_text = serialize(root)
+        if f'){DELIMITER}"' in xml_text:
+            sys.exit(f'{path}: contains the raw string delimiter {DELIMITER}')
+        source_bytes += os.path.getsize(path)
+        bundle_bytes += len(xml_text.encode('utf-8'))
+        entries.append((name, xml_text))
+
+    lines = [
+        '// Generated by scripts/compile-xml-bundle.py from ui_xml/*.xml - do not edit',
+        '',
+        '#include "ui_xml_bundle.h"',
+        '',
+        'namespace {',
+        '',
+    ]
+    for name, xml_text in entries:
+        lines.append(f'const char {symbol(name)}[] = R"{DELIMITER}({xml_text}){DELIMITER}";')
+    lines += [
+        '',
+        '} // namespace',
+        '',
+        '// Sorted by name for binary search',
+        'const UiXmlBundleEntry UI_XML_BUNDLE[] = {',
+    ]
+    for name, _ in entries:
+        lines.append(f'    {{"{name}", {symbol(name)}, sizeof({symbol(name)}) - 1}},')
+    lines += [
+        '};',
+        '',
+        'const size_t UI_XML_BUNDLE_COUNT = sizeof(UI_XML_BUNDLE) / sizeof(UI_XML_BUNDLE[0]);',
+        '',
+    ]
+
+    os.makedirs(os.path.dirname(args.output) or '.', exist_ok=True)
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+
+    print(f'[XML] {len(entries)} components: {source_bytes / 1024:.1f} KiB -> '
+          f'{bundle_bytes / 1024:.1f} KiB, {inlined[0]} constant references inlined')
+
+
+if __name__ == '__main__':
+    main()
@@ -36,6 +36,8 @@
 
 #include "ui_modal.h"
 
+#include "config.h"
+#include "main_loop_waker.h"
 #include "moonraker_api.h"
 #include "moonraker_client.h"
 #include "printer_state.h"
@@ -43,6 +45,7 @@
 #include <spdlog/spdlog.h>
 
 #include <cerrno>
+#include <csignal>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -63,6 +66,9 @@ static lv_subject_t g_notification_subject;
 // Application quit flag
 static bool g_quit_requested = false;
 
+// Signal that asked the app to quit (0 = none); written from the signal handler
+static volatile sig_atomic_t g_quit_signal = 0;
+
 // Stored command-line arguments for restart capability
 static std::vector<char*> g_stored_argv;
 static std::string g_executable_path;
@@ -127,6 +133,7 @@ void app_store_argv(int argc, char** argv) {
 void app_request_quit() {
     spdlog::info("Application quit requested");
     g_quit_requested = true;
+    MainLoopWaker::instance().wake();
 }
 
 void app_request_restart() {
@@ -138,6 +145,9 @@ void app_request_restart() {
         return;
     }
 
+    // The new instance reads the config file: write pending settings first
+    Config::get_instance()->flush();
+
 #if defined(__unix__) || defined(__APPLE__)
     // Fork a new process
     pid_t pid = fork();
@@ -256,6 +266,9 @@ void app_request_restart_for_theme() {
     }
     spdlog::info("Restart command: {}", cmd_line);
 
+    // The new instance reads the config file: write pending settings first
+    Config::get_instance()->flush();
+
 #if defined(__unix__) || defined(__APPLE__)
     pid_t pid = fork();
 
@@ -282,6 +295,21 @@ void app_request_restart_for_theme() {
 #endif
 }
 
+static void quit_signal_handler(int sig) {
+    g_quit_signal = sig;
+    // Async-signal-safe: an atomic exchange and a write() to the wakeup descriptor
+    MainLoopWaker::instance().wake();
+}
+
+void app_install_signal_handlers() {
+    signal(SIGTERM, quit_signal_handler);
+    signal(SIGINT, quit_signal_handler);
+}
+
+int app_quit_signal() {
+    return g_quit_signal;
+}
+
 bool app_quit_requested() {
-    return g_quit_requested;
+    return g_quit_requested || g_quit_signal != 0;
 }
@@ -18,11 +18,9 @@
 
 #include "bed_mesh_projection.h"
 
-bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, double z,
-                                                         int canvas_width, int canvas_height,
-                                                         const bed_mesh_view_state_t* view) {
-    bed_mesh_point_3d_t result;
-
+bed_mesh_normalized_point_t
+bed_mesh_projection_project_normalized(double x, double y, double z,
+                                       const bed_mesh_view_state_t* view) {
     // Step 1: Z-axis rotation (spin around vertical axis)
     // Use cached trig values (computed once per frame instead of per-vertex)
     double rotated_x = x * view->cached_cos_z - y * view->cached_sin_z;
@@ -38,19 +36,42 @@ bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, dou
     // Step 3: Translate camera back
     final_z += BED_MESH_CAMERA_DISTANCE;
 
-    // Step 4: Perspective projection (similar triangles)
-    double perspective_x = (final_x * view->fov_scale) / final_z;
-    double perspective_y = (final_y * view->fov_scale) / final_z;
+    // Step 4: Perspective divide (similar triangles); FOV scale is applied at screen mapping
+    bed_mesh_normalized_point_t result;
+    result.x = final_x / final_z;
+    result.y = final_y / final_z;
+    result.depth = final_z;
+    return result;
+}
+
+void bed_mesh_projection_normalized_to_screen(const bed_mesh_normalized_point_t* point,
+                                              int canvas_width, int canvas_height,
+                                              const bed_mesh_view_state_t* view, int* out_screen_x,
+                                              int* out_screen_y) {
+    double perspective_x = point->x * view->fov_scale;
+    double perspective_y = point->y * view->fov_scale;
 
-    // Step 5: Convert to screen coordinates (centered in canvas, then offset to layer position)
+    // Convert to screen coordinates (centered in canvas, then offset to layer position)
     // center_offset_x/y = canvas-relative centering adjustment
     // layer_offset_x/y = layer position on screen (updated every frame for animations)
-    result.screen_x = static_cast<int>(canvas_width / 2 + perspective_x) + view->center_offset_x +
-                      view->layer_offset_x;
-    result.screen_y =
+    *out_screen_x = static_cast<int>(canvas_width / 2 + perspective_x) + view->center_offset_x +
+                    view->layer_offset_x;
+    *out_screen_y =
         static_cast<int>(canvas_height * BED_MESH_Z_ORIGIN_VERTICAL_POS + perspective_y) +
         view->center_offset_y + view->layer_offset_y;
-    result.depth = final_z;
+}
+
+bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, double z,
+                                                         int canvas_width, int canvas_height,
+                                                         const bed_mesh_view_state_t* view) {
+    bed_mesh_normalized_point_t normalized = bed_mesh_projection_project_normalized(x, y, z, view);
 
+    bed_mesh_point_3d_t result;
+    result.x = x;
+    result.y = y;
+    result.z = z;
+    bed_mesh_projection_normalized_to_screen(&normalized, canvas_width, canvas_height, view,
+                                             &result.screen_x, &result.screen_y);
+    result.depth = normalized.depth;
     return result;
 }
@@ -0,0 +1,184 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bed_mesh_rasterizer.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace {
+
+// Color channels are stepped across a span in 16.16 fixed point
+constexpr int FIXED_SHIFT = 16;
+constexpr float FIXED_ONE = static_cast<float>(1 << FIXED_SHIFT);
+
+inline int32_t to_fixed(float value) {
+    return static_cast<int32_t>(value * FIXED_ONE + (value < 0.0f ? -0.5f : 0.5f));
+}
+
+inline uint32_t fixed_to_channel(int32_t fixed) {
+    int32_t value = (fixed + (1 << (FIXED_SHIFT - 1))) >> FIXED_SHIFT;
+    return static_cast<uint32_t>(std::clamp(value, 0, 255));
+}
+
+inline uint32_t blend_channel(uint32_t src, uint32_t dst, uint32_t opa) {
+    return (src * opa + dst * (255 - opa) + 127) / 255;
+}
+
+/**
+ * First pixel column at or right of an edge on scanline y: ceil(x at y)
+ *
+ * Evaluated exactly in integers from the edge's upper vertex, so two triangles that
+ * share an edge agree on every scanline (no gaps, no double coverage).
+ */
+inline int edge_ceil_x(const bed_mesh_raster_vertex_t& top, const bed_mesh_raster_vertex_t& bottom,
+                       int y) {
+    int64_t num = static_cast<int64_t>(y - top.y) * (bottom.x - top.x);
+    int64_t den = bottom.y - top.y; // > 0: horizontal edges are never walked
+    int64_t step = num >= 0 ? (num + den - 1) / den : -((-num) / den);
+    return top.x + static_cast<int>(step);
+}
+
+} // anonymous namespace
+
+int bed_mesh_raster_scale_coord(int screen, int origin, int scale) {
+    int offset = screen - origin;
+    int q = offset / scale;
+    return (offset % scale < 0) ? q - 1 : q;
+}
+
+int bed_mesh_raster_preview_scale(int current_scale, bool preview_active, double last_frame_ms) {
+    if (!preview_active) {
+        return BED_MESH_PREVIEW_MIN_SCALE;
+    }
+    if (last_frame_ms > BED_MESH_PREVIEW_BUDGET_MS && current_scale < BED_MESH_PREVIEW_MAX_SCALE) {
+        return current_scale * 2;
+    }
+    if (last_frame_ms < BED_MESH_PREVIEW_BUDGET_MS * BED_MESH_PREVIEW_HEADROOM_RATIO &&
+        current_scale > BED_MESH_PREVIEW_MIN_SCALE) {
+        return current_scale / 2;
+    }
+    return current_scale;
+}
+
+void bed_mesh_raster_clear(const bed_mesh_raster_target_t* target, uint32_t color) {
+    if (!target || !target->pixels) {
+        return;
+    }
+
+    const uint32_t pixel = 0xFF000000u | color;
+    for (int y = 0; y < target->height; y++) {
+        uint32_t* row = target->pixels + static_cast<size_t>(y) * target->stride;
+        std::fill(row, row + target->width, pixel);
+    }
+
+    if (target->depth) {
+        std::fill(target->depth,
+                  target->depth + static_cast<size_t>(target->width) * target->height,
+                  std::numeric_limits<float>::infinity());
+    }
+}
+
+size_t bed_mesh_raster_triangle(const bed_mesh_raster_target_t* target,
+                                const bed_mesh_raster_vertex_t& v0,
+                                const bed_mesh_raster_vertex_t& v1,
+                                const bed_mesh_raster_vertex_t& v2, uint8_t opacity) {
+    if (!target || !target->pixels || opacity == 0) {
+        return 0;
+    }
+
+    // Sort vertices top to bottom
+    const bed_mesh_raster_vertex_t* a = &v0;
+    const bed_mesh_raster_vertex_t* b = &v1;
+    const bed_mesh_raster_vertex_t* c = &v2;
+    if (a->y > b->y)
+        std::swap(a, b);
+    if (b->y > c->y)
+        std::swap(b, c);
+    if (a->y > b->y)
+        std::swap(a, b);
+
+    // Skip degenerate triangles (zero height or collinear)
+    const float e1x = static_cast<float>(b->x - a->x);
+    const float e1y = static_cast<float>(b->y - a->y);
+    const float e2x = static_cast<float>(c->x - a->x);
+    const float e2y = static_cast<float>(c->y - a->y);
+    const float area = e1x * e2y - e2x * e1y;
+    if (a->y == c->y || area == 0.0f) {
+        return 0;
+    }
+
+    // Attributes are planar over the triangle: f(x, y) = f(a) + ddx * (x - ax) + ddy * (y - ay)
+    const float inv_area = 1.0f / area;
+    auto gradient = [&](float fa, float fb, float fc, float* ddx, float* ddy) {
+        float d1 = fb - fa;
+        float d2 = fc - fa;
+        *ddx = (d1 * e2y - d2 * e1y) * inv_area;
+        *ddy = (d2 * e1x - d1 * e2x) * inv_area;
+    };
+    float r_dx, r_dy, g_dx, g_dy, b_dx, b_dy, z_dx, z_dy;
+    gradient(a->r, b->r, c->r, &r_dx, &r_dy);
+    gradient(a->g, b->g, c->g, &g_dx, &g_dy);
+    gradient(a->b, b->b, c->b, &b_dx, &b_dy);
+    gradient(a->depth, b->depth, c->depth, &z_dx, &z_dy);
+
+    const int32_t r_step = to_fixed(r_dx);
+    const int32_t g_step = to_fixed(g_dx);
+    const int32_t b_step = to_fixed(b_dx);
+    const uint32_t opa = opacity;
+    size_t written = 0;
+
+    // Scanlines [a.y, c.y): bottom edge exclusive, clipped to the target
+    const int y_start = std::max(a->y, 0);
+    const int y_end = std::min(c->y, target->height);
+    for (int y = y_start; y < y_end; y++) {
+        int x_long = edge_ceil_x(*a, *c, y);
+        int x_short = (y < b->y) ? edge_ceil_x(*a, *b, y) : edge_ceil_x(*b, *c, y);
+
+        // Pixels [ceil(left), ceil(right)): left edge inclusive, right edge exclusive
+        int x_start = std::max(std::min(x_long, x_short), 0);
+        int x_end = std::min(std::max(x_long, x_short), target->width);
+        if (x_start >= x_end) {
+            continue;
+        }
+
+        const float dx = static_cast<float>(x_start - a->x);
+        const float dy = static_cast<float>(y - a->y);
+        int32_t r = to_fixed(a->r + r_dx * dx + r_dy * dy);
+        int32_t g = to_fixed(a->g + g_dx * dx + g_dy * dy);
+        int32_t bl = to_fixed(a->b + b_dx * dx + b_dy * dy);
+        float z = a->depth + z_dx * dx + z_dy * dy;
+
+        uint32_t* row = target->pixels + static_cast<size_t>(y) * target->stride;
+        float* depth_row =
+            target->depth ? target->depth + static_cast<size_t>(y) * target->width : nullptr;
+
+        for (int x = x_start; x < x_end; x++) {
+            if (!depth_row || z < depth_row[x]) {
+                if (depth_row) {
+                    depth_row[x] = z;
+                }
+
+                uint32_t sr = fixed_to_channel(r);
+                uint32_t sg = fixed_to_channel(g);
+                uint32_t sb = fixed_to_channel(bl);
+                if (opa != 255) {
+                    uint32_t dst = row[x];
+                    sr = blend_channel(sr, (dst >> 16) & 0xFF, opa);
+                    sg = blend_channel(sg, (dst >> 8) & 0xFF, opa);
+                    sb = blend_channel(sb, dst & 0xFF, opa);
+                }
+                row[x] = 0xFF000000u | (sr << 16) | (sg << 8) | sb;
+                written++;
+            }
+
+            r += r_step;
+            g += g_step;
+            bl += b_step;
+            z += z_dx;
+        }
+    }
+
+    return written;
+}
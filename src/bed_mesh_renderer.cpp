@@ -28,6 +28,8 @@
 #include "bed_mesh_coordinate_transform.h"
 #include "bed_mesh_gradient.h"
 #include "bed_mesh_projection.h"
+#include "bed_mesh_rasterizer.h"
+#include "image_cache.h"
 
 #include <spdlog/spdlog.h>
 
@@ -37,7 +39,10 @@
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <mutex>
+#include <numeric>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -85,6 +90,14 @@ constexpr double GRADIENT_SEGMENT_SAMPLE_POSITION =
 
 } // anonymous namespace
 
+/**
+ * @brief Offscreen XRGB8888 surface for software rasterization
+ */
+struct RasterSurface {
+    lv_draw_buf_t* buf = nullptr;
+    std::vector<float> depth; // Per-pixel camera depth (empty when depth testing is off)
+};
+
 // ============================================================================
 // Renderer State Machine
 // ============================================================================
@@ -134,7 +147,32 @@ struct bed_mesh_renderer {
     bed_mesh_view_state_t view_state;
 
     // Computed rendering state
-    std::vector<bed_mesh_quad_3d_t> quads; // Generated geometry
+    std::vector<bed_mesh_quad_3d_t> quads; // Generated geometry, row-major by mesh cell
+    uint64_t mesh_generation;              // Bumped when mesh heights change
+    uint64_t quads_generation;             // Bumped when quads are regenerated
+
+    // Painter's algorithm order (indices into quads, furthest first)
+    std::vector<uint32_t> draw_order;
+    bool draw_order_valid; // False after re-projection until re-sorted
+
+    // Per-vertex projection for the current rotation and z-scale (see update_projection_cache)
+    struct {
+        bool valid;
+        double angle_x, angle_z, z_scale;
+        uint64_t mesh_generation;
+        std::vector<bed_mesh_normalized_point_t> vertices; // [row * cols + col]
+        double min_x, max_x, min_y, max_y;                // Normalized bounds of all vertices
+    } projection;
+
+    // Canvas fit of the cached projection (see update_screen_fit)
+    struct {
+        bool valid;
+        int canvas_width, canvas_height;
+        int layer_offset_x, layer_offset_y;
+        int center_offset_x, center_offset_y;
+        uint64_t quads_generation;
+        double fov_scale;
+    } screen_fit;
 
     // Cached projected screen coordinates (SOA layout for better cache efficiency)
     // Only stores screen_x/screen_y - no unused fields (world x/y/z, depth)
@@ -142,18 +180,27 @@ struct bed_mesh_renderer {
     // Memory savings: 80% reduction (16 KB → 3.2 KB for 20×20 mesh)
     std::vector<std::vector<int>> projected_screen_x; // [row][col] → screen X coordinate
     std::vector<std::vector<int>> projected_screen_y; // [row][col] → screen Y coordinate
+
+    // Software rasterization (BED_MESH_RENDER_MODE_SOFTWARE)
+    bed_mesh_render_mode_t render_mode;
+    bool use_depth_buffer;
+    RasterSurface surface; // Full resolution, composited with one lv_draw_image
+
+    // Interactive drag preview (software mode only)
+    RasterSurface preview_surface; // Reduced resolution, upscaled on blit
+    int preview_scale;             // Current downscale factor while dragging
+    bool preview_active;           // Previous frame was a drag preview
+    double last_render_ms;         // CPU time of the previous frame (frame budget input)
 };
 
 // Helper functions (forward declarations)
 static void compute_mesh_bounds(bed_mesh_renderer_t* renderer);
 static double compute_dynamic_z_scale(double z_range);
 static void update_trig_cache(bed_mesh_view_state_t* view_state);
-static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas_width,
-                                       int canvas_height);
-static void project_and_cache_quads(bed_mesh_renderer_t* renderer, int canvas_width,
-                                    int canvas_height);
-static void compute_projected_mesh_bounds(const bed_mesh_renderer_t* renderer, int* out_min_x,
-                                          int* out_max_x, int* out_min_y, int* out_max_y);
+static void update_dynamic_z_scale(bed_mesh_renderer_t* renderer);
+static bool update_projection_cache(bed_mesh_renderer_t* renderer);
+static bool update_screen_fit(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
+                              bool reprojected);
 static void compute_centering_offset(int mesh_min_x, int mesh_max_x, int mesh_min_y, int mesh_max_y,
                                      int layer_offset_x, int layer_offset_y, int canvas_width,
                                      int canvas_height, int* out_offset_x, int* out_offset_y);
@@ -163,9 +210,17 @@ static void fill_triangle_gradient(lv_layer_t* layer, int x1, int y1, lv_color_t
                                    lv_color_t c2, int x3, int y3, lv_color_t c3, int canvas_width,
                                    int canvas_height);
 static void generate_mesh_quads(bed_mesh_renderer_t* renderer);
-static void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads);
+static void update_draw_order(bed_mesh_renderer_t* renderer);
+static void sort_quads_by_depth(const std::vector<bed_mesh_quad_3d_t>& quads,
+                                std::vector<uint32_t>& order);
 static void render_quad(lv_layer_t* layer, const bed_mesh_quad_3d_t& quad, int canvas_width,
                         int canvas_height, const bed_mesh_view_state_t* view, bool use_gradient);
+static bool ensure_surface(RasterSurface* surface, int width, int height, bool with_depth);
+static void release_surface(RasterSurface* surface);
+static int select_preview_scale(bed_mesh_renderer_t* renderer);
+static size_t rasterize_quads_software(lv_layer_t* layer, bed_mesh_renderer_t* renderer,
+                                       RasterSurface* surface, int scale,
+                                       const lv_area_t* clip_area, bool use_gradient);
 static void render_grid_lines(lv_layer_t* layer, const bed_mesh_renderer_t* renderer,
                               int canvas_width, int canvas_height);
 static void render_axis_labels(lv_layer_t* layer, const bed_mesh_renderer_t* renderer,
@@ -328,6 +383,11 @@ bed_mesh_renderer_t* bed_mesh_renderer_create(void) {
     renderer->mesh_min_z = 0.0;
     renderer->mesh_max_z = 0.0;
     renderer->has_mesh_data = false;
+    renderer->mesh_generation = 0;
+    renderer->quads_generation = 0;
+    renderer->draw_order_valid = false;
+    renderer->projection.valid = false;
+    renderer->screen_fit.valid = false;
 
     renderer->auto_color_range = true;
     renderer->color_min_z = 0.0;
@@ -355,7 +415,19 @@ bed_mesh_renderer_t* bed_mesh_renderer_create(void) {
     renderer->view_state.layer_offset_x = 0;
     renderer->view_state.layer_offset_y = 0;
 
-    spdlog::debug("Created bed mesh renderer");
+    // Software rasterizer by default; HELIX_BED_MESH_RENDERER=lvgl selects the span renderer
+    renderer->render_mode = BED_MESH_RENDER_MODE_SOFTWARE;
+    renderer->use_depth_buffer = true;
+    renderer->preview_scale = BED_MESH_PREVIEW_MIN_SCALE;
+    renderer->preview_active = false;
+    renderer->last_render_ms = 0.0;
+    const char* mode_env = std::getenv("HELIX_BED_MESH_RENDERER");
+    if (mode_env && std::strcmp(mode_env, "lvgl") == 0) {
+        renderer->render_mode = BED_MESH_RENDER_MODE_LVGL;
+    }
+
+    spdlog::debug("Created bed mesh renderer (mode={})",
+                  renderer->render_mode == BED_MESH_RENDER_MODE_SOFTWARE ? "software" : "lvgl");
     return renderer;
 }
 
@@ -365,6 +437,8 @@ void bed_mesh_renderer_destroy(bed_mesh_renderer_t* renderer) {
     }
 
     spdlog::debug("Destroying bed mesh renderer");
+    release_surface(&renderer->surface);
+    release_surface(&renderer->preview_surface);
     delete renderer;
 }
 
@@ -396,6 +470,7 @@ bool bed_mesh_renderer_set_mesh_data(bed_mesh_renderer_t* renderer, const float*
     renderer->rows = rows;
     renderer->cols = cols;
     renderer->has_mesh_data = true;
+    renderer->mesh_generation++;
 
     // Compute bounds
     compute_mesh_bounds(renderer);
@@ -461,6 +536,35 @@ void bed_mesh_renderer_set_dragging(bed_mesh_renderer_t* renderer, bool is_dragg
     renderer->view_state.is_dragging = is_dragging;
 }
 
+void bed_mesh_renderer_set_render_mode(bed_mesh_renderer_t* renderer,
+                                       bed_mesh_render_mode_t mode) {
+    if (!renderer) {
+        return;
+    }
+    renderer->render_mode = mode;
+
+    // Release the private surfaces when switching back to span rendering
+    if (mode != BED_MESH_RENDER_MODE_SOFTWARE) {
+        release_surface(&renderer->surface);
+        release_surface(&renderer->preview_surface);
+    }
+}
+
+bed_mesh_render_mode_t bed_mesh_renderer_get_render_mode(const bed_mesh_renderer_t* renderer) {
+    return renderer ? renderer->render_mode : BED_MESH_RENDER_MODE_LVGL;
+}
+
+void bed_mesh_renderer_set_depth_buffer(bed_mesh_renderer_t* renderer, bool enabled) {
+    if (!renderer) {
+        return;
+    }
+    renderer->use_depth_buffer = enabled;
+    if (!enabled) {
+        std::vector<float>().swap(renderer->surface.depth);
+        std::vector<float>().swap(renderer->preview_surface.depth);
+    }
+}
+
 void bed_mesh_renderer_set_z_scale(bed_mesh_renderer_t* renderer, double z_scale) {
     if (!renderer) {
         return;
@@ -604,112 +708,89 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
     canvas_width = actual_width;
     canvas_height = actual_height;
 
-    lv_draw_rect_dsc_t bg_dsc;
-    lv_draw_rect_dsc_init(&bg_dsc);
-    bg_dsc.bg_color = CANVAS_BG_COLOR;
-    bg_dsc.bg_opa = LV_OPA_COVER;
-    bg_dsc.border_width = 0;
-    lv_draw_rect(layer, &bg_dsc, clip_area);
-
-    // Compute dynamic Z scale if needed
-    double z_range = renderer->mesh_max_z - renderer->mesh_min_z;
-    double new_z_scale;
-    if (z_range < 1e-6) {
-        // Flat mesh, use default scale
-        new_z_scale = BED_MESH_DEFAULT_Z_SCALE;
-    } else {
-        // Compute dynamic scale to fit mesh in reasonable height
-        new_z_scale = compute_dynamic_z_scale(z_range);
+    // Software mode clears the background into its own surface; fall back to span
+    // rendering if that surface cannot be allocated. While dragging, a reduced-resolution
+    // preview surface is used instead (scale chosen from the previous frame's cost).
+    const bool dragging = renderer->view_state.is_dragging;
+    int preview_scale = 1;
+    RasterSurface* surface = nullptr;
+    if (renderer->render_mode == BED_MESH_RENDER_MODE_SOFTWARE) {
+        if (dragging) {
+            preview_scale = select_preview_scale(renderer);
+            int preview_width = (canvas_width + preview_scale - 1) / preview_scale;
+            int preview_height = (canvas_height + preview_scale - 1) / preview_scale;
+            if (ensure_surface(&renderer->preview_surface, preview_width, preview_height,
+                               renderer->use_depth_buffer)) {
+                surface = &renderer->preview_surface;
+            }
+        }
+        if (!surface) {
+            preview_scale = 1;
+            if (ensure_surface(&renderer->surface, canvas_width, canvas_height,
+                               renderer->use_depth_buffer)) {
+                surface = &renderer->surface;
+            }
+        }
     }
+    renderer->preview_active = dragging && preview_scale > 1;
+    bool software = surface != nullptr;
+    bool depth_tested = software && renderer->use_depth_buffer;
 
-    // Only regenerate quads if z_scale changed
-    if (renderer->view_state.z_scale != new_z_scale) {
-        renderer->view_state.z_scale = new_z_scale;
-        generate_mesh_quads(renderer);
-        spdlog::debug("Regenerated quads due to dynamic z_scale change to {:.2f}", new_z_scale);
+    if (!software) {
+        lv_draw_rect_dsc_t bg_dsc;
+        lv_draw_rect_dsc_init(&bg_dsc);
+        bg_dsc.bg_color = CANVAS_BG_COLOR;
+        bg_dsc.bg_opa = LV_OPA_COVER;
+        bg_dsc.border_width = 0;
+        lv_draw_rect(layer, &bg_dsc, clip_area);
     }
 
-    // Initial FOV scale estimate
-    renderer->view_state.fov_scale = DEFAULT_FOV_SCALE;
+    update_dynamic_z_scale(renderer);
+
+    // PERF: Track rendering pipeline timings
+    auto t_start = std::chrono::high_resolution_clock::now();
 
     // Update cached trigonometric values (avoids recomputing sin/cos for every vertex)
     update_trig_cache(&renderer->view_state);
 
-    // Project all mesh vertices with initial scale to get actual bounds
-    project_and_cache_vertices(renderer, canvas_width, canvas_height);
-
-    // Compute actual projected bounds using helper function
-    int min_x, max_x, min_y, max_y;
-    compute_projected_mesh_bounds(renderer, &min_x, &max_x, &min_y, &max_y);
-
-    // Calculate scale needed to fit projected bounds into canvas
-    int projected_width = max_x - min_x;
-    int projected_height = max_y - min_y;
-    double scale_x = (canvas_width * CANVAS_PADDING_FACTOR) / projected_width;
-    double scale_y = (canvas_height * CANVAS_PADDING_FACTOR) / projected_height;
-    double scale_factor = std::min(scale_x, scale_y);
-
-    // Apply scale and re-project
-    renderer->view_state.fov_scale *= scale_factor;
-    project_and_cache_vertices(renderer, canvas_width, canvas_height);
-
-    // Center mesh once on first render (offsets start at 0 from initialization)
-    // After initial centering, offset remains stable across rotations
-    if (renderer->view_state.center_offset_x == 0 && renderer->view_state.center_offset_y == 0) {
-        // Compute bounds with current projection
-        int inner_min_x, inner_max_x, inner_min_y, inner_max_y;
-        compute_projected_mesh_bounds(renderer, &inner_min_x, &inner_max_x, &inner_min_y,
-                                      &inner_max_y);
-
-        // Calculate centering offset using helper function
-        compute_centering_offset(inner_min_x, inner_max_x, inner_min_y, inner_max_y, layer_offset_x,
-                                 layer_offset_y, canvas_width, canvas_height,
-                                 &renderer->view_state.center_offset_x,
-                                 &renderer->view_state.center_offset_y);
-
-        // Re-project with the centering offset applied
-        project_and_cache_vertices(renderer, canvas_width, canvas_height);
-    }
-
-    // Quads are now pre-generated in set_mesh_data() - no need to regenerate every frame!
-    // Just project vertices and update cached screen coordinates
-
     // Apply layer offset for final rendering (updated every frame for animation support)
     renderer->view_state.layer_offset_x = layer_offset_x;
     renderer->view_state.layer_offset_y = layer_offset_y;
 
-    // PERF: Track rendering pipeline timings
-    auto t_start = std::chrono::high_resolution_clock::now();
-
-    // Project all quad vertices once and cache screen coordinates + depths
-    // This replaces 3 separate projection passes (depth calc, bounds tracking, rendering)
-    project_and_cache_quads(renderer, canvas_width, canvas_height);
+    // Project each mesh vertex once per view change, then fit/offset analytically.
+    // Redraws with unchanged rotation, z-scale, canvas and offsets skip both passes.
+    bool reprojected = update_projection_cache(renderer);
+    bool refitted = update_screen_fit(renderer, canvas_width, canvas_height, reprojected);
     auto t_project = std::chrono::high_resolution_clock::now();
 
-    // Sort quads by depth using cached avg_depth (painter's algorithm - furthest first)
-    sort_quads_by_depth(renderer->quads);
+    // Painter's algorithm order (furthest first). The depth buffer resolves visibility
+    // per pixel, so submission order doesn't matter there
+    if (!depth_tested) {
+        update_draw_order(renderer);
+    }
     auto t_sort = std::chrono::high_resolution_clock::now();
 
     spdlog::trace("Rendering {} quads with {} mode", renderer->quads.size(),
                   renderer->view_state.is_dragging ? "solid" : "gradient");
 
     // DEBUG: Track overall gradient quad bounds using cached coordinates
-    int quad_min_x = INT_MAX, quad_max_x = INT_MIN;
-    int quad_min_y = INT_MAX, quad_max_y = INT_MIN;
-    for (const auto& quad : renderer->quads) {
-        for (int i = 0; i < 4; i++) {
-            quad_min_x = std::min(quad_min_x, quad.screen_x[i]);
-            quad_max_x = std::max(quad_max_x, quad.screen_x[i]);
-            quad_min_y = std::min(quad_min_y, quad.screen_y[i]);
-            quad_max_y = std::max(quad_max_y, quad.screen_y[i]);
+    if (spdlog::should_log(spdlog::level::trace) && !renderer->quads.empty()) {
+        int quad_min_x = INT_MAX, quad_max_x = INT_MIN;
+        int quad_min_y = INT_MAX, quad_max_y = INT_MIN;
+        for (const auto& quad : renderer->quads) {
+            for (int i = 0; i < 4; i++) {
+                quad_min_x = std::min(quad_min_x, quad.screen_x[i]);
+                quad_max_x = std::max(quad_max_x, quad.screen_x[i]);
+                quad_min_y = std::min(quad_min_y, quad.screen_y[i]);
+                quad_max_y = std::max(quad_max_y, quad.screen_y[i]);
+            }
         }
-    }
-    spdlog::trace("[GRADIENT_OVERALL] All quads bounds: x=[{},{}] y=[{},{}] quads={} canvas={}x{}",
-                  quad_min_x, quad_max_x, quad_min_y, quad_max_y, renderer->quads.size(),
-                  canvas_width, canvas_height);
+        spdlog::trace(
+            "[GRADIENT_OVERALL] All quads bounds: x=[{},{}] y=[{},{}] quads={} canvas={}x{}",
+            quad_min_x, quad_max_x, quad_min_y, quad_max_y, renderer->quads.size(), canvas_width,
+            canvas_height);
 
-    // DEBUG: Log first quad vertex positions using cached coordinates
-    if (!renderer->quads.empty()) {
+        // DEBUG: Log first quad vertex positions using cached coordinates
         const auto& first_quad = renderer->quads[0];
         spdlog::trace("[FIRST_QUAD] Vertices (world -> cached screen):");
         for (int i = 0; i < 4; i++) {
@@ -719,21 +800,32 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
         }
     }
 
-    // Render quads using cached screen coordinates
-    bool use_gradient = !renderer->view_state.is_dragging;
-    for (const auto& quad : renderer->quads) {
-        render_quad(layer, quad, canvas_width, canvas_height, &renderer->view_state, use_gradient);
+    // Render quads using cached screen coordinates. Span rendering drops to solid colors
+    // while dragging; per-pixel shading costs the same either way, so software keeps it.
+    bool use_gradient = software || !dragging;
+    size_t pixels_filled = 0;
+    if (software) {
+        pixels_filled = rasterize_quads_software(layer, renderer, surface, preview_scale,
+                                                 clip_area, use_gradient);
+    } else {
+        for (uint32_t index : renderer->draw_order) {
+            render_quad(layer, renderer->quads[index], canvas_width, canvas_height,
+                        &renderer->view_state, use_gradient);
+        }
     }
     auto t_rasterize = std::chrono::high_resolution_clock::now();
 
     // Render wireframe grid on top
     render_grid_lines(layer, renderer, canvas_width, canvas_height);
 
-    // Render axis labels
-    render_axis_labels(layer, renderer, canvas_width, canvas_height);
+    // Label and tick layout is skipped while dragging; the release frame restores it
+    if (!dragging) {
+        // Render axis labels
+        render_axis_labels(layer, renderer, canvas_width, canvas_height);
 
-    // Render numeric tick labels on axes
-    render_numeric_axis_ticks(layer, renderer, canvas_width, canvas_height);
+        // Render numeric tick labels on axes
+        render_numeric_axis_ticks(layer, renderer, canvas_width, canvas_height);
+    }
     auto t_overlays = std::chrono::high_resolution_clock::now();
 
     // PERF: Log performance breakdown (use -vvv to see)
@@ -742,13 +834,18 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
     auto ms_rasterize = std::chrono::duration<double, std::milli>(t_rasterize - t_sort).count();
     auto ms_overlays = std::chrono::duration<double, std::milli>(t_overlays - t_rasterize).count();
     auto ms_total = std::chrono::duration<double, std::milli>(t_overlays - t_start).count();
+    renderer->last_render_ms = ms_total;
 
     spdlog::trace(
         "[PERF] Render: {:.2f}ms total | Proj: {:.2f}ms ({:.0f}%) | Sort: {:.2f}ms ({:.0f}%) | "
-        "Raster: {:.2f}ms ({:.0f}%) | Overlays: {:.2f}ms ({:.0f}%) | Mode: {}",
+        "Raster: {:.2f}ms ({:.0f}%) | Overlays: {:.2f}ms ({:.0f}%) | Mode: {} | Backend: {}{} | "
+        "Projection: {} | Scale: 1/{}",
         ms_total, ms_project, 100.0 * ms_project / ms_total, ms_sort, 100.0 * ms_sort / ms_total,
         ms_rasterize, 100.0 * ms_rasterize / ms_total, ms_overlays, 100.0 * ms_overlays / ms_total,
-        use_gradient ? "gradient" : "solid");
+        use_gradient ? "gradient" : "solid",
+        software ? (depth_tested ? "software+zbuf" : "software") : "lvgl spans",
+        software ? fmt::format(" ({} px)", pixels_filled) : std::string(),
+        reprojected ? "projected" : (refitted ? "refit" : "cached"), preview_scale);
 
     // Output canvas dimensions and view coordinates
     spdlog::trace(
@@ -765,6 +862,45 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
     return true;
 }
 
+bool bed_mesh_renderer_prepare(bed_mesh_renderer_t* renderer, int canvas_width,
+                               int canvas_height) {
+    if (!renderer || !renderer->has_mesh_data || renderer->state == RendererState::ERROR ||
+        canvas_width <= 0 || canvas_height <= 0) {
+        spdlog::warn("Cannot prepare bed mesh geometry for {}x{} canvas", canvas_width,
+                     canvas_height);
+        return false;
+    }
+
+    update_dynamic_z_scale(renderer);
+    update_trig_cache(&renderer->view_state);
+    bool reprojected = update_projection_cache(renderer);
+    update_screen_fit(renderer, canvas_width, canvas_height, reprojected);
+    update_draw_order(renderer);
+
+    if (renderer->state == RendererState::MESH_LOADED) {
+        renderer->state = RendererState::READY_TO_RENDER;
+    }
+    return true;
+}
+
+const bed_mesh_quad_3d_t* bed_mesh_renderer_get_quads(const bed_mesh_renderer_t* renderer,
+                                                      size_t* count) {
+    if (!renderer || !count) {
+        return nullptr;
+    }
+    *count = renderer->quads.size();
+    return renderer->quads.data();
+}
+
+const uint32_t* bed_mesh_renderer_get_draw_order(const bed_mesh_renderer_t* renderer,
+                                                 size_t* count) {
+    if (!renderer || !count) {
+        return nullptr;
+    }
+    *count = renderer->draw_order.size();
+    return renderer->draw_order.data();
+}
+
 // Helper function implementations
 
 static void compute_mesh_bounds(bed_mesh_renderer_t* renderer) {
@@ -799,6 +935,31 @@ static double compute_dynamic_z_scale(double z_range) {
     return z_scale;
 }
 
+/**
+ * @brief Pick the z-scale for the current mesh and regenerate quads if it changed
+ *
+ * Flat meshes use BED_MESH_DEFAULT_Z_SCALE; otherwise the scale comes from
+ * compute_dynamic_z_scale().
+ */
+static void update_dynamic_z_scale(bed_mesh_renderer_t* renderer) {
+    double z_range = renderer->mesh_max_z - renderer->mesh_min_z;
+    double new_z_scale;
+    if (z_range < 1e-6) {
+        // Flat mesh, use default scale
+        new_z_scale = BED_MESH_DEFAULT_Z_SCALE;
+    } else {
+        // Compute dynamic scale to fit mesh in reasonable height
+        new_z_scale = compute_dynamic_z_scale(z_range);
+    }
+
+    // Only regenerate quads if z_scale changed
+    if (renderer->view_state.z_scale != new_z_scale) {
+        renderer->view_state.z_scale = new_z_scale;
+        generate_mesh_quads(renderer);
+        spdlog::debug("Regenerated quads due to dynamic z_scale change to {:.2f}", new_z_scale);
+    }
+}
+
 /**
  * Update cached trigonometric values when angles change
  * Call this once per frame before projection loop to eliminate redundant trig computations
@@ -816,139 +977,186 @@ static inline void update_trig_cache(bed_mesh_view_state_t* view_state) {
 }
 
 /**
- * Project all mesh vertices to screen space and cache for reuse
- * Avoids redundant projections in grid/axis rendering (15-20% speedup)
+ * @brief Project every mesh vertex once for the current rotation and z-scale
+ *
+ * Stores FOV- and offset-independent coordinates (bed_mesh_normalized_point_t) plus their
+ * bounds, so fitting to the canvas and following layer movement are cheap affine passes in
+ * update_screen_fit(). Does nothing when rotation, z-scale and mesh heights are unchanged
+ * since the last call (color range changes do not affect the projection).
+ *
+ * Requires update_trig_cache() to have been called for the current angles.
+ *
  * @param renderer Renderer with mesh data
- * @param canvas_width Canvas width in pixels
- * @param canvas_height Canvas height in pixels
+ * @return true if vertices were re-projected
  */
-static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas_width,
-                                       int canvas_height) {
-    if (!renderer || !renderer->has_mesh_data) {
-        return;
+static bool update_projection_cache(bed_mesh_renderer_t* renderer) {
+    auto& cache = renderer->projection;
+    const bed_mesh_view_state_t& view = renderer->view_state;
+    if (cache.valid && cache.angle_x == view.angle_x && cache.angle_z == view.angle_z &&
+        cache.z_scale == view.z_scale && cache.mesh_generation == renderer->mesh_generation) {
+        return false;
     }
 
-    // Resize SOA caches if needed (avoid reallocation on every frame)
-    if (renderer->projected_screen_x.size() != static_cast<size_t>(renderer->rows)) {
-        renderer->projected_screen_x.resize(static_cast<size_t>(renderer->rows));
-        renderer->projected_screen_y.resize(static_cast<size_t>(renderer->rows));
-    }
+    const size_t cols = static_cast<size_t>(renderer->cols);
+    cache.vertices.resize(static_cast<size_t>(renderer->rows) * cols);
+    cache.min_x = cache.min_y = std::numeric_limits<double>::max();
+    cache.max_x = cache.max_y = std::numeric_limits<double>::lowest();
 
     // Center mesh Z values (single source of truth via coordinate transform helper)
     double z_center = compute_mesh_z_center(renderer->mesh_min_z, renderer->mesh_max_z);
 
-    // Project all vertices once (projection handles centering internally)
     for (int row = 0; row < renderer->rows; row++) {
-        if (renderer->projected_screen_x[static_cast<size_t>(row)].size() !=
-            static_cast<size_t>(renderer->cols)) {
-            renderer->projected_screen_x[static_cast<size_t>(row)].resize(
-                static_cast<size_t>(renderer->cols));
-            renderer->projected_screen_y[static_cast<size_t>(row)].resize(
-                static_cast<size_t>(renderer->cols));
-        }
-
+        double world_y = mesh_row_to_world_y(row, renderer->rows);
         for (int col = 0; col < renderer->cols; col++) {
-            // Convert mesh coordinates to world space
             double world_x = mesh_col_to_world_x(col, renderer->cols);
-            double world_y = mesh_row_to_world_y(row, renderer->rows);
             double world_z = mesh_z_to_world_z(
                 renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)], z_center,
-                renderer->view_state.z_scale);
+                view.z_scale);
 
-            // Project to screen space and cache only screen coordinates (SOA)
-            bed_mesh_point_3d_t projected = bed_mesh_projection_project_3d_to_2d(
-                world_x, world_y, world_z, canvas_width, canvas_height, &renderer->view_state);
+            bed_mesh_normalized_point_t point =
+                bed_mesh_projection_project_normalized(world_x, world_y, world_z, &view);
+            cache.vertices[static_cast<size_t>(row) * cols + static_cast<size_t>(col)] = point;
 
-            renderer->projected_screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)] =
-                projected.screen_x;
-            renderer->projected_screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)] =
-                projected.screen_y;
+            cache.min_x = std::min(cache.min_x, point.x);
+            cache.max_x = std::max(cache.max_x, point.x);
+            cache.min_y = std::min(cache.min_y, point.y);
+            cache.max_y = std::max(cache.max_y, point.y);
         }
     }
+
+    cache.valid = true;
+    cache.angle_x = view.angle_x;
+    cache.angle_z = view.angle_z;
+    cache.z_scale = view.z_scale;
+    cache.mesh_generation = renderer->mesh_generation;
+
+    // Depths changed: painter's order must be rebuilt
+    renderer->draw_order_valid = false;
+
+    spdlog::trace("[CACHE] Projected {} mesh vertices", cache.vertices.size());
+    return true;
 }
 
 /**
- * @brief Project all quad vertices to screen space and cache results
+ * @brief Fit the cached projection to the canvas and write screen coordinates
  *
- * Computes screen coordinates and depths for all vertices of all quads in a single pass.
- * This eliminates redundant projections - previously each quad was projected 3 times:
- * once for depth sorting, once for bounds tracking, and once during rendering.
+ * Perspective scales linearly with fov_scale, so the FOV that makes the mesh fill
+ * CANVAS_PADDING_FACTOR of the canvas follows directly from the normalized bounds - no
+ * trial projection needed. Centering (first render only) uses the same bounds. Screen
+ * coordinates for the grid (SOA cache) and the quad corners (plus their depths) are then
+ * written in one pass over the cached vertices.
  *
- * Must be called whenever view state changes (rotation, FOV, centering offset).
+ * Does nothing when the projection, canvas size, offsets and quads are unchanged; the
+ * fitted fov_scale is still restored for the overlay passes.
  *
- * @param renderer Renderer with quads already generated
+ * @param renderer Renderer with a valid projection cache
  * @param canvas_width Canvas width in pixels
  * @param canvas_height Canvas height in pixels
- *
- * Side effects:
- * - Updates quad.screen_x[], quad.screen_y[], quad.depths[] for all quads
- * - Updates quad.avg_depth for depth sorting
+ * @param reprojected true if update_projection_cache() just re-projected
+ * @return true if screen coordinates were rewritten
  */
-static void project_and_cache_quads(bed_mesh_renderer_t* renderer, int canvas_width,
-                                    int canvas_height) {
-    if (!renderer || renderer->quads.empty()) {
-        return;
+static bool update_screen_fit(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
+                              bool reprojected) {
+    auto& fit = renderer->screen_fit;
+    bed_mesh_view_state_t& view = renderer->view_state;
+    if (!reprojected && fit.valid && fit.canvas_width == canvas_width &&
+        fit.canvas_height == canvas_height && fit.layer_offset_x == view.layer_offset_x &&
+        fit.layer_offset_y == view.layer_offset_y && fit.center_offset_x == view.center_offset_x &&
+        fit.center_offset_y == view.center_offset_y &&
+        fit.quads_generation == renderer->quads_generation) {
+        view.fov_scale = fit.fov_scale;
+        return false;
     }
 
-    for (auto& quad : renderer->quads) {
-        double total_depth = 0.0;
-
-        for (int i = 0; i < 4; i++) {
-            bed_mesh_point_3d_t projected = bed_mesh_projection_project_3d_to_2d(
-                quad.vertices[i].x, quad.vertices[i].y, quad.vertices[i].z, canvas_width,
-                canvas_height, &renderer->view_state);
-
-            quad.screen_x[i] = projected.screen_x;
-            quad.screen_y[i] = projected.screen_y;
-            quad.depths[i] = projected.depth;
-            total_depth += projected.depth;
-        }
+    const auto& cache = renderer->projection;
 
-        quad.avg_depth = total_depth / 4.0;
+    // Scale needed to fit projected bounds into canvas
+    double range_x = cache.max_x - cache.min_x;
+    double range_y = cache.max_y - cache.min_y;
+    if (range_x > 0.0 && range_y > 0.0) {
+        view.fov_scale = std::min((canvas_width * CANVAS_PADDING_FACTOR) / range_x,
+                                  (canvas_height * CANVAS_PADDING_FACTOR) / range_y);
+    } else {
+        view.fov_scale = DEFAULT_FOV_SCALE;
     }
 
-    spdlog::trace("[CACHE] Projected {} quads to screen space", renderer->quads.size());
-}
-
-/**
- * @brief Compute 2D bounding box of projected mesh points
- *
- * Scans all cached projected_points to find min/max X and Y coordinates in screen space.
- * Used for FOV scaling and centering calculations.
- *
- * @param renderer Renderer with projected_points cache populated
- * @param[out] out_min_x Minimum screen X coordinate
- * @param[out] out_max_x Maximum screen X coordinate
- * @param[out] out_min_y Minimum screen Y coordinate
- * @param[out] out_max_y Maximum screen Y coordinate
- */
-static void compute_projected_mesh_bounds(const bed_mesh_renderer_t* renderer, int* out_min_x,
-                                          int* out_max_x, int* out_min_y, int* out_max_y) {
-    if (!renderer || !renderer->has_mesh_data) {
-        *out_min_x = *out_max_x = *out_min_y = *out_max_y = 0;
-        return;
+    // Center mesh once on first render (offsets start at 0 from initialization)
+    // After initial centering, offset remains stable across rotations
+    if (view.center_offset_x == 0 && view.center_offset_y == 0) {
+        // Canvas-relative bounds: the offsets are still zero
+        bed_mesh_normalized_point_t min_point = {cache.min_x, cache.min_y, 0.0};
+        bed_mesh_normalized_point_t max_point = {cache.max_x, cache.max_y, 0.0};
+        bed_mesh_view_state_t canvas_view = view;
+        canvas_view.layer_offset_x = 0;
+        canvas_view.layer_offset_y = 0;
+        int min_x, min_y, max_x, max_y;
+        bed_mesh_projection_normalized_to_screen(&min_point, canvas_width, canvas_height,
+                                                 &canvas_view, &min_x, &min_y);
+        bed_mesh_projection_normalized_to_screen(&max_point, canvas_width, canvas_height,
+                                                 &canvas_view, &max_x, &max_y);
+
+        compute_centering_offset(min_x, max_x, min_y, max_y, view.layer_offset_x,
+                                 view.layer_offset_y, canvas_width, canvas_height,
+                                 &view.center_offset_x, &view.center_offset_y);
     }
 
-    int min_x = INT_MAX, max_x = INT_MIN;
-    int min_y = INT_MAX, max_y = INT_MIN;
+    // Resize SOA caches if needed (avoid reallocation on every frame)
+    const size_t rows = static_cast<size_t>(renderer->rows);
+    const size_t cols = static_cast<size_t>(renderer->cols);
+    renderer->projected_screen_x.resize(rows);
+    renderer->projected_screen_y.resize(rows);
+    for (size_t row = 0; row < rows; row++) {
+        renderer->projected_screen_x[row].resize(cols);
+        renderer->projected_screen_y[row].resize(cols);
+        for (size_t col = 0; col < cols; col++) {
+            bed_mesh_projection_normalized_to_screen(
+                &cache.vertices[row * cols + col], canvas_width, canvas_height, &view,
+                &renderer->projected_screen_x[row][col], &renderer->projected_screen_y[row][col]);
+        }
+    }
 
-    for (int row = 0; row < renderer->rows; row++) {
-        for (int col = 0; col < renderer->cols; col++) {
-            int screen_x =
-                renderer->projected_screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int screen_y =
-                renderer->projected_screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            min_x = std::min(min_x, screen_x);
-            max_x = std::max(max_x, screen_x);
-            min_y = std::min(min_y, screen_y);
-            max_y = std::max(max_y, screen_y);
+    // Quads are generated row-major over mesh cells, so each corner indexes the vertex cache:
+    // [0]=BL=mesh[row+1][col], [1]=BR=mesh[row+1][col+1], [2]=TL=mesh[row][col], [3]=TR
+    if (renderer->quads.size() == (rows - 1) * (cols - 1)) {
+        size_t quad_index = 0;
+        for (size_t row = 0; row + 1 < rows; row++) {
+            for (size_t col = 0; col + 1 < cols; col++) {
+                bed_mesh_quad_3d_t& quad = renderer->quads[quad_index++];
+                const size_t corner_row[4] = {row + 1, row + 1, row, row};
+                const size_t corner_col[4] = {col, col + 1, col, col + 1};
+                double total_depth = 0.0;
+                for (int i = 0; i < 4; i++) {
+                    quad.screen_x[i] = renderer->projected_screen_x[corner_row[i]][corner_col[i]];
+                    quad.screen_y[i] = renderer->projected_screen_y[corner_row[i]][corner_col[i]];
+                    quad.depths[i] = cache.vertices[corner_row[i] * cols + corner_col[i]].depth;
+                    total_depth += quad.depths[i];
+                }
+                quad.avg_depth = total_depth / 4.0;
+            }
         }
+    } else {
+        spdlog::warn("[CACHE] Quad count {} does not match {}x{} mesh", renderer->quads.size(),
+                     rows, cols);
     }
 
-    *out_min_x = min_x;
-    *out_max_x = max_x;
-    *out_min_y = min_y;
-    *out_max_y = max_y;
+    // Regenerated quads need their depths re-sorted even if the projection is unchanged
+    if (fit.quads_generation != renderer->quads_generation) {
+        renderer->draw_order_valid = false;
+    }
+
+    fit.valid = true;
+    fit.canvas_width = canvas_width;
+    fit.canvas_height = canvas_height;
+    fit.layer_offset_x = view.layer_offset_x;
+    fit.layer_offset_y = view.layer_offset_y;
+    fit.center_offset_x = view.center_offset_x;
+    fit.center_offset_y = view.center_offset_y;
+    fit.quads_generation = renderer->quads_generation;
+    fit.fov_scale = view.fov_scale;
+
+    spdlog::trace("[CACHE] Fitted projection to {}x{} (fov_scale={:.1f})", canvas_width,
+                  canvas_height, view.fov_scale);
+    return true;
 }
 
 /**
@@ -1276,16 +1484,171 @@ static void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
         }
     }
 
+    renderer->quads_generation++;
+
     spdlog::trace("Generated {} quads from {}x{} mesh", renderer->quads.size(), renderer->rows,
                   renderer->cols);
 }
 
-static void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads) {
-    std::sort(quads.begin(), quads.end(),
-              [](const bed_mesh_quad_3d_t& a, const bed_mesh_quad_3d_t& b) {
-                  // Descending order: furthest (largest depth) first
-                  return a.avg_depth > b.avg_depth;
-              });
+/**
+ * Re-sort the painter's algorithm order if the projection or quads changed since the
+ * last sort (uses the avg_depth written by update_screen_fit())
+ */
+static void update_draw_order(bed_mesh_renderer_t* renderer) {
+    if (!renderer->draw_order_valid) {
+        sort_quads_by_depth(renderer->quads, renderer->draw_order);
+        renderer->draw_order_valid = true;
+    }
+}
+
+/**
+ * Sort quad indices back to front without moving the quads themselves
+ *
+ * Quads stay in row-major cell order so their corners map directly onto the per-vertex
+ * projection cache. The previous order is reused as the starting permutation, which is
+ * already nearly sorted after a small rotation.
+ */
+static void sort_quads_by_depth(const std::vector<bed_mesh_quad_3d_t>& quads,
+                                std::vector<uint32_t>& order) {
+    if (order.size() != quads.size()) {
+        order.resize(quads.size());
+        std::iota(order.begin(), order.end(), 0u);
+    }
+    std::sort(order.begin(), order.end(), [&quads](uint32_t a, uint32_t b) {
+        // Descending order: furthest (largest depth) first
+        return quads[a].avg_depth > quads[b].avg_depth;
+    });
+}
+
+/**
+ * Allocate (or resize) a software rasterization surface and its depth buffer
+ *
+ * @return false if the draw buffer could not be allocated
+ */
+static bool ensure_surface(RasterSurface* surface, int width, int height, bool with_depth) {
+    lv_draw_buf_t* buf = surface->buf;
+    if (!buf || buf->header.w != static_cast<uint32_t>(width) ||
+        buf->header.h != static_cast<uint32_t>(height)) {
+        if (buf) {
+            ImageCache::instance().invalidate(buf);
+            lv_draw_buf_destroy(buf);
+        }
+        surface->buf = lv_draw_buf_create(static_cast<uint32_t>(width),
+                                          static_cast<uint32_t>(height),
+                                          LV_COLOR_FORMAT_XRGB8888, 0);
+        if (!surface->buf) {
+            spdlog::error("Failed to allocate {}x{} bed mesh raster buffer", width, height);
+            return false;
+        }
+        spdlog::debug("Allocated {}x{} bed mesh raster buffer (stride {})", width, height,
+                      surface->buf->header.stride);
+    }
+
+    if (with_depth) {
+        surface->depth.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+    }
+    return true;
+}
+
+static void release_surface(RasterSurface* surface) {
+    if (surface->buf) {
+        ImageCache::instance().invalidate(surface->buf);
+        lv_draw_buf_destroy(surface->buf);
+        surface->buf = nullptr;
+    }
+    std::vector<float>().swap(surface->depth);
+}
+
+/**
+ * Pick the drag preview downscale factor (see bed_mesh_raster_preview_scale())
+ */
+static int select_preview_scale(bed_mesh_renderer_t* renderer) {
+    int scale = bed_mesh_raster_preview_scale(renderer->preview_scale, renderer->preview_active,
+                                              renderer->last_render_ms);
+    if (renderer->preview_active && scale != renderer->preview_scale) {
+        spdlog::debug("Bed mesh drag frame took {:.1f}ms (budget {:.0f}ms), preview now 1/{}",
+                      renderer->last_render_ms, BED_MESH_PREVIEW_BUDGET_MS, scale);
+    }
+    renderer->preview_scale = scale;
+    return scale;
+}
+
+/**
+ * Rasterize all quads into a private surface and composite it with one lv_draw_image
+ *
+ * Cached quad screen coordinates include the layer offset, so they are shifted back to
+ * surface-relative pixels (and floor-divided by @p scale for a reduced-resolution preview,
+ * which is upscaled on blit, so clipped vertices stay on the preview grid). With the depth
+ * buffer, colors are pre-blended against the background and written opaque: only the nearest
+ * surface is visible, matching what MESH_TRIANGLE_OPACITY over the background looks like
+ * without depending on quad order.
+ *
+ * @return Number of pixels written
+ */
+static size_t rasterize_quads_software(lv_layer_t* layer, bed_mesh_renderer_t* renderer,
+                                       RasterSurface* surface, int scale,
+                                       const lv_area_t* clip_area, bool use_gradient) {
+    lv_draw_buf_t* buf = surface->buf;
+    const bool depth_test = renderer->use_depth_buffer;
+
+    bed_mesh_raster_target_t target;
+    target.pixels = reinterpret_cast<uint32_t*>(buf->data);
+    target.depth = depth_test ? surface->depth.data() : nullptr;
+    target.width = static_cast<int>(buf->header.w);
+    target.height = static_cast<int>(buf->header.h);
+    target.stride = static_cast<int>(buf->header.stride / sizeof(uint32_t));
+    bed_mesh_raster_clear(&target, lv_color_to_u32(CANVAS_BG_COLOR) & 0x00FFFFFF);
+
+    const lv_opa_t opacity =
+        depth_test ? static_cast<lv_opa_t>(LV_OPA_COVER) : MESH_TRIANGLE_OPACITY;
+    auto to_vertex = [&](const bed_mesh_quad_3d_t& quad, int i) {
+        lv_color_t color = use_gradient ? quad.vertices[i].color : quad.center_color;
+        if (depth_test) {
+            color = lv_color_mix(color, CANVAS_BG_COLOR, MESH_TRIANGLE_OPACITY);
+        }
+        return bed_mesh_raster_vertex_t{
+            bed_mesh_raster_scale_coord(quad.screen_x[i], clip_area->x1, scale),
+            bed_mesh_raster_scale_coord(quad.screen_y[i], clip_area->y1, scale),
+            static_cast<float>(quad.depths[i]), color.red, color.green, color.blue};
+    };
+
+    // Same triangulation as render_quad(): [0]BL→[1]BR→[2]TL and [1]BR→[3]TR→[2]TL
+    size_t written = 0;
+    auto raster_quad = [&](const bed_mesh_quad_3d_t& quad) {
+        bed_mesh_raster_vertex_t v[4] = {to_vertex(quad, 0), to_vertex(quad, 1),
+                                         to_vertex(quad, 2), to_vertex(quad, 3)};
+        written += bed_mesh_raster_triangle(&target, v[0], v[1], v[2], opacity);
+        written += bed_mesh_raster_triangle(&target, v[1], v[3], v[2], opacity);
+    };
+    if (depth_test) {
+        for (const auto& quad : renderer->quads) {
+            raster_quad(quad);
+        }
+    } else {
+        for (uint32_t index : renderer->draw_order) {
+            raster_quad(renderer->quads[index]);
+        }
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = buf;
+
+    // Preview: draw at buffer size from the clip origin, scaled up around that corner
+    // (nearest-neighbor; the clip area trims the rounded-up edge)
+    lv_area_t image_area = *clip_area;
+    if (scale > 1) {
+        image_area.x2 = image_area.x1 + target.width - 1;
+        image_area.y2 = image_area.y1 + target.height - 1;
+        img_dsc.scale_x = LV_SCALE_NONE * scale;
+        img_dsc.scale_y = LV_SCALE_NONE * scale;
+        img_dsc.pivot.x = 0;
+        img_dsc.pivot.y = 0;
+        img_dsc.antialias = 0;
+    }
+    lv_draw_image(layer, &img_dsc, &image_area);
+
+    return written;
 }
 
 /**
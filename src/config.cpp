@@ -6,7 +6,6 @@
 #include "ui_error_reporting.h"
 
 #include <fstream>
-#include <iomanip>
 #include <sys/stat.h>
 #ifdef __APPLE__
 #include <filesystem>
@@ -18,7 +17,12 @@ namespace fs = std::experimental::filesystem;
 
 Config* Config::instance{NULL};
 
-Config::Config() {}
+Config::Config() {
+    // Runs on the writer thread; NOTIFY_ERROR is safe from any thread
+    writer_.set_error_callback([](const std::string& file) {
+        NOTIFY_ERROR("Could not save configuration file {}", file);
+    });
+}
 
 Config* Config::get_instance() {
     if (instance == NULL) {
@@ -120,8 +124,9 @@ void Config::init(const std::string& config_path) {
     }
 
     // Save updated config with any new defaults
-    std::ofstream o(config_path);
-    o << std::setw(2) << data << std::endl;
+    if (!DebouncedFileWriter::write_atomically(config_path, data.dump(2) + "\n")) {
+        LOG_ERROR_INTERNAL("Failed to write config file: {}", config_path);
+    }
 
     spdlog::debug("Config initialized: moonraker={}:{}", get<std::string>(df() + "moonraker_host"),
                   get<int>(df() + "moonraker_port"));
@@ -140,33 +145,27 @@ json& Config::get_json(const std::string& json_path) {
 }
 
 bool Config::save() {
-    spdlog::debug("Saving config to {}", path);
-
-    try {
-        std::ofstream o(path);
-        if (!o.is_open()) {
-            NOTIFY_ERROR("Could not save configuration file");
-            LOG_ERROR_INTERNAL("Failed to open config file for writing: {}", path);
-            return false;
-        }
-
-        o << std::setw(2) << data << std::endl;
-
-        if (!o.good()) {
-            NOTIFY_ERROR("Error writing configuration file");
-            LOG_ERROR_INTERNAL("Error writing to config file: {}", path);
-            return false;
-        }
+    if (path.empty()) {
+        LOG_ERROR_INTERNAL("Config::save() called before init()");
+        return false;
+    }
 
-        o.close();
-        spdlog::debug("Config saved successfully to {}", path);
-        return true;
+    // Serialize a snapshot on the writer thread; later changes don't affect this write
+    spdlog::trace("[Config] Save scheduled for {}", path);
+    writer_.schedule(path, [snapshot = data]() { return snapshot.dump(2) + "\n"; });
+    return true;
+}
 
-    } catch (const std::exception& e) {
-        NOTIFY_ERROR("Failed to save configuration: {}", e.what());
-        LOG_ERROR_INTERNAL("Exception while saving config to {}: {}", path, e.what());
-        return false;
+bool Config::flush() {
+    if (writer_.has_pending()) {
+        spdlog::debug("[Config] Flushing pending save to {}", path);
     }
+    // Also waits for a write already in progress on the writer thread
+    return writer_.flush();
+}
+
+FileWriteStats Config::get_save_stats() const {
+    return writer_.stats();
 }
 
 bool Config::is_wizard_required() {
@@ -0,0 +1,184 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "debounced_file_writer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+DebouncedFileWriter::DebouncedFileWriter(uint32_t delay_ms) : delay_(delay_ms) {}
+
+DebouncedFileWriter::~DebouncedFileWriter() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void DebouncedFileWriter::schedule(const std::string& path, Producer producer) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.requests++;
+        if (pending_) {
+            stats_.coalesced++;
+        }
+        path_ = path;
+        pending_ = std::move(producer);
+        deadline_ = Clock::now() + delay_;
+
+        if (!thread_.joinable()) {
+            thread_ = std::thread(&DebouncedFileWriter::run, this);
+        }
+    }
+    cv_.notify_all();
+}
+
+bool DebouncedFileWriter::flush() {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!pending_) {
+        return true;
+    }
+    return write_pending(lock);
+}
+
+bool DebouncedFileWriter::has_pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<bool>(pending_);
+}
+
+void DebouncedFileWriter::set_error_callback(ErrorFn on_error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_error_ = std::move(on_error);
+}
+
+FileWriteStats DebouncedFileWriter::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void DebouncedFileWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        if (!pending_) {
+            cv_.wait(lock);
+            continue;
+        }
+        if (Clock::now() < deadline_) {
+            // A new request moves the deadline; the loop re-checks after waking
+            cv_.wait_until(lock, deadline_);
+            continue;
+        }
+
+        // Take the write lock first (same order as flush()), so that flush() never returns
+        // while this thread is still writing an older request
+        lock.unlock();
+        std::lock_guard<std::mutex> write_lock(write_mutex_);
+        lock.lock();
+
+        // flush() may have written it meanwhile, or a new request restarted the delay
+        if (pending_ && Clock::now() >= deadline_) {
+            write_pending(lock);
+        }
+    }
+}
+
+bool DebouncedFileWriter::write_pending(std::unique_lock<std::mutex>& lock) {
+    Producer producer = std::move(pending_);
+    pending_ = nullptr;
+    std::string path = path_;
+    ErrorFn on_error = on_error_;
+    lock.unlock();
+
+    bool ok = false;
+    try {
+        ok = write_atomically(path, producer());
+    } catch (const std::exception& e) {
+        spdlog::error("[DebouncedFileWriter] Failed to produce {}: {}", path, e.what());
+    }
+
+    if (!ok && on_error) {
+        on_error(path);
+    }
+
+    lock.lock();
+    if (ok) {
+        stats_.writes++;
+    } else {
+        stats_.failures++;
+    }
+    return ok;
+}
+
+bool DebouncedFileWriter::write_atomically(const std::string& path, const std::string& content) {
+    std::string tmp_path = path + ".tmp";
+
+    // Keep the permissions of the file being replaced
+    mode_t mode = 0644;
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0) {
+        mode = st.st_mode & 0777;
+    }
+
+    int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, mode);
+    if (fd < 0) {
+        spdlog::error("[DebouncedFileWriter] Cannot create {}: {}", tmp_path, strerror(errno));
+        return false;
+    }
+
+    const char* data = content.data();
+    size_t remaining = content.size();
+    while (remaining > 0) {
+        ssize_t written = write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            spdlog::error("[DebouncedFileWriter] Write to {} failed: {}", tmp_path,
+                          strerror(errno));
+            close(fd);
+            unlink(tmp_path.c_str());
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    if (fsync(fd) != 0) {
+        spdlog::error("[DebouncedFileWriter] fsync of {} failed: {}", tmp_path, strerror(errno));
+        close(fd);
+        unlink(tmp_path.c_str());
+        return false;
+    }
+    close(fd);
+
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+        spdlog::error("[DebouncedFileWriter] Cannot rename {} to {}: {}", tmp_path, path,
+                      strerror(errno));
+        unlink(tmp_path.c_str());
+        return false;
+    }
+
+    // Persist the rename itself
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : path.substr(0, slash + 1);
+    int dir_fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+
+    spdlog::trace("[DebouncedFileWriter] Wrote {} ({} bytes)", path, content.size());
+    return true;
+}
@@ -4,8 +4,12 @@
 
 #include "display_backend.h"
 
+#include "config.h"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 
@@ -135,3 +139,127 @@ std::unique_ptr<DisplayBackend> DisplayBackend::create_auto() {
 
     return nullptr;
 }
+
+// ============================================================================
+// Render configuration
+// ============================================================================
+
+DisplayRenderConfig DisplayRenderConfig::load() {
+    DisplayRenderConfig render;
+
+    Config* cfg = Config::get_instance();
+    render.buffer_lines = cfg->get<int>("/display/render_buffer_lines", render.buffer_lines);
+    render.double_buffer = cfg->get<bool>("/display/double_buffer", render.double_buffer);
+    render.vsync = cfg->get<bool>("/display/vsync", render.vsync);
+    int stats_s = cfg->get<int>("/display/frame_stats_interval_s", 0);
+
+    // Environment overrides (for measuring without editing the config)
+    const char* env = std::getenv("HELIX_RENDER_BUFFER_LINES");
+    if (env && env[0] != '\0') {
+        render.buffer_lines = std::atoi(env);
+    }
+    env = std::getenv("HELIX_DISPLAY_VSYNC");
+    if (env && env[0] != '\0') {
+        render.vsync = std::atoi(env) != 0;
+    }
+    env = std::getenv("HELIX_FRAME_STATS");
+    if (env && env[0] != '\0') {
+        stats_s = std::atoi(env);
+    }
+
+    render.buffer_lines = std::max(render.buffer_lines, 1);
+    render.frame_stats_interval_ms = static_cast<uint32_t>(std::max(stats_s, 0)) * 1000;
+    return render;
+}
+
+// ============================================================================
+// Frame time statistics
+// ============================================================================
+
+namespace {
+
+using FrameClock = std::chrono::steady_clock;
+
+struct FrameStats {
+    uint32_t interval_ms = 0;
+    FrameClock::time_point window_start;
+    FrameClock::time_point frame_start;
+    bool rendering = false; ///< Current refresh had dirty areas
+
+    uint32_t frames = 0;
+    uint32_t slow_frames = 0; ///< Frames longer than the refresh period
+    double total_ms = 0;
+    double max_ms = 0;
+
+    void start_window(FrameClock::time_point now) {
+        window_start = now;
+        frames = 0;
+        slow_frames = 0;
+        total_ms = 0;
+        max_ms = 0;
+    }
+};
+
+void frame_stats_event_cb(lv_event_t* e) {
+    auto* stats = static_cast<FrameStats*>(lv_event_get_user_data(e));
+    auto* display = static_cast<lv_display_t*>(lv_event_get_current_target(e));
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        stats->frame_start = FrameClock::now();
+        stats->rendering = false;
+        break;
+
+    case LV_EVENT_RENDER_START:
+        stats->rendering = true;
+        break;
+
+    case LV_EVENT_REFR_READY: {
+        if (!stats->rendering) {
+            break; // Nothing was dirty: not a frame
+        }
+        stats->rendering = false;
+
+        auto now = FrameClock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - stats->frame_start).count();
+        uint32_t period_ms = lv_timer_get_period(lv_display_get_refr_timer(display));
+        stats->frames++;
+        stats->total_ms += ms;
+        stats->max_ms = std::max(stats->max_ms, ms);
+        if (ms > period_ms) {
+            stats->slow_frames++;
+        }
+
+        std::chrono::duration<double> window = now - stats->window_start;
+        if (window.count() * 1000.0 >= stats->interval_ms) {
+            spdlog::info("[Display] {} frames in {:.0f}s: avg {:.1f} ms, max {:.1f} ms, "
+                         "{} over {} ms",
+                         stats->frames, window.count(), stats->total_ms / stats->frames,
+                         stats->max_ms, stats->slow_frames, period_ms);
+            stats->start_window(now);
+        }
+        break;
+    }
+
+    case LV_EVENT_DELETE:
+        delete stats;
+        break;
+
+    default:
+        break;
+    }
+}
+
+} // namespace
+
+void display_enable_frame_stats(lv_display_t* display, uint32_t interval_ms) {
+    if (display == nullptr || interval_ms == 0) {
+        return;
+    }
+
+    auto* stats = new FrameStats();
+    stats->interval_ms = interval_ms;
+    stats->start_window(FrameClock::now());
+    lv_display_add_event_cb(display, frame_stats_event_cb, LV_EVENT_ALL, stats);
+    spdlog::info("[Display] Logging frame times every {}s", interval_ms / 1000);
+}
@@ -181,6 +181,11 @@ lv_display_t* DisplayBackendDRM::create_display(int width, int height) {
     // Set the DRM device path
     lv_linux_drm_set_file(display_, drm_device_.c_str(), -1);
 
+    // LVGL's DRM driver renders directly into two dumb buffers and presents them with a
+    // page flip on vblank, so the fbdev buffer and vsync options don't apply here
+    DisplayRenderConfig render = DisplayRenderConfig::load();
+    display_enable_frame_stats(display_, render.frame_stats_interval_ms);
+
     spdlog::info("DRM display created: {}x{} on {}", width, height, drm_device_);
     return display_;
 }
@@ -209,12 +214,14 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, device_override.c_str());
         if (pointer_ != nullptr) {
             spdlog::info("Libinput pointer device created on {}", device_override);
+            pointer_path_ = device_override;
             return pointer_;
         }
         // Try evdev as fallback for the specified device
         pointer_ = lv_evdev_create(LV_INDEV_TYPE_POINTER, device_override.c_str());
         if (pointer_ != nullptr) {
             spdlog::info("Evdev pointer device created on {}", device_override);
+            pointer_path_ = device_override;
             return pointer_;
         }
         spdlog::warn("Could not open specified touch device: {}", device_override);
@@ -231,6 +238,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, touch_path);
         if (pointer_ != nullptr) {
             spdlog::info("Libinput touch device created on {}", touch_path);
+            pointer_path_ = touch_path;
             return pointer_;
         }
         spdlog::warn("Failed to create libinput device for: {}", touch_path);
@@ -243,6 +251,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, pointer_path);
         if (pointer_ != nullptr) {
             spdlog::info("Libinput pointer device created on {}", pointer_path);
+            pointer_path_ = pointer_path;
             return pointer_;
         }
         spdlog::warn("Failed to create libinput device for: {}", pointer_path);
@@ -257,6 +266,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_evdev_create(LV_INDEV_TYPE_POINTER, dev);
         if (pointer_ != nullptr) {
             spdlog::info("Evdev pointer device created on {}", dev);
+            pointer_path_ = dev;
             return pointer_;
         }
     }
@@ -11,12 +11,64 @@
 #include <lvgl.h>
 
 // System includes for device access checks
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <cstring>
 #include <dirent.h>
 #include <fcntl.h>
+#include <linux/fb.h>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+namespace {
+
+// Draw buffer start alignment: a cache line, which also covers NEON loads/stores
+constexpr size_t DRAW_BUF_ADDR_ALIGN = 64;
+
+/**
+ * @brief Render state owned by the LVGL display, released on LV_EVENT_DELETE
+ */
+struct FbdevRenderState {
+    void* draw_bufs = nullptr; ///< Both draw buffers, one allocation
+    int vsync_fd = -1;         ///< Framebuffer descriptor for FBIO_WAITFORVSYNC
+    bool vsync_waited = false; ///< Already waited for vblank in this refresh
+};
+
+void render_state_event_cb(lv_event_t* e) {
+    auto* state = static_cast<FbdevRenderState*>(lv_event_get_user_data(e));
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        state->vsync_waited = false;
+        break;
+
+    case LV_EVENT_FLUSH_START:
+        // Wait once per refresh: waiting before every partial area would cap the frame
+        // rate at one area per vblank
+        if (state->vsync_fd >= 0 && !state->vsync_waited) {
+            uint32_t crtc = 0;
+            ioctl(state->vsync_fd, FBIO_WAITFORVSYNC, &crtc);
+            state->vsync_waited = true;
+        }
+        break;
+
+    case LV_EVENT_DELETE:
+        if (state->vsync_fd >= 0) {
+            close(state->vsync_fd);
+        }
+        std::free(state->draw_bufs);
+        delete state;
+        break;
+
+    default:
+        break;
+    }
+}
+
+} // namespace
+
 DisplayBackendFbdev::DisplayBackendFbdev() = default;
 
 DisplayBackendFbdev::DisplayBackendFbdev(const std::string& fb_device,
@@ -56,10 +108,68 @@ lv_display_t* DisplayBackendFbdev::create_display(int width, int height) {
     // Set the framebuffer device path
     lv_linux_fbdev_set_file(display_, fb_device_.c_str());
 
+    DisplayRenderConfig render = DisplayRenderConfig::load();
+    if (!setup_rendering(render)) {
+        lv_display_delete(display_);
+        display_ = nullptr;
+        return nullptr;
+    }
+    display_enable_frame_stats(display_, render.frame_stats_interval_ms);
+
     spdlog::info("Framebuffer display created: {}x{} on {}", width, height, fb_device_);
     return display_;
 }
 
+bool DisplayBackendFbdev::setup_rendering(const DisplayRenderConfig& render) {
+    int32_t hor_res = lv_display_get_horizontal_resolution(display_);
+    int32_t ver_res = lv_display_get_vertical_resolution(display_);
+    if (hor_res <= 0 || ver_res <= 0) {
+        spdlog::error("Framebuffer {} reported no usable resolution", fb_device_);
+        return false;
+    }
+
+    // The driver only allocated a one-line placeholder (lv_conf.h); render into our own
+    // buffers so their height, count and alignment follow the config
+    uint32_t lines = static_cast<uint32_t>(std::min<int32_t>(render.buffer_lines, ver_res));
+    uint32_t stride = lv_draw_buf_width_to_stride(static_cast<uint32_t>(hor_res),
+                                                  lv_display_get_color_format(display_));
+    size_t buf_size = static_cast<size_t>(stride) * lines;
+    size_t buf_span = (buf_size + DRAW_BUF_ADDR_ALIGN - 1) & ~(DRAW_BUF_ADDR_ALIGN - 1);
+    size_t buf_count = render.double_buffer ? 2 : 1;
+
+    void* bufs = nullptr;
+    if (posix_memalign(&bufs, DRAW_BUF_ADDR_ALIGN, buf_span * buf_count) != 0) {
+        spdlog::error("Failed to allocate {} draw buffer(s) of {} bytes", buf_count, buf_size);
+        return false;
+    }
+
+    auto* state = new FbdevRenderState();
+    state->draw_bufs = bufs;
+    lv_display_add_event_cb(display_, render_state_event_cb, LV_EVENT_ALL, state);
+
+    void* buf_2 = render.double_buffer ? static_cast<uint8_t*>(bufs) + buf_span : nullptr;
+    lv_display_set_buffers(display_, bufs, buf_2, static_cast<uint32_t>(buf_size),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    if (render.vsync) {
+        // Probe with one real wait: many fbdev drivers don't implement it
+        state->vsync_fd = open(fb_device_.c_str(), O_RDWR | O_CLOEXEC);
+        uint32_t crtc = 0;
+        if (state->vsync_fd < 0 || ioctl(state->vsync_fd, FBIO_WAITFORVSYNC, &crtc) != 0) {
+            spdlog::warn("FBIO_WAITFORVSYNC unavailable on {} ({}), vsync disabled", fb_device_,
+                         strerror(errno));
+            if (state->vsync_fd >= 0) {
+                close(state->vsync_fd);
+                state->vsync_fd = -1;
+            }
+        }
+    }
+
+    spdlog::info("Framebuffer rendering: partial, {} x {} lines, vsync {}", buf_count, lines,
+                 state->vsync_fd >= 0 ? "on" : "off");
+    return true;
+}
+
 lv_indev_t* DisplayBackendFbdev::create_input_pointer() {
     // Determine touch device path
     std::string touch_path = touch_device_;
@@ -83,6 +193,7 @@ lv_indev_t* DisplayBackendFbdev::create_input_pointer() {
     }
 
     spdlog::info("Evdev touch input created on {}", touch_path);
+    touch_path_ = touch_path;
     return touch_;
 }
 
@@ -31,6 +31,8 @@ lv_display_t* DisplayBackendSDL::create_display(int width, int height) {
         return nullptr;
     }
 
+    display_enable_frame_stats(display_, DisplayRenderConfig::load().frame_stats_interval_ms);
+
     spdlog::info("SDL display created: {}x{}", width, height);
     return display_;
 }
@@ -217,6 +217,7 @@ void GeometryBuilder::BuildStats::log() const {
     spdlog::info("[GCode::Builder]   3D Geometry Generation:");
     spdlog::info("[GCode::Builder]     Vertices (triangle strips): {:>8}", vertices_generated);
     spdlog::info("[GCode::Builder]     Triangles rendered:         {:>8}", triangles_generated);
+    spdlog::info("[GCode::Builder]     Strips reordered by layer:  {:>8}", strips_reordered);
     spdlog::info("[GCode::Builder]   Memory:");
     spdlog::info("[GCode::Builder]     Total geometry memory:    {:>8} KB ({:.2f} MB)",
                  memory_bytes / 1024, memory_bytes / (1024.0 * 1024.0));
@@ -406,9 +407,7 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     size_t segments_shared = 0;
     size_t sharing_candidates = 0; // Segments where prev_end_cap exists
 
-    // Layer tracking for ghost layer rendering
-    // Temporary map to accumulate strips per layer, then convert to ranges
-    std::unordered_map<uint16_t, std::vector<size_t>> layer_to_strip_indices;
+    // Layer tracking for ghost layer rendering (ranges are built after generation)
     geometry.max_layer_index =
         gcode.layers.empty() ? 0 : static_cast<uint16_t>(gcode.layers.size() - 1);
 
@@ -476,30 +475,20 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
 
         // Track which strips belong to which layer
         size_t strips_after = geometry.strips.size();
-        for (size_t s = strips_before; s < strips_after; ++s) {
-            geometry.strip_layer_index.push_back(layer_idx);
-            layer_to_strip_indices[layer_idx].push_back(s);
-        }
+        geometry.strip_layer_index.insert(geometry.strip_layer_index.end(),
+                                          strips_after - strips_before, layer_idx);
 
         // Store for next iteration
         prev_end_cap = end_cap;
         prev_end_pos = segment.end;
     }
 
-    // Build layer_strip_ranges from accumulated data
-    // Initialize with empty ranges for all layers
-    geometry.layer_strip_ranges.resize(gcode.layers.size(), {0, 0});
-    for (const auto& [layer_idx, strip_indices] : layer_to_strip_indices) {
-        if (!strip_indices.empty() && layer_idx < geometry.layer_strip_ranges.size()) {
-            // Find contiguous range (strips should be mostly contiguous per layer)
-            size_t first = strip_indices.front();
-            size_t count = strip_indices.size();
-            geometry.layer_strip_ranges[layer_idx] = {first, count};
-        }
-    }
+    // Make each layer's strips contiguous so renderers can draw a layer range directly
+    sort_strips_by_layer(geometry, gcode.layers.size());
 
-    spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips",
-                  geometry.layer_strip_ranges.size(), geometry.strips.size());
+    spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips ({} reordered)",
+                  geometry.layer_strip_ranges.size(), geometry.strips.size(),
+                  stats_.strips_reordered);
 
     spdlog::trace("Segment Y range: [{:.1f}, {:.1f}]", seg_y_min, seg_y_max);
 
@@ -601,6 +590,54 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     return geometry;
 }
 
+// ============================================================================
+// Layer Ordering
+// ============================================================================
+
+void GeometryBuilder::sort_strips_by_layer(RibbonGeometry& geometry, size_t layer_count) {
+    auto& strip_layers = geometry.strip_layer_index;
+
+    // Strips whose Z matched no layer are tagged 0, but guard against stray indices anyway
+    size_t range_count = layer_count;
+    for (uint16_t layer : strip_layers) {
+        range_count = std::max(range_count, static_cast<size_t>(layer) + 1);
+    }
+
+    // Counting sort: per-layer counts, then prefix sums give each layer's first strip
+    auto& ranges = geometry.layer_strip_ranges;
+    ranges.assign(range_count, {0, 0});
+    for (uint16_t layer : strip_layers) {
+        ranges[layer].second++;
+    }
+    size_t next_strip = 0;
+    for (auto& range : ranges) {
+        range.first = next_strip;
+        next_strip += range.second;
+    }
+
+    stats_.strips_reordered = 0;
+    if (std::is_sorted(strip_layers.begin(), strip_layers.end())) {
+        return; // Common case: toolpath already emitted layer by layer
+    }
+
+    std::vector<size_t> cursor(range_count);
+    for (size_t layer = 0; layer < range_count; ++layer) {
+        cursor[layer] = ranges[layer].first;
+    }
+
+    // Stable within each layer, so strips keep their toolpath order
+    std::vector<TriangleStrip> sorted_strips(geometry.strips.size());
+    for (size_t i = 0; i < geometry.strips.size(); ++i) {
+        size_t target = cursor[strip_layers[i]]++;
+        sorted_strips[target] = geometry.strips[i];
+        if (target != i) {
+            stats_.strips_reordered++;
+        }
+    }
+    geometry.strips = std::move(sorted_strips);
+    std::sort(strip_layers.begin(), strip_layers.end());
+}
+
 // ============================================================================
 // Segment Simplification
 // ============================================================================
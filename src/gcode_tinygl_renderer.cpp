@@ -6,10 +6,14 @@
 #ifdef ENABLE_TINYGL_3D
 
 #include "config.h"
+#include "image_cache.h"
+#include "pixel_convert.h"
 #include "runtime_config.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cstring>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -21,6 +25,22 @@ extern "C" {
 
 namespace gcode {
 
+namespace {
+// TinyGL's pixel layout matches an LVGL color format, so it can render straight into
+// an lv_draw_buf: 0x00RRGGBB words are XRGB8888, 16-bit builds produce RGB565
+#if TGL_FEATURE_RENDER_BITS == 16
+constexpr int kTinyGLZBMode = ZB_MODE_5R6G5B;
+constexpr lv_color_format_t kTinyGLColorFormat = LV_COLOR_FORMAT_RGB565;
+#else
+constexpr int kTinyGLZBMode = ZB_MODE_RGBA;
+constexpr lv_color_format_t kTinyGLColorFormat = LV_COLOR_FORMAT_XRGB8888;
+#endif
+
+// A 32-bit TinyGL frame shown on a 16-bit display is converted once (vectorized) to
+// RGB565 here rather than per pixel by LVGL at blend time
+constexpr bool kConvertToRGB565 = (TGL_FEATURE_RENDER_BITS == 32 && LV_COLOR_DEPTH == 16);
+} // namespace
+
 GCodeTinyGLRenderer::GCodeTinyGLRenderer()
     : geometry_builder_(std::make_unique<GeometryBuilder>()) {
     // Set default configuration
@@ -49,6 +69,7 @@ GCodeTinyGLRenderer::~GCodeTinyGLRenderer() {
     shutdown_tinygl();
 
     if (draw_buf_) {
+        ImageCache::instance().invalidate(draw_buf_);
         lv_draw_buf_destroy(draw_buf_);
         draw_buf_ = nullptr;
     }
@@ -112,6 +133,14 @@ void GCodeTinyGLRenderer::set_debug_face_colors(bool enable) {
     }
 }
 
+void GCodeTinyGLRenderer::set_vertex_arrays_enabled(bool enable) {
+    spdlog::debug("Geometry submission: {}", enable ? "vertex arrays" : "immediate mode");
+    use_vertex_arrays_ = enable;
+    if (!enable) {
+        invalidate_vertex_arrays(); // Release the retained copy
+    }
+}
+
 void GCodeTinyGLRenderer::set_simplification_tolerance(float tolerance_mm) {
     simplification_.tolerance_mm = tolerance_mm;
 
@@ -123,7 +152,13 @@ void GCodeTinyGLRenderer::set_simplification_tolerance(float tolerance_mm) {
 }
 
 size_t GCodeTinyGLRenderer::get_memory_usage() const {
-    return geometry_ ? geometry_->memory_usage() : 0;
+    if (!geometry_) {
+        return 0;
+    }
+    const auto& arrays = vertex_arrays_;
+    size_t array_floats = arrays.positions.size() + arrays.normals.size() + arrays.colors.size() +
+                          arrays.dimmed_colors.size();
+    return geometry_->memory_usage() + array_floats * sizeof(float);
 }
 
 size_t GCodeTinyGLRenderer::get_triangle_count() const {
@@ -139,8 +174,21 @@ void GCodeTinyGLRenderer::init_tinygl() {
     spdlog::info("TinyGL init_tinygl() called with viewport_width_={}, viewport_height_={}",
                  viewport_width_, viewport_height_);
 
-    // Initialize TinyGL (it allocates its own framebuffer)
-    ZBuffer* zb = ZB_open(viewport_width_, viewport_height_, ZB_MODE_RGBA, 0);
+    // Let TinyGL render directly into the LVGL draw buffer when the formats match.
+    // TinyGL rounds the width down to a multiple of 4, so size the buffer the same way.
+    void* external_framebuffer = nullptr;
+    if (!kConvertToRGB565) {
+        int fb_width = viewport_width_ & ~3;
+        if (ensure_draw_buf(fb_width, viewport_height_, kTinyGLColorFormat) &&
+            draw_buf_->header.stride == static_cast<uint32_t>(fb_width * PSZB)) {
+            external_framebuffer = draw_buf_->data;
+        } else {
+            spdlog::debug("TinyGL: draw buffer stride mismatch, rendering to private buffer");
+        }
+    }
+
+    // Without an external buffer TinyGL allocates its own framebuffer
+    ZBuffer* zb = ZB_open(viewport_width_, viewport_height_, kTinyGLZBMode, external_framebuffer);
     if (!zb) {
         spdlog::error("Failed to initialize TinyGL");
         return;
@@ -149,7 +197,8 @@ void GCodeTinyGLRenderer::init_tinygl() {
     zbuffer_ = zb; // Store as void*
 
     // Get framebuffer pointer from ZBuffer
-    framebuffer_ = (unsigned int*)zb->pbuf;
+    framebuffer_ = zb->pbuf;
+    framebuffer_is_draw_buf_ = (external_framebuffer != nullptr);
 
     // Use the ACTUAL ZBuffer dimensions (TinyGL may round for alignment)
     // This is CRITICAL - using wrong dimensions causes massive rendering distortion!
@@ -211,7 +260,8 @@ void GCodeTinyGLRenderer::shutdown_tinygl() {
         glClose();
         ZB_close(static_cast<ZBuffer*>(zbuffer_));
         zbuffer_ = nullptr;
-        framebuffer_ = nullptr; // ZB_close frees the framebuffer
+        framebuffer_ = nullptr; // ZB_close frees the framebuffer (unless it is draw_buf_)
+        framebuffer_is_draw_buf_ = false;
     }
 }
 
@@ -463,6 +513,7 @@ void GCodeTinyGLRenderer::build_geometry(const ParsedGCodeFile& gcode) {
 
     // Build optimized ribbon geometry
     geometry_ = geometry_builder_->build(filtered_gcode, simplification_);
+    invalidate_vertex_arrays();
     current_gcode_filename_ = gcode.filename;
 
     const auto& stats = geometry_builder_->last_stats();
@@ -481,6 +532,7 @@ void GCodeTinyGLRenderer::set_prebuilt_geometry(std::unique_ptr<RibbonGeometry>
                  geometry->max_layer_index);
 
     geometry_ = std::move(*geometry); // Move the value from unique_ptr into optional
+    invalidate_vertex_arrays();
     current_gcode_filename_ = filename;
 
     spdlog::info("[GCode::Renderer] Pre-built geometry set: {} vertices, {} triangles (extrusion: "
@@ -549,47 +601,79 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
         return;
     }
 
-    // If we don't have layer tracking data, render all strips
+    const bool use_arrays = use_vertex_arrays_ && prepare_vertex_arrays();
+    if (use_arrays) {
+        bind_vertex_arrays(dim_factor);
+    }
+    auto submit = [&](size_t first, size_t count) {
+        if (use_arrays) {
+            submit_strips_arrays(first, count);
+        } else {
+            submit_strips_immediate(first, count, dim_factor);
+        }
+    };
+
+    const size_t strip_count = geometry_->strips.size();
+    const auto& ranges = geometry_->layer_strip_ranges;
+
     if (geometry_->strip_layer_index.empty()) {
-        // Fallback: render all strips with the given dim factor
-        for (size_t i = 0; i < geometry_->strips.size(); ++i) {
-            const auto& strip = geometry_->strips[i];
-
-            glBegin(GL_TRIANGLE_STRIP);
-            for (int j = 0; j < 4; j++) {
-                const auto& vertex = geometry_->vertices[strip[static_cast<size_t>(j)]];
-
-                // Lookup normal from palette
-                const glm::vec3& normal = geometry_->normal_palette[vertex.normal_index];
-                glNormal3f(normal.x, normal.y, normal.z);
-
-                // Lookup color from palette and apply dimming
-                uint32_t color_rgb = geometry_->color_palette[vertex.color_index];
-                uint8_t r = (color_rgb >> 16) & 0xFF;
-                uint8_t g = (color_rgb >> 8) & 0xFF;
-                uint8_t b = color_rgb & 0xFF;
-
-                glColor3f((r / 255.0f) * dim_factor, (g / 255.0f) * dim_factor,
-                          (b / 255.0f) * dim_factor);
-
-                // Dequantize position
-                glm::vec3 pos = geometry_->quantization.dequantize_vec3(vertex.position);
-                glVertex3f(pos.x, pos.y, pos.z);
+        // If we don't have layer tracking data, render all strips
+        submit(0, strip_count);
+    } else if (!ranges.empty()) {
+        // Layers are contiguous (GeometryBuilder sorts strips by layer): walk only the
+        // requested layers and merge adjacent ones into a single submission
+        int first_layer = std::max(start_layer, 0);
+        int last_layer = std::min(end_layer, static_cast<int>(ranges.size()) - 1);
+        size_t run_start = 0;
+        size_t run_length = 0;
+        for (int layer = first_layer; layer <= last_layer; ++layer) {
+            const auto& [first, count] = ranges[static_cast<size_t>(layer)];
+            if (count == 0) {
+                continue;
             }
-            glEnd();
+            if (run_length > 0 && first == run_start + run_length) {
+                run_length += count;
+                continue;
+            }
+            if (run_length > 0) {
+                submit(run_start, run_length);
+            }
+            run_start = first;
+            run_length = count;
+        }
+        if (run_length > 0) {
+            submit(run_start, run_length);
+        }
+    } else {
+        // No per-layer ranges: scan every strip, batching consecutive visible ones
+        size_t run_start = 0;
+        size_t run_length = 0;
+        for (size_t i = 0; i < strip_count; ++i) {
+            int strip_layer = static_cast<int>(geometry_->strip_layer_index[i]);
+            if (strip_layer >= start_layer && strip_layer <= end_layer) {
+                if (run_length == 0) {
+                    run_start = i;
+                }
+                run_length++;
+            } else if (run_length > 0) {
+                submit(run_start, run_length);
+                run_length = 0;
+            }
+        }
+        if (run_length > 0) {
+            submit(run_start, run_length);
         }
-        return;
     }
 
-    // Render only strips in the specified layer range
-    for (size_t i = 0; i < geometry_->strips.size(); ++i) {
-        // Check if this strip's layer is in range
-        uint16_t strip_layer = geometry_->strip_layer_index[i];
-        if (static_cast<int>(strip_layer) < start_layer ||
-            static_cast<int>(strip_layer) > end_layer) {
-            continue; // Skip strips outside the layer range
-        }
+    if (use_arrays) {
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_COLOR_ARRAY);
+    }
+}
 
+void GCodeTinyGLRenderer::submit_strips_immediate(size_t first, size_t count, float dim_factor) {
+    for (size_t i = first; i < first + count; ++i) {
         const auto& strip = geometry_->strips[i];
 
         glBegin(GL_TRIANGLE_STRIP);
@@ -617,38 +701,148 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
     }
 }
 
+void GCodeTinyGLRenderer::submit_strips_arrays(size_t first, size_t count) {
+    static_assert(sizeof(TriangleStrip) == 4 * sizeof(GLuint),
+                  "TriangleStrip must be four packed GLuint indices");
+    const auto* indices = reinterpret_cast<const GLuint*>(geometry_->strips[first].data());
+    glDrawElementsBatch(GL_TRIANGLE_STRIP, 4, static_cast<GLsizei>(count), indices);
+}
+
+bool GCodeTinyGLRenderer::prepare_vertex_arrays() {
+    if (vertex_arrays_.built) {
+        return true;
+    }
+    if (vertex_arrays_.over_budget) {
+        return false;
+    }
+
+    const size_t vertex_count = geometry_->vertices.size();
+    // positions + normals + colors + dimmed colors, 3 floats each
+    const size_t required_bytes = vertex_count * 12 * sizeof(float);
+    if (required_bytes > kVertexArrayBudgetBytes) {
+        spdlog::info("[GCode::Renderer] {} vertices need {:.1f} MB of vertex arrays (budget "
+                     "{:.1f} MB), using immediate mode",
+                     vertex_count, required_bytes / 1024.0 / 1024.0,
+                     kVertexArrayBudgetBytes / 1024.0 / 1024.0);
+        vertex_arrays_.over_budget = true;
+        return false;
+    }
+
+    auto& arrays = vertex_arrays_;
+    arrays.positions.resize(vertex_count * 3);
+    arrays.normals.resize(vertex_count * 3);
+    arrays.colors.resize(vertex_count * 3);
+
+    // Decode the small palettes once rather than per vertex
+    std::vector<glm::vec3> palette_colors(geometry_->color_palette.size());
+    for (size_t i = 0; i < palette_colors.size(); ++i) {
+        uint32_t color_rgb = geometry_->color_palette[i];
+        palette_colors[i] = glm::vec3(((color_rgb >> 16) & 0xFF) / 255.0f,
+                                      ((color_rgb >> 8) & 0xFF) / 255.0f,
+                                      (color_rgb & 0xFF) / 255.0f);
+    }
+
+    for (size_t i = 0; i < vertex_count; ++i) {
+        const auto& vertex = geometry_->vertices[i];
+        glm::vec3 pos = geometry_->quantization.dequantize_vec3(vertex.position);
+        const glm::vec3& normal = geometry_->normal_palette[vertex.normal_index];
+        const glm::vec3& color = palette_colors[vertex.color_index];
+
+        float* p = &arrays.positions[i * 3];
+        float* n = &arrays.normals[i * 3];
+        float* c = &arrays.colors[i * 3];
+        p[0] = pos.x;
+        p[1] = pos.y;
+        p[2] = pos.z;
+        n[0] = normal.x;
+        n[1] = normal.y;
+        n[2] = normal.z;
+        c[0] = color.r;
+        c[1] = color.g;
+        c[2] = color.b;
+    }
+
+    arrays.built = true;
+    spdlog::debug("[GCode::Renderer] Vertex arrays built: {} vertices, {:.2f} MB", vertex_count,
+                  (arrays.positions.size() * 3 * sizeof(float)) / 1024.0 / 1024.0);
+    return true;
+}
+
+void GCodeTinyGLRenderer::bind_vertex_arrays(float dim_factor) {
+    auto& arrays = vertex_arrays_;
+    const float* colors = arrays.colors.data();
+
+    if (dim_factor != 1.0f) {
+        // Ghost pass: dimmed copy is rebuilt only when the ghost opacity changes
+        if (arrays.dimmed_factor != dim_factor) {
+            arrays.dimmed_colors.resize(arrays.colors.size());
+            for (size_t i = 0; i < arrays.colors.size(); ++i) {
+                arrays.dimmed_colors[i] = arrays.colors[i] * dim_factor;
+            }
+            arrays.dimmed_factor = dim_factor;
+        }
+        colors = arrays.dimmed_colors.data();
+    }
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, arrays.positions.data());
+    glNormalPointer(GL_FLOAT, 0, arrays.normals.data());
+    glColorPointer(3, GL_FLOAT, 0, colors);
+}
+
+void GCodeTinyGLRenderer::invalidate_vertex_arrays() {
+    vertex_arrays_ = VertexArrays{};
+}
+
+bool GCodeTinyGLRenderer::ensure_draw_buf(int width, int height, lv_color_format_t format) {
+    if (draw_buf_ && draw_buf_->header.w == static_cast<uint32_t>(width) &&
+        draw_buf_->header.h == static_cast<uint32_t>(height) && draw_buf_->header.cf == format) {
+        return true;
+    }
+
+    if (draw_buf_) {
+        ImageCache::instance().invalidate(draw_buf_);
+        lv_draw_buf_destroy(draw_buf_);
+    }
+
+    draw_buf_ = lv_draw_buf_create(static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                                   format, 0);
+    if (!draw_buf_) {
+        spdlog::error("Failed to create LVGL draw buffer");
+        return false;
+    }
+    return true;
+}
+
 void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widget_coords) {
     if (!framebuffer_) {
         return;
     }
 
-    // Create or recreate LVGL draw buffer if size changed
-    if (!draw_buf_ || draw_buf_->header.w != static_cast<uint32_t>(viewport_width_) ||
-        draw_buf_->header.h != static_cast<uint32_t>(viewport_height_)) {
-        if (draw_buf_) {
-            lv_draw_buf_destroy(draw_buf_);
-        }
-
-        draw_buf_ =
-            lv_draw_buf_create(static_cast<uint32_t>(viewport_width_),
-                               static_cast<uint32_t>(viewport_height_), LV_COLOR_FORMAT_RGB888, 0);
-        if (!draw_buf_) {
-            spdlog::error("Failed to create LVGL draw buffer");
+    if (!framebuffer_is_draw_buf_) {
+        lv_color_format_t format = kConvertToRGB565 ? LV_COLOR_FORMAT_RGB565 : kTinyGLColorFormat;
+        if (!ensure_draw_buf(viewport_width_, viewport_height_, format)) {
             return;
         }
-    }
 
-    // Copy TinyGL framebuffer to LVGL draw buffer
-    // TinyGL ZB_MODE_RGBA is actually ABGR format (Alpha-Blue-Green-Red)
-    // LVGL uses RGB888, so we need to swap R and B
-    uint8_t* dest = (uint8_t*)draw_buf_->data;
-    unsigned int* src = framebuffer_;
-
-    for (int i = 0; i < viewport_width_ * viewport_height_; i++) {
-        unsigned int pixel = src[i];
-        dest[i * 3 + 0] = pixel & 0xFF;         // R (from TinyGL B channel)
-        dest[i * 3 + 1] = (pixel >> 8) & 0xFF;  // G (stays the same)
-        dest[i * 3 + 2] = (pixel >> 16) & 0xFF; // B (from TinyGL R channel)
+        // TinyGL rendered into its own buffer: convert (or copy) row by row, since the
+        // LVGL stride may include alignment padding
+        const auto* src = static_cast<const uint8_t*>(framebuffer_);
+        auto* dest = static_cast<uint8_t*>(draw_buf_->data);
+        const size_t src_stride = static_cast<size_t>(viewport_width_) * PSZB;
+        for (int y = 0; y < viewport_height_; y++) {
+            const uint8_t* src_row = src + static_cast<size_t>(y) * src_stride;
+            uint8_t* dest_row = dest + static_cast<size_t>(y) * draw_buf_->header.stride;
+            if (kConvertToRGB565) {
+                pixel_convert_xrgb8888_to_rgb565(reinterpret_cast<const uint32_t*>(src_row),
+                                                 reinterpret_cast<uint16_t*>(dest_row),
+                                                 static_cast<size_t>(viewport_width_));
+            } else {
+                memcpy(dest_row, src_row, src_stride);
+            }
+        }
     }
 
     // Draw image to layer at widget's screen position
@@ -667,13 +861,13 @@ void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widge
     lv_draw_image(layer, &img_dsc, &area);
 }
 
-void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode,
-                                 const GCodeCamera& camera, const lv_area_t* widget_coords) {
+bool GCodeTinyGLRenderer::render_offscreen(const ParsedGCodeFile& gcode,
+                                           const GCodeCamera& camera) {
     // Initialize TinyGL if needed
     if (!zbuffer_) {
         init_tinygl();
         if (!zbuffer_) {
-            return; // Initialization failed
+            return false; // Initialization failed
         }
     }
 
@@ -687,6 +881,23 @@ void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode
     spdlog::trace("TinyGL render: {} highlighted objects, gcode.objects.size()={}",
                   highlighted_objects_.size(), gcode.objects.size());
     render_bounding_box(gcode);
+    return true;
+}
+
+std::vector<uint8_t> GCodeTinyGLRenderer::capture_frame() const {
+    if (!framebuffer_) {
+        return {};
+    }
+    const auto* pixels = static_cast<const uint8_t*>(framebuffer_);
+    return std::vector<uint8_t>(
+        pixels, pixels + static_cast<size_t>(viewport_width_) * viewport_height_ * PSZB);
+}
+
+void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode,
+                                 const GCodeCamera& camera, const lv_area_t* widget_coords) {
+    if (!render_offscreen(gcode, camera)) {
+        return;
+    }
 
     // Draw to LVGL at widget's screen position
     draw_to_lvgl(layer, widget_coords);
@@ -25,6 +25,7 @@
 #include <cstring>
 #include <lvgl.h>
 #include <signal.h>
+#include <time.h>
 #include <unistd.h>
 
 // Signal handling for graceful shutdown
@@ -45,8 +46,9 @@ static constexpr int DEFAULT_HEIGHT = 480;
 static constexpr int FADE_DURATION_MS = 300; // Fast fade-in
 static constexpr int FRAME_DELAY_US = 16000; // ~60 FPS
 
-// Dark theme background color (matches app theme)
-static constexpr uint32_t BG_COLOR_DARK = 0x121212;
+// Dark theme background color (app_bg_color_dark, same as the app's own splash so the
+// handoff doesn't change color)
+static constexpr uint32_t BG_COLOR_DARK = 0x292A2D;
 
 /**
  * @brief Parse command line arguments
@@ -125,6 +127,9 @@ static lv_obj_t* create_splash_ui(lv_obj_t* screen, int width, int height) {
 }
 
 int main(int argc, char** argv) {
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
     // Set up signal handlers
     // SIGTERM/SIGINT: graceful shutdown
     // SIGUSR1: main app ready, hand off display
@@ -159,6 +164,16 @@ int main(int argc, char** argv) {
     lv_obj_t* container = create_splash_ui(screen, width, height);
     (void)container; // Used by animation, no need to track
 
+    // Draw the first frame now and report how long it took (compare with the app's
+    // "first_pixel" startup milestone)
+    lv_refr_now(display);
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long first_frame_ms =
+        (now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
+    printf("helix-splash: first frame after %ld ms\n", first_frame_ms);
+    fflush(stdout);
+
     // Main loop - run until signaled to quit
     // Exit signals: SIGTERM, SIGINT (shutdown), SIGUSR1 (main app ready)
     while (!g_quit) {
@@ -0,0 +1,187 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "image_cache.h"
+
+#include "lvgl/src/draw/lv_image_decoder_private.h" // For the decoders' own callbacks
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+namespace {
+
+constexpr const char* ASSET_PREFIX = "A:assets/images/";
+constexpr const char* NATIVE_DIR = "assets/images/native/";
+constexpr const char* PNG_EXT = ".png";
+constexpr const char* NATIVE_EXT = ".bin";
+
+// Callbacks of the decoders registered by lv_init(), replaced by the counting ones.
+// Written once on the main thread before anything is drawn, read-only afterwards.
+struct WrappedDecoder {
+    lv_image_decoder_t* decoder = nullptr;
+    lv_image_decoder_open_f_t open_cb = nullptr;
+    lv_image_decoder_close_f_t close_cb = nullptr;
+};
+
+constexpr size_t MAX_DECODERS = 8;
+WrappedDecoder g_wrapped[MAX_DECODERS];
+size_t g_wrapped_count = 0;
+
+const WrappedDecoder* find_wrapped(const lv_image_decoder_t* decoder) {
+    for (size_t i = 0; i < g_wrapped_count; i++) {
+        if (g_wrapped[i].decoder == decoder) {
+            return &g_wrapped[i];
+        }
+    }
+    return nullptr;
+}
+
+bool ends_with(const std::string& str, const char* suffix) {
+    size_t len = std::char_traits<char>::length(suffix);
+    return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+}
+
+} // namespace
+
+ImageCache& ImageCache::instance() {
+    static ImageCache instance;
+    return instance;
+}
+
+void ImageCache::init(uint32_t budget_bytes) {
+    if (budget_bytes > 0) {
+        budget_bytes = std::max(budget_bytes, MIN_BUDGET_KB * 1024);
+    }
+
+    lv_image_cache_resize(budget_bytes, true);
+    lv_image_header_cache_resize(budget_bytes > 0 ? HEADER_CACHE_COUNT : 0, true);
+    budget_bytes_ = budget_bytes;
+    install_counters();
+
+    spdlog::debug("[ImageCache] Decoded image budget {} KiB, {} header entries",
+                  budget_bytes / 1024, budget_bytes > 0 ? HEADER_CACHE_COUNT : 0);
+}
+
+void ImageCache::install_counters() {
+    if (counters_installed_) {
+        return;
+    }
+
+    for (lv_image_decoder_t* decoder = lv_image_decoder_get_next(nullptr); decoder;
+         decoder = lv_image_decoder_get_next(decoder)) {
+        if (g_wrapped_count == MAX_DECODERS) {
+            spdlog::warn("[ImageCache] Too many image decoders, not counting '{}'",
+                         decoder->name ? decoder->name : "?");
+            continue;
+        }
+        g_wrapped[g_wrapped_count++] = {decoder, decoder->open_cb, decoder->close_cb};
+        lv_image_decoder_set_open_cb(decoder, counting_open_cb);
+        lv_image_decoder_set_close_cb(decoder, counting_close_cb);
+    }
+    counters_installed_ = true;
+}
+
+lv_result_t ImageCache::counting_open_cb(lv_image_decoder_t* decoder,
+                                         lv_image_decoder_dsc_t* dsc) {
+    const WrappedDecoder* wrapped = find_wrapped(decoder);
+    if (!wrapped || !wrapped->open_cb) {
+        return LV_RESULT_INVALID;
+    }
+
+    // Only files are decoded; variables (C arrays) are used in place
+    if (dsc->src_type != LV_IMAGE_SRC_FILE) {
+        return wrapped->open_cb(decoder, dsc);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    lv_result_t res = wrapped->open_cb(decoder, dsc);
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+
+    if (res == LV_RESULT_OK) {
+        ImageCache& self = instance();
+        self.decodes_.fetch_add(1, std::memory_order_relaxed);
+        self.decode_us_.fetch_add(static_cast<uint64_t>(us), std::memory_order_relaxed);
+        spdlog::debug("[ImageCache] Decoded {} in {:.1f} ms", static_cast<const char*>(dsc->src),
+                      static_cast<double>(us) / 1000.0);
+    }
+    return res;
+}
+
+void ImageCache::counting_close_cb(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc) {
+    // Every successful open is closed, whether it was decoded or served from the cache
+    if (dsc->src_type == LV_IMAGE_SRC_FILE) {
+        instance().opens_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const WrappedDecoder* wrapped = find_wrapped(decoder);
+    if (wrapped && wrapped->close_cb) {
+        wrapped->close_cb(decoder, dsc);
+    }
+}
+
+std::string ImageCache::resolve(const std::string& src) {
+    if (src.compare(0, std::char_traits<char>::length(ASSET_PREFIX), ASSET_PREFIX) != 0 ||
+        !ends_with(src, PNG_EXT)) {
+        return src;
+    }
+
+    auto it = resolved_.find(src);
+    if (it != resolved_.end()) {
+        return it->second;
+    }
+
+    // "A:assets/images/<rel>.png" -> "assets/images/native/<rel>.bin"
+    size_t prefix_len = std::char_traits<char>::length(ASSET_PREFIX);
+    size_t ext_len = std::char_traits<char>::length(PNG_EXT);
+    std::string native = std::string(NATIVE_DIR) +
+                         src.substr(prefix_len, src.size() - prefix_len - ext_len) + NATIVE_EXT;
+
+    std::error_code ec;
+    std::string result = std::filesystem::exists(native, ec) ? "A:" + native : src;
+    resolved_.emplace(src, result);
+    return result;
+}
+
+void ImageCache::invalidate(const std::string& src) {
+    lv_image_cache_drop(src.c_str());
+    lv_image_header_cache_drop(src.c_str());
+}
+
+void ImageCache::invalidate(const lv_draw_buf_t* buf) {
+    // nullptr would drop the whole cache
+    if (buf) {
+        lv_image_cache_drop(buf);
+        lv_image_header_cache_drop(buf);
+    }
+}
+
+void ImageCache::drop_all() {
+    lv_image_cache_drop(nullptr);
+}
+
+ImageCache::Stats ImageCache::stats() const {
+    Stats stats;
+    stats.decodes = decodes_.load(std::memory_order_relaxed);
+    uint64_t opens = opens_.load(std::memory_order_relaxed);
+    stats.hits = opens > stats.decodes ? opens - stats.decodes : 0;
+    stats.decode_ms = static_cast<double>(decode_us_.load(std::memory_order_relaxed)) / 1000.0;
+    stats.budget_bytes = budget_bytes_;
+    return stats;
+}
+
+void ImageCache::reset_stats() {
+    opens_.store(0, std::memory_order_relaxed);
+    decodes_.store(0, std::memory_order_relaxed);
+    decode_us_.store(0, std::memory_order_relaxed);
+}
+
+void ImageCache::log_stats() const {
+    Stats s = stats();
+    spdlog::info("[ImageCache] {} hits, {} decodes ({:.1f} ms decoding), budget {} KiB", s.hits,
+                 s.decodes, s.decode_ms, s.budget_bytes / 1024);
+}
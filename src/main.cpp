@@ -37,6 +37,7 @@
 #include "ui_keyboard.h"
 #include "ui_nav.h"
 #include "ui_notification.h"
+#include "ui_notification_history.h"
 #include "ui_panel_advanced.h"
 #include "ui_panel_bed_mesh.h"
 #include "ui_panel_calibration_pid.h"
@@ -52,11 +53,13 @@
 #include "ui_panel_notification_history.h"
 #include "ui_panel_print_select.h"
 #include "ui_panel_print_status.h"
+#include "ui_panel_registry.h"
 #include "ui_panel_settings.h"
 #include "ui_panel_step_test.h"
 #include "ui_panel_temp_control.h"
 #include "ui_panel_test.h"
 #include "ui_severity_card.h"
+#include "ui_splash_screen.h"
 #include "ui_status_bar.h"
 #include "ui_switch.h"
 #include "ui_text.h"
@@ -66,15 +69,18 @@
 #include "ui_utils.h"
 #include "ui_wizard.h"
 #include "ui_wizard_wifi.h"
+#include "ui_xml_bundle.h"
 
 #include "app_globals.h"
 #include "config.h"
 #include "display_backend.h"
 #include "gcode_file_modifier.h"
+#include "image_cache.h"
 #include "logging_init.h"
 #include "lvgl/lvgl.h"
 #include "lvgl/src/libs/svg/lv_svg_decoder.h"
 #include "lvgl/src/xml/lv_xml.h"
+#include "main_loop_waker.h"
 #include "moonraker_api.h"
 #include "moonraker_api_mock.h"
 #include "moonraker_client.h"
@@ -83,6 +89,7 @@
 #include "runtime_config.h"
 #include "settings_manager.h"
 #include "sound_manager.h"
+#include "startup_trace.h"
 #include "tips_manager.h"
 #include "usb_backend_mock.h"
 #include "usb_manager.h"
@@ -92,6 +99,7 @@
 #ifdef HELIX_DISPLAY_SDL
 #include <SDL.h>
 #endif
+#include <algorithm>
 #include <cerrno>
 #include <cmath>
 #include <cstdio>
@@ -100,6 +108,7 @@
 #include <ctime>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <queue>
 #include <signal.h>
 #include <unistd.h>
@@ -237,6 +246,11 @@ static BedMeshPanel* bed_mesh_panel = nullptr;
 // Runtime configuration
 static RuntimeConfig g_runtime_config;
 
+// XML component of each main panel, indexed by ui_panel_id_t
+static const char* const MAIN_PANEL_COMPONENTS[UI_PANEL_COUNT] = {
+    "home_panel",     "print_select_panel", "controls_panel",
+    "filament_panel", "settings_panel",     "advanced_panel"};
+
 // Logging configuration (parsed before Config system is available)
 static std::string g_log_dest_cli; // CLI override for log destination
 static std::string g_log_file_cli; // CLI override for log file path
@@ -868,19 +882,23 @@ static void register_fonts_and_images() {
     lv_xml_register_font(NULL, "noto_sans_bold_24", &noto_sans_bold_24);
     lv_xml_register_font(NULL, "noto_sans_bold_28", &noto_sans_bold_28);
 
-    lv_xml_register_image(NULL, "A:assets/images/printer_400.png",
-                          "A:assets/images/printer_400.png");
-    lv_xml_register_image(NULL, "filament_spool", "A:assets/images/filament_spool.png");
-    lv_xml_register_image(NULL, "A:assets/images/placeholder_thumb_centered.png",
-                          "A:assets/images/placeholder_thumb_centered.png");
-    lv_xml_register_image(NULL, "A:assets/images/thumbnail-gradient-bg.png",
-                          "A:assets/images/thumbnail-gradient-bg.png");
-    lv_xml_register_image(NULL, "A:assets/images/thumbnail-placeholder.png",
-                          "A:assets/images/thumbnail-placeholder.png");
-    lv_xml_register_image(NULL, "A:assets/images/large-extruder-icon.svg",
-                          "A:assets/images/large-extruder-icon.svg");
-    lv_xml_register_image(NULL, "A:assets/images/benchy_thumbnail_white.png",
-                          "A:assets/images/benchy_thumbnail_white.png");
+    // PNGs resolve to their pre-converted variant when `make native-images` has been run
+    auto register_image = [](const char* name, const char* path) {
+        std::string src = ImageCache::instance().resolve(path);
+        lv_xml_register_image(NULL, name, src.c_str());
+    };
+    register_image("A:assets/images/printer_400.png", "A:assets/images/printer_400.png");
+    register_image("filament_spool", "A:assets/images/filament_spool.png");
+    register_image("A:assets/images/placeholder_thumb_centered.png",
+                   "A:assets/images/placeholder_thumb_centered.png");
+    register_image("A:assets/images/thumbnail-gradient-bg.png",
+                   "A:assets/images/thumbnail-gradient-bg.png");
+    register_image("A:assets/images/thumbnail-placeholder.png",
+                   "A:assets/images/thumbnail-placeholder.png");
+    register_image("A:assets/images/large-extruder-icon.svg",
+                   "A:assets/images/large-extruder-icon.svg");
+    register_image("A:assets/images/benchy_thumbnail_white.png",
+                   "A:assets/images/benchy_thumbnail_white.png");
 }
 
 // Register XML components from ui_xml/ directory
@@ -899,83 +917,79 @@ static void register_xml_components() {
     // Register custom widgets (BEFORE components that use them)
     ui_gcode_viewer_register();
 
-    lv_xml_register_component_from_file("A:ui_xml/icon.xml");
-    lv_xml_register_component_from_file("A:ui_xml/header_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/overlay_backdrop.xml");   // Modal dimming layer
-    lv_xml_register_component_from_file("A:ui_xml/overlay_panel_base.xml"); // Base styling only
-    lv_xml_register_component_from_file(
-        "A:ui_xml/overlay_panel.xml"); // Depends on header_bar + base
-    lv_xml_register_component_from_file("A:ui_xml/status_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/toast_notification.xml");
-    lv_xml_register_component_from_file("A:ui_xml/emergency_stop_button.xml");
-    lv_xml_register_component_from_file("A:ui_xml/estop_confirmation_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/klipper_recovery_dialog.xml");
+    ui_xml_register_component("icon");
+    ui_xml_register_component("header_bar");
+    ui_xml_register_component("overlay_backdrop");   // Modal dimming layer
+    ui_xml_register_component("overlay_panel_base"); // Base styling only
+    ui_xml_register_component("overlay_panel"); // Depends on header_bar + base
+    ui_xml_register_component("status_bar");
+    ui_xml_register_component("toast_notification");
+    ui_xml_register_component("emergency_stop_button");
+    ui_xml_register_component("estop_confirmation_dialog");
+    ui_xml_register_component("klipper_recovery_dialog");
     // Note: error_dialog.xml and warning_dialog.xml removed - use modal_dialog instead
     spdlog::debug("[XML] Registering notification_history_panel.xml...");
-    auto nh_panel_ret =
-        lv_xml_register_component_from_file("A:ui_xml/notification_history_panel.xml");
+    auto nh_panel_ret = ui_xml_register_component("notification_history_panel");
     spdlog::debug("[XML] notification_history_panel.xml registration returned: {}",
                   (int)nh_panel_ret);
     spdlog::debug("[XML] Registering notification_history_item.xml...");
-    auto nh_item_ret =
-        lv_xml_register_component_from_file("A:ui_xml/notification_history_item.xml");
+    auto nh_item_ret = ui_xml_register_component("notification_history_item");
     spdlog::debug("[XML] notification_history_item.xml registration returned: {}",
                   (int)nh_item_ret);
     // Note: confirmation_dialog.xml, tip_detail_dialog.xml removed - use modal_dialog instead
-    lv_xml_register_component_from_file("A:ui_xml/modal_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/numeric_keypad_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_file_card.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_file_list_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_file_detail.xml");
-    lv_xml_register_component_from_file("A:ui_xml/navigation_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/home_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/controls_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/motion_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/nozzle_temp_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/bed_temp_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/extrusion_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/fan_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_status_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/filament_panel.xml");
+    ui_xml_register_component("modal_dialog");
+    ui_xml_register_component("numeric_keypad_modal");
+    ui_xml_register_component("print_file_card");
+    ui_xml_register_component("print_file_list_row");
+    ui_xml_register_component("print_file_detail");
+    ui_xml_register_component("navigation_bar");
+    ui_xml_register_component("home_panel");
+    ui_xml_register_component("controls_panel");
+    ui_xml_register_component("motion_panel");
+    ui_xml_register_component("nozzle_temp_panel");
+    ui_xml_register_component("bed_temp_panel");
+    ui_xml_register_component("extrusion_panel");
+    ui_xml_register_component("fan_panel");
+    ui_xml_register_component("print_status_panel");
+    ui_xml_register_component("filament_panel");
     // Settings row components (must be registered before settings_panel)
-    lv_xml_register_component_from_file("A:ui_xml/setting_section_header.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_toggle_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_dropdown_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_action_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_info_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_slider_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/settings_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/restart_prompt_dialog.xml");
+    ui_xml_register_component("setting_section_header");
+    ui_xml_register_component("setting_toggle_row");
+    ui_xml_register_component("setting_dropdown_row");
+    ui_xml_register_component("setting_action_row");
+    ui_xml_register_component("setting_info_row");
+    ui_xml_register_component("setting_slider_row");
+    ui_xml_register_component("settings_panel");
+    ui_xml_register_component("restart_prompt_dialog");
     // Calibration panels (overlays launched from settings)
-    lv_xml_register_component_from_file("A:ui_xml/calibration_zoffset_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/calibration_pid_panel.xml");
+    ui_xml_register_component("calibration_zoffset_panel");
+    ui_xml_register_component("calibration_pid_panel");
     spdlog::debug("[XML] Registering bed_mesh_panel.xml...");
-    auto ret = lv_xml_register_component_from_file("A:ui_xml/bed_mesh_panel.xml");
+    auto ret = ui_xml_register_component("bed_mesh_panel");
     spdlog::debug("[XML] bed_mesh_panel.xml registration returned: {}", (int)ret);
     // Settings overlay panels (launched from settings rows)
-    lv_xml_register_component_from_file("A:ui_xml/display_settings_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/network_settings_overlay.xml");
+    ui_xml_register_component("display_settings_overlay");
+    ui_xml_register_component("network_settings_overlay");
     // Note: factory_reset_dialog.xml removed - use modal_dialog instead
-    lv_xml_register_component_from_file("A:ui_xml/advanced_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/test_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_select_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/step_progress_test.xml");
-    lv_xml_register_component_from_file("A:ui_xml/gcode_test_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/glyphs_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/gradient_test_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/app_layout.xml");
-    lv_xml_register_component_from_file(
-        "A:ui_xml/wizard_header_bar.xml"); // Must come before wizard_container
-    lv_xml_register_component_from_file("A:ui_xml/wizard_container.xml");
-    lv_xml_register_component_from_file("A:ui_xml/network_list_item.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wifi_password_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_wifi_setup.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_connection.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_printer_identify.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_heater_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_fan_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_led_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_summary.xml");
+    ui_xml_register_component("advanced_panel");
+    ui_xml_register_component("test_panel");
+    ui_xml_register_component("print_select_panel");
+    ui_xml_register_component("step_progress_test");
+    ui_xml_register_component("gcode_test_panel");
+    ui_xml_register_component("glyphs_panel");
+    ui_xml_register_component("gradient_test_panel");
+    ui_xml_register_component("app_layout");
+    ui_xml_register_component("wizard_header_bar"); // Must come before wizard_container
+    ui_xml_register_component("wizard_container");
+    ui_xml_register_component("network_list_item");
+    ui_xml_register_component("wifi_password_modal");
+    ui_xml_register_component("wizard_wifi_setup");
+    ui_xml_register_component("wizard_connection");
+    ui_xml_register_component("wizard_printer_identify");
+    ui_xml_register_component("wizard_heater_select");
+    ui_xml_register_component("wizard_fan_select");
+    ui_xml_register_component("wizard_led_select");
+    ui_xml_register_component("wizard_summary");
 }
 
 // Initialize all reactive subjects for data binding
@@ -1003,8 +1017,16 @@ static void initialize_subjects() {
     print_select_panel = get_print_select_panel(get_printer_state(), nullptr);
     print_select_panel->init_subjects();
 
-    // Initialize UsbManager with mock backend in test mode
+    // Initialize UsbManager with mock backend in test mode. Inserted drives are catalogued
+    // in the background; the saved indexes make re-inserting a drive instant.
     usb_manager = std::make_unique<UsbManager>(g_runtime_config.should_mock_usb());
+    {
+        Config* config = Config::get_instance();
+        usb_manager->catalog().set_cache_dir(config->get<std::string>(
+            config->df() + "usb_catalog_dir", "/tmp/helix_usb_catalog"));
+        usb_manager->catalog().set_worker_count(
+            config->get<int>(config->df() + "usb_catalog_workers", UsbCatalog::DEFAULT_WORKERS));
+    }
     if (usb_manager->start()) {
         spdlog::info("UsbManager started (mock={})", g_runtime_config.should_mock_usb());
         print_select_panel->set_usb_manager(usb_manager.get());
@@ -1030,6 +1052,15 @@ static void initialize_subjects() {
     // Inject TempControlPanel into HomePanel for temperature icon click
     get_global_home_panel().set_temp_control_panel(temp_control_panel.get());
 
+    // Restore notification history from its log next to the config; changes are appended
+    // in batches by a background thread
+    {
+        std::string config_path = Config::get_instance()->get_path();
+        size_t slash = config_path.find_last_of('/');
+        std::string config_dir = (slash == std::string::npos) ? "." : config_path.substr(0, slash);
+        NotificationHistory::instance().open_log(config_dir + "/helix_notifications.log");
+    }
+
     // Initialize notification system (after subjects are ready)
     ui_notification_init();
 
@@ -1075,10 +1106,52 @@ static void initialize_subjects() {
     }
 }
 
+// Create a main panel on first navigation (nav factory, see ui_nav_set_panel_factory())
+static lv_obj_t* create_main_panel(ui_panel_id_t panel_id) {
+    return PanelRegistry::instance().get(MAIN_PANEL_COMPONENTS[panel_id]);
+}
+
+// Register the launcher panels for lazy creation and queue them for idle pre-warming
+static void register_lazy_main_panels(lv_obj_t* panel_container, lv_obj_t* screen) {
+    auto& registry = PanelRegistry::instance();
+
+    // Controls panel (wire launcher card click handlers)
+    registry.add(MAIN_PANEL_COMPONENTS[UI_PANEL_CONTROLS], panel_container,
+                 [screen](lv_obj_t* obj) { get_global_controls_panel().setup(obj, screen); });
+
+    // Filament panel (wire preset/action button handlers)
+    registry.add(MAIN_PANEL_COMPONENTS[UI_PANEL_FILAMENT], panel_container,
+                 [screen](lv_obj_t* obj) { get_global_filament_panel().setup(obj, screen); });
+
+    // Settings panel (wire launcher card click handlers)
+    registry.add(MAIN_PANEL_COMPONENTS[UI_PANEL_SETTINGS], panel_container,
+                 [screen](lv_obj_t* obj) { get_global_settings_panel().setup(obj, screen); });
+
+    // Advanced panel (wire action row click handlers)
+    registry.add(MAIN_PANEL_COMPONENTS[UI_PANEL_ADVANCED], panel_container,
+                 [screen](lv_obj_t* obj) { get_global_advanced_panel().setup(obj, screen); });
+
+    ui_nav_set_panel_factory(create_main_panel);
+
+    Config* config = Config::get_instance();
+    if (config->get<bool>(config->df() + "prewarm_panels", true)) {
+        // Most visited first
+        registry.prewarm({MAIN_PANEL_COMPONENTS[UI_PANEL_CONTROLS],
+                          MAIN_PANEL_COMPONENTS[UI_PANEL_SETTINGS],
+                          MAIN_PANEL_COMPONENTS[UI_PANEL_FILAMENT],
+                          MAIN_PANEL_COMPONENTS[UI_PANEL_ADVANCED]});
+    }
+    registry.set_memory_pressure_threshold(static_cast<size_t>(
+        std::max(config->get<int>(config->df() + "panel_evict_below_kb", 8192), 0)));
+}
+
 // Initialize LVGL with auto-detected display backend
 static bool init_lvgl() {
     lv_init();
 
+    // Main loop sleeps until the next LVGL timer; background threads and input wake it
+    MainLoopWaker::instance().init();
+
     // Create display backend (auto-detects: DRM → framebuffer → SDL)
     g_display_backend = DisplayBackend::create_auto();
     if (!g_display_backend) {
@@ -1137,6 +1210,10 @@ static bool init_lvgl() {
         lv_indev_set_scroll_throw(indev_mouse, static_cast<uint8_t>(scroll_throw));
         lv_indev_set_scroll_limit(indev_mouse, static_cast<uint8_t>(scroll_limit));
         spdlog::debug("Scroll config: throw={}, limit={}", scroll_throw, scroll_limit);
+
+        // Pause the pointer's read timer while idle; device activity wakes the main loop
+        MainLoopWaker::instance().watch_input(indev_mouse,
+                                              g_display_backend->pointer_device_path());
     }
 
     // Create keyboard input device (optional - enables physical keyboard input)
@@ -1156,88 +1233,13 @@ static bool init_lvgl() {
     // Initialize SVG decoder for loading .svg files
     lv_svg_decoder_init();
 
-    return true;
-}
-
-// Show splash screen with HelixScreen logo
-static void show_splash_screen() {
-    spdlog::debug("Showing splash screen");
-
-    // Get the active screen
-    lv_obj_t* screen = lv_screen_active();
-
-    // Apply theme background color (app_bg_color runtime constant set by ui_theme_init)
-    ui_theme_apply_bg_color(screen, "app_bg_color", LV_PART_MAIN);
-
-    // Disable scrollbars on screen
-    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
-
-    // Create centered container for logo (disable scrolling)
-    lv_obj_t* container = lv_obj_create(screen);
-    lv_obj_set_size(container, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(container, 0, LV_PART_MAIN);
-    lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);         // Disable scrollbars
-    lv_obj_set_style_opa(container, LV_OPA_TRANSP, LV_PART_MAIN); // Start invisible for fade-in
-    lv_obj_center(container);
-
-    // Create image widget for logo
-    lv_obj_t* logo = lv_image_create(container);
-    const char* logo_path = "A:assets/images/helixscreen-logo.png";
-    lv_image_set_src(logo, logo_path);
-
-    // Get actual image dimensions
-    lv_image_header_t header;
-    lv_result_t res = lv_image_decoder_get_info(logo_path, &header);
-
-    if (res == LV_RESULT_OK) {
-        // Scale logo to fill more of the screen (60% of screen width)
-        lv_coord_t target_size = (SCREEN_WIDTH * 3) / 5; // 60% of screen width
-        if (SCREEN_HEIGHT < 500) {                       // Tiny screen
-            target_size = SCREEN_WIDTH / 2;              // 50% on tiny screens
-        }
-
-        // Calculate scale: (target_size * 256) / actual_width
-        // LVGL uses 1/256 scale units (256 = 100%, 128 = 50%, etc.)
-        uint32_t width = header.w;  // Copy bit-field to local var for logging
-        uint32_t height = header.h; // Copy bit-field to local var for logging
-        uint32_t scale = (static_cast<uint32_t>(target_size) * 256U) / width;
-        lv_image_set_scale(logo, scale);
-
-        spdlog::debug("Logo: {}x{} scaled to {} (scale factor: {})", width, height, target_size,
-                      scale);
-    } else {
-        spdlog::warn("Could not get logo dimensions, using default scale");
-        lv_image_set_scale(logo, 128); // 50% scale as fallback
-    }
-
-    // Create fade-in animation (0.5 seconds)
-    lv_anim_t anim;
-    lv_anim_init(&anim);
-    lv_anim_set_var(&anim, container);
-    lv_anim_set_values(&anim, LV_OPA_TRANSP, LV_OPA_COVER);
-    lv_anim_set_duration(&anim, 500); // 500ms = 0.5 seconds
-    lv_anim_set_path_cb(&anim, lv_anim_path_ease_in);
-    lv_anim_set_exec_cb(&anim, [](void* obj, int32_t value) {
-        lv_obj_set_style_opa((lv_obj_t*)obj, static_cast<lv_opa_t>(value), LV_PART_MAIN);
-    });
-    lv_anim_start(&anim);
-
-    // Run LVGL timer to process fade-in animation and keep splash visible
-    // Total display time: 2 seconds (including 0.5s fade-in)
-    uint32_t splash_start = helix_get_ticks();
-    uint32_t splash_duration = 2000; // 2 seconds total
-
-    while (helix_get_ticks() - splash_start < splash_duration) {
-        lv_timer_handler(); // Process animations and rendering
-        helix_delay(5);
-    }
-
-    // Clean up splash screen
-    lv_obj_delete(container);
+    // Decoded image budget and decode counters (after all decoders are registered)
+    Config* config = Config::get_instance();
+    int image_cache_kb = config->get<int>(config->df() + "image_cache_kb",
+                                          static_cast<int>(ImageCache::DEFAULT_BUDGET_KB));
+    ImageCache::instance().init(static_cast<uint32_t>(std::max(image_cache_kb, 0)) * 1024);
 
-    spdlog::debug("Splash screen complete");
+    return true;
 }
 
 // Save screenshot using SDL renderer
@@ -1351,6 +1353,19 @@ static void initialize_moonraker_client(Config* config) {
     moonraker_client->configure_timeouts(connection_timeout, request_timeout, keepalive_interval,
                                          reconnect_min_delay, reconnect_max_delay);
 
+    // Coalesce bursts of requests (discovery, file metadata) into one flush
+    uint32_t batch_window = static_cast<uint32_t>(
+        config->get<int>(config->df() + "moonraker_batch_window_ms", 5));
+    moonraker_client->configure_batching(batch_window);
+
+    // Cache discovery results next to the config so reconnects can subscribe immediately
+    if (config->get<bool>(config->df() + "moonraker_fast_reconnect", true)) {
+        std::string config_path = config->get_path();
+        size_t slash = config_path.find_last_of('/');
+        std::string config_dir = (slash == std::string::npos) ? "." : config_path.substr(0, slash);
+        moonraker_client->set_discovery_snapshot_path(config_dir + "/helix_discovery_cache.json");
+    }
+
     spdlog::debug("Moonraker timeouts configured: connection={}ms, request={}ms, keepalive={}ms",
                   connection_timeout, request_timeout, keepalive_interval);
 
@@ -1390,15 +1405,21 @@ static void initialize_moonraker_client(Config* config) {
         state_change["old_state"] = static_cast<int>(old_state);
         state_change["new_state"] = static_cast<int>(new_state);
         notification_queue.push(state_change);
+        MainLoopWaker::instance().wake();
     });
 
     // Register notification callback to queue updates for main thread
     // CRITICAL: Moonraker callbacks run on background thread, but LVGL is NOT thread-safe
     // Queue notifications here, process on main thread in event loop
-    moonraker_client->register_notify_update([](json notification) {
-        std::lock_guard<std::mutex> lock(notification_mutex);
-        notification_queue.push(notification);
-    });
+    moonraker_client->register_notify_update(
+        [](const json& notification) {
+            {
+                std::lock_guard<std::mutex> lock(notification_mutex);
+                notification_queue.push(notification);
+            }
+            MainLoopWaker::instance().wake();
+        },
+        "main_notification_queue");
 
     // Create MoonrakerAPI instance (mock or real based on test mode)
     spdlog::debug("Creating MoonrakerAPI instance...");
@@ -1448,6 +1469,9 @@ static void initialize_moonraker_client(Config* config) {
 
 // Main application
 int main(int argc, char** argv) {
+    // Startup phases are timed from here until the first frame is on screen
+    StartupTrace::instance().reset();
+
     // Store argv early for restart capability (before any modifications)
     app_store_argv(argc, argv);
 
@@ -1632,6 +1656,7 @@ int main(int argc, char** argv) {
     }
 
     // Initialize LVGL with display backend
+    StartupTrace::instance().begin("display_init");
     if (!init_lvgl()) {
         return 1;
     }
@@ -1653,20 +1678,33 @@ int main(int argc, char** argv) {
     // Initialize app-level resize handler for responsive layouts
     ui_resize_handler_init(screen);
 
-    // Initialize tips manager (uses standard C++ file I/O, not LVGL's "A:" filesystem)
-    TipsManager* tips_mgr = TipsManager::get_instance();
-    if (!tips_mgr->init("config/printing_tips.json")) {
-        spdlog::warn("Tips manager failed to initialize - tips will not be available");
-    } else {
-        spdlog::debug("Loaded {} tips", tips_mgr->get_total_tips());
+    // Show the splash as soon as the display exists; the UI is built beneath it and
+    // revealed before the main loop (skip if requested via --skip-splash or --test)
+    SplashScreen splash;
+    if (!g_runtime_config.should_skip_splash()) {
+        splash.show(display, dark_mode);
+        StartupTrace::instance().mark("first_pixel");
     }
 
+    // Load tips while the UI is built (standard C++ file I/O, TipsManager locks internally)
+    std::thread tips_loader([] {
+        TipsManager* tips_mgr = TipsManager::get_instance();
+        if (!tips_mgr->init("config/printing_tips.json")) {
+            spdlog::warn("Tips manager failed to initialize - tips will not be available");
+        } else {
+            spdlog::debug("Loaded {} tips", tips_mgr->get_total_tips());
+        }
+    });
+
     // Register fonts and images for XML (must be done BEFORE globals.xml for theme init)
+    StartupTrace::instance().begin("fonts_images");
     register_fonts_and_images();
+    splash.pump();
 
     // Register XML components (globals first to make constants available)
+    StartupTrace::instance().begin("theme");
     spdlog::debug("Registering XML components...");
-    lv_xml_register_component_from_file("A:ui_xml/globals.xml");
+    ui_xml_register_component("globals");
 
     // Initialize LVGL theme from globals.xml constants (after fonts and globals are registered)
     ui_theme_init(display,
@@ -1676,15 +1714,11 @@ int main(int argc, char** argv) {
 
     // Apply theme background color to screen
     ui_theme_apply_bg_color(screen, "app_bg_color", LV_PART_MAIN);
-
-    // Show splash screen AFTER theme init (skip if requested via --skip-splash or --test)
-    // Theme must be initialized first so app_bg_color runtime constant is available
-    if (!g_runtime_config.should_skip_splash()) {
-        show_splash_screen();
-    }
+    splash.pump();
 
     // Register custom widgets (must be before XML component registration)
     // Note: Material Design icons are now font-based (mdi_icons_*.c)
+    StartupTrace::instance().begin("xml_parse");
     // Icon lookup happens via ui_icon_codepoints.h
     ui_icon_register_widget();
     ui_switch_register();
@@ -1704,14 +1738,22 @@ int main(int argc, char** argv) {
 
     // Register remaining XML components (globals already registered for theme init)
     register_xml_components();
+    splash.pump();
 
     // Initialize reactive subjects BEFORE creating XML
+    StartupTrace::instance().begin("subjects");
     initialize_subjects();
 
     // Register status bar event callbacks BEFORE creating XML (so LVGL can find them)
     ui_status_bar_register_callbacks();
+    splash.pump();
+
+    // Panels show tips, so loading must be done
+    tips_loader.join();
 
-    // Create entire UI from XML (single component contains everything)
+    // Create the app layout from XML (navbar, Home and Print Select; other main panels are
+    // created on first navigation)
+    StartupTrace::instance().begin("panel_creation");
     lv_obj_t* app_layout = (lv_obj_t*)lv_xml_create(screen, "app_layout", NULL);
 
     // Disable scrollbars on screen to prevent overflow issues with overlay panels
@@ -1757,16 +1799,12 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    // Find all panel widgets by name (robust to child order changes)
-    static const char* panel_names[UI_PANEL_COUNT] = {"home_panel",     "print_select_panel",
-                                                      "controls_panel", "filament_panel",
-                                                      "settings_panel", "advanced_panel"};
-
-    lv_obj_t* panels[UI_PANEL_COUNT];
-    for (int i = 0; i < UI_PANEL_COUNT; i++) {
-        panels[i] = lv_obj_find_by_name(panel_container, panel_names[i]);
+    // Find the panels created with app_layout by name (robust to child order changes)
+    lv_obj_t* panels[UI_PANEL_COUNT] = {};
+    for (int i : {UI_PANEL_HOME, UI_PANEL_PRINT_SELECT}) {
+        panels[i] = lv_obj_find_by_name(panel_container, MAIN_PANEL_COMPONENTS[i]);
         if (!panels[i]) {
-            spdlog::error("Missing panel '{}' in panel_container", panel_names[i]);
+            spdlog::error("Missing panel '{}' in panel_container", MAIN_PANEL_COMPONENTS[i]);
             lv_deinit();
             return 1;
         }
@@ -1778,21 +1816,13 @@ int main(int argc, char** argv) {
     // Setup home panel observers (panels[0] is home panel)
     get_global_home_panel().setup(panels[0], screen);
 
-    // Setup controls panel (wire launcher card click handlers)
-    get_global_controls_panel().setup(panels[UI_PANEL_CONTROLS], screen);
-
     // Setup print select panel (wires up events, creates overlays, NOTE: data populated later)
     get_print_select_panel(get_printer_state(), nullptr)
         ->setup(panels[UI_PANEL_PRINT_SELECT], screen);
 
-    // Setup filament panel (wire preset/action button handlers)
-    get_global_filament_panel().setup(panels[UI_PANEL_FILAMENT], screen);
-
-    // Setup settings panel (wire launcher card click handlers)
-    get_global_settings_panel().setup(panels[UI_PANEL_SETTINGS], screen);
-
-    // Setup advanced panel (wire action row click handlers)
-    get_global_advanced_panel().setup(panels[UI_PANEL_ADVANCED], screen);
+    // Launcher panels are created and set up on first navigation (subjects are already
+    // initialized, so XML bindings resolve as if they had been created at startup)
+    register_lazy_main_panels(panel_container, screen);
 
     // Initialize numeric keypad modal component (creates reusable keypad widget)
     ui_keypad_init(screen);
@@ -1813,6 +1843,8 @@ int main(int argc, char** argv) {
     }
 
     spdlog::debug("XML UI created successfully with reactive navigation");
+    splash.pump();
+    StartupTrace::instance().begin("services");
 
     // Test notifications - commented out, uncomment to debug notification history
     // if (get_runtime_config().test_mode) {
@@ -2065,6 +2097,11 @@ int main(int argc, char** argv) {
             // Update version info from client (for Settings About section)
             get_printer_state().set_klipper_version(moonraker_client->get_software_version());
             get_printer_state().set_moonraker_version(moonraker_client->get_moonraker_version());
+
+            // Prefill temperature history so graphs open with the last minutes of data
+            moonraker_api->load_temperature_history(nullptr, [](const MoonrakerError& err) {
+                spdlog::warn("Temperature history unavailable: {}", err.message);
+            });
         });
 
         // Connect to Moonraker
@@ -2104,6 +2141,22 @@ int main(int argc, char** argv) {
     uint32_t timeout_check_interval = static_cast<uint32_t>(
         config->get<int>(config->df() + "moonraker_timeout_check_interval_ms", 2000));
 
+    // Upper bound on one main loop sleep. Work queued from other threads normally wakes
+    // the loop immediately; this only bounds the delay for lv_async_call() sites that don't.
+    MainLoopWaker& waker = MainLoopWaker::instance();
+    uint32_t max_sleep_ms = static_cast<uint32_t>(
+        std::max(config->get<int>(config->df() + "main_loop_max_sleep_ms", 500), 1));
+    uint32_t last_wake_report = helix_get_ticks();
+    MainLoopWakeStats last_wake_stats = waker.get_stats();
+
+    // Reveal the UI; the splash fades out from the main loop. The startup trace ends with
+    // the first frame of the UI on screen (time to interactive)
+    splash.dismiss();
+    StartupTrace::instance().finish_on_first_frame(display);
+
+    // systemctl stop/restart sends SIGTERM: leave the loop so the shutdown below runs
+    app_install_signal_handlers();
+
     // Main event loop - LVGL handles display events internally via lv_timer_handler()
     // Loop continues while display exists and quit not requested
     while (lv_display_get_next(NULL) && !app_quit_requested()) {
@@ -2138,6 +2191,9 @@ int main(int argc, char** argv) {
             last_timeout_check = current_time;
         }
 
+        // Write any coalesced requests whose batching window has elapsed
+        moonraker_client->flush_outgoing();
+
         // Process queued Moonraker notifications on main thread (LVGL thread-safety)
         {
             std::lock_guard<std::mutex> lock(notification_mutex);
@@ -2167,13 +2223,82 @@ int main(int argc, char** argv) {
         }
 
         // Run LVGL tasks - handles display events and processes input
-        lv_timer_handler();
+        uint32_t sleep_ms = std::min(lv_timer_handler(), max_sleep_ms);
         fflush(stdout);
-        helix_delay(5); // Small delay to prevent 100% CPU usage
+
+        // Sleep until the next LVGL timer or loop deadline, whichever comes first.
+        // Queued notifications, async calls and input activity end the sleep early.
+        uint32_t now = helix_get_ticks();
+        uint32_t since_timeout_check = now - last_timeout_check;
+        sleep_ms = std::min(sleep_ms, since_timeout_check < timeout_check_interval
+                                          ? timeout_check_interval - since_timeout_check
+                                          : 0U);
+        sleep_ms = std::min(sleep_ms, moonraker_client->ms_until_flush());
+        if (screenshot_enabled && !screenshot_taken) {
+            sleep_ms = std::min(sleep_ms, screenshot_time > now ? screenshot_time - now : 0U);
+        }
+        if (timeout_sec > 0) {
+            uint32_t elapsed = now - start_time;
+            sleep_ms = std::min(sleep_ms, elapsed < timeout_ms ? timeout_ms - elapsed : 0U);
+        }
+        waker.wait(sleep_ms);
+
+        // Idle wakeup rate (the old fixed 5ms poll woke ~200 times per second)
+        if (now - last_wake_report >= 60000) {
+            MainLoopWakeStats stats = waker.get_stats();
+            double seconds = (now - last_wake_report) / 1000.0;
+            spdlog::debug("[MainLoop] {:.1f} wakeups/s (timer {}, signal {}, input {})",
+                          (stats.wakeups() - last_wake_stats.wakeups()) / seconds,
+                          stats.timer_wakeups - last_wake_stats.timer_wakeups,
+                          stats.signal_wakeups - last_wake_stats.signal_wakeups,
+                          stats.input_wakeups - last_wake_stats.input_wakeups);
+            last_wake_stats = stats;
+            last_wake_report = now;
+        }
     }
 
     // Cleanup
-    spdlog::info("Shutting down...");
+    if (app_quit_signal() != 0) {
+        spdlog::info("Received signal {}, shutting down...", app_quit_signal());
+    } else {
+        spdlog::info("Shutting down...");
+    }
+
+    MainLoopWakeStats wake_stats = waker.get_stats();
+    spdlog::debug("[MainLoop] {} wakeups ({} timer, {} signal, {} input), {}s asleep",
+                  wake_stats.wakeups(), wake_stats.timer_wakeups, wake_stats.signal_wakeups,
+                  wake_stats.input_wakeups, wake_stats.slept_ms / 1000);
+    ImageCache::instance().log_stats();
+    waker.shutdown(); // Resumes paused input read timers before LVGL teardown
+
+    // Settings changed in the last second are still waiting in the config writer
+    config->flush();
+    FileWriteStats save_stats = config->get_save_stats();
+    spdlog::debug("[Config] {} saves, {} coalesced, {} writes, {} failed", save_stats.requests,
+                  save_stats.coalesced, save_stats.writes, save_stats.failures);
+
+    // Notifications from the last batch window are still waiting in the log writer
+    NotificationHistory::instance().close_log();
+
+    // Request latency summary (useful for tuning batching and timeout intervals)
+    for (const auto& [method, hist] : moonraker_client->get_method_latency()) {
+        spdlog::debug("[Moonraker Client] {}: {} calls, mean {:.1f}ms, p95 <{}ms, max {}ms",
+                      method, hist.count, hist.mean_ms(), hist.percentile_ms(0.95), hist.max_ms);
+    }
+
+    // Notification handler cost (slow subscribers stall the WebSocket thread)
+    for (const auto& method_stats : moonraker_client->get_notification_stats()) {
+        spdlog::debug("[Moonraker Client] {}: {} notifications, {}us in handlers",
+                      method_stats.method, method_stats.received, method_stats.handler_us);
+        for (const auto& handler : method_stats.handlers) {
+            spdlog::debug("[Moonraker Client]   {}: {} calls, mean {:.0f}us, max {}us",
+                          handler.name, handler.calls,
+                          handler.calls > 0 ? static_cast<double>(handler.total_us) /
+                                                  static_cast<double>(handler.calls)
+                                            : 0.0,
+                          handler.max_us);
+        }
+    }
 
     // Clear app_globals references before destroying instances
     set_moonraker_api(nullptr);
@@ -2185,6 +2310,10 @@ int main(int argc, char** argv) {
 
     // Clean up USB manager explicitly BEFORE spdlog shutdown.
     // UsbBackendMock::stop() logs, and we need spdlog alive for that.
+    // Detach the print select panel first: it outlives the manager (static destruction).
+    if (print_select_panel) {
+        print_select_panel->set_usb_manager(nullptr);
+    }
     usb_manager.reset();
 
     // Clean up wizard WiFi step explicitly BEFORE lv_deinit and spdlog shutdown.
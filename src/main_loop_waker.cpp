@@ -0,0 +1,233 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "main_loop_waker.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+namespace {
+
+// Discard everything readable on a non-blocking descriptor
+void drain_fd(int fd) {
+    char buf[256];
+    while (read(fd, buf, sizeof(buf)) > 0) {
+    }
+}
+
+#ifndef __linux__
+bool set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0 &&
+           fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+}
+#endif
+
+} // namespace
+
+MainLoopWaker& MainLoopWaker::instance() {
+    static MainLoopWaker instance;
+    return instance;
+}
+
+MainLoopWaker::~MainLoopWaker() {
+    shutdown();
+}
+
+bool MainLoopWaker::init() {
+    if (wake_read_fd_ >= 0) {
+        return true;
+    }
+
+#ifdef __linux__
+    wake_read_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_read_fd_ < 0) {
+        spdlog::error("[MainLoop] eventfd() failed: {}", strerror(errno));
+        return false;
+    }
+    wake_write_fd_ = wake_read_fd_;
+#else
+    int fds[2];
+    if (pipe(fds) != 0 || !set_nonblocking(fds[0]) || !set_nonblocking(fds[1])) {
+        spdlog::error("[MainLoop] pipe() failed: {}", strerror(errno));
+        return false;
+    }
+    wake_read_fd_ = fds[0];
+    wake_write_fd_ = fds[1];
+#endif
+
+    spdlog::debug("[MainLoop] Event-driven main loop ready");
+    return true;
+}
+
+void MainLoopWaker::shutdown() {
+    for (auto& input : inputs_) {
+        if (!input.reading) {
+            set_reading(input, true);
+        }
+        close(input.fd);
+    }
+    inputs_.clear();
+
+    if (wake_write_fd_ >= 0 && wake_write_fd_ != wake_read_fd_) {
+        close(wake_write_fd_);
+    }
+    if (wake_read_fd_ >= 0) {
+        close(wake_read_fd_);
+    }
+    wake_read_fd_ = -1;
+    wake_write_fd_ = -1;
+}
+
+void MainLoopWaker::wake() {
+    int fd = wake_write_fd_;
+    if (fd < 0 || wake_pending_.exchange(true)) {
+        return; // Not initialized, or a wakeup is already on its way
+    }
+
+#ifdef __linux__
+    uint64_t one = 1;
+    ssize_t written = write(fd, &one, sizeof(one));
+#else
+    char one = 1;
+    ssize_t written = write(fd, &one, sizeof(one));
+#endif
+    (void)written; // A full pipe already guarantees a wakeup
+}
+
+bool MainLoopWaker::watch_input(lv_indev_t* indev, const std::string& device_path) {
+    if (!indev || device_path.empty() || inputs_.size() >= MAX_WATCHED_INPUTS) {
+        return false;
+    }
+
+    // A second descriptor on the node gets its own copy of every event; it is only used
+    // to detect activity and is drained on each wakeup
+    int fd = open(device_path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::warn("[MainLoop] Cannot watch {} ({}), input stays polled", device_path,
+                     strerror(errno));
+        return false;
+    }
+
+    InputWatch input;
+    input.fd = fd;
+    input.indev = indev;
+    input.last_activity_ms = lv_tick_get();
+    inputs_.push_back(input);
+
+    spdlog::debug("[MainLoop] Watching input {} for activity", device_path);
+    return true;
+}
+
+void MainLoopWaker::set_reading(InputWatch& input, bool reading) {
+    lv_timer_t* timer = lv_indev_get_read_timer(input.indev);
+    if (timer) {
+        if (reading) {
+            lv_timer_resume(timer);
+            lv_timer_ready(timer); // Read the new event on this loop iteration
+        } else {
+            lv_timer_pause(timer);
+        }
+    }
+    input.reading = reading;
+}
+
+void MainLoopWaker::drain_wake_fd() {
+    // Clear the flag first: a wake() racing with the drain leaves the fd readable
+    wake_pending_ = false;
+    drain_fd(wake_read_fd_);
+}
+
+void MainLoopWaker::wait(uint32_t timeout_ms) {
+    // Stop polling idle input devices; their descriptors wake us instead
+    for (auto& input : inputs_) {
+        if (input.reading && lv_indev_get_state(input.indev) == LV_INDEV_STATE_RELEASED &&
+            lv_indev_get_scroll_obj(input.indev) == nullptr &&
+            lv_tick_elaps(input.last_activity_ms) >= INPUT_IDLE_MS) {
+            set_reading(input, false);
+        }
+    }
+
+    pollfd fds[1 + MAX_WATCHED_INPUTS];
+    nfds_t count = 0;
+    if (wake_read_fd_ >= 0) {
+        fds[count++] = {wake_read_fd_, POLLIN, 0};
+    }
+    const nfds_t first_input = count;
+    for (const auto& input : inputs_) {
+        fds[count++] = {input.fd, POLLIN, 0};
+    }
+
+    // Without any descriptor, "no timer pending" would sleep forever
+    int timeout = (timeout_ms == LV_NO_TIMER_READY && count > 0)
+                      ? -1
+                      : static_cast<int>(std::min<uint32_t>(timeout_ms, INT_MAX));
+
+    auto start = std::chrono::steady_clock::now();
+    int ready = poll(fds, count, timeout);
+    auto slept = std::chrono::steady_clock::now() - start;
+    stats_.slept_ms += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(slept).count());
+    stats_.waits++;
+
+    if (ready <= 0) {
+        if (ready < 0 && errno != EINTR) {
+            spdlog::warn("[MainLoop] poll() failed: {}", strerror(errno));
+        }
+        stats_.timer_wakeups++;
+        return;
+    }
+
+    bool input_ready = false;
+    bool input_lost = false;
+    for (nfds_t i = first_input; i < count; i++) {
+        if (fds[i].revents == 0) {
+            continue;
+        }
+        InputWatch& input = inputs_[i - first_input];
+        if (!input.reading) {
+            set_reading(input, true);
+        }
+        if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            // Device gone: stop watching so poll() doesn't spin, and leave LVGL polling it
+            spdlog::warn("[MainLoop] Lost input watch, falling back to polling");
+            close(input.fd);
+            input.fd = -1;
+            input_lost = true;
+            continue;
+        }
+        drain_fd(input.fd);
+        input.last_activity_ms = lv_tick_get();
+        input_ready = true;
+    }
+    if (input_lost) {
+        inputs_.erase(std::remove_if(inputs_.begin(), inputs_.end(),
+                                     [](const InputWatch& input) { return input.fd < 0; }),
+                      inputs_.end());
+    }
+
+    bool signalled = first_input > 0 && fds[0].revents != 0;
+    if (signalled) {
+        drain_wake_fd();
+    }
+
+    if (input_ready) {
+        stats_.input_wakeups++;
+    } else if (signalled) {
+        stats_.signal_wakeups++;
+    } else {
+        stats_.timer_wakeups++; // Only a lost input device was reported
+    }
+}
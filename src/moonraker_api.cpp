@@ -23,6 +23,7 @@
 
 #include "moonraker_api.h"
 
+#include "temperature_history.h"
 #include "ui_error_reporting.h"
 #include "ui_notification.h"
 
@@ -32,6 +33,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <set>
@@ -846,6 +848,30 @@ void MoonrakerAPI::set_led_off(const std::string& led, SuccessCallback on_succes
     set_led(led, 0.0, 0.0, 0.0, 0.0, on_success, on_error);
 }
 
+void MoonrakerAPI::load_temperature_history(SuccessCallback on_success, ErrorCallback on_error) {
+    json params = {{"include_monitors", false}};
+
+    spdlog::debug("[Moonraker API] Requesting temperature store");
+
+    client_.send_jsonrpc(
+        "server.temperature_store", params,
+        [on_success](json response) {
+            if (response.contains("result")) {
+                int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count();
+                TemperatureHistory::instance().import_temperature_store(response["result"],
+                                                                        now_ms);
+            } else {
+                spdlog::warn("[Moonraker API] Temperature store response has no result");
+            }
+            if (on_success) {
+                on_success();
+            }
+        },
+        on_error);
+}
+
 // ============================================================================
 // System Control Operations
 // ============================================================================
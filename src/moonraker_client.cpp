@@ -30,6 +30,8 @@
 #include "printer_state.h"
 
 #include <algorithm> // For std::sort in MCU query handling
+#include <cstring>
+#include <optional>
 
 using namespace hv;
 
@@ -44,6 +46,59 @@ void reset_notification_flags() {
     g_already_notified_max_attempts.store(false);
     g_already_notified_disconnect.store(false);
 }
+
+// Parse a Klipper Z matrix ([[z, ...], ...]), dropping non-numeric values and empty rows
+std::vector<std::vector<float>> parse_mesh_matrix(const json& matrix) {
+    std::vector<std::vector<float>> rows;
+    rows.reserve(matrix.size());
+    for (const auto& row : matrix) {
+        if (row.is_array()) {
+            std::vector<float> row_vec;
+            row_vec.reserve(row.size());
+            for (const auto& val : row) {
+                if (val.is_number()) {
+                    row_vec.push_back(val.template get<float>());
+                }
+            }
+            if (!row_vec.empty()) {
+                rows.push_back(std::move(row_vec));
+            }
+        }
+    }
+    return rows;
+}
+
+// Methods that must not wait out the coalescing window: an emergency stop has to go
+// out now, and G-code scripts are user actions that can block Klipper for minutes
+bool is_immediate_method(const json& rpc) {
+    auto it = rpc.find("method");
+    if (it == rpc.end() || !it->is_string()) {
+        return false;
+    }
+    const auto& method = it->get_ref<const std::string&>();
+    return method == "printer.emergency_stop" || method == "printer.gcode.script";
+}
+
+// Mix a value into a running 64-bit hash (boost::hash_combine style)
+uint64_t hash_mix(uint64_t seed, uint64_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+uint64_t hash_float(uint64_t seed, float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return hash_mix(seed, bits);
+}
+
+// Content hash covering everything the renderer depends on (matrix + bounds)
+uint64_t mesh_content_hash(size_t matrix_hash, const BedMeshProfile& mesh) {
+    uint64_t h = hash_mix(0, matrix_hash);
+    h = hash_float(h, mesh.mesh_min[0]);
+    h = hash_float(h, mesh.mesh_min[1]);
+    h = hash_float(h, mesh.mesh_max[0]);
+    h = hash_float(h, mesh.mesh_max[1]);
+    return h != 0 ? h : 1; // 0 is reserved for "unknown"
+}
 } // namespace
 
 MoonrakerClient::MoonrakerClient(EventLoopPtr loop)
@@ -159,7 +214,8 @@ void MoonrakerClient::disconnect() {
     onmessage = [](const std::string&) { /* no-op */ };
     onclose = []() { /* no-op */ };
 
-    // Clean up any pending requests
+    // Drop queued writes and clean up any pending requests
+    discard_outgoing();
     cleanup_pending_requests();
 
     // Reset connection state
@@ -219,6 +275,7 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
     setConnectTimeout(static_cast<int>(connection_timeout_ms_));
 
     spdlog::debug("[Moonraker Client] WebSocket connecting to {}", url);
+    connect_started_at_ = std::chrono::steady_clock::now();
     set_connection_state(ConnectionState::CONNECTING);
 
     // Connection opened callback
@@ -286,173 +343,157 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
             check_request_timeouts();
 
             // Parse JSON message
-            json j;
+            json message;
             try {
-                j = json::parse(msg);
+                message = json::parse(msg);
             } catch (const json::parse_error& e) {
                 LOG_ERROR_INTERNAL("[Moonraker Client] JSON parse error: {}", e.what());
                 return;
             }
 
-            // Handle responses with request IDs (one-time callbacks)
-            if (j.contains("id")) {
-                // Validate 'id' field type
-                if (!j["id"].is_number_integer()) {
-                    LOG_ERROR_INTERNAL("[Moonraker Client] Invalid 'id' type in response: {}",
-                                       j["id"].type_name());
-                    return;
-                }
+            // Handles a single JSON-RPC object (batched responses arrive as an array)
+            auto handle_object = [&](json& j) {
+                // Handle responses with request IDs (one-time callbacks)
+                if (j.contains("id")) {
+                    // Validate 'id' field type
+                    if (!j["id"].is_number_integer()) {
+                        LOG_ERROR_INTERNAL("[Moonraker Client] Invalid 'id' type in response: {}",
+                                           j["id"].type_name());
+                        return;
+                    }
 
-                uint64_t id = j["id"].get<uint64_t>();
-
-                // Copy callbacks out before invoking to avoid deadlock
-                std::function<void(json)> success_cb;
-                std::function<void(const MoonrakerError&)> error_cb;
-                std::string method_name;
-                bool has_error = false;
-                MoonrakerError error;
-
-                {
-                    std::lock_guard<std::mutex> lock(requests_mutex_);
-                    auto it = pending_requests_.find(id);
-                    if (it != pending_requests_.end()) {
-                        PendingRequest& request = it->second;
-                        method_name = request.method;
-
-                        // Check for JSON-RPC error
-                        if (j.contains("error")) {
-                            has_error = true;
-                            error = MoonrakerError::from_json_rpc(j["error"], request.method);
-                            error_cb = request.error_callback;
-                        } else {
-                            success_cb = request.success_callback;
+                    uint64_t id = j["id"].get<uint64_t>();
+
+                    // Copy callbacks out before invoking to avoid deadlock
+                    std::function<void(json)> success_cb;
+                    std::function<void(const MoonrakerError&)> error_cb;
+                    std::string method_name;
+                    bool has_error = false;
+                    MoonrakerError error;
+
+                    {
+                        std::lock_guard<std::mutex> lock(requests_mutex_);
+                        // Remove before invoking callbacks
+                        std::optional<PendingRequest> request = pending_requests_.take(id);
+                        if (request) {
+                            method_latency_[request->method].record(request->get_elapsed_ms());
+                            method_name = std::move(request->method);
+
+                            // Check for JSON-RPC error
+                            if (j.contains("error")) {
+                                has_error = true;
+                                error = MoonrakerError::from_json_rpc(j["error"], method_name);
+                                error_cb = std::move(request->error_callback);
+                            } else {
+                                success_cb = std::move(request->success_callback);
+                            }
                         }
+                    } // Lock released here
 
-                        pending_requests_.erase(it); // Remove before invoking callbacks
-                    }
-                } // Lock released here
-
-                // Invoke callbacks outside the lock to avoid deadlock
-                if (has_error) {
-                    spdlog::error("[Moonraker Client] Request {} failed: {}", method_name,
-                                  error.message);
+                    // Invoke callbacks outside the lock to avoid deadlock
+                    if (has_error) {
+                        spdlog::error("[Moonraker Client] Request {} failed: {}", method_name,
+                                      error.message);
 
-                    // Emit RPC error event
-                    emit_event(
-                        MoonrakerEventType::RPC_ERROR,
-                        fmt::format("Printer command '{}' failed: {}", method_name, error.message),
-                        true, method_name);
+                        // Emit RPC error event
+                        emit_event(MoonrakerEventType::RPC_ERROR,
+                                   fmt::format("Printer command '{}' failed: {}", method_name,
+                                               error.message),
+                                   true, method_name);
 
-                    if (error_cb) {
-                        error_cb(error);
+                        if (error_cb) {
+                            error_cb(error);
+                        }
+                    } else if (success_cb) {
+                        success_cb(j);
                     }
-                } else if (success_cb) {
-                    success_cb(j);
                 }
-            }
-
-            // Handle notifications (no request ID)
-            if (j.contains("method")) {
-                // Validate 'method' field type
-                if (!j["method"].is_string()) {
-                    LOG_ERROR_INTERNAL(
-                        "[Moonraker Client] Invalid 'method' type in notification: {}",
-                        j["method"].type_name());
-                    return;
-                }
-
-                std::string method = j["method"].get<std::string>();
 
-                // Copy callbacks to invoke (to avoid holding lock during callback execution)
-                std::vector<std::function<void(json)>> callbacks_to_invoke;
+                // Handle notifications (no request ID)
+                if (j.contains("method")) {
+                    // Validate 'method' field type
+                    if (!j["method"].is_string()) {
+                        LOG_ERROR_INTERNAL(
+                            "[Moonraker Client] Invalid 'method' type in notification: {}",
+                            j["method"].type_name());
+                        return;
+                    }
 
-                {
-                    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+                    const std::string& method = j["method"].get_ref<const std::string&>();
+                    NotificationMethodId method_id = notification_dispatcher_.lookup(method);
 
-                    // Printer status updates (most common)
-                    if (method == "notify_status_update" || method == "notify_filelist_changed") {
-                        // Copy all notify callbacks from map
-                        callbacks_to_invoke.reserve(notify_callbacks_.size());
-                        for (const auto& [id, cb] : notify_callbacks_) {
-                            callbacks_to_invoke.push_back(cb);
+                    // Parse bed mesh updates before invoking user callbacks
+                    if (method_id == NotificationDispatcher::STATUS_UPDATE &&
+                        j.contains("params") && j["params"].is_array() && !j["params"].empty()) {
+                        const json& params = j["params"][0];
+                        if (params.contains("bed_mesh") && params["bed_mesh"].is_object()) {
+                            parse_bed_mesh(params["bed_mesh"]);
                         }
                     }
 
-                    // Method-specific persistent callbacks
-                    auto method_it = method_callbacks_.find(method);
-                    if (method_it != method_callbacks_.end()) {
-                        for (auto& [handler_name, cb] : method_it->second) {
-                            callbacks_to_invoke.push_back(cb);
-                        }
-                    }
-                } // Release lock
-
-                // Parse bed mesh updates before invoking user callbacks
-                if (method == "notify_status_update" && j.contains("params") &&
-                    j["params"].is_array() && !j["params"].empty()) {
-                    const json& params = j["params"][0];
-                    if (params.contains("bed_mesh") && params["bed_mesh"].is_object()) {
-                        parse_bed_mesh(params["bed_mesh"]);
-                    }
-                }
+                    // Pre-bound handler lists: no lock, no copies (handlers may unregister
+                    // themselves safely - dispatch holds the table snapshot)
+                    notification_dispatcher_.dispatch(method_id, j);
 
-                // Invoke callbacks outside lock to prevent deadlock
-                for (auto& cb : callbacks_to_invoke) {
-                    try {
-                        cb(j);
-                    } catch (const std::exception& e) {
-                        LOG_ERROR_INTERNAL("[Moonraker Client] Callback for {} threw exception: {}",
-                                           method, e.what());
-                    } catch (...) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Callback for {} threw unknown exception", method);
-                    }
-                }
+                    // Klippy disconnected from Moonraker
+                    if (method_id == NotificationDispatcher::KLIPPY_DISCONNECTED) {
+                        spdlog::warn("[Moonraker Client] Klipper disconnected from Moonraker");
 
-                // Klippy disconnected from Moonraker
-                if (method == "notify_klippy_disconnected") {
-                    spdlog::warn("[Moonraker Client] Klipper disconnected from Moonraker");
+                        // Update klippy state in PrinterState (SHUTDOWN = firmware disconnected)
+                        get_printer_state().set_klippy_state(KlippyState::SHUTDOWN);
 
-                    // Update klippy state in PrinterState (SHUTDOWN = firmware disconnected)
-                    get_printer_state().set_klippy_state(KlippyState::SHUTDOWN);
+                        // Emit event for UI layer to handle
+                        emit_event(MoonrakerEventType::KLIPPY_DISCONNECTED,
+                                   "Klipper has disconnected from Moonraker. Check for errors in "
+                                   "your printer interface.",
+                                   true);
 
-                    // Emit event for UI layer to handle
-                    emit_event(MoonrakerEventType::KLIPPY_DISCONNECTED,
-                               "Klipper has disconnected from Moonraker. Check for errors in your "
-                               "printer interface.",
-                               true);
+                        // Invoke user callback with exception safety
+                        try {
+                            on_disconnected();
+                        } catch (const std::exception& e) {
+                            LOG_ERROR_INTERNAL(
+                                "[Moonraker Client] Disconnection callback threw exception: {}",
+                                e.what());
+                        } catch (...) {
+                            LOG_ERROR_INTERNAL("[Moonraker Client] Disconnection callback threw "
+                                               "unknown exception");
+                        }
+                    }
+                    // Klippy reconnected to Moonraker
+                    else if (method_id == NotificationDispatcher::KLIPPY_READY) {
+                        spdlog::info("[Moonraker Client] Klipper ready");
 
-                    // Invoke user callback with exception safety
-                    try {
-                        on_disconnected();
-                    } catch (const std::exception& e) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Disconnection callback threw exception: {}",
-                            e.what());
-                    } catch (...) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Disconnection callback threw unknown exception");
+                        // Update klippy state in PrinterState (READY = firmware ready)
+                        get_printer_state().set_klippy_state(KlippyState::READY);
+
+                        // Invoke user callback with exception safety
+                        try {
+                            on_connected();
+                        } catch (const std::exception& e) {
+                            LOG_ERROR_INTERNAL(
+                                "[Moonraker Client] Connection callback threw exception: {}",
+                                e.what());
+                        } catch (...) {
+                            LOG_ERROR_INTERNAL(
+                                "[Moonraker Client] Connection callback threw unknown exception");
+                        }
                     }
                 }
-                // Klippy reconnected to Moonraker
-                else if (method == "notify_klippy_ready") {
-                    spdlog::info("[Moonraker Client] Klipper ready");
+            };
 
-                    // Update klippy state in PrinterState (READY = firmware ready)
-                    get_printer_state().set_klippy_state(KlippyState::READY);
-
-                    // Invoke user callback with exception safety
-                    try {
-                        on_connected();
-                    } catch (const std::exception& e) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Connection callback threw exception: {}", e.what());
-                    } catch (...) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Connection callback threw unknown exception");
+            if (message.is_array()) {
+                for (auto& item : message) {
+                    if (item.is_object()) {
+                        handle_object(item);
                     }
                 }
+            } else {
+                handle_object(message);
             }
+
+            // Requests issued by the callbacks above go out together in one flush
+            flush_outgoing(true);
         } catch (const std::exception& e) {
             LOG_ERROR_INTERNAL(
                 "[Moonraker Client] onmessage callback threw unexpected exception: {}", e.what());
@@ -478,7 +519,8 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
 
             ConnectionState current = connection_state_.load();
 
-            // Cleanup all pending requests (invoke error callbacks)
+            // Drop queued writes and cleanup all pending requests (invoke error callbacks)
+            discard_outgoing();
             cleanup_pending_requests();
 
             if (was_connected_) {
@@ -561,17 +603,15 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
     return open(url, headers);
 }
 
-SubscriptionId MoonrakerClient::register_notify_update(std::function<void(json)> cb) {
+SubscriptionId MoonrakerClient::register_notify_update(NotificationCallback cb,
+                                                       const std::string& name) {
     if (!cb) {
         spdlog::warn("[Moonraker Client] register_notify_update called with null callback");
         return INVALID_SUBSCRIPTION_ID;
     }
 
     SubscriptionId id = next_subscription_id_.fetch_add(1);
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        notify_callbacks_.emplace(id, cb);
-    }
+    notification_dispatcher_.add_status_handler(id, std::move(cb), name);
     spdlog::debug("[Moonraker Client] Registered notify callback with ID {}", id);
     return id;
 }
@@ -581,10 +621,7 @@ bool MoonrakerClient::unsubscribe_notify_update(SubscriptionId id) {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    auto it = notify_callbacks_.find(id);
-    if (it != notify_callbacks_.end()) {
-        notify_callbacks_.erase(it);
+    if (notification_dispatcher_.remove_status_handler(id)) {
         spdlog::debug("[Moonraker Client] Unsubscribed notify callback ID {}", id);
         return true;
     }
@@ -664,72 +701,35 @@ void MoonrakerClient::dispatch_status_update(const json& status) {
         {"params", json::array({status, 0.0})} // [status, eventtime]
     };
 
-    // Dispatch to all registered callbacks
-    // Two-phase: copy under lock, invoke outside to avoid deadlock
-    std::vector<std::function<void(json)>> callbacks_copy;
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
-    }
-
-    for (const auto& cb : callbacks_copy) {
-        if (cb) {
-            cb(notification);
-        }
-    }
+    // Dispatch to all registered status subscribers
+    size_t dispatched = notification_dispatcher_.dispatch_status(notification);
 
-    spdlog::debug("[Moonraker Client] Dispatched status update to {} callbacks",
-                  callbacks_copy.size());
+    spdlog::debug("[Moonraker Client] Dispatched status update to {} callbacks", dispatched);
 }
 
 void MoonrakerClient::register_method_callback(const std::string& method,
                                                const std::string& handler_name,
-                                               std::function<void(json)> cb) {
-    std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    auto it = method_callbacks_.find(method);
-    if (it == method_callbacks_.end()) {
-        spdlog::debug("[Moonraker Client] Registering new method callback: {} (handler: {})",
-                      method, handler_name);
-        std::map<std::string, std::function<void(json)>> handlers;
-        handlers.insert({handler_name, cb});
-        method_callbacks_.insert({method, handlers});
-    } else {
-        spdlog::debug("[Moonraker Client] Adding handler to existing method {}: {}", method,
+                                               NotificationCallback cb) {
+    if (notification_dispatcher_.add_method_handler(method, handler_name, std::move(cb))) {
+        spdlog::debug("[Moonraker Client] Registered method callback: {} (handler: {})", method,
                       handler_name);
-        it->second.insert({handler_name, cb});
+    } else {
+        spdlog::debug("[Moonraker Client] Handler '{}' already registered for method {}",
+                      handler_name, method);
     }
 }
 
 bool MoonrakerClient::unregister_method_callback(const std::string& method,
                                                  const std::string& handler_name) {
-    std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    auto method_it = method_callbacks_.find(method);
-    if (method_it == method_callbacks_.end()) {
-        spdlog::debug("[Moonraker Client] Unregister failed: method '{}' not found", method);
-        return false;
-    }
-
-    auto handler_it = method_it->second.find(handler_name);
-    if (handler_it == method_it->second.end()) {
+    if (!notification_dispatcher_.remove_method_handler(method, handler_name)) {
         spdlog::debug(
             "[Moonraker Client] Unregister failed: handler '{}' not found for method '{}'",
             handler_name, method);
         return false;
     }
 
-    method_it->second.erase(handler_it);
     spdlog::debug("[Moonraker Client] Unregistered handler '{}' from method '{}'", handler_name,
                   method);
-
-    // Clean up empty method entries to avoid memory leaks
-    if (method_it->second.empty()) {
-        method_callbacks_.erase(method_it);
-        spdlog::debug("[Moonraker Client] Removed empty method entry for '{}'", method);
-    }
-
     return true;
 }
 
@@ -739,8 +739,7 @@ int MoonrakerClient::send_jsonrpc(const std::string& method) {
     rpc["method"] = method;
     rpc["id"] = request_id_++;
 
-    spdlog::debug("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    return send(rpc.dump());
+    return send_or_queue(std::move(rpc));
 }
 
 int MoonrakerClient::send_jsonrpc(const std::string& method, const json& params) {
@@ -755,8 +754,7 @@ int MoonrakerClient::send_jsonrpc(const std::string& method, const json& params)
 
     rpc["id"] = request_id_++;
 
-    spdlog::debug("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    return send(rpc.dump());
+    return send_or_queue(std::move(rpc));
 }
 
 RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& params,
@@ -786,13 +784,11 @@ RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& p
     // Register request
     {
         std::lock_guard<std::mutex> lock(requests_mutex_);
-        auto it = pending_requests_.find(id);
-        if (it != pending_requests_.end()) {
+        if (!pending_requests_.insert(std::move(request))) {
             LOG_ERROR_INTERNAL("[Moonraker Client] Request ID {} already has a registered callback",
                                id);
             return INVALID_REQUEST_ID;
         }
-        pending_requests_.insert({id, request});
         spdlog::debug("[Moonraker Client] Registered request {} for method {}, total pending: {}",
                       id, method, pending_requests_.size());
     }
@@ -808,38 +804,148 @@ RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& p
         rpc["params"] = params;
     }
 
-    spdlog::debug("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    int result = send(rpc.dump());
+    int result = send_or_queue(std::move(rpc), id);
     spdlog::debug("[Moonraker Client] send_jsonrpc({}) returned {}", method, result);
 
     // Return the request ID on success, or INVALID_REQUEST_ID on send failure
     if (result < 0) {
-        // Send failed - remove pending request and invoke error callback
-        std::function<void(const MoonrakerError&)> error_callback_copy;
-        std::string method_name;
-        {
-            std::lock_guard<std::mutex> lock(requests_mutex_);
-            auto it = pending_requests_.find(id);
-            if (it != pending_requests_.end()) {
-                error_callback_copy = it->second.error_callback;
-                method_name = it->second.method;
-                pending_requests_.erase(it);
+        fail_pending_request(id);
+        return INVALID_REQUEST_ID;
+    }
+
+    return id;
+}
+
+void MoonrakerClient::fail_pending_request(RequestId id) {
+    // Send failed - remove pending request and invoke error callback
+    std::function<void(const MoonrakerError&)> error_callback_copy;
+    std::string method_name;
+    {
+        std::lock_guard<std::mutex> lock(requests_mutex_);
+        std::optional<PendingRequest> failed = pending_requests_.take_failed(id);
+        if (failed) {
+            error_callback_copy = std::move(failed->error_callback);
+            method_name = std::move(failed->method);
+        }
+    }
+    spdlog::error("[Moonraker Client] Failed to send request {}, removed from pending", id);
+
+    // Invoke error callback outside lock (prevents deadlock if callback sends new request)
+    if (error_callback_copy) {
+        try {
+            error_callback_copy(MoonrakerError::connection_lost(method_name));
+        } catch (const std::exception& e) {
+            spdlog::error("[Moonraker Client] Error callback threw exception: {}", e.what());
+        }
+    }
+}
+
+int MoonrakerClient::send_or_queue(json rpc, RequestId tracked_id) {
+    // Coalescing disabled, or not connected yet: write immediately so send
+    // failures are reported synchronously to the caller
+    if (batch_window_ms_ == 0 || connection_state_.load() != ConnectionState::CONNECTED) {
+        std::string payload = rpc.dump();
+        spdlog::debug("[Moonraker Client] send_jsonrpc: {}", payload);
+        return send(payload);
+    }
+
+    // Urgent methods skip the window; flush first so requests still go out in order
+    if (is_immediate_method(rpc)) {
+        flush_outgoing(true);
+        std::string payload = rpc.dump();
+        spdlog::debug("[Moonraker Client] send_jsonrpc (immediate): {}", payload);
+        return send(payload);
+    }
+
+    bool flush_now = false;
+    {
+        std::lock_guard<std::mutex> lock(send_queue_mutex_);
+        if (outgoing_queue_.empty()) {
+            outgoing_first_queued_ = std::chrono::steady_clock::now();
+        }
+        outgoing_queue_.push_back({std::move(rpc), tracked_id});
+        flush_now = outgoing_queue_.size() >= max_batch_size_;
+    }
+
+    if (flush_now) {
+        flush_outgoing(true);
+    }
+    return 0;
+}
+
+void MoonrakerClient::flush_outgoing(bool force) {
+    std::vector<RequestId> failed_ids;
+    {
+        std::lock_guard<std::mutex> lock(send_queue_mutex_);
+        if (outgoing_queue_.empty()) {
+            return;
+        }
+        if (!force && outgoing_queue_.size() < max_batch_size_) {
+            auto age = std::chrono::steady_clock::now() - outgoing_first_queued_;
+            if (age < std::chrono::milliseconds(batch_window_ms_)) {
+                return;
             }
         }
-        spdlog::error("[Moonraker Client] Failed to send request {}, removed from pending", id);
 
-        // Invoke error callback outside lock (prevents deadlock if callback sends new request)
-        if (error_callback_copy) {
-            try {
-                error_callback_copy(MoonrakerError::connection_lost(method_name));
-            } catch (const std::exception& e) {
-                spdlog::error("[Moonraker Client] Error callback threw exception: {}", e.what());
+        // Each request is its own frame, so Moonraker answers each one as soon as it
+        // completes instead of holding a combined batch reply for the slowest request.
+        // Only the window is shared: all frames are written back to back in this flush.
+        spdlog::debug("[Moonraker Client] Flushing {} queued request(s)", outgoing_queue_.size());
+        for (const auto& queued : outgoing_queue_) {
+            int result = send(queued.rpc.dump());
+            send_stats_.frames_sent++;
+            if (result < 0 && queued.tracked_id != INVALID_REQUEST_ID) {
+                failed_ids.push_back(queued.tracked_id);
             }
         }
-        return INVALID_REQUEST_ID;
+        send_stats_.flushes++;
+        send_stats_.largest_flush = std::max(send_stats_.largest_flush, outgoing_queue_.size());
+
+        outgoing_queue_.clear();
+    } // Lock released here
+
+    // Fail tracked requests outside the queue lock (callbacks may send new requests)
+    for (RequestId id : failed_ids) {
+        fail_pending_request(id);
     }
+}
 
-    return id;
+uint32_t MoonrakerClient::ms_until_flush() const {
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    if (outgoing_queue_.empty()) {
+        return UINT32_MAX;
+    }
+
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - outgoing_first_queued_)
+                   .count();
+    return age >= batch_window_ms_ ? 0 : static_cast<uint32_t>(batch_window_ms_ - age);
+}
+
+void MoonrakerClient::discard_outgoing() {
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    if (!outgoing_queue_.empty()) {
+        spdlog::debug("[Moonraker Client] Discarding {} queued request(s)",
+                      outgoing_queue_.size());
+        outgoing_queue_.clear();
+    }
+}
+
+void MoonrakerClient::configure_batching(uint32_t window_ms, size_t max_batch_size) {
+    batch_window_ms_ = window_ms;
+    max_batch_size_ = std::max<size_t>(max_batch_size, 1);
+    spdlog::debug("[Moonraker Client] Request coalescing: window={}ms, max batch={}", window_ms,
+                  max_batch_size_);
+}
+
+SendQueueStats MoonrakerClient::get_send_stats() const {
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    return send_stats_;
+}
+
+std::map<std::string, RpcLatencyHistogram> MoonrakerClient::get_method_latency() const {
+    std::lock_guard<std::mutex> lock(requests_mutex_);
+    return method_latency_;
 }
 
 bool MoonrakerClient::cancel_request(RequestId id) {
@@ -848,10 +954,10 @@ bool MoonrakerClient::cancel_request(RequestId id) {
     }
 
     std::lock_guard<std::mutex> lock(requests_mutex_);
-    auto it = pending_requests_.find(id);
-    if (it != pending_requests_.end()) {
-        spdlog::debug("[Moonraker Client] Cancelled request {} ({})", id, it->second.method);
-        pending_requests_.erase(it);
+    const PendingRequest* request = pending_requests_.find(id);
+    if (request) {
+        spdlog::debug("[Moonraker Client] Cancelled request {} ({})", id, request->method);
+        pending_requests_.cancel(id);
         return true;
     }
 
@@ -867,6 +973,8 @@ int MoonrakerClient::gcode_script(const std::string& gcode) {
 
 void MoonrakerClient::discover_printer(std::function<void()> on_complete) {
     spdlog::debug("[Moonraker Client] Starting printer auto-discovery");
+    discovery_started_at_ = std::chrono::steady_clock::now();
+    first_temperature_pending_ = true;
 
     // Store callback for force_reconnect()
     {
@@ -874,6 +982,188 @@ void MoonrakerClient::discover_printer(std::function<void()> on_complete) {
         last_discovery_complete_ = on_complete;
     }
 
+    // Fast start: subscribe straight from the cached snapshot, validate in background
+    if (start_from_snapshot(on_complete)) {
+        return;
+    }
+
+    discovery_from_snapshot_ = false;
+    run_full_discovery(on_complete);
+}
+
+void MoonrakerClient::set_discovery_snapshot_path(const std::string& path) {
+    snapshot_store_ = DiscoverySnapshotStore(path);
+    spdlog::debug("[Moonraker Client] Discovery snapshot cache: {}",
+                  path.empty() ? "disabled" : path);
+}
+
+std::string MoonrakerClient::snapshot_key() const {
+    std::lock_guard<std::mutex> lock(reconnect_mutex_);
+    return DiscoverySnapshotStore::host_key(last_url_);
+}
+
+bool MoonrakerClient::start_from_snapshot(std::function<void()> on_complete) {
+    if (!snapshot_store_.enabled()) {
+        return false;
+    }
+
+    std::string key = snapshot_key();
+    std::optional<DiscoverySnapshot> snapshot = snapshot_store_.load(key);
+    if (!snapshot) {
+        spdlog::debug("[Moonraker Client] No discovery snapshot for {}, running full discovery",
+                      key);
+        return false;
+    }
+
+    spdlog::info("[Moonraker Client] Fast start from cached discovery for {} ({} objects)", key,
+                 snapshot->printer_objects.size());
+    discovery_from_snapshot_ = true;
+
+    // Restore discovered hardware exactly as a full discovery would have
+    parse_objects(json(snapshot->printer_objects));
+    hostname_ = snapshot->hostname;
+    software_version_ = snapshot->software_version;
+    moonraker_version_ = snapshot->moonraker_version;
+    kinematics_ = snapshot->kinematics;
+    mcu_ = snapshot->mcu;
+    mcu_list_ = snapshot->mcu_list;
+    build_volume_ = snapshot->build_volume;
+    last_snapshot_json_ = snapshot->to_json();
+    last_snapshot_json_.erase("saved_at");
+
+    complete_discovery_subscription(on_complete);
+    validate_snapshot(key, std::move(snapshot->printer_objects), on_complete);
+    return true;
+}
+
+void MoonrakerClient::validate_snapshot(const std::string& key,
+                                        std::vector<std::string> cached_objects,
+                                        std::function<void()> on_complete) {
+    send_jsonrpc(
+        "printer.objects.list", json(),
+        [this, key, cached_objects, on_complete](json response) {
+            if (!response.contains("result") || !response["result"].contains("objects") ||
+                !response["result"]["objects"].is_array()) {
+                spdlog::warn("[Moonraker Client] Snapshot validation: invalid objects.list reply");
+                return;
+            }
+
+            std::vector<std::string> objects;
+            for (const auto& obj : response["result"]["objects"]) {
+                if (obj.is_string()) {
+                    objects.push_back(obj.get<std::string>());
+                }
+            }
+
+            if (objects == cached_objects) {
+                spdlog::debug("[Moonraker Client] Discovery snapshot for {} is current", key);
+                refresh_versions();
+                return;
+            }
+
+            // Hardware changed (config edit, new toolhead...) - redo discovery and re-subscribe.
+            // The caller's completion runs again so the wizard and main pick up the fresh
+            // heater/fan/sensor lists instead of the ones restored from the snapshot.
+            spdlog::info("[Moonraker Client] Printer objects changed since snapshot ({} -> {}), "
+                         "re-running discovery",
+                         cached_objects.size(), objects.size());
+            discovery_from_snapshot_ = false;
+            run_full_discovery([on_complete]() {
+                spdlog::debug("[Moonraker Client] Re-discovery after snapshot mismatch complete");
+                if (on_complete) {
+                    on_complete();
+                }
+            });
+        },
+        [key](const MoonrakerError& err) {
+            spdlog::warn("[Moonraker Client] Snapshot validation for {} failed: {}", key,
+                         err.message);
+        });
+}
+
+void MoonrakerClient::refresh_versions() {
+    send_jsonrpc("server.info", {}, [this](json info_response) {
+        if (info_response.contains("result")) {
+            moonraker_version_ =
+                info_response["result"].value("moonraker_version", moonraker_version_);
+        }
+        send_jsonrpc("printer.info", {}, [this](json printer_response) {
+            if (printer_response.contains("result")) {
+                const json& result = printer_response["result"];
+                hostname_ = result.value("hostname", hostname_);
+                software_version_ = result.value("software_version", software_version_);
+            }
+
+            // Persist (and re-notify observers) only if something actually changed
+            if (save_discovery_snapshot() && on_discovery_complete_) {
+                on_discovery_complete_(capabilities_);
+            }
+        });
+    });
+}
+
+bool MoonrakerClient::save_discovery_snapshot() {
+    if (!snapshot_store_.enabled() || printer_objects_.empty()) {
+        return false;
+    }
+
+    DiscoverySnapshot snapshot;
+    snapshot.printer_objects = printer_objects_;
+    snapshot.hostname = hostname_;
+    snapshot.software_version = software_version_;
+    snapshot.moonraker_version = moonraker_version_;
+    snapshot.kinematics = kinematics_;
+    snapshot.mcu = mcu_;
+    snapshot.mcu_list = mcu_list_;
+    snapshot.build_volume = build_volume_;
+
+    // Skip the flash write when nothing changed since the last load/save
+    json comparable = snapshot.to_json();
+    comparable.erase("saved_at");
+    if (comparable == last_snapshot_json_) {
+        return false;
+    }
+
+    snapshot.saved_at = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+    if (!snapshot_store_.store(snapshot_key(), snapshot)) {
+        return false;
+    }
+    last_snapshot_json_ = std::move(comparable);
+    return true;
+}
+
+void MoonrakerClient::log_first_live_temperature(const json& status) {
+    if (!first_temperature_pending_) {
+        return;
+    }
+
+    bool has_temperature = false;
+    for (const auto& heater : heaters_) {
+        if (status.contains(heater) && status[heater].is_object() &&
+            status[heater].contains("temperature")) {
+            has_temperature = true;
+            break;
+        }
+    }
+    if (!has_temperature) {
+        return;
+    }
+
+    first_temperature_pending_ = false;
+    auto now = std::chrono::steady_clock::now();
+    auto since_connect =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - connect_started_at_);
+    auto since_discovery =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - discovery_started_at_);
+    spdlog::info("[Moonraker Client] First live temperature {}ms after connect ({}ms after "
+                 "discovery start, {})",
+                 since_connect.count(), since_discovery.count(),
+                 discovery_from_snapshot_ ? "cached snapshot" : "full discovery");
+}
+
+void MoonrakerClient::run_full_discovery(std::function<void()> on_complete) {
     // Step 1: Query available printer objects (no params required)
     send_jsonrpc("printer.objects.list", json(), [this, on_complete](json response) {
         // Debug: Log raw response
@@ -1090,7 +1380,11 @@ void MoonrakerClient::complete_discovery_subscription(std::function<void()> on_c
                     spdlog::info(
                         "[Moonraker Client] Processing initial printer state from subscription");
                     dispatch_status_update(sub_response["result"]["status"]);
+                    log_first_live_temperature(sub_response["result"]["status"]);
                 }
+
+                // Remember this discovery for fast reconnects (no-op if unchanged)
+                save_discovery_snapshot();
             } else if (sub_response.contains("error")) {
                 spdlog::error("[Moonraker Client] Subscription failed: {}",
                               sub_response["error"].dump());
@@ -1202,54 +1496,115 @@ void MoonrakerClient::parse_objects(const json& objects) {
     capabilities_.parse_objects(objects);
 }
 
-void MoonrakerClient::parse_bed_mesh(const json& bed_mesh) {
+bool MoonrakerClient::parse_bed_mesh(const json& bed_mesh) {
+    bed_mesh_stats_.updates++;
+    bool mesh_changed = false;     // Matrix or bounds changed (needs re-render)
+    bool metadata_changed = false; // Name, algo or profile list changed
+
+    // Parse available profiles first so a profile switch can reuse the parsed copy.
+    // Klipper sends the full profile set; only re-parse when its contents change.
+    if (bed_mesh.contains("profiles") && bed_mesh["profiles"].is_object()) {
+        const json& profiles = bed_mesh["profiles"];
+        size_t profiles_hash = std::hash<json>{}(profiles);
+        if (profiles_hash != bed_mesh_profiles_hash_) {
+            bed_mesh_profiles_hash_ = profiles_hash;
+            bed_mesh_stats_.profiles_parsed++;
+            metadata_changed = true;
+
+            bed_mesh_profiles_.clear();
+            bed_mesh_profile_cache_.clear();
+            bed_mesh_profile_points_hash_.clear();
+            for (auto& [profile_name, profile_data] : profiles.items()) {
+                bed_mesh_profiles_.push_back(profile_name);
+                if (!profile_data.is_object() || !profile_data.contains("points") ||
+                    !profile_data["points"].is_array()) {
+                    continue;
+                }
+
+                BedMeshProfile profile;
+                profile.name = profile_name;
+                profile.probed_matrix = parse_mesh_matrix(profile_data["points"]);
+                profile.y_count = static_cast<int>(profile.probed_matrix.size());
+                profile.x_count = profile.probed_matrix.empty()
+                                      ? 0
+                                      : static_cast<int>(profile.probed_matrix[0].size());
+                if (profile_data.contains("mesh_params") &&
+                    profile_data["mesh_params"].is_object()) {
+                    const json& params = profile_data["mesh_params"];
+                    profile.mesh_min[0] = params.value("min_x", 0.0f);
+                    profile.mesh_min[1] = params.value("min_y", 0.0f);
+                    profile.mesh_max[0] = params.value("max_x", 0.0f);
+                    profile.mesh_max[1] = params.value("max_y", 0.0f);
+                    profile.algo = params.value("algo", "");
+                }
+                bed_mesh_profile_points_hash_[profile_name] =
+                    std::hash<json>{}(profile_data["points"]);
+                bed_mesh_profile_cache_[profile_name] = std::move(profile);
+            }
+        }
+    }
+
     // Parse active profile name
     if (bed_mesh.contains("profile_name") && !bed_mesh["profile_name"].is_null()) {
-        active_bed_mesh_.name = bed_mesh["profile_name"].template get<std::string>();
+        std::string name = bed_mesh["profile_name"].template get<std::string>();
+        if (name != active_bed_mesh_.name) {
+            active_bed_mesh_.name = std::move(name);
+            metadata_changed = true;
+        }
     }
 
-    // Parse probed_matrix (2D array of Z heights)
+    // Parse probed_matrix (2D array of Z heights) - skipped when unchanged
     if (bed_mesh.contains("probed_matrix") && bed_mesh["probed_matrix"].is_array()) {
-        active_bed_mesh_.probed_matrix.clear();
-        for (const auto& row : bed_mesh["probed_matrix"]) {
-            if (row.is_array()) {
-                std::vector<float> row_vec;
-                for (const auto& val : row) {
-                    if (val.is_number()) {
-                        row_vec.push_back(val.template get<float>());
-                    }
-                }
-                if (!row_vec.empty()) {
-                    active_bed_mesh_.probed_matrix.push_back(row_vec);
-                }
+        const json& matrix = bed_mesh["probed_matrix"];
+        size_t matrix_hash = std::hash<json>{}(matrix);
+        if (matrix_hash == bed_mesh_matrix_hash_ && active_bed_mesh_.content_hash != 0) {
+            bed_mesh_stats_.matrix_unchanged++;
+        } else {
+            bed_mesh_matrix_hash_ = matrix_hash;
+            mesh_changed = true;
+
+            // Loading a stored profile sends that profile's points as the new matrix
+            auto cached = bed_mesh_profile_cache_.find(active_bed_mesh_.name);
+            auto cached_hash = bed_mesh_profile_points_hash_.find(active_bed_mesh_.name);
+            if (cached != bed_mesh_profile_cache_.end() &&
+                cached_hash != bed_mesh_profile_points_hash_.end() &&
+                cached_hash->second == matrix_hash) {
+                active_bed_mesh_.probed_matrix = cached->second.probed_matrix;
+                bed_mesh_stats_.matrix_reused++;
+            } else {
+                active_bed_mesh_.probed_matrix = parse_mesh_matrix(matrix);
+                bed_mesh_stats_.matrix_parsed++;
             }
-        }
 
-        // Update dimensions
-        active_bed_mesh_.y_count = static_cast<int>(active_bed_mesh_.probed_matrix.size());
-        active_bed_mesh_.x_count = active_bed_mesh_.probed_matrix.empty()
-                                       ? 0
-                                       : static_cast<int>(active_bed_mesh_.probed_matrix[0].size());
+            // Update dimensions
+            active_bed_mesh_.y_count = static_cast<int>(active_bed_mesh_.probed_matrix.size());
+            active_bed_mesh_.x_count =
+                active_bed_mesh_.probed_matrix.empty()
+                    ? 0
+                    : static_cast<int>(active_bed_mesh_.probed_matrix[0].size());
+        }
     }
 
     // Parse mesh bounds
     if (bed_mesh.contains("mesh_min") && bed_mesh["mesh_min"].is_array() &&
         bed_mesh["mesh_min"].size() >= 2) {
-        active_bed_mesh_.mesh_min[0] = bed_mesh["mesh_min"][0].template get<float>();
-        active_bed_mesh_.mesh_min[1] = bed_mesh["mesh_min"][1].template get<float>();
+        float min_x = bed_mesh["mesh_min"][0].template get<float>();
+        float min_y = bed_mesh["mesh_min"][1].template get<float>();
+        if (min_x != active_bed_mesh_.mesh_min[0] || min_y != active_bed_mesh_.mesh_min[1]) {
+            active_bed_mesh_.mesh_min[0] = min_x;
+            active_bed_mesh_.mesh_min[1] = min_y;
+            mesh_changed = true;
+        }
     }
 
     if (bed_mesh.contains("mesh_max") && bed_mesh["mesh_max"].is_array() &&
         bed_mesh["mesh_max"].size() >= 2) {
-        active_bed_mesh_.mesh_max[0] = bed_mesh["mesh_max"][0].template get<float>();
-        active_bed_mesh_.mesh_max[1] = bed_mesh["mesh_max"][1].template get<float>();
-    }
-
-    // Parse available profiles
-    if (bed_mesh.contains("profiles") && bed_mesh["profiles"].is_object()) {
-        bed_mesh_profiles_.clear();
-        for (auto& [profile_name, profile_data] : bed_mesh["profiles"].items()) {
-            bed_mesh_profiles_.push_back(profile_name);
+        float max_x = bed_mesh["mesh_max"][0].template get<float>();
+        float max_y = bed_mesh["mesh_max"][1].template get<float>();
+        if (max_x != active_bed_mesh_.mesh_max[0] || max_y != active_bed_mesh_.mesh_max[1]) {
+            active_bed_mesh_.mesh_max[0] = max_x;
+            active_bed_mesh_.mesh_max[1] = max_y;
+            mesh_changed = true;
         }
     }
 
@@ -1257,10 +1612,23 @@ void MoonrakerClient::parse_bed_mesh(const json& bed_mesh) {
     if (bed_mesh.contains("mesh_params") && bed_mesh["mesh_params"].is_object()) {
         const json& params = bed_mesh["mesh_params"];
         if (params.contains("algo") && params["algo"].is_string()) {
-            active_bed_mesh_.algo = params["algo"].template get<std::string>();
+            std::string algo = params["algo"].template get<std::string>();
+            if (algo != active_bed_mesh_.algo) {
+                active_bed_mesh_.algo = std::move(algo);
+                metadata_changed = true;
+            }
         }
     }
 
+    if (!mesh_changed && !metadata_changed) {
+        spdlog::trace("[Moonraker Client] Bed mesh unchanged, skipping update");
+        return false;
+    }
+
+    if (mesh_changed) {
+        active_bed_mesh_.content_hash = mesh_content_hash(bed_mesh_matrix_hash_, active_bed_mesh_);
+    }
+
     if (active_bed_mesh_.probed_matrix.empty()) {
         spdlog::debug("[Moonraker Client] Bed mesh data cleared (no probed_matrix)");
     } else {
@@ -1269,6 +1637,7 @@ void MoonrakerClient::parse_bed_mesh(const json& bed_mesh) {
                      active_bed_mesh_.name, active_bed_mesh_.x_count, active_bed_mesh_.y_count,
                      bed_mesh_profiles_.size(), active_bed_mesh_.algo);
     }
+    return true;
 }
 
 std::string MoonrakerClient::guess_bed_heater() const {
@@ -1396,62 +1765,57 @@ std::string MoonrakerClient::guess_hotend_sensor() const {
 }
 
 void MoonrakerClient::check_request_timeouts() {
-    // Two-phase pattern: collect callbacks under lock, invoke outside lock
+    // Two-phase pattern: collect expired requests under lock, invoke outside lock
     // This prevents deadlock if callback tries to send new request
-    std::vector<std::function<void()>> timed_out_callbacks;
+    std::vector<PendingRequest> timed_out;
 
-    // Phase 1: Find timed out requests and copy callbacks (under lock)
+    // Phase 1: Advance the timing wheel - cost is O(expired), not O(outstanding)
     {
         std::lock_guard<std::mutex> lock(requests_mutex_);
-        std::vector<uint64_t> timed_out_ids;
-
-        for (auto& [id, request] : pending_requests_) {
-            if (request.is_timed_out()) {
-                spdlog::warn("[Moonraker Client] Request {} ({}) timed out after {}ms", id,
-                             request.method, request.get_elapsed_ms());
-
-                // Emit timeout event
-                std::string method_name = request.method;
-                uint32_t timeout = request.timeout_ms;
-                emit_event(
-                    MoonrakerEventType::REQUEST_TIMEOUT,
-                    fmt::format("Printer command '{}' timed out after {}ms", method_name, timeout),
-                    false, method_name);
-
-                // Capture callback in lambda if present
-                if (request.error_callback) {
-                    MoonrakerError error =
-                        MoonrakerError::timeout(request.method, request.timeout_ms);
-                    timed_out_callbacks.push_back([cb = request.error_callback, error,
-                                                   method_name]() {
-                        try {
-                            cb(error);
-                        } catch (const std::exception& e) {
-                            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
-                                               "threw exception: {}",
-                                               method_name, e.what());
-                        } catch (...) {
-                            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
-                                               "threw unknown exception",
-                                               method_name);
-                        }
-                    });
-                }
+        if (pending_requests_.empty()) {
+            return;
+        }
+        timed_out = pending_requests_.collect_expired();
+    } // Lock released here
 
-                timed_out_ids.push_back(id);
+    if (timed_out.empty()) {
+        return;
+    }
+
+    // Phase 2: Emit events and invoke callbacks outside lock (safe - callbacks can call
+    // send_jsonrpc)
+    for (auto& request : timed_out) {
+        spdlog::warn("[Moonraker Client] Request {} ({}) timed out after {}ms", request.id,
+                     request.method, request.get_elapsed_ms());
+
+        emit_event(MoonrakerEventType::REQUEST_TIMEOUT,
+                   fmt::format("Printer command '{}' timed out after {}ms", request.method,
+                               request.timeout_ms),
+                   false, request.method);
+
+        if (request.error_callback) {
+            try {
+                request.error_callback(MoonrakerError::timeout(request.method, request.timeout_ms));
+            } catch (const std::exception& e) {
+                LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
+                                   "threw exception: {}",
+                                   request.method, e.what());
+            } catch (...) {
+                LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
+                                   "threw unknown exception",
+                                   request.method);
             }
         }
+    }
 
-        // Remove timed out requests while still holding lock
-        for (uint64_t id : timed_out_ids) {
-            pending_requests_.erase(id);
-        }
-    } // Lock released here
+    RequestTableStats stats = get_request_stats();
+    spdlog::debug("[Moonraker Client] {} request(s) timed out ({} outstanding, {} total timeouts)",
+                  timed_out.size(), stats.outstanding, stats.timed_out);
+}
 
-    // Phase 2: Invoke callbacks outside lock (safe - callbacks can call send_jsonrpc)
-    for (auto& callback : timed_out_callbacks) {
-        callback();
-    }
+RequestTableStats MoonrakerClient::get_request_stats() const {
+    std::lock_guard<std::mutex> lock(requests_mutex_);
+    return pending_requests_.stats();
 }
 
 void MoonrakerClient::cleanup_pending_requests() {
@@ -1468,7 +1832,7 @@ void MoonrakerClient::cleanup_pending_requests() {
                           pending_requests_.size());
 
             // Capture callbacks in lambdas
-            for (auto& [id, request] : pending_requests_) {
+            for (auto& request : pending_requests_.take_all()) {
                 if (request.error_callback) {
                     MoonrakerError error = MoonrakerError::connection_lost(request.method);
                     std::string method_name = request.method;
@@ -1488,8 +1852,6 @@ void MoonrakerClient::cleanup_pending_requests() {
                     });
                 }
             }
-
-            pending_requests_.clear();
         }
     } // Lock released here
 
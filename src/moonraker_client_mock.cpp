@@ -270,8 +270,8 @@ int MoonrakerClientMock::connect(const char* url, std::function<void()> on_conne
 
     set_connection_state(ConnectionState::CONNECTED);
 
-    // Dispatch historical temperature data first (fills graph with 2-3 min of data)
-    dispatch_historical_temperatures();
+    // Generate temperature history first (served via server.temperature_store)
+    generate_temperature_store();
 
     // Start live temperature simulation
     start_temperature_simulation();
@@ -684,6 +684,13 @@ RequestId MoonrakerClientMock::send_jsonrpc(const std::string& method, const jso
         }
     }
 
+    // Handle temperature history API (generated at connect)
+    if (method == "server.temperature_store" && success_cb) {
+        spdlog::info("[MoonrakerClientMock] Returning mock temperature store");
+        success_cb(json{{"result", temperature_store_}});
+        return next_mock_request_id();
+    }
+
     // Handle G-code script execution (routes to gcode_script for state updates)
     if (method == "printer.gcode.script") {
         std::string script;
@@ -1857,15 +1864,17 @@ void MoonrakerClientMock::dispatch_initial_state() {
     dispatch_status_update(initial_status);
 }
 
-void MoonrakerClientMock::dispatch_historical_temperatures() {
+void MoonrakerClientMock::generate_temperature_store() {
     // Generate 2-3 minutes of synthetic temperature history
-    // At 250ms intervals, that's ~600 data points for 2.5 minutes
+    // Simulated at 250ms steps; every 4th step is stored (Moonraker's store is 1 Hz)
     constexpr int HISTORY_DURATION_MS = 150000; // 2.5 minutes of history
     constexpr int SAMPLE_INTERVAL_MS = 250;     // Same as SIMULATION_INTERVAL_MS
+    constexpr int STORE_INTERVAL_MS = 1000;     // Moonraker temperature store resolution
     constexpr int HISTORY_SAMPLES = HISTORY_DURATION_MS / SAMPLE_INTERVAL_MS;
+    constexpr int STORE_STRIDE = STORE_INTERVAL_MS / SAMPLE_INTERVAL_MS;
 
-    spdlog::info("[MoonrakerClientMock] Dispatching {} historical temperature samples ({} seconds)",
-                 HISTORY_SAMPLES, HISTORY_DURATION_MS / 1000);
+    spdlog::info("[MoonrakerClientMock] Generating {} seconds of temperature history",
+                 HISTORY_DURATION_MS / 1000);
 
     // Simulate a realistic temperature profile: heating up to ~60°C then partial cooldown
     // This creates an interesting curve for debugging/visualization
@@ -1878,24 +1887,7 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
     constexpr int HOLD_PHASE_SAMPLES = 120; // ~30 seconds hold at peak
     // Cooling phase = remaining samples (~70s, cools extruder ~20°C to ~40°C)
 
-    // Copy callbacks to avoid holding lock during dispatch
-    std::vector<std::function<void(json)>> callbacks_copy;
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
-    }
-
-    // If no callbacks registered yet, skip (caller should register before connect)
-    if (callbacks_copy.empty()) {
-        spdlog::warn(
-            "[MoonrakerClientMock] No callbacks registered for historical temps - skipping");
-        return;
-    }
-
-    // Generate and dispatch historical samples with realistic noise
+    // Generate historical samples with realistic noise
     double ext_temp_hist = ROOM_TEMP;
     double bed_temp_hist = ROOM_TEMP;
     const double dt_sec = SAMPLE_INTERVAL_MS / 1000.0;
@@ -1909,10 +1901,10 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
         return (static_cast<double>(state) / 0x3fffffff) - 1.0;
     };
 
-    for (int i = 0; i < HISTORY_SAMPLES; i++) {
-        // Calculate simulated timestamp (negative = in the past)
-        double timestamp_sec = -((HISTORY_SAMPLES - i) * dt_sec);
+    json ext_temps = json::array();
+    json bed_temps = json::array();
 
+    for (int i = 0; i < HISTORY_SAMPLES; i++) {
         // Update base temperatures based on phase
         if (i < HEAT_PHASE_SAMPLES) {
             // Heating phase: ramp up to peak (slightly faster at start, slower near target)
@@ -1952,28 +1944,32 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
         double ext_with_noise = ext_temp_hist + ext_noise;
         double bed_with_noise = bed_temp_hist + bed_noise;
 
-        // Build minimal status object (only temperature data needed for graphs)
-        json status_obj = {{"extruder", {{"temperature", ext_with_noise}, {"target", 0.0}}},
-                           {"heater_bed", {{"temperature", bed_with_noise}, {"target", 0.0}}}};
-
-        json notification = {{"method", "notify_status_update"},
-                             {"params", json::array({status_obj, timestamp_sec})}};
-
-        // Dispatch to all callbacks
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
+        // Keep the last step of each second (the newest stored sample is the current one)
+        if ((HISTORY_SAMPLES - 1 - i) % STORE_STRIDE == 0) {
+            ext_temps.push_back(std::round(ext_with_noise * 100.0) / 100.0);
+            bed_temps.push_back(std::round(bed_with_noise * 100.0) / 100.0);
         }
     }
 
+    // Same layout as Moonraker's server.temperature_store (heaters are off in the history)
+    json ext_zeros = json::array();
+    json bed_zeros = json::array();
+    for (size_t i = 0; i < ext_temps.size(); i++) {
+        ext_zeros.push_back(0.0);
+        bed_zeros.push_back(0.0);
+    }
+    temperature_store_ = {
+        {"extruder", {{"temperatures", ext_temps}, {"targets", ext_zeros}, {"powers", ext_zeros}}},
+        {"heater_bed",
+         {{"temperatures", bed_temps}, {"targets", bed_zeros}, {"powers", bed_zeros}}}};
+
     // Store final historical values as current temps
     extruder_temp_.store(ext_temp_hist);
     bed_temp_.store(bed_temp_hist);
 
-    spdlog::info("[MoonrakerClientMock] Historical temps dispatched: final extruder={:.1f}°C, "
-                 "bed={:.1f}°C",
-                 ext_temp_hist, bed_temp_hist);
+    spdlog::info("[MoonrakerClientMock] Temperature store ready ({} samples per heater): "
+                 "final extruder={:.1f}°C, bed={:.1f}°C",
+                 ext_temps.size(), ext_temp_hist, bed_temp_hist);
 }
 
 void MoonrakerClientMock::set_extruder_target(double target) {
@@ -2240,20 +2236,7 @@ void MoonrakerClientMock::temperature_simulation_loop() {
                              {"params", json::array({status_obj, tick * base_dt})}};
 
         // Push notification through all registered callbacks
-        // Two-phase: copy under lock, invoke outside to avoid deadlock
-        std::vector<std::function<void(json)>> callbacks_copy;
-        {
-            std::lock_guard<std::mutex> lock(callbacks_mutex_);
-            callbacks_copy.reserve(notify_callbacks_.size());
-            for (const auto& [id, cb] : notify_callbacks_) {
-                callbacks_copy.push_back(cb);
-            }
-        }
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        notification_dispatcher_.dispatch_status(notification);
 
         // Sleep wall-clock interval (unchanged by speedup factor)
         std::this_thread::sleep_for(std::chrono::milliseconds(SIMULATION_INTERVAL_MS));
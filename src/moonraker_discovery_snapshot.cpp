@@ -0,0 +1,147 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_discovery_snapshot.h"
+
+#include "spdlog/spdlog.h"
+
+#include <cstdio>
+#include <fstream>
+
+json DiscoverySnapshot::to_json() const {
+    return {{"printer_objects", printer_objects},
+            {"hostname", hostname},
+            {"software_version", software_version},
+            {"moonraker_version", moonraker_version},
+            {"kinematics", kinematics},
+            {"mcu", mcu},
+            {"mcu_list", mcu_list},
+            {"build_volume",
+             {{"x_min", build_volume.x_min},
+              {"x_max", build_volume.x_max},
+              {"y_min", build_volume.y_min},
+              {"y_max", build_volume.y_max},
+              {"z_max", build_volume.z_max}}},
+            {"saved_at", saved_at}};
+}
+
+std::optional<DiscoverySnapshot> DiscoverySnapshot::from_json(const json& j) {
+    if (!j.is_object() || !j.contains("printer_objects") || !j["printer_objects"].is_array() ||
+        j["printer_objects"].empty()) {
+        return std::nullopt;
+    }
+
+    try {
+        DiscoverySnapshot snap;
+        snap.printer_objects = j["printer_objects"].get<std::vector<std::string>>();
+        snap.hostname = j.value("hostname", "");
+        snap.software_version = j.value("software_version", "");
+        snap.moonraker_version = j.value("moonraker_version", "");
+        snap.kinematics = j.value("kinematics", "");
+        snap.mcu = j.value("mcu", "");
+        if (j.contains("mcu_list") && j["mcu_list"].is_array()) {
+            snap.mcu_list = j["mcu_list"].get<std::vector<std::string>>();
+        }
+        if (j.contains("build_volume") && j["build_volume"].is_object()) {
+            const json& bv = j["build_volume"];
+            snap.build_volume.x_min = bv.value("x_min", 0.0f);
+            snap.build_volume.x_max = bv.value("x_max", 0.0f);
+            snap.build_volume.y_min = bv.value("y_min", 0.0f);
+            snap.build_volume.y_max = bv.value("y_max", 0.0f);
+            snap.build_volume.z_max = bv.value("z_max", 0.0f);
+        }
+        snap.saved_at = j.value("saved_at", int64_t{0});
+        return snap;
+    } catch (const json::exception& e) {
+        spdlog::warn("[Discovery Snapshot] Ignoring malformed snapshot: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+std::string DiscoverySnapshotStore::host_key(const std::string& url) {
+    std::string key = url;
+    size_t scheme = key.find("://");
+    if (scheme != std::string::npos) {
+        key.erase(0, scheme + 3);
+    }
+    size_t slash = key.find('/');
+    if (slash != std::string::npos) {
+        key.erase(slash);
+    }
+    return key;
+}
+
+json DiscoverySnapshotStore::read_all() const {
+    std::ifstream in(path_);
+    if (!in.is_open()) {
+        return json::object();
+    }
+    try {
+        json all = json::parse(in);
+        if (all.is_object()) {
+            return all;
+        }
+    } catch (const json::exception& e) {
+        spdlog::warn("[Discovery Snapshot] Cache {} is corrupt, ignoring: {}", path_, e.what());
+    }
+    return json::object();
+}
+
+bool DiscoverySnapshotStore::write_all(const json& all) const {
+    std::string tmp_path = path_ + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::trunc);
+        if (!out.is_open()) {
+            spdlog::warn("[Discovery Snapshot] Cannot write {}", tmp_path);
+            return false;
+        }
+        out << all.dump();
+        if (!out.good()) {
+            spdlog::warn("[Discovery Snapshot] Error writing {}", tmp_path);
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        spdlog::warn("[Discovery Snapshot] Cannot replace {}", path_);
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::optional<DiscoverySnapshot> DiscoverySnapshotStore::load(const std::string& key) const {
+    if (!enabled() || key.empty()) {
+        return std::nullopt;
+    }
+    json all = read_all();
+    if (!all.contains(key)) {
+        return std::nullopt;
+    }
+    return DiscoverySnapshot::from_json(all[key]);
+}
+
+bool DiscoverySnapshotStore::store(const std::string& key, const DiscoverySnapshot& snapshot) const {
+    if (!enabled() || key.empty()) {
+        return false;
+    }
+    json all = read_all();
+    all[key] = snapshot.to_json();
+    if (!write_all(all)) {
+        return false;
+    }
+    spdlog::debug("[Discovery Snapshot] Saved snapshot for {} ({} objects)", key,
+                  snapshot.printer_objects.size());
+    return true;
+}
+
+bool DiscoverySnapshotStore::remove(const std::string& key) const {
+    if (!enabled()) {
+        return false;
+    }
+    json all = read_all();
+    if (all.erase(key) == 0) {
+        return false;
+    }
+    return write_all(all);
+}
@@ -0,0 +1,250 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_notification_dispatch.h"
+
+#include "ui_error_reporting.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace {
+constexpr const char* BUILTIN_METHOD_NAMES[] = {
+    "notify_status_update",       // STATUS_UPDATE
+    "notify_filelist_changed",    // FILELIST_CHANGED
+    "notify_klippy_ready",        // KLIPPY_READY
+    "notify_klippy_disconnected", // KLIPPY_DISCONNECTED
+    "notify_klippy_shutdown",     // KLIPPY_SHUTDOWN
+    "notify_gcode_response",      // GCODE_RESPONSE
+};
+static_assert(sizeof(BUILTIN_METHOD_NAMES) / sizeof(BUILTIN_METHOD_NAMES[0]) ==
+                  NotificationDispatcher::BUILTIN_METHOD_COUNT,
+              "BUILTIN_METHOD_NAMES must match BuiltinMethod");
+} // namespace
+
+NotificationDispatcher::NotificationDispatcher() {
+    auto table = std::make_shared<Table>();
+    for (const char* name : BUILTIN_METHOD_NAMES) {
+        intern(*table, name);
+    }
+    table->methods[STATUS_UPDATE].fan_out_status = true;
+    table->methods[FILELIST_CHANGED].fan_out_status = true;
+    publish(std::move(table));
+}
+
+std::shared_ptr<const NotificationDispatcher::Table> NotificationDispatcher::load() const {
+    return std::atomic_load_explicit(&table_, std::memory_order_acquire);
+}
+
+void NotificationDispatcher::publish(std::shared_ptr<const Table> table) {
+    std::atomic_store_explicit(&table_, std::move(table), std::memory_order_release);
+}
+
+NotificationMethodId NotificationDispatcher::intern(Table& table, const std::string& method) {
+    auto it = table.ids.find(method);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+    auto id = static_cast<NotificationMethodId>(table.methods.size());
+    MethodEntry entry;
+    entry.name = method;
+    entry.counters = std::make_shared<MethodCounters>();
+    table.methods.push_back(std::move(entry));
+    table.ids.emplace(method, id);
+    return id;
+}
+
+NotificationMethodId NotificationDispatcher::lookup(const std::string& method) const {
+    auto table = load();
+    auto it = table->ids.find(method);
+    return it == table->ids.end() ? UNKNOWN_METHOD : it->second;
+}
+
+void NotificationDispatcher::add_status_handler(uint64_t id, NotificationCallback cb,
+                                                const std::string& name) {
+    Handler handler;
+    handler.id = id;
+    handler.name = name.empty() ? "subscriber#" + std::to_string(id) : name;
+    handler.cb = std::move(cb);
+    handler.counters = std::make_shared<HandlerCounters>();
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto table = std::make_shared<Table>(*load());
+    table->status_handlers.push_back(std::move(handler));
+    publish(std::move(table));
+}
+
+bool NotificationDispatcher::remove_status_handler(uint64_t id) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto current = load();
+    auto match = [id](const Handler& h) { return h.id == id; };
+    if (std::none_of(current->status_handlers.begin(), current->status_handlers.end(), match)) {
+        return false;
+    }
+
+    auto table = std::make_shared<Table>(*current);
+    auto& handlers = table->status_handlers;
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(), match), handlers.end());
+    publish(std::move(table));
+    return true;
+}
+
+bool NotificationDispatcher::add_method_handler(const std::string& method, const std::string& name,
+                                                NotificationCallback cb) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto current = load();
+    auto it = current->ids.find(method);
+    if (it != current->ids.end()) {
+        const auto& handlers = current->methods[it->second].handlers;
+        if (std::any_of(handlers.begin(), handlers.end(),
+                        [&name](const Handler& h) { return h.name == name; })) {
+            return false;
+        }
+    }
+
+    Handler handler;
+    handler.name = name;
+    handler.cb = std::move(cb);
+    handler.counters = std::make_shared<HandlerCounters>();
+
+    auto table = std::make_shared<Table>(*current);
+    NotificationMethodId id = intern(*table, method);
+    table->methods[id].handlers.push_back(std::move(handler));
+    publish(std::move(table));
+    return true;
+}
+
+bool NotificationDispatcher::remove_method_handler(const std::string& method,
+                                                   const std::string& name) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto current = load();
+    auto it = current->ids.find(method);
+    if (it == current->ids.end()) {
+        return false;
+    }
+
+    auto match = [&name](const Handler& h) { return h.name == name; };
+    const auto& existing = current->methods[it->second].handlers;
+    if (std::none_of(existing.begin(), existing.end(), match)) {
+        return false;
+    }
+
+    // Method stays interned (IDs are never reused) so its counters survive
+    auto table = std::make_shared<Table>(*current);
+    auto& handlers = table->methods[it->second].handlers;
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(), match), handlers.end());
+    publish(std::move(table));
+    return true;
+}
+
+size_t NotificationDispatcher::invoke(const std::vector<Handler>& handlers, const json& message,
+                                      const std::string& method) {
+    using std::chrono::steady_clock;
+    for (const auto& handler : handlers) {
+        auto start = steady_clock::now();
+        try {
+            handler.cb(message);
+        } catch (const std::exception& e) {
+            handler.counters->exceptions.fetch_add(1, std::memory_order_relaxed);
+            LOG_ERROR_INTERNAL("[Moonraker Client] Callback '{}' for {} threw exception: {}",
+                               handler.name, method, e.what());
+        } catch (...) {
+            handler.counters->exceptions.fetch_add(1, std::memory_order_relaxed);
+            LOG_ERROR_INTERNAL("[Moonraker Client] Callback '{}' for {} threw unknown exception",
+                               handler.name, method);
+        }
+        auto elapsed_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - start)
+                .count());
+
+        HandlerCounters& counters = *handler.counters;
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        counters.total_us.fetch_add(elapsed_us, std::memory_order_relaxed);
+        auto clamped = static_cast<uint32_t>(std::min<uint64_t>(elapsed_us, UINT32_MAX));
+        uint32_t prev_max = counters.max_us.load(std::memory_order_relaxed);
+        while (clamped > prev_max &&
+               !counters.max_us.compare_exchange_weak(prev_max, clamped,
+                                                      std::memory_order_relaxed)) {
+        }
+    }
+    return handlers.size();
+}
+
+size_t NotificationDispatcher::dispatch(NotificationMethodId method_id, const json& message) {
+    // Holding the snapshot keeps every handler alive even if it unregisters itself
+    auto table = load();
+    if (method_id >= table->methods.size()) {
+        unknown_received_.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    const MethodEntry& entry = table->methods[method_id];
+    entry.counters->received.fetch_add(1, std::memory_order_relaxed);
+
+    size_t invoked = 0;
+    if (entry.fan_out_status) {
+        invoked += invoke(table->status_handlers, message, entry.name);
+    }
+    invoked += invoke(entry.handlers, message, entry.name);
+    return invoked;
+}
+
+size_t NotificationDispatcher::dispatch_status(const json& message) {
+    auto table = load();
+    return invoke(table->status_handlers, message, table->methods[STATUS_UPDATE].name);
+}
+
+size_t NotificationDispatcher::status_handler_count() const {
+    return load()->status_handlers.size();
+}
+
+void NotificationDispatcher::clear() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto table = std::make_shared<Table>(*load());
+    table->status_handlers.clear();
+    for (auto& entry : table->methods) {
+        entry.handlers.clear();
+    }
+    publish(std::move(table));
+}
+
+std::vector<NotificationMethodStats> NotificationDispatcher::stats() const {
+    auto table = load();
+
+    auto snapshot = [](const Handler& handler) {
+        NotificationHandlerStats s;
+        s.name = handler.name;
+        s.calls = handler.counters->calls.load(std::memory_order_relaxed);
+        s.total_us = handler.counters->total_us.load(std::memory_order_relaxed);
+        s.max_us = handler.counters->max_us.load(std::memory_order_relaxed);
+        s.exceptions = handler.counters->exceptions.load(std::memory_order_relaxed);
+        return s;
+    };
+
+    std::vector<NotificationMethodStats> result;
+    for (const auto& entry : table->methods) {
+        NotificationMethodStats method_stats;
+        method_stats.method = entry.name;
+        method_stats.received = entry.counters->received.load(std::memory_order_relaxed);
+        // Status subscribers are shared by every fan-out method; report them once
+        if (&entry == &table->methods[STATUS_UPDATE]) {
+            for (const auto& handler : table->status_handlers) {
+                method_stats.handlers.push_back(snapshot(handler));
+            }
+        }
+        for (const auto& handler : entry.handlers) {
+            method_stats.handlers.push_back(snapshot(handler));
+        }
+        if (method_stats.received == 0 && method_stats.handlers.empty()) {
+            continue;
+        }
+        for (const auto& handler : method_stats.handlers) {
+            method_stats.handler_us += handler.total_us;
+        }
+        result.push_back(std::move(method_stats));
+    }
+    return result;
+}
@@ -0,0 +1,333 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_request_table.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace {
+constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+// Round up to the next power of two (minimum 8)
+size_t round_up_pow2(size_t n) {
+    size_t cap = 8;
+    while (cap < n) {
+        cap <<= 1;
+    }
+    return cap;
+}
+} // namespace
+
+// ============================================================================
+// Latency histogram
+// ============================================================================
+
+void RpcLatencyHistogram::record(uint32_t elapsed_ms) {
+    size_t bucket = 0;
+    uint32_t v = elapsed_ms;
+    while (v > 0 && bucket < BUCKET_COUNT - 1) {
+        v >>= 1;
+        bucket++;
+    }
+    buckets[bucket]++;
+    count++;
+    total_ms += elapsed_ms;
+    max_ms = std::max(max_ms, elapsed_ms);
+}
+
+uint32_t RpcLatencyHistogram::percentile_ms(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    auto wanted = static_cast<uint64_t>(fraction * static_cast<double>(count));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT - 1; i++) {
+        seen += buckets[i];
+        if (seen > wanted) {
+            return std::min(uint32_t{1} << i, max_ms);
+        }
+    }
+    return max_ms;
+}
+
+PendingRequestTable::PendingRequestTable(uint32_t tick_ms, size_t initial_capacity)
+    : origin_(Clock::now()), tick_ms_(tick_ms > 0 ? tick_ms : DEFAULT_TICK_MS) {
+    // Keep load factor <= 0.5 so probe sequences stay short
+    slots_.resize(round_up_pow2(initial_capacity * 2));
+    mask_ = slots_.size() - 1;
+}
+
+// ============================================================================
+// Flat table
+// ============================================================================
+
+size_t PendingRequestTable::find_index(uint64_t id) const {
+    size_t i = static_cast<size_t>(id) & mask_;
+    while (slots_[i].used) {
+        if (slots_[i].id == id) {
+            return i;
+        }
+        i = (i + 1) & mask_;
+    }
+    return NPOS;
+}
+
+PendingRequest PendingRequestTable::erase_at(size_t index) {
+    PendingRequest removed = std::move(slots_[index].request);
+
+    // Backward-shift deletion: pull later members of the probe chain into the hole
+    // so lookups never need tombstones.
+    size_t hole = index;
+    size_t j = index;
+    for (;;) {
+        j = (j + 1) & mask_;
+        if (!slots_[j].used) {
+            break;
+        }
+        size_t home = static_cast<size_t>(slots_[j].id) & mask_;
+        // Entry at j may move into the hole only if its home is not in (hole, j]
+        bool home_between =
+            (hole <= j) ? (hole < home && home <= j) : (hole < home || home <= j);
+        if (!home_between) {
+            slots_[hole] = std::move(slots_[j]);
+            hole = j;
+        }
+    }
+
+    slots_[hole].used = false;
+    slots_[hole].id = 0;
+    slots_[hole].request = PendingRequest{};
+    count_--;
+    return removed;
+}
+
+void PendingRequestTable::grow() {
+    std::vector<Slot> old = std::move(slots_);
+    slots_.clear();
+    slots_.resize(old.size() * 2);
+    mask_ = slots_.size() - 1;
+
+    for (auto& slot : old) {
+        if (!slot.used) {
+            continue;
+        }
+        size_t i = static_cast<size_t>(slot.id) & mask_;
+        while (slots_[i].used) {
+            i = (i + 1) & mask_;
+        }
+        slots_[i] = std::move(slot);
+    }
+}
+
+bool PendingRequestTable::insert(PendingRequest request) {
+    if (find_index(request.id) != NPOS) {
+        return false;
+    }
+
+    if ((count_ + 1) * 2 > slots_.size()) {
+        grow();
+    }
+
+    size_t i = static_cast<size_t>(request.id) & mask_;
+    while (slots_[i].used) {
+        i = (i + 1) & mask_;
+    }
+
+    WheelEntry entry{request.id, deadline_tick(request)};
+
+    slots_[i].used = true;
+    slots_[i].id = request.id;
+    slots_[i].request = std::move(request);
+    count_++;
+
+    stats_.registered++;
+    stats_.peak_outstanding = std::max(stats_.peak_outstanding, count_);
+
+    schedule(entry);
+    return true;
+}
+
+bool PendingRequestTable::contains(uint64_t id) const {
+    return find_index(id) != NPOS;
+}
+
+const PendingRequest* PendingRequestTable::find(uint64_t id) const {
+    size_t i = find_index(id);
+    return i == NPOS ? nullptr : &slots_[i].request;
+}
+
+std::optional<PendingRequest> PendingRequestTable::take(uint64_t id) {
+    size_t i = find_index(id);
+    if (i == NPOS) {
+        return std::nullopt;
+    }
+    stats_.completed++;
+    return erase_at(i);
+}
+
+std::optional<PendingRequest> PendingRequestTable::take_failed(uint64_t id) {
+    size_t i = find_index(id);
+    if (i == NPOS) {
+        return std::nullopt;
+    }
+    stats_.send_failed++;
+    return erase_at(i);
+}
+
+bool PendingRequestTable::cancel(uint64_t id) {
+    size_t i = find_index(id);
+    if (i == NPOS) {
+        return false;
+    }
+    stats_.cancelled++;
+    erase_at(i);
+    return true;
+}
+
+std::vector<PendingRequest> PendingRequestTable::take_all() {
+    std::vector<PendingRequest> all;
+    all.reserve(count_);
+    for (auto& slot : slots_) {
+        if (slot.used) {
+            all.push_back(std::move(slot.request));
+            slot.used = false;
+            slot.id = 0;
+            slot.request = PendingRequest{};
+        }
+    }
+    count_ = 0;
+    clear_wheel();
+    return all;
+}
+
+// ============================================================================
+// Timing wheel
+// ============================================================================
+
+uint64_t PendingRequestTable::to_tick(Clock::time_point t) const {
+    if (t <= origin_) {
+        return 0;
+    }
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - origin_).count();
+    return static_cast<uint64_t>(ms) / tick_ms_;
+}
+
+uint64_t PendingRequestTable::deadline_tick(const PendingRequest& request) const {
+    return to_tick(request.timestamp + std::chrono::milliseconds(request.timeout_ms));
+}
+
+void PendingRequestTable::schedule(const WheelEntry& entry) {
+    // Never schedule into the slot currently being processed
+    uint64_t target = std::max(entry.deadline_tick, current_tick_ + 1);
+    uint64_t delta = target - current_tick_;
+
+    // Deadlines beyond the wheel span park in the top level and re-cascade
+    if (delta >= WHEEL_SPAN) {
+        target = current_tick_ + WHEEL_SPAN - 1;
+        delta = WHEEL_SPAN - 1;
+    }
+
+    for (unsigned level = 0; level < WHEEL_LEVELS; ++level) {
+        if (delta < (uint64_t{1} << (WHEEL_BITS * (level + 1)))) {
+            size_t slot = static_cast<size_t>((target >> (WHEEL_BITS * level)) & WHEEL_MASK);
+            wheel_[level][slot].push_back(entry);
+            return;
+        }
+    }
+}
+
+void PendingRequestTable::cascade(unsigned level) {
+    size_t slot = static_cast<size_t>((current_tick_ >> (WHEEL_BITS * level)) & WHEEL_MASK);
+    std::vector<WheelEntry> entries;
+    entries.swap(wheel_[level][slot]);
+    for (const auto& entry : entries) {
+        schedule(entry);
+    }
+}
+
+void PendingRequestTable::clear_wheel() {
+    for (auto& level : wheel_) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+}
+
+std::vector<PendingRequest> PendingRequestTable::collect_expired(Clock::time_point now) {
+    std::vector<PendingRequest> expired;
+    stats_.timeout_scans++;
+
+    uint64_t target = to_tick(now);
+    if (target <= current_tick_) {
+        return expired;
+    }
+
+    // Nothing outstanding: any wheel entries are stale, skip straight to target
+    if (count_ == 0) {
+        clear_wheel();
+        current_tick_ = target;
+        return expired;
+    }
+
+    // Handles one wheel entry whose slot is due. Returns true if it was consumed.
+    auto process_due = [&](const WheelEntry& entry) {
+        size_t i = find_index(entry.id);
+        if (i == NPOS || deadline_tick(slots_[i].request) != entry.deadline_tick) {
+            stats_.stale_skipped++;
+            return;
+        }
+        if (entry.deadline_tick > current_tick_) {
+            // Parked beyond the wheel span, or rebased - re-schedule closer
+            schedule(entry);
+            return;
+        }
+
+        const PendingRequest& request = slots_[i].request;
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - request.timestamp);
+        if (elapsed.count() > static_cast<int64_t>(request.timeout_ms)) {
+            stats_.timed_out++;
+            expired.push_back(erase_at(i));
+        } else {
+            // Deadline falls inside the current tick - check again next tick
+            schedule(entry);
+        }
+    };
+
+    // Very long gap (e.g. host suspended): rebase instead of stepping every tick
+    if (target - current_tick_ > WHEEL_SIZE * WHEEL_SIZE) {
+        std::vector<WheelEntry> entries;
+        for (auto& level : wheel_) {
+            for (auto& slot : level) {
+                entries.insert(entries.end(), slot.begin(), slot.end());
+                slot.clear();
+            }
+        }
+        current_tick_ = target;
+        for (const auto& entry : entries) {
+            process_due(entry);
+        }
+        return expired;
+    }
+
+    while (current_tick_ < target) {
+        ++current_tick_;
+
+        if ((current_tick_ & WHEEL_MASK) == 0) {
+            if (((current_tick_ >> WHEEL_BITS) & WHEEL_MASK) == 0) {
+                cascade(2);
+            }
+            cascade(1);
+        }
+
+        std::vector<WheelEntry> due;
+        due.swap(wheel_[0][static_cast<size_t>(current_tick_ & WHEEL_MASK)]);
+        for (const auto& entry : due) {
+            process_due(entry);
+        }
+    }
+
+    return expired;
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pattern_matcher.h"
+
+#include <algorithm>
+#include <cctype>
+#include <queue>
+
+namespace {
+
+char fold(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+} // namespace
+
+size_t PatternMatcher::add(std::string_view pattern) {
+    std::string folded(pattern);
+    std::transform(folded.begin(), folded.end(), folded.begin(), fold);
+
+    // Walk (and extend) the trie; the node at the end remembers the pattern
+    int32_t node = 0;
+    for (char c : folded) {
+        int32_t next = child(node, c);
+        if (next == NONE) {
+            next = static_cast<int32_t>(nodes_.size());
+            auto& children = nodes_[static_cast<size_t>(node)].next;
+            children.insert(std::upper_bound(children.begin(), children.end(),
+                                             std::make_pair(c, NONE)),
+                            {c, next});
+            nodes_.emplace_back();
+        }
+        node = next;
+    }
+
+    Node& end = nodes_[static_cast<size_t>(node)];
+    if (end.output == NONE) {
+        end.output = static_cast<int32_t>(patterns_.size());
+        patterns_.push_back(std::move(folded));
+        if (node == 0) {
+            empty_pattern_ = end.output;
+        }
+    }
+    return static_cast<size_t>(end.output);
+}
+
+void PatternMatcher::build() {
+    // Breadth-first, so every node's fail target is finished before the node itself
+    std::queue<int32_t> queue;
+    for (const auto& [c, next] : nodes_[0].next) {
+        nodes_[static_cast<size_t>(next)].fail = 0;
+        queue.push(next);
+    }
+
+    while (!queue.empty()) {
+        int32_t node = queue.front();
+        queue.pop();
+
+        for (const auto& [c, next] : nodes_[static_cast<size_t>(node)].next) {
+            int32_t fail = nodes_[static_cast<size_t>(node)].fail;
+            while (fail != 0 && child(fail, c) == NONE) {
+                fail = nodes_[static_cast<size_t>(fail)].fail;
+            }
+            int32_t target = child(fail, c);
+            Node& child_node = nodes_[static_cast<size_t>(next)];
+            child_node.fail = (target == NONE || target == next) ? 0 : target;
+
+            // The root's output (the empty pattern) is reported separately
+            const Node& fail_node = nodes_[static_cast<size_t>(child_node.fail)];
+            child_node.dictionary = (child_node.fail != 0 && fail_node.output != NONE)
+                                        ? child_node.fail
+                                        : fail_node.dictionary;
+            queue.push(next);
+        }
+    }
+}
+
+void PatternMatcher::find_all(std::string_view text, std::vector<bool>& found) const {
+    if (found.size() < patterns_.size()) {
+        found.resize(patterns_.size(), false);
+    }
+    if (empty_pattern_ != NONE) {
+        found[static_cast<size_t>(empty_pattern_)] = true;
+    }
+
+    int32_t node = 0;
+    for (char raw : text) {
+        char c = fold(raw);
+        int32_t next = child(node, c);
+        while (next == NONE && node != 0) {
+            node = nodes_[static_cast<size_t>(node)].fail;
+            next = child(node, c);
+        }
+        node = (next == NONE) ? 0 : next;
+
+        const Node& current = nodes_[static_cast<size_t>(node)];
+        int32_t match = (current.output != NONE && node != 0) ? node : current.dictionary;
+        while (match != NONE) {
+            const Node& matched = nodes_[static_cast<size_t>(match)];
+            found[static_cast<size_t>(matched.output)] = true;
+            match = matched.dictionary;
+        }
+    }
+}
+
+int32_t PatternMatcher::child(int32_t node, char c) const {
+    const auto& children = nodes_[static_cast<size_t>(node)].next;
+    auto it = std::lower_bound(children.begin(), children.end(), std::make_pair(c, NONE));
+    return (it != children.end() && it->first == c) ? it->second : NONE;
+}
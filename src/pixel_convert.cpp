@@ -0,0 +1,66 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pixel_convert.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIXEL_CONVERT_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PIXEL_CONVERT_SSE2 1
+#endif
+
+static inline uint16_t xrgb8888_to_rgb565(uint32_t p) {
+    return static_cast<uint16_t>(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+}
+
+void pixel_convert_xrgb8888_to_rgb565_scalar(const uint32_t* src, uint16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = xrgb8888_to_rgb565(src[i]);
+    }
+}
+
+void pixel_convert_xrgb8888_to_rgb565(const uint32_t* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+
+#if defined(PIXEL_CONVERT_NEON)
+    // vld4 de-interleaves 8 pixels into B, G, R, X byte lanes (little-endian words)
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t bgrx = vld4_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint16x8_t out = vshll_n_u8(bgrx.val[2], 8);             // R in bits 8-15
+        out = vsriq_n_u16(out, vshll_n_u8(bgrx.val[1], 8), 5);  // G top 6 bits -> 5-10
+        out = vsriq_n_u16(out, vshll_n_u8(bgrx.val[0], 8), 11); // B top 5 bits -> 0-4
+        vst1q_u16(dst + i, out);
+    }
+#elif defined(PIXEL_CONVERT_SSE2)
+    const __m128i mask_r = _mm_set1_epi32(0xF800);
+    const __m128i mask_g = _mm_set1_epi32(0x07E0);
+    const __m128i mask_b = _mm_set1_epi32(0x001F);
+    auto convert4 = [&](__m128i p) {
+        __m128i r = _mm_and_si128(_mm_srli_epi32(p, 8), mask_r);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(p, 5), mask_g);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(p, 3), mask_b);
+        __m128i rgb = _mm_or_si128(_mm_or_si128(r, g), b);
+        // Sign-extend the low 16 bits so the signed saturating pack keeps them unchanged
+        return _mm_srai_epi32(_mm_slli_epi32(rgb, 16), 16);
+    };
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = convert4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        __m128i hi = convert4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+
+    pixel_convert_xrgb8888_to_rgb565_scalar(src + i, dst + i, count - i);
+}
+
+const char* pixel_convert_implementation() {
+#if defined(PIXEL_CONVERT_NEON)
+    return "NEON";
+#elif defined(PIXEL_CONVERT_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
@@ -25,24 +25,117 @@
 
 #include "ui_error_reporting.h"
 
+#include "pattern_matcher.h"
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
 #include <cctype>
 #include <fstream>
+#include <optional>
+#include <unordered_map>
 
 #include "hv/json.hpp"
 
 using json = nlohmann::json;
 
 // ============================================================================
-// JSON Database Loader
+// Compiled Rule Table
 // ============================================================================
+//
+// config/printer_database.json is compiled once into a flat table: every printer's
+// heuristics become CompiledRule rows, and all their patterns go into one PatternMatcher.
+// Detection then scans each hardware name once for all patterns together, records which
+// patterns each field contains, and scores the rules with a lookup per pattern.
 
 namespace {
-// Lazy-loaded printer database
-struct PrinterDatabase {
-    json data;
+
+// Hardware fields that rules can match against (see scan_fields())
+enum class RuleField : uint8_t {
+    SENSORS,
+    FANS,
+    HEATERS,
+    LEDS,
+    PRINTER_OBJECTS,
+    STEPPERS,
+    HOSTNAME,
+    KINEMATICS,
+    MCU,
+    MACROS, ///< Macro names from "gcode_macro <NAME>" printer objects
+    NONE,   ///< Unknown field: pattern rules never match
+};
+constexpr size_t FIELD_COUNT = static_cast<size_t>(RuleField::NONE);
+
+enum class RuleKind : uint8_t {
+    PATTERN,        ///< The rule's pattern occurs in one of the field's names
+    ALL_PATTERNS,   ///< Every pattern occurs in some name of the field
+    Z_STEPPERS,     ///< Exact number of stepper_z* steppers
+    BUILD_VOLUME,   ///< Bed mesh size within range
+};
+
+struct CompiledRule {
+    RuleKind kind = RuleKind::PATTERN;
+    RuleField field = RuleField::NONE;
+    bool needs_value = false; ///< kinematics/mcu rules never match an unknown (empty) value
+    int confidence = 0;
+    uint32_t first_pattern = 0; ///< Range in RuleTable::rule_patterns
+    uint32_t pattern_count = 0;
+    int z_steppers = 0;
+    std::optional<float> min_x, max_x, min_y, max_y;
+    std::string type; ///< Heuristic type from the database, for logging
+    std::string reason;
+};
+
+struct CompiledPrinter {
+    std::string id;
+    std::string name;
+    std::string image;
+    bool show_in_roller = true;
+    uint32_t first_rule = 0; ///< Range in RuleTable::rules
+    uint32_t rule_count = 0;
+};
+
+std::string to_lower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return value;
+}
+
+RuleField parse_field(const std::string& field) {
+    static const std::pair<const char*, RuleField> FIELDS[] = {
+        {"sensors", RuleField::SENSORS},
+        {"fans", RuleField::FANS},
+        {"heaters", RuleField::HEATERS},
+        {"leds", RuleField::LEDS},
+        {"printer_objects", RuleField::PRINTER_OBJECTS},
+        {"steppers", RuleField::STEPPERS},
+        {"hostname", RuleField::HOSTNAME},
+        {"kinematics", RuleField::KINEMATICS},
+        {"mcu", RuleField::MCU},
+    };
+    for (const auto& [name, value] : FIELDS) {
+        if (field == name) {
+            return value;
+        }
+    }
+    return RuleField::NONE;
+}
+
+std::optional<float> optional_float(const json& heuristic, const char* key) {
+    if (!heuristic.contains(key)) {
+        return std::nullopt;
+    }
+    return heuristic[key].get<float>();
+}
+
+// Lazy-loaded, compiled printer database
+struct RuleTable {
+    std::vector<CompiledPrinter> printers;
+    std::vector<CompiledRule> rules;
+    std::vector<uint32_t> rule_patterns; ///< Pattern IDs referenced by rules
+    PatternMatcher matcher;
+    std::unordered_map<std::string, size_t> printer_by_name; ///< Lower-cased name -> index
+    std::unordered_map<std::string, size_t> printer_by_id;   ///< Lower-cased ID -> index
     bool loaded = false;
 
     bool load() {
@@ -57,131 +150,149 @@ struct PrinterDatabase {
                 return false;
             }
 
-            data = json::parse(file);
+            json data = json::parse(file);
+            if (!data.contains("printers") || !data["printers"].is_array()) {
+                NOTIFY_ERROR("Printer database is corrupt");
+                LOG_ERROR_INTERNAL(
+                    "[PrinterDetector] Invalid database format: missing 'printers' array");
+                return false;
+            }
+
+            compile(data["printers"]);
             loaded = true;
-            spdlog::info("[PrinterDetector] Loaded printer database version {}",
-                         data.value("version", "unknown"));
+            spdlog::info("[PrinterDetector] Loaded printer database version {} ({} printers, {} "
+                         "rules, {} patterns)",
+                         data.value("version", "unknown"), printers.size(), rules.size(),
+                         matcher.size());
             return true;
         } catch (const std::exception& e) {
             NOTIFY_ERROR("Printer database format error");
             LOG_ERROR_INTERNAL("[PrinterDetector] Failed to parse printer database: {}", e.what());
+            clear();
             return false;
         }
     }
-};
-
-PrinterDatabase g_database;
-} // namespace
-
-// ============================================================================
-// Helper Functions
-// ============================================================================
-
-namespace {
-// Case-insensitive substring search
-bool has_pattern(const std::vector<std::string>& objects, const std::string& pattern) {
-    std::string pattern_lower = pattern;
-    std::transform(pattern_lower.begin(), pattern_lower.end(), pattern_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    return std::any_of(objects.begin(), objects.end(), [&pattern_lower](const std::string& obj) {
-        std::string obj_lower = obj;
-        std::transform(obj_lower.begin(), obj_lower.end(), obj_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-        return obj_lower.find(pattern_lower) != std::string::npos;
-    });
-}
 
-// Check if all patterns in array are present
-bool has_all_patterns(const std::vector<std::string>& objects, const json& patterns) {
-    for (const auto& pattern : patterns) {
-        if (!has_pattern(objects, pattern.get<std::string>())) {
-            return false;
-        }
+    void clear() {
+        printers.clear();
+        rules.clear();
+        rule_patterns.clear();
+        matcher = PatternMatcher{};
+        printer_by_name.clear();
+        printer_by_id.clear();
     }
-    return true;
-}
-
-// Get field data from hardware based on field name
-// Returns a vector by value for string fields, reference for vector fields
-std::vector<std::string> get_field_data(const PrinterHardwareData& hardware,
-                                        const std::string& field) {
-    if (field == "sensors")
-        return hardware.sensors;
-    if (field == "fans")
-        return hardware.fans;
-    if (field == "heaters")
-        return hardware.heaters;
-    if (field == "leds")
-        return hardware.leds;
-    if (field == "printer_objects")
-        return hardware.printer_objects;
-    if (field == "steppers")
-        return hardware.steppers;
-    if (field == "hostname")
-        return {hardware.hostname};
-    if (field == "kinematics")
-        return {hardware.kinematics};
-    if (field == "mcu")
-        return {hardware.mcu};
-
-    // Unknown field - return empty vector
-    return {};
-}
 
-// Count Z steppers in the steppers list
-int count_z_steppers(const std::vector<std::string>& steppers) {
-    int count = 0;
-    for (const auto& stepper : steppers) {
-        std::string stepper_lower = stepper;
-        std::transform(stepper_lower.begin(), stepper_lower.end(), stepper_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
+    void compile(const json& database) {
+        clear();
+
+        for (const auto& printer : database) {
+            CompiledPrinter compiled;
+            compiled.id = printer.value("id", "");
+            compiled.name = printer.value("name", "");
+            compiled.image = printer.value("image", "");
+            compiled.show_in_roller = printer.value("show_in_roller", true);
+            compiled.first_rule = static_cast<uint32_t>(rules.size());
+
+            if (printer.contains("heuristics") && printer["heuristics"].is_array()) {
+                for (const auto& heuristic : printer["heuristics"]) {
+                    CompiledRule rule;
+                    if (compile_rule(heuristic, rule)) {
+                        rules.push_back(std::move(rule));
+                    }
+                }
+            }
+            compiled.rule_count = static_cast<uint32_t>(rules.size()) - compiled.first_rule;
 
-        // Match stepper_z, stepper_z1, stepper_z2, stepper_z3 patterns
-        if (stepper_lower.find("stepper_z") == 0) {
-            count++;
+            // First entry wins, as with a front-to-back search
+            printer_by_name.emplace(to_lower(compiled.name), printers.size());
+            printer_by_id.emplace(to_lower(compiled.id), printers.size());
+            printers.push_back(std::move(compiled));
         }
-    }
-    return count;
-}
-
-// Check if build volume is within specified range
-bool check_build_volume_range(const BuildVolume& volume, const json& heuristic) {
-    // Get the dimensions we need to check
-    float x_size = volume.x_max - volume.x_min;
-    float y_size = volume.y_max - volume.y_min;
 
-    // If no volume data, can't match
-    if (x_size <= 0 || y_size <= 0) {
-        return false;
+        matcher.build();
     }
 
-    // Check X range
-    if (heuristic.contains("min_x")) {
-        float min_x = heuristic["min_x"].get<float>();
-        if (x_size < min_x)
-            return false;
-    }
-    if (heuristic.contains("max_x")) {
-        float max_x = heuristic["max_x"].get<float>();
-        if (x_size > max_x)
-            return false;
+    void add_pattern(CompiledRule& rule, const std::string& pattern) {
+        rule_patterns.push_back(static_cast<uint32_t>(matcher.add(pattern)));
+        rule.pattern_count++;
     }
 
-    // Check Y range
-    if (heuristic.contains("min_y")) {
-        float min_y = heuristic["min_y"].get<float>();
-        if (y_size < min_y)
+    // Returns false for rules that can never win (unknown type, no confidence)
+    bool compile_rule(const json& heuristic, CompiledRule& rule) {
+        rule.type = heuristic.value("type", "");
+        rule.confidence = heuristic.value("confidence", 0);
+        rule.reason = heuristic.value("reason", "");
+        rule.first_pattern = static_cast<uint32_t>(rule_patterns.size());
+        std::string pattern = heuristic.value("pattern", "");
+        const std::string& type = rule.type;
+
+        if (type == "sensor_match" || type == "fan_match" || type == "hostname_match" ||
+            type == "led_match") {
+            rule.field = parse_field(heuristic.value("field", ""));
+            add_pattern(rule, pattern);
+        } else if (type == "fan_combo") {
+            // Multiple patterns must all be present
+            rule.kind = RuleKind::ALL_PATTERNS;
+            rule.field = parse_field(heuristic.value("field", ""));
+            if (!heuristic.contains("patterns") || !heuristic["patterns"].is_array()) {
+                return false;
+            }
+            for (const auto& combo_pattern : heuristic["patterns"]) {
+                add_pattern(rule, combo_pattern.get<std::string>());
+            }
+        } else if (type == "kinematics_match") {
+            rule.field = RuleField::KINEMATICS;
+            rule.needs_value = true;
+            add_pattern(rule, pattern);
+        } else if (type == "object_exists") {
+            rule.field = RuleField::PRINTER_OBJECTS;
+            add_pattern(rule, pattern);
+        } else if (type == "stepper_count") {
+            if (pattern == "stepper_a") {
+                // Delta printer detection via stepper naming
+                rule.field = RuleField::STEPPERS;
+                add_pattern(rule, pattern);
+            } else {
+                // Expected Z stepper count from pattern (z_count_1 .. z_count_4)
+                rule.kind = RuleKind::Z_STEPPERS;
+                static const char* const Z_COUNTS[] = {"z_count_1", "z_count_2", "z_count_3",
+                                                       "z_count_4"};
+                for (int i = 0; i < 4; i++) {
+                    if (pattern == Z_COUNTS[i]) {
+                        rule.z_steppers = i + 1;
+                    }
+                }
+                if (rule.z_steppers == 0) {
+                    return false;
+                }
+            }
+        } else if (type == "build_volume_range") {
+            rule.kind = RuleKind::BUILD_VOLUME;
+            rule.min_x = optional_float(heuristic, "min_x");
+            rule.max_x = optional_float(heuristic, "max_x");
+            rule.min_y = optional_float(heuristic, "min_y");
+            rule.max_y = optional_float(heuristic, "max_y");
+        } else if (type == "mcu_match") {
+            rule.field = RuleField::MCU;
+            rule.needs_value = true;
+            add_pattern(rule, pattern);
+        } else if (type == "macro_match") {
+            rule.field = RuleField::MACROS;
+            add_pattern(rule, pattern);
+        } else {
+            spdlog::warn("[PrinterDetector] Unknown heuristic type: {}", type);
             return false;
-    }
-    if (heuristic.contains("max_y")) {
-        float max_y = heuristic["max_y"].get<float>();
-        if (y_size > max_y)
+        }
+
+        if (rule.confidence <= 0) {
+            rule_patterns.resize(rule.first_pattern);
             return false;
+        }
+        return true;
     }
+};
 
-    return true;
-}
+RuleTable g_rules;
 } // namespace
 
 // ============================================================================
@@ -189,166 +300,100 @@ bool check_build_volume_range(const BuildVolume& volume, const json& heuristic)
 // ============================================================================
 
 namespace {
-// Execute a single heuristic and return confidence (0 = no match)
-int execute_heuristic(const json& heuristic, const PrinterHardwareData& hardware) {
-    std::string type = heuristic.value("type", "");
-    std::string field = heuristic.value("field", "");
-    int confidence = heuristic.value("confidence", 0);
+// Hardware facts gathered once per detect() for all rules
+struct HardwareFacts {
+    std::vector<bool> found[FIELD_COUNT]; ///< Per field: pattern IDs occurring in its names
+    bool has_value[FIELD_COUNT] = {};     ///< Field has at least one non-empty name
+    int z_steppers = 0;
+    float x_size = 0.0f;
+    float y_size = 0.0f;
+};
 
-    auto field_data = get_field_data(hardware, field);
+void scan_field(const RuleTable& table, HardwareFacts& facts, RuleField field,
+                const std::vector<std::string>& names) {
+    auto index = static_cast<size_t>(field);
+    facts.found[index].assign(table.matcher.size(), false);
+    for (const auto& name : names) {
+        table.matcher.find_all(name, facts.found[index]);
+        facts.has_value[index] = facts.has_value[index] || !name.empty();
+    }
+}
 
-    if (type == "sensor_match" || type == "fan_match" || type == "hostname_match" ||
-        type == "led_match") {
-        // Simple pattern matching in specified field
-        std::string pattern = heuristic.value("pattern", "");
-        if (has_pattern(field_data, pattern)) {
-            spdlog::debug("[PrinterDetector] Matched {} pattern '{}' (confidence: {})", type,
-                          pattern, confidence);
-            return confidence;
-        }
-    } else if (type == "fan_combo") {
-        // Multiple patterns must all be present
-        if (heuristic.contains("patterns") && heuristic["patterns"].is_array()) {
-            if (has_all_patterns(field_data, heuristic["patterns"])) {
-                spdlog::debug("[PrinterDetector] Matched fan combo (confidence: {})", confidence);
-                return confidence;
-            }
-        }
-    } else if (type == "kinematics_match") {
-        // Match against printer kinematics type (corexy, cartesian, delta, etc.)
-        std::string pattern = heuristic.value("pattern", "");
-        if (!hardware.kinematics.empty()) {
-            std::string kinematics_lower = hardware.kinematics;
-            std::transform(kinematics_lower.begin(), kinematics_lower.end(),
-                           kinematics_lower.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-            std::string pattern_lower = pattern;
-            std::transform(pattern_lower.begin(), pattern_lower.end(), pattern_lower.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-
-            if (kinematics_lower.find(pattern_lower) != std::string::npos) {
-                spdlog::debug("[PrinterDetector] Matched kinematics '{}' (confidence: {})", pattern,
-                              confidence);
-                return confidence;
-            }
-        }
-    } else if (type == "object_exists") {
-        // Check if a Klipper object exists in the printer_objects list
-        std::string pattern = heuristic.value("pattern", "");
-        if (has_pattern(hardware.printer_objects, pattern)) {
-            spdlog::debug("[PrinterDetector] Found object '{}' (confidence: {})", pattern,
-                          confidence);
-            return confidence;
-        }
-    } else if (type == "stepper_count") {
-        // Count Z steppers and match against pattern (z_count_1, z_count_2, z_count_3, z_count_4)
-        std::string pattern = heuristic.value("pattern", "");
-        int z_count = count_z_steppers(hardware.steppers);
-
-        // Also check for delta steppers (stepper_a, stepper_b, stepper_c)
-        if (pattern == "stepper_a") {
-            // Delta printer detection via stepper naming
-            if (has_pattern(hardware.steppers, "stepper_a")) {
-                spdlog::debug("[PrinterDetector] Found delta stepper pattern (confidence: {})",
-                              confidence);
-                return confidence;
-            }
-        } else {
-            // Parse expected count from pattern (z_count_N)
-            int expected_count = 0;
-            if (pattern == "z_count_1")
-                expected_count = 1;
-            else if (pattern == "z_count_2")
-                expected_count = 2;
-            else if (pattern == "z_count_3")
-                expected_count = 3;
-            else if (pattern == "z_count_4")
-                expected_count = 4;
-
-            if (expected_count > 0 && z_count == expected_count) {
-                spdlog::debug("[PrinterDetector] Matched {} Z steppers (confidence: {})", z_count,
-                              confidence);
-                return confidence;
-            }
-        }
-    } else if (type == "build_volume_range") {
-        // Check if build volume is within specified range
-        if (check_build_volume_range(hardware.build_volume, heuristic)) {
-            spdlog::debug("[PrinterDetector] Matched build volume range (confidence: {})",
-                          confidence);
-            return confidence;
-        }
-    } else if (type == "mcu_match") {
-        // Match against MCU chip type
-        std::string pattern = heuristic.value("pattern", "");
-        if (!hardware.mcu.empty()) {
-            std::string mcu_lower = hardware.mcu;
-            std::transform(mcu_lower.begin(), mcu_lower.end(), mcu_lower.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-            std::string pattern_lower = pattern;
-            std::transform(pattern_lower.begin(), pattern_lower.end(), pattern_lower.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-
-            if (mcu_lower.find(pattern_lower) != std::string::npos) {
-                spdlog::debug("[PrinterDetector] Matched MCU '{}' (confidence: {})", pattern,
-                              confidence);
-                return confidence;
-            }
+void scan_field(const RuleTable& table, HardwareFacts& facts, RuleField field,
+                const std::string& value) {
+    auto index = static_cast<size_t>(field);
+    facts.found[index].assign(table.matcher.size(), false);
+    table.matcher.find_all(value, facts.found[index]);
+    facts.has_value[index] = !value.empty();
+}
+
+HardwareFacts scan_fields(const RuleTable& table, const PrinterHardwareData& hardware) {
+    HardwareFacts facts;
+    scan_field(table, facts, RuleField::SENSORS, hardware.sensors);
+    scan_field(table, facts, RuleField::FANS, hardware.fans);
+    scan_field(table, facts, RuleField::HEATERS, hardware.heaters);
+    scan_field(table, facts, RuleField::LEDS, hardware.leds);
+    scan_field(table, facts, RuleField::PRINTER_OBJECTS, hardware.printer_objects);
+    scan_field(table, facts, RuleField::STEPPERS, hardware.steppers);
+    scan_field(table, facts, RuleField::HOSTNAME, hardware.hostname);
+    scan_field(table, facts, RuleField::KINEMATICS, hardware.kinematics);
+    scan_field(table, facts, RuleField::MCU, hardware.mcu);
+
+    // G-code macros appear as "gcode_macro <NAME>" in the objects list
+    auto macros_index = static_cast<size_t>(RuleField::MACROS);
+    facts.found[macros_index].assign(table.matcher.size(), false);
+    for (const auto& obj : hardware.printer_objects) {
+        if (obj.rfind("gcode_macro ", 0) == 0) {
+            table.matcher.find_all(std::string_view(obj).substr(12), facts.found[macros_index]);
         }
-    } else if (type == "macro_match") {
-        // Match against G-code macro names in printer_objects
-        // G-code macros appear as "gcode_macro <NAME>" in the objects list
-        std::string pattern = heuristic.value("pattern", "");
-        std::string pattern_lower = pattern;
-        std::transform(pattern_lower.begin(), pattern_lower.end(), pattern_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
+    }
 
-        for (const auto& obj : hardware.printer_objects) {
-            // Check if object is a G-code macro
-            if (obj.rfind("gcode_macro ", 0) == 0) {
-                // Extract macro name (everything after "gcode_macro ")
-                std::string macro_name = obj.substr(12);
-                std::string macro_lower = macro_name;
-                std::transform(macro_lower.begin(), macro_lower.end(), macro_lower.begin(),
-                               [](unsigned char c) { return std::tolower(c); });
-
-                if (macro_lower.find(pattern_lower) != std::string::npos) {
-                    spdlog::debug("[PrinterDetector] Matched macro '{}' (confidence: {})",
-                                  macro_name, confidence);
-                    return confidence;
-                }
-            }
+    // Match stepper_z, stepper_z1, stepper_z2, stepper_z3 patterns
+    for (const auto& stepper : hardware.steppers) {
+        if (to_lower(stepper.substr(0, 9)) == "stepper_z") {
+            facts.z_steppers++;
         }
-    } else {
-        spdlog::warn("[PrinterDetector] Unknown heuristic type: {}", type);
     }
 
-    return 0; // No match
+    facts.x_size = hardware.build_volume.x_max - hardware.build_volume.x_min;
+    facts.y_size = hardware.build_volume.y_max - hardware.build_volume.y_min;
+    return facts;
 }
 
-// Execute all heuristics for a printer and return best confidence + reason
-PrinterDetectionResult execute_printer_heuristics(const json& printer,
-                                                  const PrinterHardwareData& hardware) {
-    std::string printer_id = printer.value("id", "");
-    std::string printer_name = printer.value("name", "");
-
-    if (!printer.contains("heuristics") || !printer["heuristics"].is_array()) {
-        return {"", 0, ""};
+bool in_build_volume_range(const CompiledRule& rule, const HardwareFacts& facts) {
+    // If no volume data, can't match
+    if (facts.x_size <= 0 || facts.y_size <= 0) {
+        return false;
     }
+    return !(rule.min_x && facts.x_size < *rule.min_x) &&
+           !(rule.max_x && facts.x_size > *rule.max_x) &&
+           !(rule.min_y && facts.y_size < *rule.min_y) &&
+           !(rule.max_y && facts.y_size > *rule.max_y);
+}
 
-    PrinterDetectionResult best_result{"", 0, ""};
-
-    // Try all heuristics for this printer
-    for (const auto& heuristic : printer["heuristics"]) {
-        int confidence = execute_heuristic(heuristic, hardware);
-        if (confidence > best_result.confidence) {
-            best_result.type_name = printer_name;
-            best_result.confidence = confidence;
-            best_result.reason = heuristic.value("reason", "");
-        }
+bool rule_matches(const RuleTable& table, const CompiledRule& rule, const HardwareFacts& facts) {
+    switch (rule.kind) {
+    case RuleKind::Z_STEPPERS:
+        return facts.z_steppers == rule.z_steppers;
+    case RuleKind::BUILD_VOLUME:
+        return in_build_volume_range(rule, facts);
+    case RuleKind::PATTERN:
+    case RuleKind::ALL_PATTERNS:
+        break;
     }
 
-    return best_result;
+    auto patterns = table.rule_patterns.begin() + rule.first_pattern;
+    if (rule.field == RuleField::NONE) {
+        // No names to search: only an empty pattern list is satisfied
+        return rule.kind == RuleKind::ALL_PATTERNS && rule.pattern_count == 0;
+    }
+    auto index = static_cast<size_t>(rule.field);
+    if (rule.needs_value && !facts.has_value[index]) {
+        return false;
+    }
+    const std::vector<bool>& found = facts.found[index];
+    return std::all_of(patterns, patterns + rule.pattern_count,
+                       [&found](uint32_t pattern) { return found[pattern]; });
 }
 } // namespace
 
@@ -366,32 +411,38 @@ PrinterDetectionResult PrinterDetector::detect(const PrinterHardwareData& hardwa
                      hardware.kinematics);
 
         // Load database if not already loaded
-        if (!g_database.load()) {
+        if (!g_rules.load()) {
             LOG_ERROR_INTERNAL("[PrinterDetector] Cannot perform detection without database");
             return {"", 0, "Failed to load printer database"};
         }
 
+        HardwareFacts facts = scan_fields(g_rules, hardware);
+
         // Iterate through all printers in database and find best match
         PrinterDetectionResult best_match{"", 0, "No distinctive hardware detected"};
 
-        if (!g_database.data.contains("printers") || !g_database.data["printers"].is_array()) {
-            NOTIFY_ERROR("Printer database is corrupt");
-            LOG_ERROR_INTERNAL(
-                "[PrinterDetector] Invalid database format: missing 'printers' array");
-            return {"", 0, "Invalid printer database format"};
-        }
-
-        for (const auto& printer : g_database.data["printers"]) {
-            PrinterDetectionResult result = execute_printer_heuristics(printer, hardware);
+        for (const auto& printer : g_rules.printers) {
+            // Best heuristic for this printer (first one wins ties)
+            const CompiledRule* best_rule = nullptr;
+            for (uint32_t i = 0; i < printer.rule_count; i++) {
+                const CompiledRule& rule = g_rules.rules[printer.first_rule + i];
+                if ((!best_rule || rule.confidence > best_rule->confidence) &&
+                    rule_matches(g_rules, rule, facts)) {
+                    spdlog::debug("[PrinterDetector] Matched {} for '{}' (confidence: {})",
+                                  rule.type, printer.name, rule.confidence);
+                    best_rule = &rule;
+                }
+            }
+            if (!best_rule) {
+                continue;
+            }
 
             // Log all matches for debugging (not just best)
-            if (result.confidence > 0) {
-                spdlog::info("[PrinterDetector] Candidate: '{}' scored {}% via: {}",
-                             result.type_name, result.confidence, result.reason);
-            }
+            spdlog::info("[PrinterDetector] Candidate: '{}' scored {}% via: {}", printer.name,
+                         best_rule->confidence, best_rule->reason);
 
-            if (result.confidence > best_match.confidence) {
-                best_match = result;
+            if (best_rule->confidence > best_match.confidence) {
+                best_match = {printer.name, best_rule->confidence, best_rule->reason};
             }
         }
 
@@ -415,74 +466,45 @@ PrinterDetectionResult PrinterDetector::detect(const PrinterHardwareData& hardwa
 
 std::string PrinterDetector::get_image_for_printer(const std::string& printer_name) {
     // Load database if not already loaded
-    if (!g_database.load()) {
+    if (!g_rules.load()) {
         spdlog::warn("[PrinterDetector] Cannot lookup image without database");
         return "";
     }
 
-    if (!g_database.data.contains("printers") || !g_database.data["printers"].is_array()) {
+    // Case-insensitive search by printer name
+    auto it = g_rules.printer_by_name.find(to_lower(printer_name));
+    if (it == g_rules.printer_by_name.end()) {
+        spdlog::debug("[PrinterDetector] No image found for printer '{}'", printer_name);
         return "";
     }
 
-    // Case-insensitive search by printer name
-    std::string name_lower = printer_name;
-    std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    for (const auto& printer : g_database.data["printers"]) {
-        std::string db_name = printer.value("name", "");
-        std::string db_name_lower = db_name;
-        std::transform(db_name_lower.begin(), db_name_lower.end(), db_name_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-
-        if (db_name_lower == name_lower) {
-            std::string image = printer.value("image", "");
-            if (!image.empty()) {
-                spdlog::debug("[PrinterDetector] Found image '{}' for printer '{}'", image,
-                              printer_name);
-            }
-            return image;
-        }
+    const std::string& image = g_rules.printers[it->second].image;
+    if (!image.empty()) {
+        spdlog::debug("[PrinterDetector] Found image '{}' for printer '{}'", image, printer_name);
     }
-
-    spdlog::debug("[PrinterDetector] No image found for printer '{}'", printer_name);
-    return "";
+    return image;
 }
 
 std::string PrinterDetector::get_image_for_printer_id(const std::string& printer_id) {
     // Load database if not already loaded
-    if (!g_database.load()) {
+    if (!g_rules.load()) {
         spdlog::warn("[PrinterDetector] Cannot lookup image without database");
         return "";
     }
 
-    if (!g_database.data.contains("printers") || !g_database.data["printers"].is_array()) {
+    // Case-insensitive search by printer ID
+    auto it = g_rules.printer_by_id.find(to_lower(printer_id));
+    if (it == g_rules.printer_by_id.end()) {
+        spdlog::debug("[PrinterDetector] No image found for printer ID '{}'", printer_id);
         return "";
     }
 
-    // Case-insensitive search by printer ID
-    std::string id_lower = printer_id;
-    std::transform(id_lower.begin(), id_lower.end(), id_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    for (const auto& printer : g_database.data["printers"]) {
-        std::string db_id = printer.value("id", "");
-        std::string db_id_lower = db_id;
-        std::transform(db_id_lower.begin(), db_id_lower.end(), db_id_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-
-        if (db_id_lower == id_lower) {
-            std::string image = printer.value("image", "");
-            if (!image.empty()) {
-                spdlog::debug("[PrinterDetector] Found image '{}' for printer ID '{}'", image,
-                              printer_id);
-            }
-            return image;
-        }
+    const std::string& image = g_rules.printers[it->second].image;
+    if (!image.empty()) {
+        spdlog::debug("[PrinterDetector] Found image '{}' for printer ID '{}'", image,
+                      printer_id);
     }
-
-    spdlog::debug("[PrinterDetector] No image found for printer ID '{}'", printer_id);
-    return "";
+    return image;
 }
 
 // ============================================================================
@@ -501,7 +523,7 @@ struct RollerCache {
             return;
 
         // Load database if not already loaded
-        if (!g_database.load()) {
+        if (!g_rules.load()) {
             spdlog::warn("[PrinterDetector] Cannot build roller without database");
             // Fallback to just Custom/Other and Unknown
             names = {"Custom/Other", "Unknown"};
@@ -510,24 +532,10 @@ struct RollerCache {
             return;
         }
 
-        if (!g_database.data.contains("printers") || !g_database.data["printers"].is_array()) {
-            names = {"Custom/Other", "Unknown"};
-            options = "Custom/Other\nUnknown";
-            built = true;
-            return;
-        }
-
         // Collect all printer names that should appear in roller
-        for (const auto& printer : g_database.data["printers"]) {
-            // Check show_in_roller flag (defaults to true if missing)
-            bool show = printer.value("show_in_roller", true);
-            if (!show) {
-                continue;
-            }
-
-            std::string name = printer.value("name", "");
-            if (!name.empty()) {
-                names.push_back(name);
+        for (const auto& printer : g_rules.printers) {
+            if (printer.show_in_roller && !printer.name.empty()) {
+                names.push_back(printer.name);
             }
         }
 
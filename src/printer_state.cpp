@@ -26,7 +26,9 @@
 #include "capability_overrides.h"
 #include "printer_capabilities.h"
 #include "runtime_config.h"
+#include "temperature_history.h"
 
+#include <chrono>
 #include <cstring>
 
 // ============================================================================
@@ -297,37 +299,48 @@ void PrinterState::update_from_notification(const json& notification) {
 void PrinterState::update_from_status(const json& state) {
     std::lock_guard<std::mutex> lock(state_mutex_);
 
+    // Temperatures are recorded into the central history before subjects fire, so graph
+    // observers redraw with the new sample already in place
+    auto& history = TemperatureHistory::instance();
+    const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+
     // Update extruder temperature (stored as centidegrees for 0.1°C resolution)
     if (state.contains("extruder")) {
         const auto& extruder = state["extruder"];
 
-        if (extruder.contains("temperature")) {
-            int temp_centi = static_cast<int>(extruder["temperature"].get<double>() * 10.0);
-            lv_subject_set_int(&extruder_temp_, temp_centi);
-        }
-
         if (extruder.contains("target")) {
             int target_centi = static_cast<int>(extruder["target"].get<double>() * 10.0);
+            history.set_target("extruder", target_centi);
             lv_subject_set_int(&extruder_target_, target_centi);
         }
+
+        if (extruder.contains("temperature")) {
+            int temp_centi = static_cast<int>(extruder["temperature"].get<double>() * 10.0);
+            history.record("extruder", now_ms, temp_centi);
+            lv_subject_set_int(&extruder_temp_, temp_centi);
+        }
     }
 
     // Update bed temperature (stored as centidegrees for 0.1°C resolution)
     if (state.contains("heater_bed")) {
         const auto& bed = state["heater_bed"];
 
-        if (bed.contains("temperature")) {
-            int temp_centi = static_cast<int>(bed["temperature"].get<double>() * 10.0);
-            lv_subject_set_int(&bed_temp_, temp_centi);
-            spdlog::trace("[PrinterState] Bed temp: {}.{}°C", temp_centi / 10, temp_centi % 10);
-        }
-
         if (bed.contains("target")) {
             int target_centi = static_cast<int>(bed["target"].get<double>() * 10.0);
+            history.set_target("heater_bed", target_centi);
             lv_subject_set_int(&bed_target_, target_centi);
             spdlog::trace("[PrinterState] Bed target: {}.{}°C", target_centi / 10,
                           target_centi % 10);
         }
+
+        if (bed.contains("temperature")) {
+            int temp_centi = static_cast<int>(bed["temperature"].get<double>() * 10.0);
+            history.record("heater_bed", now_ms, temp_centi);
+            lv_subject_set_int(&bed_temp_, temp_centi);
+            spdlog::trace("[PrinterState] Bed temp: {}.{}°C", temp_centi / 10, temp_centi % 10);
+        }
     }
 
     // Update print progress
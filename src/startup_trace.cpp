@@ -0,0 +1,110 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "startup_trace.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+StartupTrace& StartupTrace::instance() {
+    static StartupTrace instance;
+    return instance;
+}
+
+StartupTrace::StartupTrace() {
+    reset();
+}
+
+void StartupTrace::reset() {
+    origin_ = Clock::now();
+    last_end_ = origin_;
+    open_phase_.clear();
+    phases_.clear();
+    milestones_.clear();
+    waiting_for_frame_ = false;
+    frame_rendering_ = false;
+    finished_ = false;
+}
+
+void StartupTrace::begin(const std::string& name) {
+    end();
+    open_phase_ = name;
+    phase_start_ = Clock::now();
+}
+
+void StartupTrace::end() {
+    if (open_phase_.empty()) {
+        return;
+    }
+
+    last_end_ = Clock::now();
+    double ms = std::chrono::duration<double, std::milli>(last_end_ - phase_start_).count();
+    phases_.push_back({open_phase_, ms});
+    spdlog::debug("[Startup] {} took {:.1f} ms", open_phase_, ms);
+    open_phase_.clear();
+}
+
+void StartupTrace::mark(const std::string& name) {
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - origin_).count();
+    milestones_.push_back({name, ms});
+    spdlog::debug("[Startup] {} at {:.1f} ms", name, ms);
+}
+
+double StartupTrace::total_ms() const {
+    return std::chrono::duration<double, std::milli>(last_end_ - origin_).count();
+}
+
+std::string StartupTrace::summary() const {
+    std::string out;
+    for (const auto& phase : phases_) {
+        if (!out.empty()) {
+            out += ", ";
+        }
+        out += fmt::format("{} {:.0f} ms", phase.name, phase.ms);
+    }
+    out += fmt::format(" (total {:.0f} ms", total_ms());
+    for (const auto& milestone : milestones_) {
+        out += fmt::format(", {} at {:.0f} ms", milestone.name, milestone.ms);
+    }
+    out += ")";
+    return out;
+}
+
+void StartupTrace::finish_on_first_frame(lv_display_t* display) {
+    begin("first_flush");
+    if (!display) {
+        end();
+        finished_ = true;
+        spdlog::info("[Startup] {}", summary());
+        return;
+    }
+
+    waiting_for_frame_ = true;
+    frame_rendering_ = false;
+    lv_display_add_event_cb(display, display_event_cb, LV_EVENT_ALL, this);
+}
+
+void StartupTrace::display_event_cb(lv_event_t* e) {
+    auto* self = static_cast<StartupTrace*>(lv_event_get_user_data(e));
+    if (!self->waiting_for_frame_) {
+        return; // Stays registered but idle: removing it during dispatch isn't worth it
+    }
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_RENDER_START:
+        self->frame_rendering_ = true;
+        break;
+
+    case LV_EVENT_REFR_READY:
+        if (self->frame_rendering_) {
+            self->waiting_for_frame_ = false;
+            self->end();
+            self->finished_ = true;
+            spdlog::info("[Startup] {}", self->summary());
+        }
+        break;
+
+    default:
+        break;
+    }
+}
@@ -0,0 +1,287 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "temperature_history.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace {
+
+int16_t clamp_centi(int value) {
+    return static_cast<int16_t>(std::clamp(value, static_cast<int>(INT16_MIN),
+                                           static_cast<int>(INT16_MAX)));
+}
+
+int16_t json_to_centi(const json& value) {
+    return value.is_number() ? clamp_centi(static_cast<int>(value.get<double>() * 10.0)) : 0;
+}
+
+int64_t slot_of(int64_t timestamp_ms) {
+    return timestamp_ms / TemperatureHistory::SAMPLE_INTERVAL_MS;
+}
+
+} // namespace
+
+// ============================================================================
+// Series ring buffer
+// ============================================================================
+
+const TemperatureSample& TemperatureHistory::Series::at(size_t i) const {
+    return samples[(head + i) % samples.size()];
+}
+
+TemperatureSample& TemperatureHistory::Series::newest() {
+    return samples[(head + samples.size() - 1) % samples.size()];
+}
+
+void TemperatureHistory::Series::push(const TemperatureSample& sample) {
+    if (samples.size() < CAPACITY) {
+        samples.push_back(sample);
+    } else {
+        samples[head] = sample;
+        head = (head + 1) % CAPACITY;
+    }
+}
+
+// ============================================================================
+// TemperatureHistory
+// ============================================================================
+
+TemperatureHistory& TemperatureHistory::instance() {
+    static TemperatureHistory instance;
+    return instance;
+}
+
+TemperatureHistory::Series* TemperatureHistory::find_series(const std::string& sensor) {
+    for (auto& series : series_) {
+        if (series.name == sensor) {
+            return &series;
+        }
+    }
+    return nullptr;
+}
+
+const TemperatureHistory::Series*
+TemperatureHistory::find_series(const std::string& sensor) const {
+    for (const auto& series : series_) {
+        if (series.name == sensor) {
+            return &series;
+        }
+    }
+    return nullptr;
+}
+
+TemperatureHistory::Series* TemperatureHistory::get_or_create_series(const std::string& sensor) {
+    if (Series* existing = find_series(sensor)) {
+        return existing;
+    }
+
+    if (series_.size() >= MAX_SENSORS) {
+        spdlog::debug("[TemperatureHistory] Sensor limit ({}) reached, ignoring '{}'",
+                      MAX_SENSORS, sensor);
+        return nullptr;
+    }
+
+    if (series_.empty()) {
+        series_.reserve(MAX_SENSORS); // Keep Series pointers stable
+    }
+    series_.emplace_back();
+    Series& series = series_.back();
+    series.name = sensor;
+    series.samples.reserve(CAPACITY);
+    spdlog::debug("[TemperatureHistory] Tracking '{}'", sensor);
+    return &series;
+}
+
+void TemperatureHistory::record(const std::string& sensor, int64_t timestamp_ms, int temp_centi) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Series* series = get_or_create_series(sensor);
+    if (!series) {
+        return;
+    }
+
+    TemperatureSample sample{timestamp_ms, clamp_centi(temp_centi), series->target_centi};
+
+    // Coalesce readings within one interval (latest wins); never go back in time
+    if (!series->samples.empty() &&
+        slot_of(timestamp_ms) <= slot_of(series->newest().timestamp_ms)) {
+        TemperatureSample& newest = series->newest();
+        sample.timestamp_ms = std::max(timestamp_ms, newest.timestamp_ms);
+        newest = sample;
+    } else {
+        series->push(sample);
+    }
+    series->revision = ++revision_counter_;
+}
+
+void TemperatureHistory::set_target(const std::string& sensor, int target_centi) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (Series* series = get_or_create_series(sensor)) {
+        series->target_centi = clamp_centi(target_centi);
+    }
+}
+
+size_t TemperatureHistory::import_temperature_store(const json& result, int64_t now_ms) {
+    if (!result.is_object()) {
+        spdlog::warn("[TemperatureHistory] Ignoring malformed temperature store");
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t imported = 0;
+
+    for (auto it = result.begin(); it != result.end(); ++it) {
+        const json& entry = it.value();
+        if (!entry.is_object() || !entry.contains("temperatures") ||
+            !entry["temperatures"].is_array()) {
+            continue; // Monitors without temperatures (e.g. fans) are skipped
+        }
+
+        Series* series = get_or_create_series(it.key());
+        if (!series) {
+            continue;
+        }
+
+        const json& temps = entry["temperatures"];
+        const json* targets = (entry.contains("targets") && entry["targets"].is_array())
+                                  ? &entry["targets"]
+                                  : nullptr;
+        const size_t total = temps.size();
+        const size_t count = std::min(total, CAPACITY);
+
+        // Keep live samples that are newer than the store's last entry
+        std::vector<TemperatureSample> live;
+        for (size_t i = 0; i < series->samples.size(); i++) {
+            if (slot_of(series->at(i).timestamp_ms) > slot_of(now_ms)) {
+                live.push_back(series->at(i));
+            }
+        }
+
+        series->samples.clear();
+        series->head = 0;
+        for (size_t i = total - count; i < total; i++) {
+            int64_t age_ms = static_cast<int64_t>(total - 1 - i) * SAMPLE_INTERVAL_MS;
+            int16_t target = (targets && i < targets->size()) ? json_to_centi((*targets)[i]) : 0;
+            series->push({now_ms - age_ms, json_to_centi(temps[i]), target});
+        }
+        for (const auto& sample : live) {
+            series->push(sample);
+        }
+        if (targets && !targets->empty() && live.empty()) {
+            series->target_centi = json_to_centi(targets->back());
+        }
+        series->revision = ++revision_counter_;
+        imported += count;
+
+        spdlog::debug("[TemperatureHistory] Imported {} samples for '{}' (kept {} live)", count,
+                      it.key(), live.size());
+    }
+
+    spdlog::info("[TemperatureHistory] Imported {} samples from temperature store", imported);
+    return imported;
+}
+
+size_t TemperatureHistory::decimate(const std::string& sensor, int64_t start_ms, int64_t end_ms,
+                                    TemperatureBucket* out, size_t bucket_count) const {
+    if (!out || bucket_count == 0) {
+        return 0;
+    }
+    std::fill(out, out + bucket_count, TemperatureBucket{0, 0, false, false});
+    if (end_ms <= start_ms) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Series* series = find_series(sensor);
+    if (!series || series->samples.empty()) {
+        return 0;
+    }
+
+    // Timestamps are monotonic: binary search for the first sample in the window
+    size_t lo = 0;
+    size_t hi = series->samples.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (series->at(mid).timestamp_ms < start_ms) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    const int64_t span = end_ms - start_ms;
+    size_t filled = 0;
+    for (size_t i = lo; i < series->samples.size(); i++) {
+        const TemperatureSample& sample = series->at(i);
+        if (sample.timestamp_ms >= end_ms) {
+            break;
+        }
+
+        size_t index = static_cast<size_t>((sample.timestamp_ms - start_ms) *
+                                           static_cast<int64_t>(bucket_count) / span);
+        TemperatureBucket& bucket = out[index];
+        if (!bucket.valid) {
+            bucket = {sample.temp_centi, sample.temp_centi, true, true};
+            filled++;
+        } else if (sample.temp_centi < bucket.min_centi) {
+            bucket.min_centi = sample.temp_centi;
+            bucket.min_first = false; // New minimum comes after the current maximum
+        } else if (sample.temp_centi > bucket.max_centi) {
+            bucket.max_centi = sample.temp_centi;
+            bucket.min_first = true;
+        }
+    }
+    return filled;
+}
+
+std::vector<TemperatureSample> TemperatureHistory::get_samples(const std::string& sensor) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<TemperatureSample> result;
+    if (const Series* series = find_series(sensor)) {
+        result.reserve(series->samples.size());
+        for (size_t i = 0; i < series->samples.size(); i++) {
+            result.push_back(series->at(i));
+        }
+    }
+    return result;
+}
+
+size_t TemperatureHistory::sample_count(const std::string& sensor) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Series* series = find_series(sensor);
+    return series ? series->samples.size() : 0;
+}
+
+bool TemperatureHistory::get_time_range(const std::string& sensor, int64_t* oldest_ms,
+                                        int64_t* newest_ms) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Series* series = find_series(sensor);
+    if (!series || series->samples.empty()) {
+        return false;
+    }
+
+    if (oldest_ms) {
+        *oldest_ms = series->at(0).timestamp_ms;
+    }
+    if (newest_ms) {
+        *newest_ms = series->at(series->samples.size() - 1).timestamp_ms;
+    }
+    return true;
+}
+
+uint64_t TemperatureHistory::revision(const std::string& sensor) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Series* series = find_series(sensor);
+    return series ? series->revision : 0;
+}
+
+void TemperatureHistory::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    series_.clear();
+    spdlog::debug("[TemperatureHistory] Cleared");
+}
@@ -8,10 +8,99 @@
 #include <algorithm>
 #include <cctype>
 #include <fstream>
+#include <numeric>
 #include <sys/stat.h>
 
+namespace {
+
+char fold(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Words are runs of letters and digits; UTF-8 bytes count as letters
+bool is_word_char(char c) {
+    auto u = static_cast<unsigned char>(c);
+    return std::isalnum(u) || u >= 0x80;
+}
+
+// Compare ignoring ASCII case: <0, 0 or >0 like strcmp
+int compare_folded(std::string_view a, std::string_view b) {
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; i++) {
+        char ca = fold(a[i]);
+        char cb = fold(b[i]);
+        if (ca != cb) {
+            return static_cast<unsigned char>(ca) < static_cast<unsigned char>(cb) ? -1 : 1;
+        }
+    }
+    return a.size() < b.size() ? -1 : (a.size() > b.size() ? 1 : 0);
+}
+
+bool contains_folded(std::string_view text, std::string_view needle) {
+    return std::search(text.begin(), text.end(), needle.begin(), needle.end(),
+                       [](char a, char b) { return fold(a) == fold(b); }) != text.end();
+}
+
+bool tip_contains(const PrintingTip& tip, std::string_view keyword) {
+    if (contains_folded(tip.title, keyword) || contains_folded(tip.content, keyword)) {
+        return true;
+    }
+    return std::any_of(tip.tags.begin(), tip.tags.end(),
+                       [keyword](const std::string& tag) { return contains_folded(tag, keyword); });
+}
+
+// Call fn(word) for each word in text
+template <typename Fn> void for_each_word(std::string_view text, Fn&& fn) {
+    size_t start = 0;
+    while (start < text.size()) {
+        while (start < text.size() && !is_word_char(text[start])) {
+            start++;
+        }
+        size_t end = start;
+        while (end < text.size() && is_word_char(text[end])) {
+            end++;
+        }
+        if (end > start) {
+            fn(text.substr(start, end - start));
+        }
+        start = end;
+    }
+}
+
+const std::vector<size_t> NO_TIPS;
+
+} // namespace
+
 TipsManager* TipsManager::instance{nullptr};
 
+void TipsManager::TermIndex::add(std::string_view term, size_t tip_index) {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), term,
+                               [](const Entry& entry, std::string_view key) {
+                                   return compare_folded(entry.first, key) < 0;
+                               });
+    if (it == entries_.end() || compare_folded(it->first, term) != 0) {
+        std::string folded(term);
+        std::transform(folded.begin(), folded.end(), folded.begin(), fold);
+        it = entries_.insert(it, Entry{std::move(folded), {}});
+    }
+
+    // Tips are indexed in order, so a repeated term in the same tip is always the last entry
+    if (it->second.empty() || it->second.back() != tip_index) {
+        it->second.push_back(tip_index);
+    }
+}
+
+const std::vector<size_t>& TipsManager::TermIndex::find(std::string_view term) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), term,
+                               [](const Entry& entry, std::string_view key) {
+                                   return compare_folded(entry.first, key) < 0;
+                               });
+    if (it == entries_.end() || compare_folded(it->first, term) != 0) {
+        return NO_TIPS;
+    }
+    return it->second;
+}
+
 TipsManager::TipsManager() {
     // Seed random generator with high-quality entropy
     std::random_device rd;
@@ -29,7 +118,7 @@ bool TipsManager::init(const std::string& tips_path) {
     std::lock_guard<std::mutex> lock(tips_mutex);
 
     // Reset viewed tips session when reinitializing
-    viewed_tip_ids_.clear();
+    reset_unviewed_locked();
 
     path = tips_path;
     struct stat buffer;
@@ -74,9 +163,16 @@ bool TipsManager::init(const std::string& tips_path) {
 
 void TipsManager::build_tips_cache() {
     tips_cache.clear();
+    category_index_.clear();
+    tag_index_.clear();
+    difficulty_index_.clear();
+    priority_index_.clear();
+    keyword_index_.clear();
+    id_index_.clear();
 
     if (!data.contains("categories") || !data["categories"].is_object()) {
         spdlog::warn("[TipsManager] No categories found in tips database");
+        reset_unviewed_locked();
         return;
     }
 
@@ -89,12 +185,33 @@ void TipsManager::build_tips_cache() {
 
         // Iterate through tips in this category
         for (const auto& tip_json : category_obj["tips"]) {
-            PrintingTip tip = json_to_tip(tip_json, category_key);
-            tips_cache.push_back(tip);
+            tips_cache.push_back(json_to_tip(tip_json, category_key));
+        }
+    }
+
+    // Index every tip once so queries never scan or copy the cache
+    for (size_t i = 0; i < tips_cache.size(); i++) {
+        const PrintingTip& tip = tips_cache[i];
+        auto add_keyword = [this, i](std::string_view word) { keyword_index_.add(word, i); };
+
+        category_index_.add(tip.category, i);
+        difficulty_index_.add(tip.difficulty, i);
+        priority_index_.add(tip.priority, i);
+        id_index_.emplace(tip.id, i);
+        for_each_word(tip.title, add_keyword);
+        for_each_word(tip.content, add_keyword);
+        for (const auto& tag : tip.tags) {
+            tag_index_.add(tag, i);
+            for_each_word(tag, add_keyword);
         }
     }
 
-    spdlog::debug("[TipsManager] Built cache with {} tips", tips_cache.size());
+    unviewed_tips_.reserve(tips_cache.size());
+    reset_unviewed_locked();
+
+    spdlog::debug("[TipsManager] Built cache with {} tips ({} tags, {} keywords)",
+                  tips_cache.size(), tag_index_.entries().size(),
+                  keyword_index_.entries().size());
 }
 
 PrintingTip TipsManager::json_to_tip(const json& tip_json, const std::string& category) {
@@ -128,6 +245,97 @@ PrintingTip TipsManager::json_to_tip(const json& tip_json, const std::string& ca
     return tip;
 }
 
+void TipsManager::reset_unviewed_locked() {
+    unviewed_tips_.resize(tips_cache.size());
+    std::iota(unviewed_tips_.begin(), unviewed_tips_.end(), size_t{0});
+}
+
+size_t TipsManager::random_index_locked(const std::vector<size_t>& indices) {
+    std::uniform_int_distribution<size_t> dist(0, indices.size() - 1);
+    return indices[dist(random_generator)];
+}
+
+size_t TipsManager::random_unique_index_locked() {
+    if (tips_cache.empty()) {
+        spdlog::warn("[TipsManager] No tips available for unique selection");
+        return NO_TIP;
+    }
+
+    // Check if all tips have been viewed
+    if (unviewed_tips_.empty()) {
+        spdlog::info("[TipsManager] All {} tips viewed - resetting session", tips_cache.size());
+        reset_unviewed_locked();
+    }
+
+    // Take a random unviewed tip out of the pool (swap with last, no reallocation)
+    std::uniform_int_distribution<size_t> dist(0, unviewed_tips_.size() - 1);
+    size_t slot = dist(random_generator);
+    size_t selected = unviewed_tips_[slot];
+    unviewed_tips_[slot] = unviewed_tips_.back();
+    unviewed_tips_.pop_back();
+
+    spdlog::debug("[TipsManager] Selected unique tip '{}' ({}/{})", tips_cache[selected].id,
+                  tips_cache.size() - unviewed_tips_.size(), tips_cache.size());
+
+    return selected;
+}
+
+void TipsManager::search_locked(std::string_view keyword, std::vector<size_t>& results) const {
+    results.clear();
+    if (keyword.empty()) {
+        return;
+    }
+
+    // A single word can only occur inside one indexed word, so only the vocabulary is scanned
+    if (std::all_of(keyword.begin(), keyword.end(), is_word_char)) {
+        for (const auto& [word, tips] : keyword_index_.entries()) {
+            if (contains_folded(word, keyword)) {
+                results.insert(results.end(), tips.begin(), tips.end());
+            }
+        }
+        std::sort(results.begin(), results.end());
+        results.erase(std::unique(results.begin(), results.end()), results.end());
+        return;
+    }
+
+    // Phrases: any match also contains the phrase's longest word, so check only those tips
+    std::string_view longest;
+    for_each_word(keyword, [&longest](std::string_view word) {
+        if (word.size() > longest.size()) {
+            longest = word;
+        }
+    });
+
+    if (longest.empty()) {
+        for (size_t i = 0; i < tips_cache.size(); i++) {
+            results.push_back(i);
+        }
+    } else {
+        for (const auto& [word, tips] : keyword_index_.entries()) {
+            if (contains_folded(word, longest)) {
+                results.insert(results.end(), tips.begin(), tips.end());
+            }
+        }
+        std::sort(results.begin(), results.end());
+        results.erase(std::unique(results.begin(), results.end()), results.end());
+    }
+
+    results.erase(std::remove_if(results.begin(), results.end(),
+                                 [this, keyword](size_t i) {
+                                     return !tip_contains(tips_cache[i], keyword);
+                                 }),
+                  results.end());
+}
+
+std::vector<PrintingTip> TipsManager::copy_tips_locked(const std::vector<size_t>& indices) const {
+    std::vector<PrintingTip> results;
+    results.reserve(indices.size());
+    for (size_t i : indices) {
+        results.push_back(tips_cache[i]);
+    }
+    return results;
+}
+
 PrintingTip TipsManager::get_random_tip() {
     std::lock_guard<std::mutex> lock(tips_mutex);
 
@@ -141,219 +349,114 @@ PrintingTip TipsManager::get_random_tip() {
 }
 
 PrintingTip TipsManager::get_random_tip_by_category(const std::string& category) {
-    auto category_tips = get_tips_by_category(category);
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    const auto& category_tips = category_index_.find(category);
 
     if (category_tips.empty()) {
         spdlog::warn("[TipsManager] No tips found in category '{}'", category);
         return PrintingTip{};
     }
 
-    std::uniform_int_distribution<size_t> dist(0, category_tips.size() - 1);
-    return category_tips[dist(random_generator)];
+    return tips_cache[random_index_locked(category_tips)];
 }
 
 PrintingTip TipsManager::get_random_tip_by_difficulty(const std::string& difficulty) {
-    auto difficulty_tips = get_tips_by_difficulty(difficulty);
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    const auto& difficulty_tips = difficulty_index_.find(difficulty);
 
     if (difficulty_tips.empty()) {
         spdlog::warn("[TipsManager] No tips found with difficulty '{}'", difficulty);
         return PrintingTip{};
     }
 
-    std::uniform_int_distribution<size_t> dist(0, difficulty_tips.size() - 1);
-    return difficulty_tips[dist(random_generator)];
+    return tips_cache[random_index_locked(difficulty_tips)];
 }
 
 PrintingTip TipsManager::get_random_unique_tip() {
     std::lock_guard<std::mutex> lock(tips_mutex);
+    size_t index = random_unique_index_locked();
+    return index == NO_TIP ? PrintingTip{} : tips_cache[index];
+}
 
-    if (tips_cache.empty()) {
-        spdlog::warn("[TipsManager] No tips available for unique selection");
-        return PrintingTip{};
-    }
-
-    // Check if all tips have been viewed
-    if (viewed_tip_ids_.size() >= tips_cache.size()) {
-        spdlog::info("[TipsManager] All {} tips viewed - resetting session", tips_cache.size());
-        viewed_tip_ids_.clear();
-    }
-
-    // Build list of unviewed tips
-    std::vector<PrintingTip> unviewed_tips;
-    for (const auto& tip : tips_cache) {
-        // Check if this tip ID is in the viewed list
-        if (std::find(viewed_tip_ids_.begin(), viewed_tip_ids_.end(), tip.id) ==
-            viewed_tip_ids_.end()) {
-            unviewed_tips.push_back(tip);
-        }
-    }
-
-    if (unviewed_tips.empty()) {
-        spdlog::error("[TipsManager] Logic error: no unviewed tips found but viewed count < total");
-        return PrintingTip{};
-    }
-
-    // Select random unviewed tip
-    std::uniform_int_distribution<size_t> dist(0, unviewed_tips.size() - 1);
-    PrintingTip selected = unviewed_tips[dist(random_generator)];
-
-    // Mark as viewed
-    viewed_tip_ids_.push_back(selected.id);
-
-    spdlog::debug("[TipsManager] Selected unique tip '{}' ({}/{})", selected.id,
-                  viewed_tip_ids_.size(), tips_cache.size());
+size_t TipsManager::get_random_unique_tip_index() {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return random_unique_index_locked();
+}
 
-    return selected;
+const PrintingTip* TipsManager::get_tip(size_t index) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return index < tips_cache.size() ? &tips_cache[index] : nullptr;
 }
 
 void TipsManager::reset_viewed_tips() {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    spdlog::info("[TipsManager] Manually resetting viewed tips ({} tips)", viewed_tip_ids_.size());
-    viewed_tip_ids_.clear();
+    spdlog::info("[TipsManager] Manually resetting viewed tips ({} tips)",
+                 tips_cache.size() - unviewed_tips_.size());
+    reset_unviewed_locked();
 }
 
 std::vector<PrintingTip> TipsManager::search_by_keyword(const std::string& keyword) {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    std::vector<PrintingTip> results;
-
-    if (keyword.empty()) {
-        return results;
-    }
-
-    // Convert keyword to lowercase for case-insensitive search
-    std::string keyword_lower = keyword;
-    std::transform(keyword_lower.begin(), keyword_lower.end(), keyword_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
+    std::vector<size_t> matches;
+    search_locked(keyword, matches);
 
-    for (const auto& tip : tips_cache) {
-        // Search in title
-        std::string title_lower = tip.title;
-        std::transform(title_lower.begin(), title_lower.end(), title_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-
-        // Search in content
-        std::string content_lower = tip.content;
-        std::transform(content_lower.begin(), content_lower.end(), content_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-
-        // Check title, content, and tags
-        bool found = false;
-
-        if (title_lower.find(keyword_lower) != std::string::npos ||
-            content_lower.find(keyword_lower) != std::string::npos) {
-            found = true;
-        } else {
-            // Search in tags
-            for (const auto& tag : tip.tags) {
-                std::string tag_lower = tag;
-                std::transform(tag_lower.begin(), tag_lower.end(), tag_lower.begin(),
-                               [](unsigned char c) { return std::tolower(c); });
-                if (tag_lower.find(keyword_lower) != std::string::npos) {
-                    found = true;
-                    break;
-                }
-            }
-        }
-
-        if (found) {
-            results.push_back(tip);
-        }
-    }
+    spdlog::debug("[TipsManager] Keyword search '{}' found {} tips", keyword, matches.size());
+    return copy_tips_locked(matches);
+}
 
-    spdlog::debug("[TipsManager] Keyword search '{}' found {} tips", keyword, results.size());
-    return results;
+size_t TipsManager::search_tip_indices(const std::string& keyword, std::vector<size_t>& results) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    search_locked(keyword, results);
+    return results.size();
 }
 
 std::vector<PrintingTip> TipsManager::get_tips_by_category(const std::string& category) {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    std::vector<PrintingTip> results;
-
-    for (const auto& tip : tips_cache) {
-        if (tip.category == category) {
-            results.push_back(tip);
-        }
-    }
-
-    return results;
+    return copy_tips_locked(category_index_.find(category));
 }
 
 std::vector<PrintingTip> TipsManager::get_tips_by_tag(const std::string& tag) {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    std::vector<PrintingTip> results;
-
-    // Convert tag to lowercase for case-insensitive comparison
-    std::string tag_lower = tag;
-    std::transform(tag_lower.begin(), tag_lower.end(), tag_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    for (const auto& tip : tips_cache) {
-        for (const auto& tip_tag : tip.tags) {
-            std::string tip_tag_lower = tip_tag;
-            std::transform(tip_tag_lower.begin(), tip_tag_lower.end(), tip_tag_lower.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-
-            if (tip_tag_lower == tag_lower) {
-                results.push_back(tip);
-                break;
-            }
-        }
-    }
-
-    return results;
+    return copy_tips_locked(tag_index_.find(tag));
 }
 
 std::vector<PrintingTip> TipsManager::get_tips_by_difficulty(const std::string& difficulty) {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    std::vector<PrintingTip> results;
-
-    // Convert to lowercase for case-insensitive comparison
-    std::string difficulty_lower = difficulty;
-    std::transform(difficulty_lower.begin(), difficulty_lower.end(), difficulty_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    for (const auto& tip : tips_cache) {
-        std::string tip_difficulty_lower = tip.difficulty;
-        std::transform(tip_difficulty_lower.begin(), tip_difficulty_lower.end(),
-                       tip_difficulty_lower.begin(),
-                       [](unsigned char c) { return std::tolower(c); });
-
-        if (tip_difficulty_lower == difficulty_lower) {
-            results.push_back(tip);
-        }
-    }
-
-    return results;
+    return copy_tips_locked(difficulty_index_.find(difficulty));
 }
 
 std::vector<PrintingTip> TipsManager::get_tips_by_priority(const std::string& priority) {
     std::lock_guard<std::mutex> lock(tips_mutex);
-    std::vector<PrintingTip> results;
+    return copy_tips_locked(priority_index_.find(priority));
+}
 
-    // Convert to lowercase for case-insensitive comparison
-    std::string priority_lower = priority;
-    std::transform(priority_lower.begin(), priority_lower.end(), priority_lower.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
+const std::vector<size_t>& TipsManager::get_tip_indices_by_category(const std::string& category) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return category_index_.find(category);
+}
 
-    for (const auto& tip : tips_cache) {
-        std::string tip_priority_lower = tip.priority;
-        std::transform(tip_priority_lower.begin(), tip_priority_lower.end(),
-                       tip_priority_lower.begin(), [](unsigned char c) { return std::tolower(c); });
+const std::vector<size_t>& TipsManager::get_tip_indices_by_tag(const std::string& tag) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return tag_index_.find(tag);
+}
 
-        if (tip_priority_lower == priority_lower) {
-            results.push_back(tip);
-        }
-    }
+const std::vector<size_t>& TipsManager::get_tip_indices_by_difficulty(
+    const std::string& difficulty) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return difficulty_index_.find(difficulty);
+}
 
-    return results;
+const std::vector<size_t>& TipsManager::get_tip_indices_by_priority(const std::string& priority) {
+    std::lock_guard<std::mutex> lock(tips_mutex);
+    return priority_index_.find(priority);
 }
 
 PrintingTip TipsManager::get_tip_by_id(const std::string& id) {
     std::lock_guard<std::mutex> lock(tips_mutex);
 
-    for (const auto& tip : tips_cache) {
-        if (tip.id == id) {
-            return tip;
-        }
+    auto it = id_index_.find(id);
+    if (it != id_index_.end()) {
+        return tips_cache[it->second];
     }
 
     spdlog::warn("[TipsManager] Tip ID '{}' not found", id);
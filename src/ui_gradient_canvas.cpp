@@ -3,6 +3,7 @@
 
 #include "ui_gradient_canvas.h"
 
+#include "image_cache.h"
 #include "ui_error_reporting.h"
 
 #include "lvgl/lvgl.h"
@@ -139,6 +140,7 @@ static void gradient_delete_cb(lv_event_t* e) {
     GradientData* data = static_cast<GradientData*>(lv_obj_get_user_data(obj));
     if (data) {
         if (data->draw_buf) {
+            ImageCache::instance().invalidate(data->draw_buf);
             lv_draw_buf_destroy(data->draw_buf);
             data->draw_buf = nullptr;
         }
@@ -33,6 +33,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdlib> // for atoi
 #include <vector>
 
@@ -43,6 +44,9 @@ static ui_panel_id_t active_panel = UI_PANEL_HOME;
 // Panel widget tracking for show/hide
 static lv_obj_t* panel_widgets[UI_PANEL_COUNT] = {nullptr};
 
+// Creates main panels that were registered as NULL on first activation
+static ui_nav_panel_factory_t panel_factory = nullptr;
+
 // App layout widget reference (contains navbar + panels, must never be hidden)
 static lv_obj_t* app_layout_widget = nullptr;
 
@@ -61,6 +65,21 @@ static lv_obj_t* overlay_backdrop = nullptr;
 static constexpr uint32_t OVERLAY_ANIM_DURATION_MS = 200; // Fast but visible
 static constexpr int32_t OVERLAY_SLIDE_OFFSET = 400;      // Pixels to slide from off-screen
 
+// Create a lazily registered panel the first time it is needed
+static void ensure_panel_created(int panel_id) {
+    if (panel_widgets[panel_id] || !panel_factory) {
+        return;
+    }
+
+    lv_obj_t* panel = panel_factory(static_cast<ui_panel_id_t>(panel_id));
+    if (!panel) {
+        spdlog::error("Failed to create panel {} on demand", panel_id);
+        return;
+    }
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_HIDDEN);
+    panel_widgets[panel_id] = panel;
+}
+
 // Observer callback - handles panel show/hide when active panel changes
 // Note: Icon colors are now handled reactively via XML bindings to active_panel subject
 static void active_panel_observer_cb(lv_observer_t* /*observer*/, lv_subject_t* subject) {
@@ -125,6 +144,8 @@ LVGL_SAFE_EVENT_CB_WITH_EVENT(nav_button_clicked_cb, event, {
             }
         }
 
+        ensure_panel_created(panel_id);
+
         // Hide all main panels
         for (int i = 0; i < UI_PANEL_COUNT; i++) {
             if (panel_widgets[i]) {
@@ -259,6 +280,8 @@ void ui_nav_set_active(ui_panel_id_t panel_id) {
         return;
     }
 
+    ensure_panel_created(panel_id);
+
     // Update panel stack to reflect new active panel (important for go_back)
     // Only update if we have panel widgets registered
     if (panel_widgets[panel_id]) {
@@ -311,6 +334,14 @@ void ui_nav_set_panels(lv_obj_t** panels) {
     spdlog::debug("Panel widgets registered for show/hide management");
 }
 
+void ui_nav_set_panel_factory(ui_nav_panel_factory_t factory) {
+    panel_factory = factory;
+}
+
+bool ui_nav_is_in_stack(lv_obj_t* panel) {
+    return panel && std::find(panel_stack.begin(), panel_stack.end(), panel) != panel_stack.end();
+}
+
 // Animation callback: called when slide-out completes to hide the panel
 static void overlay_slide_out_complete_cb(lv_anim_t* anim) {
     lv_obj_t* panel = static_cast<lv_obj_t*>(anim->var);
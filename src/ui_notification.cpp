@@ -29,6 +29,7 @@
 #include "ui_toast.h"
 
 #include "app_globals.h"
+#include "main_loop_waker.h"
 
 #include <spdlog/spdlog.h>
 
@@ -76,7 +77,7 @@ static void async_message_callback(void* user_data) {
 
         // Add to history (title is always null for these)
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = data->severity;
         entry.was_modal = false;
         entry.was_read = false;
@@ -142,7 +143,7 @@ static void async_error_callback(void* user_data) {
 
         // Add to history
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = ToastSeverity::ERROR;
         entry.was_modal = data->modal;
         entry.was_read = false;
@@ -193,7 +194,7 @@ void ui_notification_info(const char* message) {
         ui_toast_show(ToastSeverity::INFO, message, 4000);
 
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = ToastSeverity::INFO;
         entry.was_modal = false;
         entry.was_read = false;
@@ -222,6 +223,7 @@ void ui_notification_info(const char* message) {
         data->duration_ms = 4000;
 
         lv_async_call(async_message_callback, data);
+        MainLoopWaker::instance().wake();
     }
 }
 
@@ -236,7 +238,7 @@ void ui_notification_success(const char* message) {
         ui_toast_show(ToastSeverity::SUCCESS, message, 4000);
 
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = ToastSeverity::SUCCESS;
         entry.was_modal = false;
         entry.was_read = false;
@@ -265,6 +267,7 @@ void ui_notification_success(const char* message) {
         data->duration_ms = 4000;
 
         lv_async_call(async_message_callback, data);
+        MainLoopWaker::instance().wake();
     }
 }
 
@@ -279,7 +282,7 @@ void ui_notification_warning(const char* message) {
         ui_toast_show(ToastSeverity::WARNING, message, 5000);
 
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = ToastSeverity::WARNING;
         entry.was_modal = false;
         entry.was_read = false;
@@ -308,6 +311,7 @@ void ui_notification_warning(const char* message) {
         data->duration_ms = 5000;
 
         lv_async_call(async_message_callback, data);
+        MainLoopWaker::instance().wake();
     }
 }
 
@@ -363,7 +367,7 @@ void ui_notification_error(const char* title, const char* message, bool modal) {
 
         // Add to history
         NotificationHistoryEntry entry = {};
-        entry.timestamp_ms = lv_tick_get();
+        entry.timestamp_ms = NotificationHistory::now_ms();
         entry.severity = ToastSeverity::ERROR;
         entry.was_modal = modal;
         entry.was_read = false;
@@ -412,6 +416,7 @@ void ui_notification_error(const char* title, const char* message, bool modal) {
         data->modal = modal;
 
         lv_async_call(async_error_callback, data);
+        MainLoopWaker::instance().wake();
     }
 }
 
@@ -5,22 +5,89 @@
 
 #include "ui_error_reporting.h"
 
+#include "debounced_file_writer.h"
+
 #include <hv/json.hpp>
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 
 using json = nlohmann::json;
 
+namespace {
+
+const char* severity_to_string(ToastSeverity severity) {
+    switch (severity) {
+    case ToastSeverity::INFO:
+        return "INFO";
+    case ToastSeverity::SUCCESS:
+        return "SUCCESS";
+    case ToastSeverity::WARNING:
+        return "WARNING";
+    case ToastSeverity::ERROR:
+        return "ERROR";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+ToastSeverity severity_from_string(const std::string& severity) {
+    if (severity == "SUCCESS") {
+        return ToastSeverity::SUCCESS;
+    }
+    if (severity == "WARNING") {
+        return ToastSeverity::WARNING;
+    }
+    if (severity == "ERROR") {
+        return ToastSeverity::ERROR;
+    }
+    return ToastSeverity::INFO;
+}
+
+// Fixed-size fields are not always NUL-terminated when the writer filled them completely
+std::string field_string(const char* field, size_t size) {
+    return std::string(field, strnlen(field, size));
+}
+
+void copy_field(char* field, size_t size, const std::string& value) {
+    strncpy(field, value.c_str(), size - 1);
+    field[size - 1] = '\0';
+}
+
+} // namespace
+
 NotificationHistory& NotificationHistory::instance() {
     static NotificationHistory instance;
     return instance;
 }
 
+uint64_t NotificationHistory::now_ms() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
+NotificationHistory::~NotificationHistory() {
+    close_log();
+}
+
 void NotificationHistory::add(const NotificationHistoryEntry& entry) {
     std::lock_guard<std::mutex> lock(mutex_);
 
+    add_locked(entry);
+    if (!log_path_.empty()) {
+        append_record_locked(entry_record(entry));
+    }
+
+    spdlog::trace("Added notification to history: severity={}, message='{}'",
+                  static_cast<int>(entry.severity), entry.message);
+}
+
+void NotificationHistory::add_locked(const NotificationHistoryEntry& entry) {
     // Reserve space if needed
     if (entries_.empty()) {
         entries_.reserve(MAX_ENTRIES);
@@ -37,91 +104,121 @@ void NotificationHistory::add(const NotificationHistoryEntry& entry) {
         if (!buffer_full_) {
             buffer_full_ = true;
         }
+        const NotificationHistoryEntry& oldest = entries_[head_index_];
+        if (!oldest.was_read) {
+            unread_by_severity_[static_cast<size_t>(oldest.severity) % SEVERITY_COUNT]--;
+        }
         entries_[head_index_] = entry;
         head_index_ = (head_index_ + 1) % MAX_ENTRIES;
     }
 
-    spdlog::trace("Added notification to history: severity={}, message='{}'",
-                  static_cast<int>(entry.severity), entry.message);
+    if (!entry.was_read) {
+        unread_by_severity_[static_cast<size_t>(entry.severity) % SEVERITY_COUNT]++;
+    }
+}
+
+const NotificationHistoryEntry& NotificationHistory::newest_locked(size_t age) const {
+    // head_index_ is the next write position, so the newest entry sits just before it
+    size_t newest = (head_index_ + entries_.size() - 1) % entries_.size();
+    return entries_[(newest + entries_.size() - age) % entries_.size()];
 }
 
 std::vector<NotificationHistoryEntry> NotificationHistory::get_all() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<NotificationHistoryEntry> result;
+    query(NotificationQuery{}, [&result](const NotificationHistoryEntry& entry) {
+        result.push_back(entry);
+    });
+    return result;
+}
 
-    if (entries_.empty()) {
-        return {};
-    }
+std::vector<NotificationHistoryEntry> NotificationHistory::get_filtered(int severity) const {
+    NotificationQuery filter;
+    filter.severity = severity;
 
     std::vector<NotificationHistoryEntry> result;
-    result.reserve(entries_.size());
+    query(filter, [&result](const NotificationHistoryEntry& entry) { result.push_back(entry); });
+    return result;
+}
 
-    if (!buffer_full_) {
-        // Buffer not full - entries are in order, just reverse
-        result.assign(entries_.rbegin(), entries_.rend());
-    } else {
-        // Buffer is full - reconstruct newest-first order
-        // head_index_ points to oldest, so start from head_index_-1 (newest)
-        size_t idx = (head_index_ == 0) ? MAX_ENTRIES - 1 : head_index_ - 1;
-        for (size_t i = 0; i < entries_.size(); i++) {
-            result.push_back(entries_[idx]);
-            idx = (idx == 0) ? MAX_ENTRIES - 1 : idx - 1;
-        }
+bool NotificationHistory::matches(const NotificationHistoryEntry& entry,
+                                  const NotificationQuery& query) {
+    if (query.severity >= 0 && static_cast<int>(entry.severity) != query.severity) {
+        return false;
     }
-
-    return result;
+    if (query.unread_only && entry.was_read) {
+        return false;
+    }
+    return entry.timestamp_ms >= query.since_ms && entry.timestamp_ms <= query.until_ms;
 }
 
-std::vector<NotificationHistoryEntry> NotificationHistory::get_filtered(int severity) const {
-    // Don't hold lock while calling get_all() - it has its own lock
-    auto all_entries = get_all();
+size_t NotificationHistory::query(const NotificationQuery& query, const Visitor& visitor) const {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    if (severity < 0) {
-        return all_entries;
+    size_t skipped = 0;
+    size_t visited = 0;
+    for (size_t age = 0; age < entries_.size() && visited < query.limit; age++) {
+        const NotificationHistoryEntry& entry = newest_locked(age);
+        if (!matches(entry, query)) {
+            continue;
+        }
+        if (skipped < query.offset) {
+            skipped++;
+            continue;
+        }
+        visitor(entry);
+        visited++;
     }
+    return visited;
+}
 
-    std::vector<NotificationHistoryEntry> result;
-    std::copy_if(all_entries.begin(), all_entries.end(), std::back_inserter(result),
-                 [severity](const NotificationHistoryEntry& e) {
-                     return static_cast<int>(e.severity) == severity;
-                 });
+size_t NotificationHistory::count_matching(const NotificationQuery& query) const {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    return result;
+    return static_cast<size_t>(
+        std::count_if(entries_.begin(), entries_.end(),
+                      [&query](const NotificationHistoryEntry& e) { return matches(e, query); }));
 }
 
 size_t NotificationHistory::get_unread_count() const {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    return static_cast<size_t>(
-        std::count_if(entries_.begin(), entries_.end(),
-                      [](const NotificationHistoryEntry& e) { return !e.was_read; }));
+    size_t unread = 0;
+    for (size_t count : unread_by_severity_) {
+        unread += count;
+    }
+    return unread;
 }
 
 ToastSeverity NotificationHistory::get_highest_unread_severity() const {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    // Severity priority: ERROR > WARNING > SUCCESS > INFO
-    ToastSeverity highest = ToastSeverity::INFO;
-
-    for (const auto& entry : entries_) {
-        if (!entry.was_read) {
-            if (entry.severity == ToastSeverity::ERROR) {
-                return ToastSeverity::ERROR; // Can't get higher than this
-            }
-            if (entry.severity == ToastSeverity::WARNING && highest != ToastSeverity::ERROR) {
-                highest = ToastSeverity::WARNING;
-            }
-        }
+    // Severity priority: ERROR > WARNING > everything else (reported as INFO)
+    if (unread_by_severity_[static_cast<size_t>(ToastSeverity::ERROR)] > 0) {
+        return ToastSeverity::ERROR;
     }
-
-    return highest;
+    if (unread_by_severity_[static_cast<size_t>(ToastSeverity::WARNING)] > 0) {
+        return ToastSeverity::WARNING;
+    }
+    return ToastSeverity::INFO;
 }
 
 void NotificationHistory::mark_all_read() {
     std::lock_guard<std::mutex> lock(mutex_);
 
+    // The history panel marks everything read each time it opens - only log real changes
+    bool had_unread = std::any_of(std::begin(unread_by_severity_), std::end(unread_by_severity_),
+                                  [](size_t count) { return count > 0; });
+    if (!had_unread) {
+        return;
+    }
+
     for (auto& entry : entries_) {
         entry.was_read = true;
     }
+    std::fill(std::begin(unread_by_severity_), std::end(unread_by_severity_), 0);
+    if (!log_path_.empty()) {
+        append_record_locked(R"({"op":"read"})");
+    }
 
     spdlog::debug("Marked all {} notifications as read", entries_.size());
 }
@@ -129,11 +226,19 @@ void NotificationHistory::mark_all_read() {
 void NotificationHistory::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
 
+    clear_locked();
+    if (!log_path_.empty()) {
+        append_record_locked(R"({"op":"clear"})");
+    }
+
+    spdlog::debug("Cleared notification history");
+}
+
+void NotificationHistory::clear_locked() {
     entries_.clear();
     head_index_ = 0;
     buffer_full_ = false;
-
-    spdlog::debug("Cleared notification history");
+    std::fill(std::begin(unread_by_severity_), std::end(unread_by_severity_), 0);
 }
 
 size_t NotificationHistory::count() const {
@@ -141,149 +246,208 @@ size_t NotificationHistory::count() const {
     return entries_.size();
 }
 
-bool NotificationHistory::save_to_disk(const char* path) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    try {
-        json j;
-        j["version"] = 1;
-        j["entries"] = json::array();
-
-        // Get entries in newest-first order
-        auto all_entries = get_all();
-
-        // Limit to last 50 entries to keep file size reasonable
-        size_t save_count = std::min(all_entries.size(), size_t(50));
-
-        for (size_t i = 0; i < save_count; i++) {
-            const auto& entry = all_entries[i];
-
-            // Convert severity to string
-            std::string severity_str;
-            switch (entry.severity) {
-            case ToastSeverity::INFO:
-                severity_str = "INFO";
-                break;
-            case ToastSeverity::SUCCESS:
-                severity_str = "SUCCESS";
-                break;
-            case ToastSeverity::WARNING:
-                severity_str = "WARNING";
-                break;
-            case ToastSeverity::ERROR:
-                severity_str = "ERROR";
-                break;
-            default:
-                severity_str = "UNKNOWN";
-                break;
-            }
-
-            json entry_json;
-            entry_json["timestamp"] = entry.timestamp_ms;
-            entry_json["severity"] = severity_str;
-            entry_json["title"] = entry.title;
-            entry_json["message"] = entry.message;
-            entry_json["was_modal"] = entry.was_modal;
-            entry_json["was_read"] = entry.was_read;
-
-            j["entries"].push_back(entry_json);
-        }
-
-        // Write to file
-        std::ofstream file(path);
-        if (!file.is_open()) {
-            LOG_WARN_INTERNAL("Failed to open notification history file for writing: {}", path);
-            return false;
-        }
+// ============================================================================
+// Persistence: append-only log, one compact JSON record per line
+// ============================================================================
+
+std::string NotificationHistory::entry_record(const NotificationHistoryEntry& entry) {
+    json record;
+    record["op"] = "add";
+    record["timestamp"] = entry.timestamp_ms;
+    record["severity"] = severity_to_string(entry.severity);
+    record["title"] = field_string(entry.title, sizeof(entry.title));
+    record["message"] = field_string(entry.message, sizeof(entry.message));
+    record["was_modal"] = entry.was_modal;
+    record["was_read"] = entry.was_read;
+    // Truncation into the fixed-size fields can split a UTF-8 sequence
+    return record.dump(-1, ' ', false, json::error_handler_t::replace);
+}
 
-        file << j.dump(2); // Pretty-print with 2-space indent
-        file.close();
+void NotificationHistory::append_record_locked(std::string record) {
+    pending_.push_back(std::move(record));
+    log_records_++;
+    writer_cv_.notify_one();
+}
 
-        spdlog::info("Saved {} notification entries to {}", save_count, path);
-        return true;
+bool NotificationHistory::open_log(const std::string& path, uint32_t batch_ms) {
+    close_log();
 
-    } catch (const std::exception& e) {
-        LOG_WARN_INTERNAL("Failed to save notification history: {}", e.what());
+    std::ifstream file(path);
+    std::error_code ec;
+    if (!file.is_open() && std::filesystem::exists(path, ec)) {
+        LOG_WARN_INTERNAL("Failed to open notification log for reading: {}", path);
         return false;
     }
-}
 
-bool NotificationHistory::load_from_disk(const char* path) {
     std::lock_guard<std::mutex> lock(mutex_);
-
-    try {
-        std::ifstream file(path);
-        if (!file.is_open()) {
-            spdlog::debug("No notification history file found at {}", path);
-            return false;
+    clear_locked();
+
+    size_t records = 0;
+    size_t skipped = 0;
+    std::string line;
+    while (file.is_open() && std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
         }
+        records++;
 
-        json j;
-        file >> j;
-        file.close();
+        // A crash mid-append leaves a torn last line
+        json record = json::parse(line, nullptr, false);
+        if (record.is_discarded() || !record.is_object()) {
+            skipped++;
+            continue;
+        }
 
-        // Check version
-        int version = j.value("version", 0);
-        if (version != 1) {
-            spdlog::warn("Unsupported notification history version: {}", version);
-            return false;
+        // value() throws when a field has the wrong type; skip the record, not the log
+        try {
+            std::string op = record.value("op", "");
+            if (op == "clear") {
+                clear_locked();
+            } else if (op == "read") {
+                for (auto& entry : entries_) {
+                    entry.was_read = true;
+                }
+                std::fill(std::begin(unread_by_severity_), std::end(unread_by_severity_), 0);
+            } else if (op == "add") {
+                NotificationHistoryEntry entry = {};
+                entry.timestamp_ms = record.value("timestamp", uint64_t(0));
+                entry.severity = severity_from_string(record.value("severity", "INFO"));
+                copy_field(entry.title, sizeof(entry.title), record.value("title", ""));
+                copy_field(entry.message, sizeof(entry.message), record.value("message", ""));
+                entry.was_modal = record.value("was_modal", false);
+                entry.was_read = record.value("was_read", false);
+                add_locked(entry);
+            } else {
+                skipped++;
+            }
+        } catch (const json::exception& e) {
+            spdlog::debug("Skipping notification log record: {}", e.what());
+            skipped++;
         }
+    }
 
-        // Clear existing entries
-        entries_.clear();
-        head_index_ = 0;
-        buffer_full_ = false;
+    log_path_ = path;
+    log_records_ = records;
+    batch_ms_ = batch_ms;
+    writer_stop_ = false;
+    log_stats_ = NotificationLogStats{};
+    writer_ = std::thread([this, path]() { run_writer(path); });
 
-        // Load entries
-        if (j.contains("entries") && j["entries"].is_array()) {
-            for (const auto& entry_json : j["entries"]) {
-                NotificationHistoryEntry entry = {};
+    if (skipped > 0) {
+        spdlog::warn("Skipped {} unreadable notification log records in {}", skipped, path);
+    }
+    spdlog::info("Loaded {} notification entries from {} ({} records)", entries_.size(), path,
+                 records);
+    return true;
+}
 
-                entry.timestamp_ms = entry_json.value("timestamp", uint64_t(0));
-                entry.was_modal = entry_json.value("was_modal", false);
-                entry.was_read = entry_json.value("was_read", false);
-
-                // Parse severity
-                std::string severity_str = entry_json.value("severity", "INFO");
-                if (severity_str == "INFO") {
-                    entry.severity = ToastSeverity::INFO;
-                } else if (severity_str == "SUCCESS") {
-                    entry.severity = ToastSeverity::SUCCESS;
-                } else if (severity_str == "WARNING") {
-                    entry.severity = ToastSeverity::WARNING;
-                } else if (severity_str == "ERROR") {
-                    entry.severity = ToastSeverity::ERROR;
-                } else {
-                    entry.severity = ToastSeverity::INFO;
-                }
+void NotificationHistory::close_log() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!writer_.joinable()) {
+            return;
+        }
+        // Stop queueing; the writer drains what is already pending before exiting
+        log_path_.clear();
+        writer_stop_ = true;
+    }
+    writer_cv_.notify_all();
+    writer_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    spdlog::debug("Notification log closed: {} records in {} appends, {} compactions, {} "
+                  "failures",
+                  log_stats_.records, log_stats_.batches, log_stats_.compactions,
+                  log_stats_.failures);
+}
 
-                // Copy strings
-                std::string title = entry_json.value("title", "");
-                std::string message = entry_json.value("message", "");
+NotificationLogStats NotificationHistory::log_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return log_stats_;
+}
 
-                strncpy(entry.title, title.c_str(), sizeof(entry.title) - 1);
-                entry.title[sizeof(entry.title) - 1] = '\0';
+void NotificationHistory::run_writer(std::string path) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        writer_cv_.wait(lock, [this]() { return writer_stop_ || !pending_.empty(); });
+        if (!writer_stop_) {
+            // Let a burst of notifications (a failing print) land in one append
+            writer_cv_.wait_for(lock, std::chrono::milliseconds(batch_ms_),
+                                [this]() { return writer_stop_; });
+        }
+        if (pending_.empty()) {
+            break; // Only reached when stopping
+        }
 
-                strncpy(entry.message, message.c_str(), sizeof(entry.message) - 1);
-                entry.message[sizeof(entry.message) - 1] = '\0';
+        std::vector<std::string> batch;
+        batch.swap(pending_);
+        lock.unlock();
+        bool appended = append_to_log(path, batch);
+        lock.lock();
+
+        if (appended) {
+            log_stats_.records += batch.size();
+            log_stats_.batches++;
+        } else {
+            log_stats_.failures++;
+        }
 
-                entries_.push_back(entry);
+        if (log_records_ > COMPACT_RECORDS) {
+            // Rewrite with one record per current entry. Records queued meanwhile are
+            // already reflected in the snapshot, so they are dropped once it is written.
+            std::vector<NotificationHistoryEntry> snapshot;
+            snapshot.reserve(entries_.size());
+            for (size_t age = entries_.size(); age > 0; age--) {
+                snapshot.push_back(newest_locked(age - 1));
             }
+            size_t covered = pending_.size();
+            lock.unlock();
 
-            head_index_ = entries_.size();
-            if (entries_.size() >= MAX_ENTRIES) {
-                buffer_full_ = true;
-                head_index_ = 0;
+            std::string content;
+            for (const auto& entry : snapshot) {
+                content += entry_record(entry);
+                content += '\n';
+            }
+            bool compacted = DebouncedFileWriter::write_atomically(path, content);
+
+            lock.lock();
+            if (compacted) {
+                pending_.erase(pending_.begin(), pending_.begin() + covered);
+                log_records_ = snapshot.size() + pending_.size();
+                log_stats_.compactions++;
+                spdlog::debug("Compacted notification log to {} records", snapshot.size());
+            } else {
+                log_stats_.failures++;
             }
+        }
 
-            spdlog::info("Loaded {} notification entries from {}", entries_.size(), path);
-            return true;
+        if (writer_stop_ && pending_.empty()) {
+            break;
         }
+    }
+}
 
-        return false;
+bool NotificationHistory::append_to_log(const std::string& path,
+                                        const std::vector<std::string>& records) {
+    std::string content;
+    for (const auto& record : records) {
+        content += record;
+        content += '\n';
+    }
 
-    } catch (const std::exception& e) {
-        spdlog::error("Failed to load notification history: {}", e.what());
+    std::ofstream file(path, std::ios::app | std::ios::binary);
+    if (!file.is_open()) {
+        LOG_WARN_INTERNAL("Failed to open notification log for writing: {}", path);
         return false;
     }
+    file << content;
+    file.flush();
+    if (!file.good()) {
+        LOG_WARN_INTERNAL("Failed to append {} records to notification log {}", records.size(),
+                          path);
+        return false;
+    }
+
+    spdlog::trace("Appended {} notification log records", records.size());
+    return true;
 }
@@ -202,6 +202,9 @@ void BedMeshPanel::setup_moonraker_subscription() {
         spdlog::warn("[{}] Cannot subscribe to Moonraker - API is null", get_name());
         return;
     }
+    if (mesh_subscribed_) {
+        return; // Overlay recreated after eviction: the callback checks canvas_ itself
+    }
 
     // Note: We capture 'this' and 'api_' in the lambda. This is safe because:
     // 1. Panels are destroyed when the app exits
@@ -211,20 +214,23 @@ void BedMeshPanel::setup_moonraker_subscription() {
     // We use get_client() to access the transport layer for subscriptions,
     // which is appropriate since subscriptions are a transport-level concern.
     MoonrakerAPI* api = api_;
-    api_->get_client().register_notify_update([this, api](nlohmann::json notification) {
-        // Check if this notification contains bed_mesh updates
-        if (notification.contains("params") && notification["params"].is_array() &&
-            !notification["params"].empty()) {
-            const nlohmann::json& params = notification["params"][0];
-            if (params.contains("bed_mesh") && params["bed_mesh"].is_object()) {
-                // Mesh data was updated - refresh UI via MoonrakerAPI
-                const BedMeshProfile* mesh = api->get_active_bed_mesh();
-                if (mesh) {
-                    on_mesh_update_internal(*mesh);
+    api_->get_client().register_notify_update(
+        [this, api](const nlohmann::json& notification) {
+            // Check if this notification contains bed_mesh updates
+            if (notification.contains("params") && notification["params"].is_array() &&
+                !notification["params"].empty()) {
+                const nlohmann::json& params = notification["params"][0];
+                if (params.contains("bed_mesh") && params["bed_mesh"].is_object()) {
+                    // Mesh data was updated - refresh UI via MoonrakerAPI
+                    const BedMeshProfile* mesh = api->get_active_bed_mesh();
+                    if (mesh) {
+                        on_mesh_update_internal(*mesh);
+                    }
                 }
             }
-        }
-    });
+        },
+        "bed_mesh_panel");
+    mesh_subscribed_ = true;
     spdlog::debug("[{}] Registered Moonraker callback for mesh updates", get_name());
 }
 
@@ -237,6 +243,7 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
         lv_subject_copy_string(&bed_mesh_dimensions_, "No mesh data");
         lv_subject_copy_string(&bed_mesh_z_range_, "");
         lv_subject_copy_string(&bed_mesh_variance_, "");
+        rendered_mesh_hash_ = 0;
         spdlog::warn("[{}] No mesh data available", get_name());
         return;
     }
@@ -248,6 +255,13 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     lv_subject_copy_string(&bed_mesh_profile_name_, mesh.name.c_str());
     spdlog::debug("[{}] Set profile name: {}", get_name(), mesh.name);
 
+    // Same matrix and bounds as last time (e.g. Klipper re-emitted bed_mesh, or only the
+    // profile name changed): skip statistics and renderer re-tessellation
+    if (mesh.content_hash != 0 && mesh.content_hash == rendered_mesh_hash_) {
+        spdlog::debug("[{}] Mesh content unchanged, skipping renderer update", get_name());
+        return;
+    }
+
     // Format and update dimensions
     std::snprintf(dimensions_buf_, sizeof(dimensions_buf_), "%dx%d points", mesh.x_count,
                   mesh.y_count);
@@ -299,8 +313,11 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     lv_subject_copy_string(&bed_mesh_variance_, variance_buf_);
     spdlog::debug("[{}] Set variance: {}", get_name(), variance_buf_);
 
-    // Update renderer with new mesh data
-    set_mesh_data(mesh.probed_matrix);
+    // Update renderer with new mesh data (no canvas while the overlay is not created)
+    if (canvas_) {
+        set_mesh_data(mesh.probed_matrix);
+        rendered_mesh_hash_ = mesh.content_hash;
+    }
 
     spdlog::info("[{}] Mesh updated: {} ({}x{}, Z: {:.3f} to {:.3f})", get_name(), mesh.name,
                  mesh.x_count, mesh.y_count, min_z, max_z);
@@ -334,8 +351,12 @@ void BedMeshPanel::on_panel_delete(lv_event_t* e) {
     spdlog::debug("[{}] Panel delete event - cleaning up resources", self->get_name());
 
     // Clear widget pointers (owned by LVGL)
+    self->panel_ = nullptr;
     self->canvas_ = nullptr;
     self->profile_dropdown_ = nullptr;
+
+    // A recreated overlay (PanelRegistry eviction) starts with an empty canvas
+    self->rendered_mesh_hash_ = 0;
 }
 
 void BedMeshPanel::on_profile_dropdown_changed(lv_event_t* e) {
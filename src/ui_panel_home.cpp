@@ -12,6 +12,7 @@
 
 #include "app_globals.h"
 #include "config.h"
+#include "image_cache.h"
 #include "moonraker_api.h"
 #include "printer_detector.h"
 #include "printer_state.h"
@@ -197,15 +198,17 @@ void HomePanel::on_deactivate() {
 }
 
 void HomePanel::update_tip_of_day() {
-    auto tip = TipsManager::get_instance()->get_random_unique_tip();
+    // Index-based lookup: the tip stays in TipsManager's cache, nothing is copied per rotation
+    TipsManager* tips = TipsManager::get_instance();
+    const PrintingTip* tip = tips->get_tip(tips->get_random_unique_tip_index());
 
-    if (!tip.title.empty()) {
-        // Store full tip for dialog display
+    if (tip && !tip->title.empty()) {
+        // Remember tip for dialog display
         current_tip_ = tip;
 
-        std::snprintf(status_buffer_, sizeof(status_buffer_), "%s", tip.title.c_str());
+        std::snprintf(status_buffer_, sizeof(status_buffer_), "%s", tip->title.c_str());
         lv_subject_copy_string(&status_subject_, status_buffer_);
-        spdlog::debug("[{}] Updated tip: {}", get_name(), tip.title);
+        spdlog::debug("[{}] Updated tip: {}", get_name(), tip->title);
     } else {
         spdlog::warn("[{}] Failed to get tip, keeping current", get_name());
     }
@@ -261,7 +264,7 @@ void HomePanel::handle_print_card_clicked() {
 }
 
 void HomePanel::handle_tip_text_clicked() {
-    if (current_tip_.title.empty()) {
+    if (!current_tip_) {
         spdlog::warn("[{}] No tip available to display", get_name());
         return;
     }
@@ -275,8 +278,8 @@ void HomePanel::handle_tip_text_clicked() {
                                 .persistent = false,
                                 .on_close = nullptr};
 
-    const char* attrs[] = {"title", current_tip_.title.c_str(), "message",
-                           current_tip_.content.c_str(), nullptr};
+    const char* attrs[] = {"title", current_tip_->title.c_str(), "message",
+                           current_tip_->content.c_str(), nullptr};
 
     ui_modal_configure(UI_MODAL_SEVERITY_INFO, false, "Ok", nullptr);
     lv_obj_t* tip_dialog = ui_modal_show("modal_dialog", &config, attrs);
@@ -428,6 +431,7 @@ void HomePanel::reload_from_config() {
         if (panel_) {
             lv_obj_t* printer_image = lv_obj_find_by_name(panel_, "printer_image");
             if (printer_image) {
+                image_path = ImageCache::instance().resolve(image_path);
                 lv_image_set_src(printer_image, image_path.c_str());
                 spdlog::info("[{}] Printer image: '{}' for '{}'", get_name(), image_path,
                              printer_type);
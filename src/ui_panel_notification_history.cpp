@@ -84,6 +84,12 @@ void NotificationHistoryPanel::setup(lv_obj_t* panel, lv_obj_t* parent_screen) {
     }
 #endif
 
+    // Load further pages as the list is scrolled to the end
+    lv_obj_t* overlay_content = lv_obj_find_by_name(panel_, "overlay_content");
+    if (overlay_content) {
+        lv_obj_add_event_cb(overlay_content, on_scroll_end, LV_EVENT_SCROLL_END, this);
+    }
+
     // Reset filter
     current_filter_ = -1;
 
@@ -103,10 +109,6 @@ void NotificationHistoryPanel::refresh() {
         return;
     }
 
-    // Get entries (filtered or all)
-    auto entries =
-        (current_filter_ < 0) ? history_.get_all() : history_.get_filtered(current_filter_);
-
     // Find content container
     lv_obj_t* overlay_content = lv_obj_find_by_name(panel_, "overlay_content");
     if (!overlay_content) {
@@ -116,13 +118,50 @@ void NotificationHistoryPanel::refresh() {
 
     // Clear existing items from content area
     lv_obj_clean(overlay_content);
+    shown_count_ = 0;
+
+    // First page only - opening the panel costs the same however long the history is
+    append_page(overlay_content);
 
     // Update has_entries subject - XML bindings handle visibility reactively
-    bool has_entries = !entries.empty();
-    lv_subject_set_int(&has_entries_subject_, has_entries ? 1 : 0);
+    lv_subject_set_int(&has_entries_subject_, shown_count_ > 0 ? 1 : 0);
+
+    // Mark all as read
+    history_.mark_all_read();
 
-    // Create list items using severity_card for automatic color styling
-    for (const auto& entry : entries) {
+    // Update status bar - badge count is 0 and bell goes gray (no unread)
+    ui_status_bar_update_notification_count(0);
+    ui_status_bar_update_notification(NotificationStatus::NONE);
+
+    spdlog::debug("[{}] Refreshed: {} entries displayed", get_name(), shown_count_);
+}
+
+void NotificationHistoryPanel::set_filter(int filter) {
+    if (current_filter_ != filter) {
+        current_filter_ = filter;
+        refresh();
+    }
+}
+
+// ============================================================================
+// PRIVATE HELPERS
+// ============================================================================
+
+size_t NotificationHistoryPanel::append_page(lv_obj_t* content) {
+    NotificationQuery page;
+    page.severity = current_filter_;
+    page.offset = shown_count_;
+    page.limit = PAGE_SIZE;
+
+    // Copy the page out first: the history stays locked during query(), and building
+    // widgets there would stall add() callers (and deadlock if LVGL re-entered it)
+    page_entries_.clear();
+    page_entries_.reserve(PAGE_SIZE);
+    history_.query(page, [this](const NotificationHistoryEntry& entry) {
+        page_entries_.push_back(entry);
+    });
+
+    for (const auto& entry : page_entries_) {
         // Format timestamp
         std::string timestamp_str = format_timestamp(entry.timestamp_ms);
 
@@ -137,13 +176,13 @@ void NotificationHistoryPanel::refresh() {
                                nullptr};
 
         // Create item from XML (severity_card sets border color automatically)
-        lv_xml_create(overlay_content, "notification_history_item", attrs);
+        lv_xml_create(content, "notification_history_item", attrs);
 
         // Find the most recently created item (last child)
-        uint32_t child_cnt = lv_obj_get_child_count(overlay_content);
-        lv_obj_t* item =
-            (child_cnt > 0) ? lv_obj_get_child(overlay_content, static_cast<int32_t>(child_cnt - 1))
-                            : nullptr;
+        uint32_t child_cnt = lv_obj_get_child_count(content);
+        lv_obj_t* item = (child_cnt > 0)
+                             ? lv_obj_get_child(content, static_cast<int32_t>(child_cnt - 1))
+                             : nullptr;
         if (!item) {
             spdlog::error("[{}] Failed to create notification_history_item from XML", get_name());
             continue;
@@ -153,27 +192,11 @@ void NotificationHistoryPanel::refresh() {
         ui_severity_card_finalize(item);
     }
 
-    // Mark all as read
-    history_.mark_all_read();
-
-    // Update status bar - badge count is 0 and bell goes gray (no unread)
-    ui_status_bar_update_notification_count(0);
-    ui_status_bar_update_notification(NotificationStatus::NONE);
-
-    spdlog::debug("[{}] Refreshed: {} entries displayed", get_name(), entries.size());
-}
-
-void NotificationHistoryPanel::set_filter(int filter) {
-    if (current_filter_ != filter) {
-        current_filter_ = filter;
-        refresh();
-    }
+    size_t added = page_entries_.size();
+    shown_count_ += added;
+    return added;
 }
 
-// ============================================================================
-// PRIVATE HELPERS
-// ============================================================================
-
 const char* NotificationHistoryPanel::severity_to_string(ToastSeverity severity) {
     switch (severity) {
     case ToastSeverity::ERROR:
@@ -189,9 +212,9 @@ const char* NotificationHistoryPanel::severity_to_string(ToastSeverity severity)
 }
 
 std::string NotificationHistoryPanel::format_timestamp(uint64_t timestamp_ms) {
-    uint64_t now = lv_tick_get();
+    uint64_t now = NotificationHistory::now_ms();
 
-    // Handle edge case where timestamp is in future (shouldn't happen)
+    // Timestamp in the future (clock set back since it was logged)
     if (timestamp_ms > now) {
         return "Just now";
     }
@@ -221,6 +244,23 @@ void NotificationHistoryPanel::handle_clear_clicked() {
     spdlog::info("[{}] History cleared by user", get_name());
 }
 
+void NotificationHistoryPanel::handle_scroll_end() {
+    lv_obj_t* overlay_content = panel_ ? lv_obj_find_by_name(panel_, "overlay_content") : nullptr;
+    if (!overlay_content || shown_count_ % PAGE_SIZE != 0) {
+        return; // Last page already shown
+    }
+
+    // Only when the end of the list is (nearly) in view
+    if (lv_obj_get_scroll_bottom(overlay_content) > lv_obj_get_height(overlay_content) / 2) {
+        return;
+    }
+
+    size_t added = append_page(overlay_content);
+    if (added > 0) {
+        spdlog::debug("[{}] Loaded {} more entries ({} shown)", get_name(), added, shown_count_);
+    }
+}
+
 void NotificationHistoryPanel::handle_filter_all() {
     set_filter(-1);
 }
@@ -250,6 +290,15 @@ void NotificationHistoryPanel::on_clear_clicked(lv_event_t* e) {
     LVGL_SAFE_EVENT_CB_END();
 }
 
+void NotificationHistoryPanel::on_scroll_end(lv_event_t* e) {
+    LVGL_SAFE_EVENT_CB_BEGIN("[NotificationHistoryPanel] on_scroll_end");
+    auto* self = static_cast<NotificationHistoryPanel*>(lv_event_get_user_data(e));
+    if (self) {
+        self->handle_scroll_end();
+    }
+    LVGL_SAFE_EVENT_CB_END();
+}
+
 void NotificationHistoryPanel::on_filter_all_clicked(lv_event_t* e) {
     LVGL_SAFE_EVENT_CB_BEGIN("[NotificationHistoryPanel] on_filter_all_clicked");
     auto* self = static_cast<NotificationHistoryPanel*>(lv_event_get_user_data(e));
@@ -15,7 +15,9 @@
 
 #include "app_globals.h"
 #include "config.h"
+#include "image_cache.h"
 #include "lvgl/src/xml/lv_xml.h"
+#include "main_loop_waker.h"
 #include "moonraker_api.h"
 #include "printer_state.h"
 #include "runtime_config.h"
@@ -24,9 +26,12 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <ctime>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Forward declaration for class-based API
@@ -100,6 +105,12 @@ PrintSelectPanel::~PrintSelectPanel() {
         refresh_timer_ = nullptr;
     }
 
+    // The catalog progress callback captures 'this' and outlives us otherwise
+    if (usb_manager_) {
+        usb_manager_->catalog().set_progress_callback(nullptr);
+        usb_manager_ = nullptr;
+    }
+
     // Reset our pointers - the LVGL widget tree handles widget cleanup.
     card_view_container_ = nullptr;
     list_view_container_ = nullptr;
@@ -143,6 +154,10 @@ void PrintSelectPanel::init_subjects() {
     // Initialize detail view visibility subject (0 = hidden, 1 = visible)
     UI_SUBJECT_INIT_AND_REGISTER_INT(detail_view_visible_subject_, 0, "detail_view_visible");
 
+    // USB catalog progress text (empty unless a USB drive is being read)
+    UI_SUBJECT_INIT_AND_REGISTER_STRING(usb_status_subject_, usb_status_buffer_, "",
+                                        "print_select_usb_status");
+
     // Initialize view mode subject (0 = CARD, 1 = LIST) - XML bindings control container visibility
     UI_SUBJECT_INIT_AND_REGISTER_INT(view_mode_subject_, 0, "print_select_view_mode");
 
@@ -372,7 +387,7 @@ void PrintSelectPanel::refresh_files() {
                 PrintFileData parent_dir;
                 parent_dir.filename = "..";
                 parent_dir.is_dir = true;
-                parent_dir.thumbnail_path = self->FOLDER_UP_ICON;
+                parent_dir.thumbnail_path = ImageCache::instance().resolve(self->FOLDER_UP_ICON);
                 parent_dir.size_str = "Go up";
                 parent_dir.print_time_str = "";
                 parent_dir.filament_str = "";
@@ -390,7 +405,7 @@ void PrintSelectPanel::refresh_files() {
 
                 if (file.is_dir) {
                     // Directory - use folder icon
-                    data.thumbnail_path = self->FOLDER_ICON;
+                    data.thumbnail_path = ImageCache::instance().resolve(self->FOLDER_ICON);
                     data.print_time_minutes = 0;
                     data.filament_grams = 0.0f;
                     data.size_str = "Folder";
@@ -403,7 +418,8 @@ void PrintSelectPanel::refresh_files() {
                         continue;
                     }
 
-                    data.thumbnail_path = self->DEFAULT_PLACEHOLDER_THUMB;
+                    data.thumbnail_path =
+                        ImageCache::instance().resolve(self->DEFAULT_PLACEHOLDER_THUMB);
                     data.print_time_minutes = 0;
                     data.filament_grams = 0.0f;
                     data.size_str = format_file_size(data.file_size_bytes);
@@ -463,6 +479,7 @@ void PrintSelectPanel::refresh_files() {
                     panel->fetch_all_metadata();
                 },
                 self);
+            MainLoopWaker::instance().wake();
         },
         // Error callback
         [self](const MoonrakerError& error) {
@@ -584,11 +601,16 @@ void PrintSelectPanel::fetch_all_metadata() {
                                             std::make_unique<ThumbUpdate>(ThumbUpdate{
                                                 self, file_idx, filename_copy, local_path}),
                                             [](ThumbUpdate* t) {
+                                                // A re-uploaded file reuses its cache path:
+                                                // drop the old decode either way
+                                                std::string src = "A:" + t->local_path;
+                                                ImageCache::instance().invalidate(src);
+
                                                 if (t->index < t->panel->file_list_.size() &&
                                                     t->panel->file_list_[t->index].filename ==
                                                         t->filename) {
                                                     t->panel->file_list_[t->index].thumbnail_path =
-                                                        "A:" + t->local_path;
+                                                        std::move(src);
                                                     spdlog::debug(
                                                         "[{}] Thumbnail cached for {}: {}",
                                                         t->panel->get_name(), t->filename,
@@ -899,6 +921,7 @@ void PrintSelectPanel::schedule_view_refresh() {
             lv_timer_set_repeat_count(self->refresh_timer_, 1);
         },
         this);
+    MainLoopWaker::instance().wake();
 }
 
 void PrintSelectPanel::populate_card_view() {
@@ -920,6 +943,9 @@ void PrintSelectPanel::populate_card_view() {
     // Update container gap
     lv_obj_set_style_pad_gap(card_view_container_, CARD_GAP, LV_PART_MAIN);
 
+    // Card creation dominates this function (one lv_xml_create() per file)
+    auto start = std::chrono::steady_clock::now();
+
     for (size_t i = 0; i < file_list_.size(); i++) {
         const auto& file = file_list_[i];
 
@@ -990,6 +1016,11 @@ void PrintSelectPanel::populate_card_view() {
             attach_card_click_handler(card, i);
         }
     }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    spdlog::debug("[{}] Created {} cards in {:.1f} ms", get_name(), file_list_.size(),
+                  static_cast<double>(elapsed.count()) / 1000.0);
 }
 
 void PrintSelectPanel::populate_list_view() {
@@ -1754,6 +1785,7 @@ void PrintSelectPanel::on_source_printer_clicked() {
     spdlog::debug("[{}] Switching to Printer source", get_name());
     current_source_ = FileSource::PRINTER;
     update_source_buttons();
+    lv_subject_copy_string(&usb_status_subject_, "");
 
     // Refresh Moonraker files
     refresh_files();
@@ -1790,22 +1822,26 @@ void PrintSelectPanel::refresh_usb_files() {
         return;
     }
 
-    // Scan first drive for G-code files
+    // List the first drive from the catalog: it was indexed in the background since the
+    // drive was inserted, so nothing is read from the drive here
     // TODO: If multiple drives, show a drive selector
-    usb_files_ = usb_manager_->scan_for_gcode(drives[0].mount_path);
+    UsbCatalog& catalog = usb_manager_->catalog();
+    const std::string& mount_path = drives[0].mount_path;
+    std::vector<UsbCatalogEntry> entries = catalog.entries(mount_path);
 
-    spdlog::info("[{}] Found {} G-code files on USB drive '{}'", get_name(), usb_files_.size(),
+    spdlog::info("[{}] Found {} G-code files on USB drive '{}'", get_name(), entries.size(),
                  drives[0].label);
 
     // Convert USB files to PrintFileData for display
-    for (const auto& usb_file : usb_files_) {
+    for (const auto& entry : entries) {
+        const UsbGcodeFile& usb_file = entry.file;
+        usb_files_.push_back(usb_file);
+
         PrintFileData file_data;
         file_data.filename = usb_file.filename;
+        file_data.path = usb_file.path;
         file_data.file_size_bytes = usb_file.size_bytes;
         file_data.modified_timestamp = static_cast<time_t>(usb_file.modified_time);
-        file_data.print_time_minutes = 0; // USB files don't have Moonraker metadata
-        file_data.filament_grams = 0.0f;
-        file_data.thumbnail_path = DEFAULT_PLACEHOLDER_THUMB;
         file_data.is_dir = false;
 
         // Format strings for display
@@ -1827,9 +1863,7 @@ void PrintSelectPanel::refresh_usb_files() {
             file_data.modified_str = "Unknown";
         }
 
-        file_data.print_time_str = "--";
-        file_data.filament_str = "--";
-
+        apply_usb_entry(file_data, entry);
         file_list_.push_back(std::move(file_data));
     }
 
@@ -1843,6 +1877,96 @@ void PrintSelectPanel::refresh_usb_files() {
     }
 
     update_empty_state();
+
+    // Fill in the files at the top of the sorted list first
+    std::vector<std::string> visible_paths;
+    for (const auto& file_data : file_list_) {
+        if (visible_paths.size() >= USB_PRIORITY_FILES) {
+            break;
+        }
+        visible_paths.push_back(file_data.path);
+    }
+    catalog.prioritize(mount_path, visible_paths);
+    update_usb_status(catalog.progress(mount_path));
+}
+
+void PrintSelectPanel::apply_usb_entry(PrintFileData& file_data, const UsbCatalogEntry& entry) {
+    if (!entry.has_metadata) {
+        file_data.print_time_minutes = 0; // Not read yet
+        file_data.filament_grams = 0.0f;
+        file_data.print_time_str = "--";
+        file_data.filament_str = "--";
+        file_data.thumbnail_path = ImageCache::instance().resolve(DEFAULT_PLACEHOLDER_THUMB);
+        return;
+    }
+
+    file_data.print_time_minutes =
+        static_cast<int>(std::round(entry.metadata.estimated_time_seconds / 60.0));
+    file_data.filament_grams = static_cast<float>(entry.metadata.filament_used_g);
+    file_data.filament_type = entry.metadata.filament_type;
+    file_data.print_time_str = file_data.print_time_minutes > 0
+                                   ? format_print_time(file_data.print_time_minutes)
+                                   : "--";
+    file_data.filament_str =
+        file_data.filament_grams > 0.0f ? format_filament_weight(file_data.filament_grams) : "--";
+    if (entry.thumbnail_path.empty()) {
+        file_data.thumbnail_path = ImageCache::instance().resolve(DEFAULT_PLACEHOLDER_THUMB);
+        return;
+    }
+    file_data.thumbnail_path = "A:" + entry.thumbnail_path;
+
+    // A changed file's thumbnail is rewritten under the same path: drop the old decode
+    auto source = std::make_pair(entry.file.modified_time, entry.file.size_bytes);
+    auto [it, inserted] = usb_thumb_sources_.emplace(entry.thumbnail_path, source);
+    if (!inserted && it->second != source) {
+        ImageCache::instance().invalidate(file_data.thumbnail_path);
+        it->second = source;
+    }
+}
+
+void PrintSelectPanel::on_usb_catalog_progress(const UsbCatalogProgress& progress) {
+    if (current_source_ != FileSource::USB || !usb_manager_) {
+        return;
+    }
+
+    auto drives = usb_manager_->get_drives();
+    if (drives.empty() || drives[0].mount_path != progress.mount_path) {
+        return; // Not the drive on screen
+    }
+
+    std::vector<UsbCatalogEntry> entries = usb_manager_->catalog().entries(progress.mount_path);
+    if (entries.size() != file_list_.size()) {
+        refresh_usb_files(); // Walk finished with different files
+        return;
+    }
+
+    // Same files: fill in what was read since the last report without rebuilding the list.
+    // Matched by full path, like the catalog: subdirectories can hold files of the same name.
+    std::unordered_map<std::string, const UsbCatalogEntry*> by_path;
+    for (const auto& entry : entries) {
+        by_path[entry.file.path] = &entry;
+    }
+    for (auto& file_data : file_list_) {
+        auto it = by_path.find(file_data.path);
+        if (it == by_path.end()) {
+            refresh_usb_files(); // Renamed or replaced
+            return;
+        }
+        apply_usb_entry(file_data, *it->second);
+    }
+
+    schedule_view_refresh();
+    update_usb_status(progress);
+}
+
+void PrintSelectPanel::update_usb_status(const UsbCatalogProgress& progress) {
+    std::string status;
+    if (progress.indexing && progress.files == 0) {
+        status = "Reading USB...";
+    } else if (!progress.complete()) {
+        status = fmt::format("Reading USB {}/{}", progress.metadata_done, progress.files);
+    }
+    lv_subject_copy_string(&usb_status_subject_, status.c_str());
 }
 
 void PrintSelectPanel::populate_usb_card_view() {
@@ -1856,8 +1980,25 @@ void PrintSelectPanel::populate_usb_list_view() {
 }
 
 void PrintSelectPanel::set_usb_manager(UsbManager* manager) {
+    // Detach from the previous manager so its catalog stops reporting to us
+    if (usb_manager_ && usb_manager_ != manager) {
+        usb_manager_->catalog().set_progress_callback(nullptr);
+    }
     usb_manager_ = manager;
 
+    if (usb_manager_) {
+        // Reports come from catalog worker threads
+        usb_manager_->catalog().set_progress_callback([this](const UsbCatalogProgress& progress) {
+            struct UsbProgress {
+                PrintSelectPanel* panel;
+                UsbCatalogProgress progress;
+            };
+            ui_async_call_safe<UsbProgress>(
+                std::make_unique<UsbProgress>(UsbProgress{this, progress}),
+                [](UsbProgress* d) { d->panel->on_usb_catalog_progress(d->progress); });
+        });
+    }
+
     // If USB source is currently active, refresh the file list
     if (current_source_ == FileSource::USB && usb_manager_) {
         refresh_usb_files();
@@ -1890,6 +2031,7 @@ void PrintSelectPanel::on_usb_drive_removed() {
         // Clear USB files and the display file list
         usb_files_.clear();
         file_list_.clear();
+        lv_subject_copy_string(&usb_status_subject_, "");
 
         // Clear card/list views
         if (card_view_container_) {
@@ -0,0 +1,252 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_panel_registry.h"
+
+#include "ui_nav.h"
+
+#include "image_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace {
+
+// MemAvailable from /proc/meminfo in KiB, or 0 if unknown
+size_t read_mem_available_kb() {
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    size_t value = 0;
+    std::string unit;
+    while (meminfo >> key >> value >> unit) {
+        if (key == "MemAvailable:") {
+            return value;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+PanelRegistry& PanelRegistry::instance() {
+    static PanelRegistry instance;
+    return instance;
+}
+
+PanelRegistry::Entry* PanelRegistry::lookup(const std::string& component) {
+    for (auto& entry : entries_) {
+        if (entry->component == component) {
+            return entry.get();
+        }
+    }
+    return nullptr;
+}
+
+const PanelRegistry::Entry* PanelRegistry::lookup(const std::string& component) const {
+    for (const auto& entry : entries_) {
+        if (entry->component == component) {
+            return entry.get();
+        }
+    }
+    return nullptr;
+}
+
+void PanelRegistry::add(const std::string& component, lv_obj_t* parent, SetupFn setup,
+                        EvictFn on_evict) {
+    Entry* entry = lookup(component);
+    if (!entry) {
+        entries_.push_back(std::make_unique<Entry>());
+        entry = entries_.back().get();
+        entry->component = component;
+    }
+    entry->parent = parent;
+    entry->setup = std::move(setup);
+    entry->on_evict = std::move(on_evict);
+}
+
+bool PanelRegistry::create(Entry& entry) {
+    auto start = std::chrono::steady_clock::now();
+
+    auto* obj =
+        static_cast<lv_obj_t*>(lv_xml_create(entry.parent, entry.component.c_str(), nullptr));
+    if (!obj) {
+        spdlog::error("[PanelRegistry] Failed to create '{}' from XML", entry.component);
+        return false;
+    }
+    if (lv_obj_get_name(obj) == nullptr) {
+        lv_obj_set_name(obj, entry.component.c_str());
+    }
+
+    // Forget the widget however it gets deleted (eviction, or its parent going away)
+    entry.obj = obj;
+    entry.last_used_ms = lv_tick_get();
+    lv_obj_add_event_cb(
+        obj,
+        [](lv_event_t* e) {
+            auto* deleted = static_cast<Entry*>(lv_event_get_user_data(e));
+            deleted->obj = nullptr;
+        },
+        LV_EVENT_DELETE, &entry);
+
+    if (entry.setup) {
+        entry.setup(obj);
+    }
+
+    // Initially hidden: navigation shows it
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    spdlog::debug("[PanelRegistry] Created '{}' in {} ms", entry.component, elapsed.count());
+    return true;
+}
+
+lv_obj_t* PanelRegistry::get(const std::string& component) {
+    Entry* entry = lookup(component);
+    if (!entry) {
+        spdlog::error("[PanelRegistry] '{}' is not registered", component);
+        return nullptr;
+    }
+    if (!entry->obj && !create(*entry)) {
+        return nullptr;
+    }
+    entry->last_used_ms = lv_tick_get();
+    return entry->obj;
+}
+
+lv_obj_t* PanelRegistry::find(const std::string& component) const {
+    const Entry* entry = lookup(component);
+    return entry ? entry->obj : nullptr;
+}
+
+void PanelRegistry::prewarm(const std::vector<std::string>& components) {
+    for (const auto& component : components) {
+        if (find(component) == nullptr &&
+            std::find(prewarm_queue_.begin(), prewarm_queue_.end(), component) ==
+                prewarm_queue_.end()) {
+            prewarm_queue_.push_back(component);
+        }
+    }
+
+    if (!prewarm_queue_.empty() && !prewarm_timer_) {
+        prewarm_timer_ = lv_timer_create(prewarm_timer_cb, PREWARM_PERIOD_MS, this);
+    }
+}
+
+bool PanelRegistry::prewarm_next() {
+    while (!prewarm_queue_.empty()) {
+        std::string component = prewarm_queue_.front();
+        prewarm_queue_.pop_front();
+
+        Entry* entry = lookup(component);
+        if (entry && !entry->obj) {
+            spdlog::debug("[PanelRegistry] Pre-warming '{}'", component);
+            return create(*entry);
+        }
+    }
+    return false;
+}
+
+void PanelRegistry::prewarm_timer_cb(lv_timer_t* timer) {
+    auto* self = static_cast<PanelRegistry*>(lv_timer_get_user_data(timer));
+
+    // Only while the user isn't interacting: creation can take tens of milliseconds
+    if (lv_display_get_inactive_time(nullptr) < PREWARM_IDLE_MS) {
+        return;
+    }
+
+    self->prewarm_next();
+    if (self->prewarm_queue_.empty()) {
+        lv_timer_delete(timer);
+        self->prewarm_timer_ = nullptr;
+    }
+}
+
+size_t PanelRegistry::evict(size_t max_count) {
+    std::vector<Entry*> candidates;
+    for (auto& entry : entries_) {
+        if (entry->obj && entry->on_evict && lv_obj_has_flag(entry->obj, LV_OBJ_FLAG_HIDDEN) &&
+            !ui_nav_is_in_stack(entry->obj)) {
+            candidates.push_back(entry.get());
+        }
+    }
+
+    // Least recently used first
+    std::sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        return lv_tick_elaps(a->last_used_ms) > lv_tick_elaps(b->last_used_ms);
+    });
+
+    size_t evicted = 0;
+    for (Entry* entry : candidates) {
+        if (evicted >= max_count) {
+            break;
+        }
+        spdlog::debug("[PanelRegistry] Evicting '{}'", entry->component);
+        entry->on_evict();
+        lv_obj_delete(entry->obj); // LV_EVENT_DELETE clears entry->obj
+        evicted++;
+    }
+    return evicted;
+}
+
+void PanelRegistry::set_memory_pressure_threshold(size_t min_available_kb) {
+    min_available_kb_ = min_available_kb;
+
+    if (min_available_kb == 0) {
+        if (memory_timer_) {
+            lv_timer_delete(memory_timer_);
+            memory_timer_ = nullptr;
+        }
+        return;
+    }
+
+    if (!memory_timer_) {
+        memory_timer_ = lv_timer_create(memory_timer_cb, MEMORY_CHECK_MS, this);
+    }
+}
+
+void PanelRegistry::memory_timer_cb(lv_timer_t* timer) {
+    auto* self = static_cast<PanelRegistry*>(lv_timer_get_user_data(timer));
+
+    size_t available_kb = read_mem_available_kb();
+    if (available_kb == 0 || available_kb >= self->min_available_kb_) {
+        return;
+    }
+
+    // Decoded images are the cheapest to give back: they're decoded again when next drawn
+    ImageCache::instance().drop_all();
+
+    size_t evicted = self->evict();
+    if (evicted > 0) {
+        spdlog::warn("[PanelRegistry] Low memory ({} KiB available), evicted {} overlay(s)",
+                     available_kb, evicted);
+    }
+}
+
+size_t PanelRegistry::created_count() const {
+    auto created = std::count_if(entries_.begin(), entries_.end(),
+                                 [](const auto& entry) { return entry->obj != nullptr; });
+    return static_cast<size_t>(created);
+}
+
+void PanelRegistry::clear() {
+    for (auto& entry : entries_) {
+        if (entry->obj) {
+            if (entry->on_evict) {
+                entry->on_evict();
+            }
+            lv_obj_delete(entry->obj);
+        }
+    }
+    entries_.clear();
+    prewarm_queue_.clear();
+
+    if (prewarm_timer_) {
+        lv_timer_delete(prewarm_timer_);
+        prewarm_timer_ = nullptr;
+    }
+    set_memory_pressure_threshold(0);
+}
@@ -10,6 +10,7 @@
 #include "ui_panel_bed_mesh.h"
 #include "ui_panel_calibration_pid.h"
 #include "ui_panel_calibration_zoffset.h"
+#include "ui_panel_registry.h"
 
 #include "app_globals.h"
 #include "config.h"
@@ -75,6 +76,7 @@ void SettingsPanel::setup(lv_obj_t* panel, lv_obj_t* parent_screen) {
     setup_toggle_handlers();
     setup_scroll_sliders();
     setup_action_handlers();
+    register_overlays();
     populate_info_rows();
 
     spdlog::info("[{}] Setup complete", get_name());
@@ -513,6 +515,7 @@ void SettingsPanel::show_restart_prompt() {
                         spdlog::info("[SettingsPanel] User requested restart");
                         // Exit the application - user will restart manually
                         // In a real embedded system, this would trigger a system restart
+                        Config::get_instance()->flush();
                         exit(0);
                     },
                     LV_EVENT_CLICKED, nullptr);
@@ -532,127 +535,114 @@ void SettingsPanel::show_restart_prompt() {
     }
 }
 
+void SettingsPanel::register_overlays() {
+    // Overlays are created on first use. These hold no state outside their widget tree
+    // (BedMeshPanel drops its widget pointers on LV_EVENT_DELETE), so they may be evicted
+    // while closed when memory runs low.
+    auto& registry = PanelRegistry::instance();
+    registry.add(
+        "display_settings_overlay", parent_screen_,
+        [this](lv_obj_t* overlay) { setup_display_settings_overlay(overlay); }, [] {});
+    registry.add(
+        "network_settings_overlay", parent_screen_,
+        [this](lv_obj_t* overlay) { setup_network_settings_overlay(overlay); }, [] {});
+    registry.add(
+        "bed_mesh_panel", parent_screen_,
+        [this](lv_obj_t* overlay) {
+            // Setup event handlers and renderer (class-based API)
+            get_global_bed_mesh_panel().setup(overlay, parent_screen_);
+            spdlog::info("[{}] Bed mesh visualization panel created", get_name());
+        },
+        [] {});
+}
+
 void SettingsPanel::handle_display_settings_clicked() {
     spdlog::debug("[{}] Display Settings clicked - opening overlay", get_name());
 
-    // Create display settings overlay on first access (lazy initialization)
-    if (!display_settings_overlay_ && parent_screen_) {
-        spdlog::debug("[{}] Creating display settings overlay...", get_name());
-
-        // Create from XML - component name matches filename
-        display_settings_overlay_ = static_cast<lv_obj_t*>(
-            lv_xml_create(parent_screen_, "display_settings_overlay", nullptr));
-        if (display_settings_overlay_) {
-            // Wire up back button
-            lv_obj_t* header = lv_obj_find_by_name(display_settings_overlay_, "overlay_header");
-            if (header) {
-                lv_obj_t* back_btn = lv_obj_find_by_name(header, "back_button");
-                if (back_btn) {
-                    lv_obj_add_event_cb(
-                        back_btn, [](lv_event_t*) { ui_nav_go_back(); }, LV_EVENT_CLICKED, nullptr);
-                }
-            }
+    // Created on first access (and again after eviction), see register_overlays()
+    lv_obj_t* overlay = PanelRegistry::instance().get("display_settings_overlay");
+    if (overlay) {
+        ui_nav_push_overlay(overlay);
+    }
+}
 
-            // Wire up brightness slider
-            lv_obj_t* brightness_slider =
-                lv_obj_find_by_name(display_settings_overlay_, "brightness_slider");
-            lv_obj_t* brightness_label =
-                lv_obj_find_by_name(display_settings_overlay_, "brightness_value_label");
-            if (brightness_slider && brightness_label) {
-                // Set initial value from settings
-                int brightness = SettingsManager::instance().get_brightness();
-                lv_slider_set_value(brightness_slider, brightness, LV_ANIM_OFF);
-                lv_label_set_text_fmt(brightness_label, "%d%%", brightness);
-
-                // Store label pointer for callback
-                lv_obj_set_user_data(brightness_slider, brightness_label);
-
-                // Wire up value change
-                lv_obj_add_event_cb(
-                    brightness_slider,
-                    [](lv_event_t* e) {
-                        auto* slider = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
-                        int value = lv_slider_get_value(slider);
-                        SettingsManager::instance().set_brightness(value);
-
-                        // Update label
-                        auto* label = static_cast<lv_obj_t*>(lv_obj_get_user_data(slider));
-                        if (label) {
-                            lv_label_set_text_fmt(label, "%d%%", value);
-                        }
-                    },
-                    LV_EVENT_VALUE_CHANGED, nullptr);
-            }
+void SettingsPanel::setup_display_settings_overlay(lv_obj_t* overlay) {
+    // Wire up back button
+    lv_obj_t* header = lv_obj_find_by_name(overlay, "overlay_header");
+    if (header) {
+        lv_obj_t* back_btn = lv_obj_find_by_name(header, "back_button");
+        if (back_btn) {
+            lv_obj_add_event_cb(
+                back_btn, [](lv_event_t*) { ui_nav_go_back(); }, LV_EVENT_CLICKED, nullptr);
+        }
+    }
 
-            // Wire up timeout preset buttons
-            static constexpr struct {
-                const char* name;
-                int seconds;
-            } timeouts[] = {
-                {"timeout_never", 0},   {"timeout_1min", 60},    {"timeout_5min", 300},
-                {"timeout_10min", 600}, {"timeout_30min", 1800},
-            };
-
-            for (const auto& t : timeouts) {
-                lv_obj_t* btn = lv_obj_find_by_name(display_settings_overlay_, t.name);
-                if (btn) {
-                    // Store timeout value as user data (cast int to pointer)
-                    lv_obj_set_user_data(btn,
-                                         reinterpret_cast<void*>(static_cast<intptr_t>(t.seconds)));
-                    lv_obj_add_event_cb(
-                        btn,
-                        [](lv_event_t* e) {
-                            auto* button = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
-                            int seconds = static_cast<int>(
-                                reinterpret_cast<intptr_t>(lv_obj_get_user_data(button)));
-                            SettingsManager::instance().set_display_sleep_sec(seconds);
-                            spdlog::info("Display sleep set to {}s", seconds);
-                        },
-                        LV_EVENT_CLICKED, nullptr);
-                }
-            }
+    // Wire up brightness slider
+    lv_obj_t* brightness_slider = lv_obj_find_by_name(overlay, "brightness_slider");
+    lv_obj_t* brightness_label = lv_obj_find_by_name(overlay, "brightness_value_label");
+    if (brightness_slider && brightness_label) {
+        // Set initial value from settings
+        int brightness = SettingsManager::instance().get_brightness();
+        lv_slider_set_value(brightness_slider, brightness, LV_ANIM_OFF);
+        lv_label_set_text_fmt(brightness_label, "%d%%", brightness);
 
-            // Initially hidden
-            lv_obj_add_flag(display_settings_overlay_, LV_OBJ_FLAG_HIDDEN);
-            spdlog::info("[{}] Display settings overlay created", get_name());
-        } else {
-            spdlog::error("[{}] Failed to create display settings overlay from XML", get_name());
-            return;
+        // Store label pointer for callback
+        lv_obj_set_user_data(brightness_slider, brightness_label);
+
+        // Wire up value change
+        lv_obj_add_event_cb(
+            brightness_slider,
+            [](lv_event_t* e) {
+                auto* slider = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+                int value = lv_slider_get_value(slider);
+                SettingsManager::instance().set_brightness(value);
+
+                // Update label
+                auto* label = static_cast<lv_obj_t*>(lv_obj_get_user_data(slider));
+                if (label) {
+                    lv_label_set_text_fmt(label, "%d%%", value);
+                }
+            },
+            LV_EVENT_VALUE_CHANGED, nullptr);
+    }
+
+    // Wire up timeout preset buttons
+    static constexpr struct {
+        const char* name;
+        int seconds;
+    } timeouts[] = {
+        {"timeout_never", 0},   {"timeout_1min", 60},    {"timeout_5min", 300},
+        {"timeout_10min", 600}, {"timeout_30min", 1800},
+    };
+
+    for (const auto& t : timeouts) {
+        lv_obj_t* btn = lv_obj_find_by_name(overlay, t.name);
+        if (btn) {
+            // Store timeout value as user data (cast int to pointer)
+            lv_obj_set_user_data(btn, reinterpret_cast<void*>(static_cast<intptr_t>(t.seconds)));
+            lv_obj_add_event_cb(
+                btn,
+                [](lv_event_t* e) {
+                    auto* button = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+                    int seconds = static_cast<int>(
+                        reinterpret_cast<intptr_t>(lv_obj_get_user_data(button)));
+                    SettingsManager::instance().set_display_sleep_sec(seconds);
+                    spdlog::info("Display sleep set to {}s", seconds);
+                },
+                LV_EVENT_CLICKED, nullptr);
         }
     }
 
-    // Push overlay onto navigation history and show it
-    if (display_settings_overlay_) {
-        ui_nav_push_overlay(display_settings_overlay_);
-    }
+    spdlog::info("[{}] Display settings overlay created", get_name());
 }
 
 void SettingsPanel::handle_bed_mesh_clicked() {
     spdlog::debug("[{}] Bed Mesh clicked - opening visualization", get_name());
 
-    // Create bed mesh panel on first access (lazy initialization)
-    if (!bed_mesh_panel_ && parent_screen_) {
-        spdlog::debug("[{}] Creating bed mesh visualization panel...", get_name());
-
-        // Create from XML
-        bed_mesh_panel_ =
-            static_cast<lv_obj_t*>(lv_xml_create(parent_screen_, "bed_mesh_panel", nullptr));
-        if (bed_mesh_panel_) {
-            // Setup event handlers and renderer (class-based API)
-            get_global_bed_mesh_panel().setup(bed_mesh_panel_, parent_screen_);
-
-            // Initially hidden
-            lv_obj_add_flag(bed_mesh_panel_, LV_OBJ_FLAG_HIDDEN);
-            spdlog::info("[{}] Bed mesh visualization panel created", get_name());
-        } else {
-            spdlog::error("[{}] Failed to create bed mesh panel from XML", get_name());
-            return;
-        }
-    }
-
-    // Push bed mesh panel onto navigation history and show it
-    if (bed_mesh_panel_) {
-        ui_nav_push_overlay(bed_mesh_panel_);
+    // Created on first access (and again after eviction), see register_overlays()
+    lv_obj_t* overlay = PanelRegistry::instance().get("bed_mesh_panel");
+    if (overlay) {
+        ui_nav_push_overlay(overlay);
     }
 }
 
@@ -719,69 +709,55 @@ void SettingsPanel::handle_pid_tuning_clicked() {
 void SettingsPanel::handle_network_clicked() {
     spdlog::debug("[{}] Network Settings clicked", get_name());
 
-    // Create network settings overlay on first access (lazy initialization)
-    if (!network_settings_overlay_ && parent_screen_) {
-        spdlog::debug("[{}] Creating network settings overlay...", get_name());
-
-        // Create from XML
-        network_settings_overlay_ = static_cast<lv_obj_t*>(
-            lv_xml_create(parent_screen_, "network_settings_overlay", nullptr));
-
-        if (network_settings_overlay_) {
-            // Wire up header bar back button to use nav stack
-            lv_obj_t* header = lv_obj_find_by_name(network_settings_overlay_, "overlay_header");
-            if (header) {
-                lv_obj_t* back_btn = lv_obj_find_by_name(header, "back_button");
-                if (back_btn) {
-                    lv_obj_add_event_cb(
-                        back_btn, [](lv_event_t*) { ui_nav_go_back(); }, LV_EVENT_CLICKED, nullptr);
-                }
-            }
+    // Created on first access (and again after eviction), see register_overlays()
+    lv_obj_t* overlay = PanelRegistry::instance().get("network_settings_overlay");
+    if (overlay) {
+        ui_nav_push_overlay(overlay);
 
-            // Wire up Scan button
-            lv_obj_t* scan_btn = lv_obj_find_by_name(network_settings_overlay_, "scan_btn");
-            if (scan_btn) {
-                lv_obj_add_event_cb(
-                    scan_btn,
-                    [](lv_event_t*) {
-                        spdlog::info("[SettingsPanel] Network scan requested");
-                        // TODO: Trigger WiFiManager scan
-                        // WiFiManager::instance().start_scan(...);
-                    },
-                    LV_EVENT_CLICKED, nullptr);
-            }
-
-            // Wire up Disconnect button
-            lv_obj_t* disconnect_btn =
-                lv_obj_find_by_name(network_settings_overlay_, "disconnect_btn");
-            if (disconnect_btn) {
-                lv_obj_add_event_cb(
-                    disconnect_btn,
-                    [](lv_event_t*) {
-                        spdlog::info("[SettingsPanel] WiFi disconnect requested");
-                        // TODO: Disconnect via WiFiManager
-                        // WiFiManager::instance().disconnect();
-                    },
-                    LV_EVENT_CLICKED, nullptr);
-            }
+        // TODO: Update connection status display
+        // Update connected_ssid, connected_ip labels based on WiFiManager state
+        // Show/hide connected_info vs disconnected_info based on connection state
+    }
+}
 
-            // Initially hidden
-            lv_obj_add_flag(network_settings_overlay_, LV_OBJ_FLAG_HIDDEN);
-            spdlog::info("[{}] Network settings overlay created", get_name());
-        } else {
-            spdlog::error("[{}] Failed to create network settings overlay from XML", get_name());
-            return;
+void SettingsPanel::setup_network_settings_overlay(lv_obj_t* overlay) {
+    // Wire up header bar back button to use nav stack
+    lv_obj_t* header = lv_obj_find_by_name(overlay, "overlay_header");
+    if (header) {
+        lv_obj_t* back_btn = lv_obj_find_by_name(header, "back_button");
+        if (back_btn) {
+            lv_obj_add_event_cb(
+                back_btn, [](lv_event_t*) { ui_nav_go_back(); }, LV_EVENT_CLICKED, nullptr);
         }
     }
 
-    // Push overlay onto navigation history and show it with slide animation
-    if (network_settings_overlay_) {
-        ui_nav_push_overlay(network_settings_overlay_);
+    // Wire up Scan button
+    lv_obj_t* scan_btn = lv_obj_find_by_name(overlay, "scan_btn");
+    if (scan_btn) {
+        lv_obj_add_event_cb(
+            scan_btn,
+            [](lv_event_t*) {
+                spdlog::info("[SettingsPanel] Network scan requested");
+                // TODO: Trigger WiFiManager scan
+                // WiFiManager::instance().start_scan(...);
+            },
+            LV_EVENT_CLICKED, nullptr);
+    }
 
-        // TODO: Update connection status display
-        // Update connected_ssid, connected_ip labels based on WiFiManager state
-        // Show/hide connected_info vs disconnected_info based on connection state
+    // Wire up Disconnect button
+    lv_obj_t* disconnect_btn = lv_obj_find_by_name(overlay, "disconnect_btn");
+    if (disconnect_btn) {
+        lv_obj_add_event_cb(
+            disconnect_btn,
+            [](lv_event_t*) {
+                spdlog::info("[SettingsPanel] WiFi disconnect requested");
+                // TODO: Disconnect via WiFiManager
+                // WiFiManager::instance().disconnect();
+            },
+            LV_EVENT_CLICKED, nullptr);
     }
+
+    spdlog::info("[{}] Network settings overlay created", get_name());
 }
 
 void SettingsPanel::handle_factory_reset_clicked() {
@@ -838,7 +814,9 @@ void SettingsPanel::handle_factory_reset_clicked() {
                 Config* config = Config::get_instance();
                 if (config) {
                     config->reset_to_defaults();
+                    // Written now, not debounced: a restart or power-off usually follows
                     config->save();
+                    config->flush();
                     spdlog::info("[SettingsPanel] Config reset to defaults");
                 }
 
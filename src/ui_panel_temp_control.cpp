@@ -15,9 +15,11 @@
 #include "app_constants.h"
 #include "moonraker_api.h"
 #include "printer_state.h"
+#include "temperature_history.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <ctime>
@@ -31,6 +33,7 @@ TempControlPanel::TempControlPanel(PrinterState& printer_state, MoonrakerAPI* ap
       bed_max_temp_(AppConstants::Temperature::DEFAULT_BED_MAX) {
     nozzle_config_ = {.type = HEATER_NOZZLE,
                       .name = "Nozzle",
+                      .object_name = "extruder",
                       .title = "Nozzle Temperature",
                       .color = lv_color_hex(0xFF4444),
                       .temp_range_max = 320.0f,
@@ -40,6 +43,7 @@ TempControlPanel::TempControlPanel(PrinterState& printer_state, MoonrakerAPI* ap
 
     bed_config_ = {.type = HEATER_BED,
                    .name = "Bed",
+                   .object_name = "heater_bed",
                    .title = "Heatbed Temperature",
                    .color = lv_color_hex(0x00CED1),
                    .temp_range_max = 140.0f,
@@ -102,38 +106,14 @@ void TempControlPanel::on_nozzle_temp_changed(int temp_centi) {
     update_nozzle_display();
     update_nozzle_status(); // Update status text and heating icon state
 
-    // Always store in history buffer (even before subjects initialized)
-    // This ensures we capture data from app start
-    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                         std::chrono::system_clock::now().time_since_epoch())
-                         .count();
-
-    int write_idx = nozzle_history_count_ % TEMP_HISTORY_SIZE;
-    nozzle_history_[write_idx] = {temp_centi, now_ms};
-    nozzle_history_count_++;
-
-    // Guard: don't track graph points until subjects initialized
+    // Guard: don't touch graph subjects until initialized
+    // (PrinterState records every reading into TemperatureHistory regardless)
     if (!subjects_initialized_) {
         return;
     }
 
-    // Track timestamp on first point (for X-axis labels)
-    if (nozzle_start_time_ms_ == 0) {
-        nozzle_start_time_ms_ = now_ms;
-    }
-    nozzle_point_count_++;
-
-    // Update subject for reactive X-axis label visibility
-    lv_subject_set_int(&nozzle_graph_points_subject_, nozzle_point_count_);
-
-    // Push to graph if it exists (convert centidegrees to degrees with 0.1°C precision)
-    if (nozzle_graph_ && nozzle_series_id_ >= 0) {
-        float temp_deg = static_cast<float>(temp_centi) / 10.0f;
-        ui_temp_graph_update_series(nozzle_graph_, nozzle_series_id_, temp_deg);
-        update_x_axis_labels(nozzle_x_labels_, nozzle_start_time_ms_, nozzle_point_count_);
-        spdlog::trace("[TempPanel] Nozzle graph updated: {:.1f}°C (point #{})", temp_deg,
-                      nozzle_point_count_);
-    }
+    update_graph_from_history(nozzle_graph_, nozzle_config_, &nozzle_graph_points_subject_,
+                              nozzle_x_labels_);
 }
 
 void TempControlPanel::on_nozzle_target_changed(int target_centi) {
@@ -156,38 +136,13 @@ void TempControlPanel::on_bed_temp_changed(int temp_centi) {
     update_bed_display();
     update_bed_status(); // Update status text and heating icon state
 
-    // Always store in history buffer (even before subjects initialized)
-    // This ensures we capture data from app start
-    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                         std::chrono::system_clock::now().time_since_epoch())
-                         .count();
-
-    int write_idx = bed_history_count_ % TEMP_HISTORY_SIZE;
-    bed_history_[write_idx] = {temp_centi, now_ms};
-    bed_history_count_++;
-
-    // Guard: don't track graph points until subjects initialized
+    // Guard: don't touch graph subjects until initialized
+    // (PrinterState records every reading into TemperatureHistory regardless)
     if (!subjects_initialized_) {
         return;
     }
 
-    // Track timestamp on first point (for X-axis labels)
-    if (bed_start_time_ms_ == 0) {
-        bed_start_time_ms_ = now_ms;
-    }
-    bed_point_count_++;
-
-    // Update subject for reactive X-axis label visibility
-    lv_subject_set_int(&bed_graph_points_subject_, bed_point_count_);
-
-    // Push to graph if it exists (convert centidegrees to degrees with 0.1°C precision)
-    if (bed_graph_ && bed_series_id_ >= 0) {
-        float temp_deg = static_cast<float>(temp_centi) / 10.0f;
-        ui_temp_graph_update_series(bed_graph_, bed_series_id_, temp_deg);
-        update_x_axis_labels(bed_x_labels_, bed_start_time_ms_, bed_point_count_);
-        spdlog::trace("[TempPanel] Bed graph updated: {:.1f}°C (point #{})", temp_deg,
-                      bed_point_count_);
-    }
+    update_graph_from_history(bed_graph_, bed_config_, &bed_graph_points_subject_, bed_x_labels_);
 }
 
 void TempControlPanel::on_bed_target_changed(int target_centi) {
@@ -353,8 +308,10 @@ ui_temp_graph_t* TempControlPanel::create_temp_graph(lv_obj_t* chart_area,
         ui_temp_graph_set_series_target(graph, series_id, static_cast<float>(target_temp),
                                         show_target);
 
-        // Graph starts empty - real-time data comes from PrinterState observers
-        spdlog::debug("[TempPanel] {} graph created (awaiting live data)", config->name);
+        // The graph is a view over TemperatureHistory, so it opens with history already drawn
+        ui_temp_graph_bind_history(graph, series_id, config->object_name);
+        spdlog::debug("[TempPanel] {} graph created (history '{}')", config->name,
+                      config->object_name);
     }
 
     return graph;
@@ -687,8 +644,9 @@ void TempControlPanel::setup_nozzle_panel(lv_obj_t* panel, lv_obj_t* parent_scre
         create_x_axis_labels(x_axis_labels, nozzle_x_labels_);
     }
 
-    // Replay buffered temperature history to graph (shows data from app start)
-    replay_nozzle_history_to_graph();
+    // Label the history the graph opened with
+    update_graph_from_history(nozzle_graph_, nozzle_config_, &nozzle_graph_points_subject_,
+                              nozzle_x_labels_);
 
     // Wire up confirm button
     lv_obj_t* header = lv_obj_find_by_name(panel, "overlay_header");
@@ -766,8 +724,8 @@ void TempControlPanel::setup_bed_panel(lv_obj_t* panel, lv_obj_t* parent_screen)
         create_x_axis_labels(x_axis_labels, bed_x_labels_);
     }
 
-    // Replay buffered temperature history to graph (shows data from app start)
-    replay_bed_history_to_graph();
+    // Label the history the graph opened with
+    update_graph_from_history(bed_graph_, bed_config_, &bed_graph_points_subject_, bed_x_labels_);
 
     // Wire up confirm button
     lv_obj_t* header = lv_obj_find_by_name(panel, "overlay_header");
@@ -906,100 +864,27 @@ void TempControlPanel::set_bed_limits(int min_temp, int max_temp) {
     spdlog::debug("[TempPanel] Bed limits updated: {}-{}°C", min_temp, max_temp);
 }
 
-void TempControlPanel::replay_nozzle_history_to_graph() {
-    if (!nozzle_graph_ || nozzle_series_id_ < 0 || nozzle_history_count_ == 0) {
+void TempControlPanel::update_graph_from_history(
+    ui_temp_graph_t* graph, const heater_config_t& config, lv_subject_t* points_subject,
+    std::array<lv_obj_t*, X_AXIS_LABEL_COUNT>& labels) {
+    int64_t oldest_ms = 0;
+    int64_t newest_ms = 0;
+    if (!TemperatureHistory::instance().get_time_range(config.object_name, &oldest_ms,
+                                                       &newest_ms)) {
         return;
     }
 
-    // Determine how many samples to replay (up to TEMP_HISTORY_SIZE)
-    int samples_to_replay = std::min(nozzle_history_count_, TEMP_HISTORY_SIZE);
-
-    // Find the oldest sample index
-    int start_idx;
-    if (nozzle_history_count_ <= TEMP_HISTORY_SIZE) {
-        // Buffer hasn't wrapped yet - start from 0
-        start_idx = 0;
-    } else {
-        // Buffer has wrapped - oldest is at current write position
-        start_idx = nozzle_history_count_ % TEMP_HISTORY_SIZE;
-    }
-
-    // Get timestamp of first sample for X-axis reference
-    nozzle_start_time_ms_ = nozzle_history_[start_idx].timestamp_ms;
-    nozzle_point_count_ = samples_to_replay;
-
-    // Update point count subject for X-axis label visibility
-    lv_subject_set_int(&nozzle_graph_points_subject_, nozzle_point_count_);
-
-    // Replay all samples in chronological order
-    // Skip zero values (no valid data yet) to avoid graphing uninitialized entries
-    // Convert centidegrees to degrees for graph display
-    int replayed = 0;
-    for (int i = 0; i < samples_to_replay; i++) {
-        int idx = (start_idx + i) % TEMP_HISTORY_SIZE;
-        int temp_centi = nozzle_history_[idx].temp;
-        if (temp_centi == 0) {
-            continue; // Skip uninitialized/zero entries
-        }
-        float temp_deg = static_cast<float>(temp_centi) / 10.0f;
-        ui_temp_graph_update_series(nozzle_graph_, nozzle_series_id_, temp_deg);
-        replayed++;
-    }
-
-    // Update X-axis labels
-    update_x_axis_labels(nozzle_x_labels_, nozzle_start_time_ms_, nozzle_point_count_);
-
-    if (replayed > 0) {
-        spdlog::info("[TempPanel] Replayed {} nozzle temp samples to graph (skipped {} zeros)",
-                     replayed, samples_to_replay - replayed);
-    }
-}
+    // Seconds of history inside the graph window (samples are stored at ~1 Hz)
+    int64_t start_ms = std::max(oldest_ms, newest_ms - int64_t{UI_TEMP_GRAPH_DEFAULT_WINDOW_MS});
+    int visible_seconds = static_cast<int>((newest_ms - start_ms) / 1000) + 1;
 
-void TempControlPanel::replay_bed_history_to_graph() {
-    if (!bed_graph_ || bed_series_id_ < 0 || bed_history_count_ == 0) {
-        return;
-    }
-
-    // Determine how many samples to replay (up to TEMP_HISTORY_SIZE)
-    int samples_to_replay = std::min(bed_history_count_, TEMP_HISTORY_SIZE);
-
-    // Find the oldest sample index
-    int start_idx;
-    if (bed_history_count_ <= TEMP_HISTORY_SIZE) {
-        // Buffer hasn't wrapped yet - start from 0
-        start_idx = 0;
-    } else {
-        // Buffer has wrapped - oldest is at current write position
-        start_idx = bed_history_count_ % TEMP_HISTORY_SIZE;
-    }
-
-    // Get timestamp of first sample for X-axis reference
-    bed_start_time_ms_ = bed_history_[start_idx].timestamp_ms;
-    bed_point_count_ = samples_to_replay;
-
-    // Update point count subject for X-axis label visibility
-    lv_subject_set_int(&bed_graph_points_subject_, bed_point_count_);
-
-    // Replay all samples in chronological order
-    // Skip zero values (no valid data yet) to avoid graphing uninitialized entries
-    // Convert centidegrees to degrees for graph display
-    int replayed = 0;
-    for (int i = 0; i < samples_to_replay; i++) {
-        int idx = (start_idx + i) % TEMP_HISTORY_SIZE;
-        int temp_centi = bed_history_[idx].temp;
-        if (temp_centi == 0) {
-            continue; // Skip uninitialized/zero entries
-        }
-        float temp_deg = static_cast<float>(temp_centi) / 10.0f;
-        ui_temp_graph_update_series(bed_graph_, bed_series_id_, temp_deg);
-        replayed++;
-    }
-
-    // Update X-axis labels
-    update_x_axis_labels(bed_x_labels_, bed_start_time_ms_, bed_point_count_);
+    // Update subject for reactive X-axis label visibility
+    lv_subject_set_int(points_subject, visible_seconds);
 
-    if (replayed > 0) {
-        spdlog::info("[TempPanel] Replayed {} bed temp samples to graph (skipped {} zeros)",
-                     replayed, samples_to_replay - replayed);
+    // Redraws only when the sensor's history changed since the last refresh
+    if (graph && ui_temp_graph_refresh_history(graph)) {
+        spdlog::trace("[TempPanel] {} graph refreshed ({}s of history)", config.name,
+                      visible_seconds);
     }
+    update_x_axis_labels(labels, start_ms, visible_seconds);
 }
@@ -0,0 +1,114 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_splash_screen.h"
+
+#include "image_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <string>
+
+namespace {
+
+const char* const LOGO_PATH = "A:assets/images/helixscreen-logo.png";
+
+void opa_anim_cb(void* obj, int32_t value) {
+    lv_obj_set_style_opa(static_cast<lv_obj_t*>(obj), static_cast<lv_opa_t>(value),
+                         LV_PART_MAIN);
+}
+
+} // namespace
+
+void SplashScreen::show(lv_display_t* display, bool dark_mode) {
+    if (overlay_ || !display) {
+        return;
+    }
+    display_ = display;
+
+    // Full-screen background on the top layer; clickable so touches during startup don't
+    // reach the UI being built beneath it
+    overlay_ = lv_obj_create(lv_display_get_layer_top(display));
+    lv_obj_remove_style_all(overlay_);
+    lv_obj_set_size(overlay_, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(overlay_,
+                              lv_color_hex(dark_mode ? BG_COLOR_DARK : BG_COLOR_LIGHT),
+                              LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(overlay_, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_add_flag(overlay_, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_SCROLLABLE);
+
+    // Logo sized like helix-splash: 60% of the width, 50% on tiny screens
+    std::string logo_src = ImageCache::instance().resolve(LOGO_PATH);
+    logo_ = lv_image_create(overlay_);
+    lv_image_set_src(logo_, logo_src.c_str());
+    lv_obj_center(logo_);
+    lv_obj_set_style_opa(logo_, LV_OPA_TRANSP, LV_PART_MAIN);
+
+    int32_t width = lv_display_get_horizontal_resolution(display);
+    int32_t height = lv_display_get_vertical_resolution(display);
+    lv_image_header_t header;
+    if (lv_image_decoder_get_info(logo_src.c_str(), &header) == LV_RESULT_OK && header.w > 0) {
+        int32_t target_size = height < 500 ? width / 2 : (width * 3) / 5;
+        lv_image_set_scale(logo_, static_cast<uint32_t>(target_size * 256) / header.w);
+    } else {
+        spdlog::warn("[Splash] Could not get logo dimensions, using default scale");
+        lv_image_set_scale(logo_, 128);
+    }
+
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, logo_);
+    lv_anim_set_values(&anim, LV_OPA_TRANSP, LV_OPA_COVER);
+    lv_anim_set_duration(&anim, FADE_IN_MS);
+    lv_anim_set_path_cb(&anim, lv_anim_path_ease_in);
+    lv_anim_set_exec_cb(&anim, opa_anim_cb);
+    lv_anim_start(&anim);
+
+    // Objects under a hidden parent are neither invalidated nor drawn, so the UI can be
+    // built on the screen without redrawing it on every pump()
+    hidden_screen_ = lv_display_get_screen_active(display);
+    if (hidden_screen_) {
+        lv_obj_add_flag(hidden_screen_, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    lv_refr_now(display);
+    spdlog::debug("[Splash] Shown");
+}
+
+void SplashScreen::pump() {
+    if (!overlay_) {
+        return;
+    }
+    lv_refr_now(display_); // Advances animations first
+}
+
+void SplashScreen::dismiss() {
+    if (!overlay_) {
+        return;
+    }
+
+    if (hidden_screen_) {
+        lv_obj_clear_flag(hidden_screen_, LV_OBJ_FLAG_HIDDEN);
+        hidden_screen_ = nullptr;
+    }
+
+    // Let touches through to the UI while fading out
+    lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_CLICKABLE);
+    lv_anim_delete(logo_, opa_anim_cb);
+    lv_obj_set_style_opa(logo_, LV_OPA_COVER, LV_PART_MAIN);
+
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, overlay_);
+    lv_anim_set_values(&anim, LV_OPA_COVER, LV_OPA_TRANSP);
+    lv_anim_set_duration(&anim, FADE_OUT_MS);
+    lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
+    lv_anim_set_exec_cb(&anim, opa_anim_cb);
+    lv_anim_set_completed_cb(&anim, lv_obj_delete_anim_completed_cb);
+    lv_anim_start(&anim);
+
+    overlay_ = nullptr;
+    logo_ = nullptr;
+    spdlog::debug("[Splash] Dismissed");
+}
@@ -25,9 +25,13 @@
 
 #include "ui_theme.h"
 
+#include "temperature_history.h"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -59,6 +63,19 @@ static lv_color_t mute_color(lv_color_t color, lv_opa_t opa) {
     return lv_color_make(r, g, b);
 }
 
+// Helper: Gradient fill opacity at a height fraction (0 = chart top, 255 = chart bottom)
+static lv_opa_t gradient_opa(lv_opa_t top_opa, lv_opa_t bottom_opa, int32_t fract) {
+    return static_cast<lv_opa_t>(top_opa - (top_opa - bottom_opa) * fract / 255);
+}
+
+// Helper: Precompute a series' fill opacity for every height fraction
+static void rebuild_gradient_lut(ui_temp_series_meta_t* meta) {
+    for (int32_t fract = 0; fract < UI_TEMP_GRAPH_GRADIENT_LUT_SIZE; fract++) {
+        meta->gradient_lut[fract] =
+            gradient_opa(meta->gradient_top_opa, meta->gradient_bottom_opa, fract);
+    }
+}
+
 // Helper: Convert temperature value to pixel Y coordinate
 // LVGL chart cursor position is relative to object's top-left corner,
 // but data is plotted in the content area (after padding).
@@ -97,12 +114,116 @@ static void update_all_cursor_positions(ui_temp_graph_t* graph) {
     }
 }
 
-// Event callback: Recalculate cursor positions when chart is resized
+// Revision marker forcing a bound series to redraw on the next refresh
+static constexpr uint64_t HISTORY_REVISION_STALE = UINT64_MAX;
+
+// Helper: Point count for history-bound series (two points per min/max bucket)
+static int history_point_count(ui_temp_graph_t* graph) {
+    int32_t width = lv_obj_get_content_width(graph->chart);
+    if (width <= 0) {
+        return graph->point_count; // Chart not laid out yet
+    }
+    return std::max(2, static_cast<int>(width / UI_TEMP_GRAPH_PIXELS_PER_BUCKET) * 2);
+}
+
+// Helper: (Re)allocate a bound series' point buffer and hand it to the chart
+static void attach_history_points(ui_temp_graph_t* graph, ui_temp_series_meta_t* meta,
+                                  int point_count) {
+    int32_t* points = new int32_t[static_cast<size_t>(point_count)];
+    std::fill(points, points + point_count, LV_CHART_POINT_NONE);
+    lv_chart_set_ext_y_array(graph->chart, meta->chart_series, points);
+    delete[] meta->history_points;
+    meta->history_points = points;
+    meta->history_revision = HISTORY_REVISION_STALE; // Redraw into the new buffer
+}
+
+// Helper: Redraw one bound series from the history store
+// Returns the index of the first point whose value changed (point_count if none did)
+static int draw_history_series(ui_temp_graph_t* graph, ui_temp_series_meta_t* meta) {
+    const size_t bucket_count = static_cast<size_t>(graph->point_count / 2);
+    if (bucket_count == 0) {
+        return graph->point_count;
+    }
+    const int64_t bucket_ms = std::max<int64_t>(graph->history_window_ms /
+                                                    static_cast<int64_t>(bucket_count),
+                                                1);
+
+    int32_t* points = meta->history_points;
+    int first_changed = graph->point_count;
+    auto put = [&](int index, int32_t value) {
+        if (points[index] != value) {
+            points[index] = value;
+            first_changed = std::min(first_changed, index);
+        }
+    };
+
+    auto& history = TemperatureHistory::instance();
+    int64_t newest_ms = 0;
+    if (!history.get_time_range(meta->history_sensor, nullptr, &newest_ms)) {
+        for (int i = 0; i < graph->point_count; i++) {
+            put(i, LV_CHART_POINT_NONE);
+        }
+        return first_changed;
+    }
+
+    // Align the window to whole buckets so min/max values don't shimmer as it scrolls
+    int64_t end_ms = (newest_ms / bucket_ms + 1) * bucket_ms;
+    int64_t start_ms = end_ms - bucket_ms * static_cast<int64_t>(bucket_count);
+
+    static std::vector<TemperatureBucket> buckets; // UI thread only; reused across redraws
+    buckets.resize(bucket_count);
+    history.decimate(meta->history_sensor, start_ms, end_ms, buckets.data(), bucket_count);
+
+    // Each bucket becomes two points in the order the extremes occurred (degrees).
+    // Unchanged points are left alone so the caller can invalidate just the changed strip.
+    int index = 0;
+    for (const auto& bucket : buckets) {
+        if (!bucket.valid) {
+            put(index++, LV_CHART_POINT_NONE);
+            put(index++, LV_CHART_POINT_NONE);
+            continue;
+        }
+        int32_t lo = bucket.min_centi / 10;
+        int32_t hi = bucket.max_centi / 10;
+        put(index++, bucket.min_first ? lo : hi);
+        put(index++, bucket.min_first ? hi : lo);
+    }
+    // Odd point counts leave one trailing slot
+    if (index < graph->point_count) {
+        put(index, LV_CHART_POINT_NONE);
+    }
+    return first_changed;
+}
+
+// Helper: Invalidate the chart from a point index to its right edge
+// The segment leading into the first changed point changes too, as does the gradient fill
+// below it, so the strip starts one point earlier and spans the full chart height.
+static void invalidate_from_point(ui_temp_graph_t* graph, int first_point) {
+    if (first_point <= 0 || graph->point_count < 2) {
+        lv_obj_invalidate(graph->chart);
+        return;
+    }
+
+    lv_area_t content;
+    lv_obj_get_content_coords(graph->chart, &content);
+    int32_t width = lv_area_get_width(&content);
+    int32_t line_width = lv_obj_get_style_line_width(graph->chart, LV_PART_ITEMS);
+    int32_t x = content.x1 + static_cast<int32_t>(static_cast<int64_t>(width) * (first_point - 1) /
+                                                  (graph->point_count - 1));
+
+    lv_area_t strip;
+    lv_obj_get_coords(graph->chart, &strip);
+    strip.x1 = LV_MAX(strip.x1, x - line_width);
+    lv_obj_invalidate_area(graph->chart, &strip);
+}
+
+// Event callback: Recalculate cursor positions and bound history when chart is resized
 static void chart_resize_cb(lv_event_t* e) {
     lv_obj_t* chart = lv_event_get_target_obj(e);
     ui_temp_graph_t* graph = static_cast<ui_temp_graph_t*>(lv_obj_get_user_data(chart));
     if (graph) {
         update_all_cursor_positions(graph);
+        ui_temp_graph_refresh_history(graph);
     }
 }
 
@@ -151,6 +272,9 @@ static void draw_task_cb(lv_event_t* e) {
     lv_opa_t top_opa = meta ? meta->gradient_top_opa : UI_TEMP_GRAPH_GRADIENT_TOP_OPA;
     lv_opa_t bottom_opa = meta ? meta->gradient_bottom_opa : UI_TEMP_GRAPH_GRADIENT_BOTTOM_OPA;
     lv_color_t ser_color = line_dsc->color;
+    if (top_opa == LV_OPA_TRANSP && bottom_opa == LV_OPA_TRANSP) {
+        return; // Fill disabled for this series
+    }
 
     // Calculate opacity fractions based on Y position within chart
     // Higher Y = lower on screen = closer to bottom = more transparent
@@ -159,12 +283,15 @@ static void draw_task_cb(lv_event_t* e) {
         (int32_t)(LV_MIN(line_dsc->p1.y, line_dsc->p2.y) - coords.y1) * 255 / full_h;
     int32_t fract_lower =
         (int32_t)(LV_MAX(line_dsc->p1.y, line_dsc->p2.y) - coords.y1) * 255 / full_h;
+    fract_upper = LV_CLAMP(0, fract_upper, UI_TEMP_GRAPH_GRADIENT_LUT_SIZE - 1);
+    fract_lower = LV_CLAMP(0, fract_lower, UI_TEMP_GRAPH_GRADIENT_LUT_SIZE - 1);
 
-    // Calculate interpolated opacity at each point (top_opa at top, bottom_opa at bottom)
-    lv_opa_t opa_upper =
-        static_cast<lv_opa_t>(top_opa - (top_opa - bottom_opa) * fract_upper / 255);
-    lv_opa_t opa_lower =
-        static_cast<lv_opa_t>(top_opa - (top_opa - bottom_opa) * fract_lower / 255);
+    // Interpolated opacity at each point (top_opa at top, bottom_opa at bottom),
+    // precomputed per series so the per-segment cost is two table lookups
+    lv_opa_t opa_upper = meta ? meta->gradient_lut[fract_upper]
+                              : gradient_opa(top_opa, bottom_opa, fract_upper);
+    lv_opa_t opa_lower = meta ? meta->gradient_lut[fract_lower]
+                              : gradient_opa(top_opa, bottom_opa, fract_lower);
 
     // Draw triangle from line segment down to the lower of the two points
     // This fills the gap between the line and a horizontal at the lower point
@@ -232,6 +359,7 @@ ui_temp_graph_t* ui_temp_graph_create(lv_obj_t* parent) {
     graph->max_temp = UI_TEMP_GRAPH_DEFAULT_MAX_TEMP;
     graph->series_count = 0;
     graph->next_series_id = 0;
+    graph->history_window_ms = UI_TEMP_GRAPH_DEFAULT_WINDOW_MS;
 
     // Create LVGL chart
     graph->chart = lv_chart_create(parent);
@@ -307,6 +435,11 @@ void ui_temp_graph_destroy(ui_temp_graph_t* graph) {
         lv_obj_del(graph_ptr->chart);
     }
 
+    // History point buffers are not owned by LVGL
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        delete[] graph_ptr->series_meta[i].history_points;
+    }
+
     // graph_ptr automatically freed via ~unique_ptr()
     spdlog::debug("[TempGraph] Destroyed");
 }
@@ -361,6 +494,7 @@ int ui_temp_graph_add_series(ui_temp_graph_t* graph, const char* name, lv_color_
     meta->target_temp = 0.0f;
     meta->gradient_bottom_opa = UI_TEMP_GRAPH_GRADIENT_BOTTOM_OPA;
     meta->gradient_top_opa = UI_TEMP_GRAPH_GRADIENT_TOP_OPA;
+    rebuild_gradient_lut(meta);
 
     // Create target temperature cursor (horizontal line, initially hidden)
     // Note: We don't use lv_chart_set_cursor_point because that binds the cursor
@@ -392,8 +526,9 @@ void ui_temp_graph_remove_series(ui_temp_graph_t* graph, int series_id) {
         meta->target_cursor = nullptr;
     }
 
-    // Remove chart series
+    // Remove chart series (a bound series' point buffer is ours to free)
     lv_chart_remove_series(graph->chart, meta->chart_series);
+    delete[] meta->history_points;
 
     // Clear metadata
     memset(meta, 0, sizeof(ui_temp_series_meta_t));
@@ -431,6 +566,12 @@ void ui_temp_graph_update_series(ui_temp_graph_t* graph, int series_id, float te
         return;
     }
 
+    if (meta->history_sensor[0] != '\0') {
+        spdlog::trace("[TempGraph] Series {} is bound to history, ignoring pushed point",
+                      series_id);
+        return;
+    }
+
     // Add point to series (shifts old data left)
     lv_chart_set_next_value(graph->chart, meta->chart_series, (int32_t)temp);
 }
@@ -444,6 +585,11 @@ void ui_temp_graph_set_series_data(ui_temp_graph_t* graph, int series_id, const
         return;
     }
 
+    if (meta->history_sensor[0] != '\0') {
+        spdlog::warn("[TempGraph] Series {} is bound to history, ignoring data array", series_id);
+        return;
+    }
+
     // Clear existing data using public API
     lv_chart_set_all_values(graph->chart, meta->chart_series, LV_CHART_POINT_NONE);
 
@@ -500,6 +646,87 @@ void ui_temp_graph_clear_series(ui_temp_graph_t* graph, int series_id) {
     spdlog::debug("[TempGraph] Series {} '{}' cleared", series_id, meta->name);
 }
 
+// Bind a series to the central temperature history
+void ui_temp_graph_bind_history(ui_temp_graph_t* graph, int series_id, const char* sensor) {
+    ui_temp_series_meta_t* meta = find_series(graph, series_id);
+    if (!meta || !sensor || sensor[0] == '\0') {
+        spdlog::error("[TempGraph] Invalid history binding for series {}", series_id);
+        return;
+    }
+
+    strncpy(meta->history_sensor, sensor, sizeof(meta->history_sensor) - 1);
+    meta->history_sensor[sizeof(meta->history_sensor) - 1] = '\0';
+
+    lv_obj_update_layout(graph->chart); // Size the buffer to the laid-out width
+    int point_count = history_point_count(graph);
+    if (point_count != graph->point_count) {
+        ui_temp_graph_set_point_count(graph, point_count);
+    } else {
+        attach_history_points(graph, meta, point_count);
+    }
+    ui_temp_graph_refresh_history(graph);
+
+    spdlog::debug("[TempGraph] Series {} '{}' bound to history '{}' ({} points)", series_id,
+                  meta->name, meta->history_sensor, graph->point_count);
+}
+
+// Redraw bound series whose history changed
+bool ui_temp_graph_refresh_history(ui_temp_graph_t* graph) {
+    if (!graph)
+        return false;
+
+    // Follow the chart width (reallocates every bound buffer)
+    int point_count = history_point_count(graph);
+    bool has_bound = false;
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        has_bound |= graph->series_meta[i].chart_series && graph->series_meta[i].history_points;
+    }
+    if (!has_bound) {
+        return false;
+    }
+    if (point_count != graph->point_count) {
+        ui_temp_graph_set_point_count(graph, point_count);
+    }
+
+    auto& history = TemperatureHistory::instance();
+    int first_changed = graph->point_count;
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        ui_temp_series_meta_t* meta = &graph->series_meta[i];
+        if (!meta->chart_series || !meta->history_points) {
+            continue;
+        }
+
+        uint64_t revision = history.revision(meta->history_sensor);
+        if (revision == meta->history_revision) {
+            continue;
+        }
+        first_changed = std::min(first_changed, draw_history_series(graph, meta));
+        meta->history_revision = revision;
+    }
+
+    if (first_changed >= graph->point_count) {
+        return false; // Coalesced readings that didn't move any point
+    }
+    invalidate_from_point(graph, first_changed);
+    return true;
+}
+
+// Set the history window
+void ui_temp_graph_set_history_window(ui_temp_graph_t* graph, int64_t window_ms) {
+    if (!graph || window_ms <= 0) {
+        spdlog::error("[TempGraph] Invalid history window");
+        return;
+    }
+
+    graph->history_window_ms = window_ms;
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        graph->series_meta[i].history_revision = HISTORY_REVISION_STALE; // Redraw new span
+    }
+    ui_temp_graph_refresh_history(graph);
+
+    spdlog::debug("[TempGraph] History window set: {}s", window_ms / 1000);
+}
+
 // Set target temperature and visibility
 void ui_temp_graph_set_series_target(ui_temp_graph_t* graph, int series_id, float target,
                                      bool show) {
@@ -509,6 +736,12 @@ void ui_temp_graph_set_series_target(ui_temp_graph_t* graph, int series_id, floa
         return;
     }
 
+    // Target subjects fire on every status update; skip the relayout and redraw when
+    // nothing changed (resizes reposition the cursor through chart_resize_cb)
+    if (meta->target_temp == target && meta->show_target == show) {
+        return;
+    }
+
     // Store the value (used for recalculation on resize)
     meta->target_temp = target;
     meta->show_target = show;
@@ -565,6 +798,14 @@ void ui_temp_graph_set_point_count(ui_temp_graph_t* graph, int count) {
     }
 
     graph->point_count = count;
+
+    // History-bound series draw from their own buffers, which must match the new count
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        ui_temp_series_meta_t* meta = &graph->series_meta[i];
+        if (meta->chart_series && meta->history_sensor[0] != '\0') {
+            attach_history_points(graph, meta, count);
+        }
+    }
     lv_chart_set_point_count(graph->chart, static_cast<uint32_t>(count));
 
     spdlog::debug("[TempGraph] Point count set: {}", count);
@@ -581,6 +822,7 @@ void ui_temp_graph_set_series_gradient(ui_temp_graph_t* graph, int series_id, lv
 
     meta->gradient_bottom_opa = bottom_opa;
     meta->gradient_top_opa = top_opa;
+    rebuild_gradient_lut(meta);
 
     lv_obj_invalidate(graph->chart);
 
@@ -25,6 +25,7 @@
 
 #include "ui_error_reporting.h"
 #include "ui_fonts.h"
+#include "ui_xml_bundle.h"
 
 #include "helix_theme.h"
 #include "lvgl/lvgl.h"
@@ -35,8 +36,6 @@
 
 #include <cstdlib>
 #include <cstring>
-#include <fstream>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -108,17 +107,13 @@ static std::vector<std::string> parse_globals_for_suffix(const char* element_typ
                                                          const char* suffix) {
     std::vector<std::string> result;
 
-    std::ifstream file("ui_xml/globals.xml");
-    if (!file.is_open()) {
-        NOTIFY_ERROR("Could not open ui_xml/globals.xml for {} pattern matching", element_type);
+    // Compiled-in copy when built with the XML bundle, ui_xml/globals.xml otherwise
+    std::string xml_content = ui_xml_read_component("globals");
+    if (xml_content.empty()) {
+        NOTIFY_ERROR("Could not read globals.xml for {} pattern matching", element_type);
         return result;
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string xml_content = buffer.str();
-    file.close();
-
     SuffixParserData parser_data = {element_type, suffix, {}};
     XML_Parser parser = XML_ParserCreate(nullptr);
     XML_SetUserData(parser, &parser_data);
@@ -541,7 +541,8 @@ void ui_wizard_complete() {
     if (config) {
         spdlog::debug("[Wizard] Setting wizard_completed flag");
         config->set<bool>("/wizard_completed", true);
-        if (!config->save()) {
+        // Written now, not debounced: the printer is often powered off right after setup
+        if (!config->save() || !config->flush()) {
             NOTIFY_ERROR("Failed to save setup completion");
         }
     } else {
@@ -9,9 +9,11 @@
 #include "ui_modal.h"
 #include "ui_subject_registry.h"
 #include "ui_theme.h"
+#include "ui_xml_bundle.h"
 
 #include "ethernet_manager.h"
 #include "lvgl/lvgl.h"
+#include "main_loop_waker.h"
 #include "wifi_manager.h"
 
 #include <spdlog/spdlog.h>
@@ -742,7 +744,7 @@ lv_obj_t* WizardWifiStep::create(lv_obj_t* parent) {
     // Register wifi_network_item component first
     static bool network_item_registered = false;
     if (!network_item_registered) {
-        lv_xml_register_component_from_file("A:ui_xml/wifi_network_item.xml");
+        ui_xml_register_component("wifi_network_item");
         network_item_registered = true;
         spdlog::debug("[{}] Registered wifi_network_item component", get_name());
     }
@@ -846,6 +848,7 @@ void WizardWifiStep::init_wifi_manager() {
                             self->populate_network_list(self->cached_networks_);
                         },
                         this);
+                    MainLoopWaker::instance().wake();
                 }
             });
         } else {
@@ -0,0 +1,68 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_xml_bundle.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+const UiXmlBundleEntry* find_entry(const char* name) {
+#ifdef HELIX_XML_BUNDLE
+    const UiXmlBundleEntry* end = UI_XML_BUNDLE + UI_XML_BUNDLE_COUNT;
+    auto less = [](const UiXmlBundleEntry& entry, const char* key) {
+        return std::strcmp(entry.name, key) < 0;
+    };
+    const UiXmlBundleEntry* it = std::lower_bound(UI_XML_BUNDLE, end, name, less);
+    if (it != end && std::strcmp(it->name, name) == 0) {
+        return it;
+    }
+#else
+    (void)name;
+#endif
+    return nullptr;
+}
+
+} // namespace
+
+bool ui_xml_bundle_enabled() {
+#ifdef HELIX_XML_BUNDLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+lv_result_t ui_xml_register_component(const char* name) {
+    const UiXmlBundleEntry* entry = find_entry(name);
+    if (entry) {
+        return lv_xml_register_component_from_data(entry->name, entry->xml);
+    }
+
+    if (ui_xml_bundle_enabled()) {
+        spdlog::warn("[XML] '{}' is not in the compiled bundle, loading ui_xml/{}.xml", name,
+                     name);
+    }
+    std::string path = std::string("A:ui_xml/") + name + ".xml";
+    return lv_xml_register_component_from_file(path.c_str());
+}
+
+std::string ui_xml_read_component(const char* name) {
+    const UiXmlBundleEntry* entry = find_entry(name);
+    if (entry) {
+        return std::string(entry->xml, entry->size);
+    }
+
+    std::ifstream file(std::string("ui_xml/") + name + ".xml");
+    if (!file.is_open()) {
+        return {};
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
@@ -142,7 +142,7 @@ UsbError UsbBackendLinux::get_connected_drives(std::vector<UsbDrive>& drives) {
 
 UsbError UsbBackendLinux::scan_for_gcode(const std::string& mount_path,
                                          std::vector<UsbGcodeFile>& files, int max_depth) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
 
     if (!running_) {
         return UsbError(UsbResult::NOT_INITIALIZED, "Backend not started",
@@ -157,6 +157,8 @@ UsbError UsbBackendLinux::scan_for_gcode(const std::string& mount_path,
                         "USB drive not connected");
     }
 
+    // Walk without the lock: a large drive must not hold up the monitor thread
+    lock.unlock();
     files.clear();
     scan_directory(mount_path, files, 0, max_depth);
 
@@ -193,6 +195,7 @@ std::vector<UsbDrive> UsbBackendLinux::parse_mounts() {
             drive.device = device;
             drive.mount_path = mount_point;
             drive.label = get_volume_label(device, mount_point);
+            drive.uuid = get_volume_uuid(device);
             get_capacity(mount_point, drive.total_bytes, drive.available_bytes);
 
             spdlog::debug("[UsbBackendLinux] Found USB drive: {} at {} ({})", drive.label,
@@ -321,6 +324,30 @@ std::string UsbBackendLinux::get_volume_label(const std::string& device,
     return "USB Drive";
 }
 
+std::string UsbBackendLinux::get_volume_uuid(const std::string& device) {
+    DIR* dir = opendir("/dev/disk/by-uuid");
+    if (!dir) {
+        return "";
+    }
+
+    std::string uuid;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+
+        std::string link_path = std::string("/dev/disk/by-uuid/") + entry->d_name;
+        char resolved[PATH_MAX];
+        if (realpath(link_path.c_str(), resolved) != nullptr && device == resolved) {
+            uuid = entry->d_name;
+            break;
+        }
+    }
+    closedir(dir);
+    return uuid;
+}
+
 void UsbBackendLinux::get_capacity(const std::string& mount_point, uint64_t& total,
                                    uint64_t& available) {
     struct statvfs stat;
@@ -190,10 +190,9 @@ void UsbBackendMock::add_demo_drives() {
     UsbDrive demo_drive("/media/usb0", "/dev/sda1", "PRINT_FILES",
                         16ULL * 1024 * 1024 * 1024, // 16 GB total
                         8ULL * 1024 * 1024 * 1024); // 8 GB available
+    demo_drive.uuid = "1234-ABCD";
 
-    simulate_drive_insert(demo_drive);
-
-    // Add demo G-code files
+    // Add demo G-code files (before the insert event, which starts indexing the drive)
     int64_t now = std::time(nullptr);
     std::vector<UsbGcodeFile> demo_files = {
         {"/media/usb0/benchy.gcode", "benchy.gcode", 2ULL * 1024 * 1024, now - 86400},
@@ -209,6 +208,7 @@ void UsbBackendMock::add_demo_drives() {
     };
 
     set_mock_files(demo_drive.mount_path, demo_files);
+    simulate_drive_insert(demo_drive);
 
     spdlog::info("[UsbBackendMock] Added demo drive with {} files", demo_files.size());
 }
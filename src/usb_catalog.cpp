@@ -0,0 +1,547 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "usb_catalog.h"
+
+#include "debounced_file_writer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+
+#include "hv/json.hpp"
+
+using json = nlohmann::json;
+
+namespace {
+
+// Paths are saved relative to the mount point, which can differ between insertions
+std::string relative_path(const std::string& path, const std::string& mount_path) {
+    if (path.size() > mount_path.size() + 1 && path.compare(0, mount_path.size(), mount_path) == 0 &&
+        path[mount_path.size()] == '/') {
+        return path.substr(mount_path.size() + 1);
+    }
+    return path;
+}
+
+std::string absolute_path(const std::string& path, const std::string& mount_path) {
+    return !path.empty() && path[0] == '/' ? path : mount_path + "/" + path;
+}
+
+std::string basename_of(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+bool file_exists(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::exists(path, ec);
+}
+
+} // namespace
+
+UsbCatalog::UsbCatalog(Scanner scanner) : scanner_(std::move(scanner)) {}
+
+UsbCatalog::~UsbCatalog() {
+    shutdown();
+}
+
+void UsbCatalog::set_cache_dir(const std::string& dir) {
+    if (!dir.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(dir + "/thumbs", ec);
+        if (ec) {
+            spdlog::warn("[UsbCatalog] Cannot create {}: {}", dir, ec.message());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_dir_ = dir;
+}
+
+void UsbCatalog::set_worker_count(int count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    worker_count_ = std::clamp(count, 1, MAX_WORKERS);
+}
+
+void UsbCatalog::set_progress_callback(ProgressCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    progress_callback_ = std::move(callback);
+}
+
+std::string UsbCatalog::drive_key(const UsbDrive& drive) {
+    std::string key = drive.uuid;
+    if (key.empty() && !drive.label.empty() && drive.total_bytes > 0) {
+        key = drive.label + "-" + std::to_string(drive.total_bytes);
+    }
+
+    // Used as a file name
+    for (char& c : key) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-') {
+            c = '_';
+        }
+    }
+    return key;
+}
+
+void UsbCatalog::open(const UsbDrive& drive) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_ || drives_.count(drive.mount_path)) {
+            return;
+        }
+
+        auto state = std::make_shared<Drive>();
+        state->drive = drive;
+        state->key = drive_key(drive);
+        drives_[drive.mount_path] = state;
+
+        if (workers_.empty()) {
+            start_workers();
+        }
+    }
+    cv_.notify_all();
+    spdlog::debug("[UsbCatalog] Indexing {} ({})", drive.mount_path, drive_key(drive));
+}
+
+void UsbCatalog::close(const std::string& mount_path) {
+    PendingSave pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = drives_.find(mount_path);
+        if (it == drives_.end()) {
+            return;
+        }
+
+        Drive& drive = *it->second;
+        drive.cancelled = true;
+        take_save(drive, pending);
+        spdlog::debug("[UsbCatalog] Closed {} ({} of {} files catalogued)", mount_path,
+                      drive.metadata_done, drive.entries.size());
+        drives_.erase(it);
+    }
+    write(pending);
+}
+
+void UsbCatalog::shutdown() {
+    std::vector<PendingSave> pending;
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        for (auto& [mount_path, drive] : drives_) {
+            drive->cancelled = true;
+            pending.emplace_back();
+            take_save(*drive, pending.back());
+        }
+        drives_.clear();
+        workers.swap(workers_);
+    }
+    cv_.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& save : pending) {
+        write(save);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = false; // open() starts new workers
+}
+
+std::vector<UsbCatalogEntry> UsbCatalog::entries(const std::string& mount_path) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = drives_.find(mount_path);
+    return it == drives_.end() ? std::vector<UsbCatalogEntry>{} : it->second->entries;
+}
+
+UsbCatalogProgress UsbCatalog::progress(const std::string& mount_path) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = drives_.find(mount_path);
+    if (it == drives_.end()) {
+        UsbCatalogProgress none;
+        none.mount_path = mount_path;
+        none.indexing = false;
+        return none;
+    }
+    return progress_of(*it->second);
+}
+
+void UsbCatalog::prioritize(const std::string& mount_path, const std::vector<std::string>& paths) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = drives_.find(mount_path);
+        if (it == drives_.end()) {
+            return;
+        }
+
+        Drive& drive = *it->second;
+        drive.urgent.clear();
+        for (const auto& path : paths) {
+            auto found = drive.index_of.find(path);
+            if (found != drive.index_of.end() && !drive.entries[found->second].has_metadata) {
+                drive.urgent.push_back(found->second);
+            }
+        }
+    }
+    cv_.notify_all();
+}
+
+void UsbCatalog::start_workers() {
+    for (int i = 0; i < worker_count_; i++) {
+        workers_.emplace_back(&UsbCatalog::run, this);
+    }
+}
+
+void UsbCatalog::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        Task task;
+        if (!next_task(task)) {
+            cv_.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        if (task.walk) {
+            walk(task.drive);
+        } else {
+            fill_in(task);
+        }
+        lock.lock();
+    }
+}
+
+bool UsbCatalog::next_task(Task& task) {
+    // Walks first: a new drive's file list matters more than another drive's metadata
+    for (auto& [mount_path, drive] : drives_) {
+        if (!drive->walk_claimed) {
+            drive->walk_claimed = true;
+            task.drive = drive;
+            task.walk = true;
+            return true;
+        }
+    }
+
+    for (auto& [mount_path, drive_ptr] : drives_) {
+        Drive& drive = *drive_ptr;
+        if (drive.indexing) {
+            continue;
+        }
+
+        auto available = [&drive](size_t i) {
+            return !drive.entries[i].has_metadata && !drive.claimed[i];
+        };
+
+        size_t index = drive.entries.size();
+        while (!drive.urgent.empty() && index == drive.entries.size()) {
+            if (available(drive.urgent.front())) {
+                index = drive.urgent.front();
+            }
+            drive.urgent.pop_front();
+        }
+        while (index == drive.entries.size() && drive.next < drive.order.size()) {
+            if (available(drive.order[drive.next])) {
+                index = drive.order[drive.next];
+            }
+            drive.next++;
+        }
+        if (index == drive.entries.size()) {
+            continue;
+        }
+
+        drive.claimed[index] = true;
+        task.drive = drive_ptr;
+        task.walk = false;
+        task.index = index;
+        task.generation = drive.generation;
+        task.path = drive.entries[index].file.path;
+        task.thumbnail = thumbnail_file(drive, drive.entries[index].file);
+        return true;
+    }
+    return false;
+}
+
+void UsbCatalog::walk(const std::shared_ptr<Drive>& drive) {
+    std::string mount_path = drive->drive.mount_path;
+
+    // Publish the index saved at the last insertion while the drive is walked again
+    std::string saved_file;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        saved_file = cache_file(*drive);
+    }
+    if (!saved_file.empty()) {
+        std::vector<UsbCatalogEntry> saved = load(saved_file, mount_path);
+        if (!saved.empty()) {
+            UsbCatalogProgress progress;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (drive->cancelled) {
+                    return;
+                }
+                set_entries(*drive, std::move(saved));
+                drive->from_cache = true;
+                progress = progress_of(*drive);
+            }
+            spdlog::debug("[UsbCatalog] {}: {} files from the saved index", mount_path,
+                          progress.files);
+            report(progress);
+        }
+    }
+
+    auto start = Clock::now();
+    std::vector<UsbGcodeFile> files = scanner_(mount_path);
+
+    UsbCatalogProgress progress;
+    PendingSave pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (drive->cancelled) {
+            return;
+        }
+
+        // Keep metadata of files that haven't changed since it was read
+        std::vector<UsbCatalogEntry> entries;
+        entries.reserve(files.size());
+        size_t reused = 0;
+        for (auto& file : files) {
+            UsbCatalogEntry entry;
+            auto known = drive->index_of.find(file.path);
+            if (known != drive->index_of.end()) {
+                const UsbCatalogEntry& old = drive->entries[known->second];
+                if (old.has_metadata && old.file.size_bytes == file.size_bytes &&
+                    old.file.modified_time == file.modified_time &&
+                    (old.thumbnail_path.empty() || file_exists(old.thumbnail_path))) {
+                    entry = old;
+                    reused++;
+                }
+            }
+            entry.file = std::move(file);
+            entries.push_back(std::move(entry));
+        }
+
+        drive->dirty = drive->dirty || reused != drive->entries.size() || reused != entries.size();
+        set_entries(*drive, std::move(entries));
+        drive->indexing = false;
+        take_save(*drive, pending); // The file list is saved before metadata is filled in
+        progress = progress_of(*drive);
+
+        spdlog::info("[UsbCatalog] {}: {} G-code files indexed in {} ms ({} unchanged)",
+                     mount_path, progress.files,
+                     std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start)
+                         .count(),
+                     reused);
+    }
+    cv_.notify_all();
+    write(pending);
+    report(progress);
+}
+
+void UsbCatalog::fill_in(const Task& task) {
+    gcode::GCodeHeaderMetadata metadata = gcode::extract_header_metadata(task.path);
+
+    std::string thumbnail = task.thumbnail;
+    if (!thumbnail.empty() && !gcode::save_thumbnail_to_file(task.path, thumbnail)) {
+        thumbnail.clear(); // No thumbnail in this file
+    }
+
+    UsbCatalogProgress progress;
+    PendingSave pending;
+    bool should_report = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Drive& drive = *task.drive;
+        if (drive.cancelled || drive.generation != task.generation) {
+            return; // Removed, or walked again meanwhile
+        }
+
+        UsbCatalogEntry& entry = drive.entries[task.index];
+        entry.metadata = std::move(metadata);
+        entry.thumbnail_path = std::move(thumbnail);
+        entry.has_metadata = true;
+        drive.claimed[task.index] = false;
+        drive.metadata_done++;
+        drive.dirty = true;
+
+        progress = progress_of(drive);
+        auto now = Clock::now();
+        if (progress.complete()) {
+            take_save(drive, pending);
+            should_report = true;
+            spdlog::debug("[UsbCatalog] {}: metadata complete ({} files)",
+                          drive.drive.mount_path, progress.files);
+        } else if (now - drive.last_report >= std::chrono::milliseconds(PROGRESS_INTERVAL_MS)) {
+            should_report = true;
+        }
+        if (should_report) {
+            drive.last_report = now;
+        }
+    }
+
+    write(pending);
+    if (should_report) {
+        report(progress);
+    }
+}
+
+void UsbCatalog::set_entries(Drive& drive, std::vector<UsbCatalogEntry> entries) {
+    drive.entries = std::move(entries);
+    drive.index_of.clear();
+    drive.order.clear();
+    drive.metadata_done = 0;
+    for (size_t i = 0; i < drive.entries.size(); i++) {
+        drive.index_of[drive.entries[i].file.path] = i;
+        drive.order.push_back(i);
+        if (drive.entries[i].has_metadata) {
+            drive.metadata_done++;
+        }
+    }
+
+    std::stable_sort(drive.order.begin(), drive.order.end(), [&drive](size_t a, size_t b) {
+        return drive.entries[a].file.modified_time > drive.entries[b].file.modified_time;
+    });
+    drive.next = 0;
+    drive.urgent.clear();
+    drive.claimed.assign(drive.entries.size(), false);
+    drive.generation++;
+}
+
+UsbCatalogProgress UsbCatalog::progress_of(const Drive& drive) const {
+    UsbCatalogProgress progress;
+    progress.mount_path = drive.drive.mount_path;
+    progress.files = drive.entries.size();
+    progress.metadata_done = drive.metadata_done;
+    progress.indexing = drive.indexing;
+    progress.from_cache = drive.from_cache;
+    return progress;
+}
+
+void UsbCatalog::report(const UsbCatalogProgress& progress) {
+    ProgressCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = progress_callback_;
+    }
+    if (callback) {
+        callback(progress);
+    }
+}
+
+std::string UsbCatalog::cache_file(const Drive& drive) const {
+    if (cache_dir_.empty() || drive.key.empty()) {
+        return "";
+    }
+    return cache_dir_ + "/" + drive.key + ".json";
+}
+
+std::string UsbCatalog::thumbnail_file(const Drive& drive, const UsbGcodeFile& file) const {
+    if (cache_dir_.empty() || drive.key.empty()) {
+        return "";
+    }
+    size_t hash = std::hash<std::string>{}(relative_path(file.path, drive.drive.mount_path));
+    return cache_dir_ + "/thumbs/" + drive.key + "-" + std::to_string(hash) + ".png";
+}
+
+void UsbCatalog::take_save(Drive& drive, PendingSave& pending) {
+    if (!drive.dirty || drive.indexing) {
+        return; // Only saved once walked: a partial walk would drop files from the index
+    }
+    pending.file = cache_file(drive);
+    if (pending.file.empty()) {
+        return;
+    }
+    pending.mount_path = drive.drive.mount_path;
+    pending.entries = drive.entries;
+    drive.dirty = false;
+}
+
+void UsbCatalog::write(const PendingSave& pending) {
+    if (pending.file.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(save_mutex_);
+    save(pending.file, pending.mount_path, pending.entries);
+}
+
+std::vector<UsbCatalogEntry> UsbCatalog::load(const std::string& cache_file,
+                                              const std::string& mount_path) {
+    std::vector<UsbCatalogEntry> entries;
+    std::ifstream in(cache_file);
+    if (!in.is_open()) {
+        return entries;
+    }
+
+    try {
+        json data = json::parse(in);
+        if (data.value("version", 0) != CACHE_VERSION) {
+            spdlog::debug("[UsbCatalog] Ignoring {} (old format)", cache_file);
+            return entries;
+        }
+
+        for (const auto& item : data.at("files")) {
+            UsbCatalogEntry entry;
+            entry.file.path = absolute_path(item.at("path").get<std::string>(), mount_path);
+            entry.file.filename = basename_of(entry.file.path);
+            entry.file.size_bytes = item.at("size").get<uint64_t>();
+            entry.file.modified_time = item.at("mtime").get<int64_t>();
+
+            if (item.contains("metadata")) {
+                const json& meta = item["metadata"];
+                gcode::GCodeHeaderMetadata& m = entry.metadata;
+                m.filename = entry.file.path;
+                m.file_size = entry.file.size_bytes;
+                m.modified_time = static_cast<double>(entry.file.modified_time);
+                m.slicer = meta.value("slicer", "");
+                m.slicer_version = meta.value("slicer_version", "");
+                m.estimated_time_seconds = meta.value("estimated_time", 0.0);
+                m.filament_used_mm = meta.value("filament_mm", 0.0);
+                m.filament_used_g = meta.value("filament_g", 0.0);
+                m.filament_type = meta.value("filament_type", "");
+                m.layer_count = meta.value("layers", 0u);
+                m.first_layer_bed_temp = meta.value("bed_temp", 0.0);
+                m.first_layer_nozzle_temp = meta.value("nozzle_temp", 0.0);
+                entry.thumbnail_path = meta.value("thumbnail", "");
+                entry.has_metadata = true;
+            }
+            entries.push_back(std::move(entry));
+        }
+    } catch (const std::exception& e) {
+        spdlog::warn("[UsbCatalog] Ignoring unreadable index {}: {}", cache_file, e.what());
+        entries.clear();
+    }
+    return entries;
+}
+
+void UsbCatalog::save(const std::string& cache_file, const std::string& mount_path,
+                      const std::vector<UsbCatalogEntry>& entries) {
+    json files = json::array();
+    for (const auto& entry : entries) {
+        json item = {{"path", relative_path(entry.file.path, mount_path)},
+                     {"size", entry.file.size_bytes},
+                     {"mtime", entry.file.modified_time}};
+        if (entry.has_metadata) {
+            const gcode::GCodeHeaderMetadata& m = entry.metadata;
+            item["metadata"] = {{"slicer", m.slicer},
+                                {"slicer_version", m.slicer_version},
+                                {"estimated_time", m.estimated_time_seconds},
+                                {"filament_mm", m.filament_used_mm},
+                                {"filament_g", m.filament_used_g},
+                                {"filament_type", m.filament_type},
+                                {"layers", m.layer_count},
+                                {"bed_temp", m.first_layer_bed_temp},
+                                {"nozzle_temp", m.first_layer_nozzle_temp},
+                                {"thumbnail", entry.thumbnail_path}};
+        }
+        files.push_back(std::move(item));
+    }
+
+    json data = {{"version", CACHE_VERSION}, {"files", std::move(files)}};
+    if (!DebouncedFileWriter::write_atomically(cache_file, data.dump())) {
+        spdlog::warn("[UsbCatalog] Could not save index {}", cache_file);
+    }
+}
@@ -25,7 +25,9 @@
 
 #include <spdlog/spdlog.h>
 
-UsbManager::UsbManager(bool force_mock) : force_mock_(force_mock) {
+UsbManager::UsbManager(bool force_mock)
+    : force_mock_(force_mock),
+      catalog_([this](const std::string& mount_path) { return scan_for_gcode(mount_path); }) {
     spdlog::debug("[UsbManager] Created (force_mock={})", force_mock);
 }
 
@@ -33,6 +35,7 @@ UsbManager::~UsbManager() {
     // Don't call stop() which locks mutex_ - during static destruction
     // the mutex may already be destroyed, causing "mutex lock failed" crash.
     // Just reset the backend - its destructor will handle cleanup without locking.
+    catalog_.shutdown();
     backend_.reset();
 }
 
@@ -68,6 +71,9 @@ bool UsbManager::start() {
 }
 
 void UsbManager::stop() {
+    // Before taking the lock: catalog workers scan through this manager
+    catalog_.shutdown();
+
     std::lock_guard<std::mutex> lock(mutex_);
 
     if (!backend_) {
@@ -111,14 +117,19 @@ std::vector<UsbDrive> UsbManager::get_drives() const {
 
 std::vector<UsbGcodeFile> UsbManager::scan_for_gcode(const std::string& mount_path,
                                                      int max_depth) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     std::vector<UsbGcodeFile> files;
-    if (!backend_ || !backend_->is_running()) {
-        return files;
+    UsbBackend* backend = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!backend_ || !backend_->is_running()) {
+            return files;
+        }
+        backend = backend_.get();
     }
 
-    UsbError result = backend_->scan_for_gcode(mount_path, files, max_depth);
+    // Walk without the lock so a large drive doesn't block get_drives() and events. The
+    // backend is only reset by stop(), after the catalog's workers have finished.
+    UsbError result = backend->scan_for_gcode(mount_path, files, max_depth);
     if (!result.success()) {
         spdlog::warn("[UsbManager] Failed to scan for G-code: {}", result.technical_msg);
         files.clear();
@@ -144,6 +155,12 @@ void UsbManager::on_backend_event(UsbEvent event, const UsbDrive& drive) {
     const char* event_name = (event == UsbEvent::DRIVE_INSERTED) ? "INSERTED" : "REMOVED";
     spdlog::info("[UsbManager] Drive {}: {} ({})", event_name, drive.label, drive.mount_path);
 
+    if (event == UsbEvent::DRIVE_INSERTED) {
+        catalog_.open(drive);
+    } else {
+        catalog_.close(drive.mount_path);
+    }
+
     // Fire callback outside lock
     if (callback_copy) {
         callback_copy(event, drive);
@@ -40,13 +40,12 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
-#include <unordered_map>
 
 namespace fs = std::filesystem;
 
-WifiBackendWpaSupplicant::WifiBackendWpaSupplicant()
-    : hv::EventLoopThread(NULL), conn(NULL), mon_conn(NULL) // Initialize monitor connection
-{
+WifiBackendWpaSupplicant::WifiBackendWpaSupplicant(const std::string& socket_path)
+    : hv::EventLoopThread(NULL), conn(NULL), mon_conn(NULL), // Initialize monitor connection
+      socket_path_(socket_path) {
     spdlog::debug("[WifiBackend] Initialized (wpa_supplicant mode)");
 }
 
@@ -59,8 +58,9 @@ WifiBackendWpaSupplicant::~WifiBackendWpaSupplicant() {
 WiFiError WifiBackendWpaSupplicant::start() {
     spdlog::debug("[WifiBackend] Starting wpa_supplicant backend...");
 
-    // Pre-flight checks before starting event loop
-    WiFiError preflight_result = check_system_prerequisites();
+    // Pre-flight checks before starting event loop (only the socket when it is given)
+    WiFiError preflight_result = socket_path_.empty() ? check_system_prerequisites()
+                                                      : check_socket_permissions(socket_path_);
     if (!preflight_result.success()) {
         // User-facing critical error - wpa_supplicant not running or no permissions
         // In silent mode (e.g., HomePanel signal probe), only log - don't show modals
@@ -110,7 +110,13 @@ void WifiBackendWpaSupplicant::stop() {
 
     spdlog::info("[WifiBackend] Stopping event loop thread");
     hv::EventLoopThread::stop(true); // Block until thread terminates
+    scan_timer_id_ = INVALID_TIMER_ID; // Timers die with the loop
     spdlog::trace("[WifiBackend] Event loop stopped");
+
+    // Results may be stale by the next start()
+    std::lock_guard<std::mutex> lock(networks_mutex_);
+    networks_.clear();
+    networks_loaded_ = false;
 }
 
 void WifiBackendWpaSupplicant::register_event_callback(
@@ -296,12 +302,12 @@ void WifiBackendWpaSupplicant::init_wpa() {
     spdlog::trace("[WifiBackend] init_wpa() called in event loop thread");
 
     // Socket discovery: Try common paths
-    std::string wpa_socket;
-    bool socket_found = false;
+    std::string wpa_socket = socket_path_;
+    bool socket_found = !wpa_socket.empty();
 
     // Try modern systemd path first: /run/wpa_supplicant
     std::string base_path = "/run/wpa_supplicant";
-    if (fs::exists(base_path) && fs::is_directory(base_path)) {
+    if (!socket_found && fs::exists(base_path) && fs::is_directory(base_path)) {
         spdlog::debug("[WifiBackend] Searching for wpa_supplicant socket in {}", base_path);
 
         for (const auto& entry : fs::directory_iterator(base_path)) {
@@ -473,6 +479,20 @@ void WifiBackendWpaSupplicant::handle_wpa_events(void* data, int len) {
         return;
     }
 
+    if (callback_name == "SCAN_COMPLETE") {
+        // Fetch the results here, on the event loop thread, and only wake the UI when the
+        // list changed or someone asked for this scan
+        WifiNetworkDiff diff;
+        WiFiError result = refresh_networks(diff);
+        bool requested = scan_requested_.exchange(false);
+        if (result.success() && diff.empty() && !requested) {
+            spdlog::trace("[WifiBackend] Scan results unchanged");
+            return;
+        }
+        spdlog::debug("[WifiBackend] Scan results: {} added, {} changed, {} removed",
+                      diff.added.size(), diff.changed.size(), diff.removed.size());
+    }
+
     // THREAD SAFETY: Lock callbacks during lookup and dispatch
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     auto it = callbacks.find(callback_name);
@@ -528,6 +548,7 @@ static std::string sanitize_command_for_log(const std::string& cmd) {
 }
 
 std::string WifiBackendWpaSupplicant::send_command(const std::string& cmd) {
+    std::lock_guard<std::mutex> lock(command_mutex_);
     if (conn == NULL) {
         LOG_WARN_INTERNAL("send_command called but not connected to wpa_supplicant");
         return "";
@@ -579,6 +600,7 @@ WiFiError WifiBackendWpaSupplicant::trigger_scan() {
                          "WiFi system not ready");
     }
 
+    scan_requested_ = true; // Report these results even if nothing changed
     std::string result = send_command("SCAN");
     if (result == "OK\n") {
         spdlog::debug("[WifiBackend] Scan triggered successfully");
@@ -595,41 +617,33 @@ WiFiError WifiBackendWpaSupplicant::trigger_scan() {
     }
 }
 
-// Deduplicate networks by SSID, keeping the strongest signal for each.
-// In mesh WiFi systems, multiple APs broadcast the same SSID - show only the best one.
-static std::vector<WiFiNetwork> deduplicate_by_ssid(std::vector<WiFiNetwork>& networks) {
-    std::unordered_map<std::string, size_t> best_index_by_ssid;
-
-    for (size_t i = 0; i < networks.size(); ++i) {
-        const auto& net = networks[i];
-        auto it = best_index_by_ssid.find(net.ssid);
-        if (it == best_index_by_ssid.end()) {
-            best_index_by_ssid[net.ssid] = i;
-        } else if (net.signal_strength > networks[it->second].signal_strength) {
-            it->second = i;
-        }
+WiFiError WifiBackendWpaSupplicant::get_scan_results(std::vector<WiFiNetwork>& networks) {
+    if (!isRunning()) {
+        return WiFiError(WiFiResult::NOT_INITIALIZED, "Backend not started",
+                         "WiFi system not ready");
     }
 
-    std::vector<WiFiNetwork> result;
-    result.reserve(best_index_by_ssid.size());
-    for (const auto& [ssid, idx] : best_index_by_ssid) {
-        result.push_back(networks[idx]);
+    bool loaded;
+    {
+        std::lock_guard<std::mutex> lock(networks_mutex_);
+        loaded = networks_loaded_;
     }
-
-    if (result.size() < networks.size()) {
-        spdlog::debug("[WifiBackend] Deduplicated {} networks to {} unique SSIDs", networks.size(),
-                      result.size());
+    if (!loaded) {
+        // No CTRL-EVENT-SCAN-RESULTS since start(): ask for wpa_supplicant's last results
+        WifiNetworkDiff diff;
+        WiFiError result = refresh_networks(diff);
+        if (!result.success()) {
+            return result;
+        }
     }
 
-    return result;
+    std::lock_guard<std::mutex> lock(networks_mutex_);
+    networks = networks_.networks();
+    spdlog::debug("[WifiBackend] Retrieved {} unique networks", networks.size());
+    return WiFiErrorHelper::success();
 }
 
-WiFiError WifiBackendWpaSupplicant::get_scan_results(std::vector<WiFiNetwork>& networks) {
-    if (!isRunning()) {
-        return WiFiError(WiFiResult::NOT_INITIALIZED, "Backend not started",
-                         "WiFi system not ready");
-    }
-
+WiFiError WifiBackendWpaSupplicant::refresh_networks(WifiNetworkDiff& diff) {
     std::string raw = send_command("SCAN_RESULTS");
     if (raw.empty()) {
         return WiFiErrorHelper::connection_failed(
@@ -641,16 +655,38 @@ WiFiError WifiBackendWpaSupplicant::get_scan_results(std::vector<WiFiNetwork>& n
                          "Failed to retrieve scan results");
     }
 
-    try {
-        networks = parse_scan_results(raw);
-        networks = deduplicate_by_ssid(networks);
-        spdlog::debug("[WifiBackend] Retrieved {} unique networks", networks.size());
-        return WiFiErrorHelper::success();
-    } catch (const std::exception& e) {
-        return WiFiError(WiFiResult::BACKEND_ERROR,
-                         "Failed to parse scan results: " + std::string(e.what()),
-                         "Error processing network scan data");
+    std::lock_guard<std::mutex> lock(networks_mutex_);
+    diff = networks_.apply_scan_results(raw);
+    networks_loaded_ = true;
+    return WiFiErrorHelper::success();
+}
+
+bool WifiBackendWpaSupplicant::set_periodic_scan(uint32_t interval_ms) {
+    if (!isRunning()) {
+        return false;
     }
+
+    // Timers belong to the loop thread
+    loop()->runInLoop([this, interval_ms]() {
+        if (scan_timer_id_ != INVALID_TIMER_ID) {
+            loop()->killTimer(scan_timer_id_);
+            scan_timer_id_ = INVALID_TIMER_ID;
+        }
+        if (interval_ms == 0) {
+            spdlog::debug("[WifiBackend] Periodic scan stopped");
+            return;
+        }
+
+        scan_timer_id_ = loop()->setInterval(static_cast<int>(interval_ms), [this](hv::TimerID) {
+            // Results arrive as CTRL-EVENT-SCAN-RESULTS on the monitor socket
+            std::string result = send_command("SCAN");
+            if (result != "OK\n") {
+                spdlog::debug("[WifiBackend] Periodic scan not started: {}", result);
+            }
+        });
+        spdlog::debug("[WifiBackend] Periodic scan every {} ms", interval_ms);
+    });
+    return true;
 }
 
 // Helper function to validate and escape wpa_supplicant strings
@@ -865,7 +901,7 @@ WifiBackend::ConnectionStatus WifiBackendWpaSupplicant::get_status() {
                 if (key == "RSSI") {
                     try {
                         int rssi_dbm = std::stoi(value);
-                        status.signal_strength = dbm_to_percentage(rssi_dbm);
+                        status.signal_strength = WifiNetworkTable::dbm_to_percentage(rssi_dbm);
                     } catch (const std::exception& e) {
                         spdlog::trace("[WifiBackend] Invalid RSSI value '{}': {}", value, e.what());
                     }
@@ -891,120 +927,6 @@ WifiBackend::ConnectionStatus WifiBackendWpaSupplicant::get_status() {
     return status;
 }
 
-// ============================================================================
-// Helper Methods (encapsulate wpa_supplicant ugliness)
-// ============================================================================
-
-std::vector<WiFiNetwork> WifiBackendWpaSupplicant::parse_scan_results(const std::string& raw) {
-    std::vector<WiFiNetwork> networks;
-
-    if (raw.empty()) {
-        spdlog::debug("[WifiBackend] Empty scan results");
-        return networks;
-    }
-
-    // Skip header line (bssid / frequency / signal level / flags / ssid)
-    std::istringstream stream(raw);
-    std::string line;
-    bool skip_header = true;
-
-    while (std::getline(stream, line)) {
-        if (skip_header) {
-            skip_header = false;
-            continue; // Skip "bssid / frequency / signal level / flags / ssid"
-        }
-
-        if (line.empty())
-            continue;
-
-        // Parse tab-separated fields: BSSID\tfreq\tsignal\tflags\tSSID
-        // Note: Hidden networks may have only 4 fields (SSID completely absent)
-        std::vector<std::string> fields = split_by_tabs(line);
-        if (fields.size() < 4) {
-            // Truly malformed - need at least BSSID, freq, signal, flags
-            spdlog::trace("[WifiBackend] Skipping malformed scan line ({} fields): {}",
-                          fields.size(), line);
-            continue;
-        }
-
-        std::string bssid = fields[0];
-        std::string freq_str = fields[1];
-        std::string signal_str = fields[2];
-        std::string flags = fields[3];
-        // SSID may be missing entirely for hidden networks
-        std::string ssid = (fields.size() >= 5) ? fields[4] : "";
-
-        // Skip hidden networks (empty or missing SSID)
-        if (ssid.empty()) {
-            spdlog::trace("[WifiBackend] Skipping hidden network: {}", bssid);
-            continue;
-        }
-
-        // Parse signal strength (dBm)
-        int signal_dbm = 0;
-        try {
-            signal_dbm = std::stoi(signal_str);
-        } catch (const std::exception& e) {
-            LOG_WARN_INTERNAL("Invalid signal strength '{}': {}", signal_str, e.what());
-            continue;
-        }
-
-        // Convert dBm to percentage
-        int signal_percent = dbm_to_percentage(signal_dbm);
-
-        // Detect security type
-        bool is_secured = false;
-        std::string security_type = detect_security_type(flags, is_secured);
-
-        // Create network entry
-        WiFiNetwork network(ssid, signal_percent, is_secured, security_type);
-        networks.push_back(network);
-
-        spdlog::trace("[WifiBackend] Parsed network: '{}' {}% {} {}", ssid, signal_percent,
-                      security_type, bssid);
-    }
-
-    spdlog::debug("[WifiBackend] Parsed {} networks from scan results", networks.size());
-    return networks;
-}
-
-std::vector<std::string> WifiBackendWpaSupplicant::split_by_tabs(const std::string& str) {
-    std::vector<std::string> parts;
-    std::stringstream ss(str);
-    std::string part;
-    while (std::getline(ss, part, '\t')) {
-        parts.push_back(part);
-    }
-    return parts;
-}
-
-int WifiBackendWpaSupplicant::dbm_to_percentage(int dbm) {
-    // -30 dBm = 100% (excellent), -90 dBm = 0% (unusable)
-    return std::max(0, std::min(100, (dbm + 90) * 100 / 60));
-}
-
-std::string WifiBackendWpaSupplicant::detect_security_type(const std::string& flags,
-                                                           bool& is_secured) {
-    if (flags.find("WPA3") != std::string::npos) {
-        is_secured = true;
-        return "WPA3";
-    }
-    if (flags.find("WPA2") != std::string::npos) {
-        is_secured = true;
-        return "WPA2";
-    }
-    if (flags.find("WPA") != std::string::npos) {
-        is_secured = true;
-        return "WPA";
-    }
-    if (flags.find("WEP") != std::string::npos) {
-        is_secured = true;
-        return "WEP";
-    }
-    is_secured = false;
-    return "Open";
-}
-
 #else
 // ============================================================================
 // macOS Stub Implementation: No-op for simulator
@@ -147,11 +147,17 @@ void WiFiManager::start_scan(
     // Stop existing timer if running
     stop_scan();
 
-    spdlog::info("[WiFiManager] Starting periodic network scan (every 7 seconds)");
-
-    // Create timer for periodic scanning
-    scan_timer_ = lv_timer_create(scan_timer_callback, 7000, this);
-    spdlog::debug("[WiFiManager] Timer created: {}", (void*)scan_timer_);
+    // Periodic scanning on the backend's thread when it can, otherwise from an LVGL timer
+    if (backend_->set_periodic_scan(SCAN_INTERVAL_MS)) {
+        backend_scanning_ = true;
+        spdlog::info("[WiFiManager] Starting periodic network scan (every {} ms, by backend)",
+                     SCAN_INTERVAL_MS);
+    } else {
+        spdlog::info("[WiFiManager] Starting periodic network scan (every {} ms)",
+                     SCAN_INTERVAL_MS);
+        scan_timer_ = lv_timer_create(scan_timer_callback, SCAN_INTERVAL_MS, this);
+        spdlog::debug("[WiFiManager] Timer created: {}", (void*)scan_timer_);
+    }
 
     // Trigger immediate scan
     spdlog::debug("[WiFiManager] About to trigger initial scan");
@@ -171,6 +177,10 @@ void WiFiManager::stop_scan() {
         scan_timer_ = nullptr;
         spdlog::info("[WiFiManager] Stopped network scanning");
     }
+    if (backend_scanning_.exchange(false) && backend_) {
+        backend_->set_periodic_scan(0);
+        spdlog::info("[WiFiManager] Stopped network scanning");
+    }
     // Note: Callback is NOT cleared here - callers can clear it explicitly if needed
 }
 
@@ -324,8 +334,9 @@ void WiFiManager::handle_scan_complete(const std::string& event_data) {
     spdlog::debug("[WiFiManager] handle_scan_complete ENTRY (backend thread)");
 
     // Debounce: wpa_supplicant can emit duplicate SCAN_RESULTS events
-    // Only process the first one per scan cycle
-    if (!scan_pending_) {
+    // Only process the first one per scan cycle. A backend that scans by itself only
+    // reports results that changed, so all of them are wanted.
+    if (!scan_pending_ && !backend_scanning_) {
         spdlog::trace("[WiFiManager] Ignoring duplicate SCAN_COMPLETE (already processed)");
         return;
     }
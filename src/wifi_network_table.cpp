@@ -0,0 +1,158 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "wifi_network_table.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+WifiNetworkDiff WifiNetworkTable::apply_scan_results(const std::string& raw) {
+    std::unordered_map<std::string, AccessPoint> access_points;
+    size_t parsed = 0;
+
+    std::istringstream stream(raw);
+    std::string line;
+    bool header = true;
+    while (std::getline(stream, line)) {
+        if (header) {
+            header = false; // "bssid / frequency / signal level / flags / ssid"
+            continue;
+        }
+        if (line.empty()) {
+            continue;
+        }
+
+        std::string bssid = line.substr(0, line.find('\t'));
+        auto previous = access_points_.find(bssid);
+        if (previous != access_points_.end() && previous->second.line == line) {
+            access_points.emplace(bssid, std::move(previous->second));
+            continue;
+        }
+
+        AccessPoint ap;
+        if (!parse_line(line, ap.network)) {
+            continue;
+        }
+        ap.line = line;
+        access_points.emplace(bssid, std::move(ap));
+        parsed++;
+    }
+    access_points_ = std::move(access_points);
+
+    // Strongest access point per SSID
+    std::map<std::string, const WiFiNetwork*> best;
+    for (const auto& [bssid, ap] : access_points_) {
+        auto it = best.find(ap.network.ssid);
+        if (it == best.end() || ap.network.signal_strength > it->second->signal_strength) {
+            best[ap.network.ssid] = &ap.network;
+        }
+    }
+
+    WifiNetworkDiff diff;
+    for (auto it = networks_.begin(); it != networks_.end();) {
+        if (best.count(it->first) == 0) {
+            diff.removed.push_back(it->first);
+            it = networks_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (const auto& [ssid, network] : best) {
+        auto it = networks_.find(ssid);
+        if (it == networks_.end()) {
+            networks_.emplace(ssid, *network);
+            diff.added.push_back(*network);
+        } else if (std::abs(it->second.signal_strength - network->signal_strength) >=
+                       SIGNAL_HYSTERESIS ||
+                   it->second.security_type != network->security_type) {
+            it->second = *network;
+            diff.changed.push_back(*network);
+        }
+    }
+
+    spdlog::trace("[WifiNetworkTable] {} access points ({} parsed): {} added, {} changed, "
+                  "{} removed",
+                  access_points_.size(), parsed, diff.added.size(), diff.changed.size(),
+                  diff.removed.size());
+    return diff;
+}
+
+std::vector<WiFiNetwork> WifiNetworkTable::networks() const {
+    std::vector<WiFiNetwork> result;
+    result.reserve(networks_.size());
+    for (const auto& [ssid, network] : networks_) {
+        result.push_back(network);
+    }
+    std::stable_sort(result.begin(), result.end(), [](const WiFiNetwork& a, const WiFiNetwork& b) {
+        return a.signal_strength > b.signal_strength;
+    });
+    return result;
+}
+
+void WifiNetworkTable::clear() {
+    access_points_.clear();
+    networks_.clear();
+}
+
+bool WifiNetworkTable::parse_line(const std::string& line, WiFiNetwork& network) {
+    // BSSID\tfreq\tsignal\tflags\tSSID - hidden networks may have no SSID field at all
+    std::vector<std::string> fields;
+    std::stringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, '\t')) {
+        fields.push_back(field);
+    }
+    if (fields.size() < 4) {
+        spdlog::trace("[WifiNetworkTable] Skipping malformed scan line ({} fields): {}",
+                      fields.size(), line);
+        return false;
+    }
+
+    std::string ssid = fields.size() >= 5 ? fields[4] : "";
+    if (ssid.empty()) {
+        spdlog::trace("[WifiNetworkTable] Skipping hidden network: {}", fields[0]);
+        return false;
+    }
+
+    int signal_dbm = 0;
+    try {
+        signal_dbm = std::stoi(fields[2]);
+    } catch (const std::exception& e) {
+        spdlog::warn("[WifiNetworkTable] Invalid signal strength '{}': {}", fields[2], e.what());
+        return false;
+    }
+
+    bool is_secured = false;
+    std::string security_type = detect_security_type(fields[3], is_secured);
+    network = WiFiNetwork(ssid, dbm_to_percentage(signal_dbm), is_secured, security_type);
+    return true;
+}
+
+int WifiNetworkTable::dbm_to_percentage(int dbm) {
+    // -30 dBm = 100% (excellent), -90 dBm = 0% (unusable)
+    return std::max(0, std::min(100, (dbm + 90) * 100 / 60));
+}
+
+std::string WifiNetworkTable::detect_security_type(const std::string& flags, bool& is_secured) {
+    if (flags.find("WPA3") != std::string::npos) {
+        is_secured = true;
+        return "WPA3";
+    }
+    if (flags.find("WPA2") != std::string::npos) {
+        is_secured = true;
+        return "WPA2";
+    }
+    if (flags.find("WPA") != std::string::npos) {
+        is_secured = true;
+        return "WPA";
+    }
+    if (flags.find("WEP") != std::string::npos) {
+        is_secured = true;
+        return "WEP";
+    }
+    is_secured = false;
+    return "Open";
+}
@@ -0,0 +1,201 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "fake_wpa_supplicant.h"
+
+#include "spdlog/spdlog.h"
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+constexpr int POLL_INTERVAL_MS = 20; // How quickly stop() is noticed
+
+} // namespace
+
+FakeWpaSupplicant::FakeWpaSupplicant(const std::string& socket_path) : socket_path_(socket_path) {}
+
+FakeWpaSupplicant::~FakeWpaSupplicant() {
+    stop();
+}
+
+bool FakeWpaSupplicant::start() {
+    if (running_) {
+        return true;
+    }
+
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    if (socket_path_.size() >= sizeof(addr.sun_path)) {
+        spdlog::error("[FakeWpaSupplicant] Socket path too long: {}", socket_path_);
+        return false;
+    }
+    strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+
+    fd_ = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd_ < 0) {
+        spdlog::error("[FakeWpaSupplicant] socket() failed: {}", strerror(errno));
+        return false;
+    }
+    unlink(socket_path_.c_str());
+    if (bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        spdlog::error("[FakeWpaSupplicant] bind({}) failed: {}", socket_path_, strerror(errno));
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&FakeWpaSupplicant::run, this);
+    spdlog::debug("[FakeWpaSupplicant] Listening on {}", socket_path_);
+    return true;
+}
+
+void FakeWpaSupplicant::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    close(fd_);
+    fd_ = -1;
+    unlink(socket_path_.c_str());
+}
+
+void FakeWpaSupplicant::set_scan_results(const std::vector<std::string>& lines) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scan_results_ = lines;
+}
+
+void FakeWpaSupplicant::set_status(const std::string& status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status_ = status;
+}
+
+void FakeWpaSupplicant::set_scan_completes(bool completes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scan_completes_ = completes;
+}
+
+void FakeWpaSupplicant::send_event(const std::string& event) {
+    std::vector<std::pair<sockaddr_un, socklen_t>> monitors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        monitors = monitors_;
+    }
+
+    // "<level>" prefix as sent by wpa_msg(); MSG_INFO = 2
+    std::string message = "<2>" + event;
+    for (const auto& [addr, len] : monitors) {
+        sendto(fd_, message.data(), message.size(), 0, reinterpret_cast<const sockaddr*>(&addr),
+               len);
+    }
+}
+
+int FakeWpaSupplicant::command_count(const std::string& command) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = commands_.find(command);
+    return it == commands_.end() ? 0 : it->second;
+}
+
+bool FakeWpaSupplicant::wait_for_attach(int timeout_ms) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                        [this] { return !monitors_.empty(); });
+}
+
+bool FakeWpaSupplicant::wait_for_command(const std::string& command, int count, int timeout_ms) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this, &command, count] {
+        auto it = commands_.find(command);
+        return it != commands_.end() && it->second >= count;
+    });
+}
+
+void FakeWpaSupplicant::run() {
+    char buffer[4096];
+    while (running_) {
+        pollfd pfd = {fd_, POLLIN, 0};
+        if (poll(&pfd, 1, POLL_INTERVAL_MS) <= 0) {
+            continue;
+        }
+
+        sockaddr_un from = {};
+        socklen_t from_len = sizeof(from);
+        ssize_t len = recvfrom(fd_, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr*>(&from),
+                               &from_len);
+        if (len <= 0) {
+            continue;
+        }
+
+        std::string command(buffer, static_cast<size_t>(len));
+        std::string reply = handle(command, from, from_len);
+        sendto(fd_, reply.data(), reply.size(), 0, reinterpret_cast<sockaddr*>(&from), from_len);
+
+        bool scan_completes;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            scan_completes = scan_completes_;
+        }
+        if (command == "SCAN" && scan_completes) {
+            send_event("CTRL-EVENT-SCAN-STARTED ");
+            send_event("CTRL-EVENT-SCAN-RESULTS ");
+        }
+    }
+}
+
+std::string FakeWpaSupplicant::handle(const std::string& command, const sockaddr_un& from,
+                                      socklen_t from_len) {
+    std::string name = command.substr(0, command.find(' '));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_[name]++;
+    cv_.notify_all();
+
+    if (name == "PING") {
+        return "PONG\n";
+    }
+    if (name == "ATTACH") {
+        monitors_.emplace_back(from, from_len);
+        return "OK\n";
+    }
+    if (name == "DETACH") {
+        for (auto it = monitors_.begin(); it != monitors_.end(); ++it) {
+            if (strcmp(it->first.sun_path, from.sun_path) == 0) {
+                monitors_.erase(it);
+                break;
+            }
+        }
+        return "OK\n";
+    }
+    if (name == "SCAN_RESULTS") {
+        std::string reply = "bssid / frequency / signal level / flags / ssid\n";
+        for (const auto& line : scan_results_) {
+            reply += line + "\n";
+        }
+        return reply;
+    }
+    if (name == "STATUS") {
+        return status_;
+    }
+    if (name == "SIGNAL_POLL") {
+        return "RSSI=-50\nLINKSPEED=72\nNOISE=9999\nFREQUENCY=2437\n";
+    }
+    if (name == "ADD_NETWORK") {
+        return "0\n";
+    }
+    if (name == "LIST_NETWORKS") {
+        return "network id / ssid / bssid / flags\n";
+    }
+    if (name == "SCAN" || name == "SET_NETWORK" || name == "ENABLE_NETWORK" ||
+        name == "SELECT_NETWORK" || name == "REMOVE_NETWORK" || name == "SAVE_CONFIG" ||
+        name == "DISCONNECT" || name == "RECONNECT") {
+        return "OK\n";
+    }
+    return "UNKNOWN COMMAND\n";
+}
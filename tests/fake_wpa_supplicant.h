@@ -0,0 +1,112 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file fake_wpa_supplicant.h
+ * @brief Local stand-in for the wpa_supplicant control interface
+ *
+ * Serves the datagram protocol wpa_ctrl speaks on a Unix socket, so
+ * WifiBackendWpaSupplicant can be tested without WiFi hardware or a daemon:
+ * - Replies to PING, SCAN, SCAN_RESULTS, STATUS, ATTACH and DETACH
+ * - SCAN answers OK and, unless disabled, sends CTRL-EVENT-SCAN-RESULTS to attached
+ *   monitors like the real daemon does when the scan finishes
+ * - send_event() pushes any event ("CTRL-EVENT-CONNECTED ...") to attached monitors
+ * - Counts the commands it receives
+ *
+ * Usage:
+ * @code
+ * FakeWpaSupplicant wpa("/tmp/helix_fake_wpa");
+ * REQUIRE(wpa.start());
+ * wpa.set_scan_results({"aa:bb:cc:dd:ee:01\t2437\t-45\t[WPA2-PSK-CCMP][ESS]\tHome"});
+ * WifiBackendWpaSupplicant backend(wpa.socket_path());
+ * backend.start();
+ * REQUIRE(wpa.wait_for_attach());
+ * @endcode
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class FakeWpaSupplicant {
+  public:
+    /**
+     * @param socket_path Where to create the control socket (replaced if it exists)
+     */
+    explicit FakeWpaSupplicant(const std::string& socket_path);
+    ~FakeWpaSupplicant();
+
+    FakeWpaSupplicant(const FakeWpaSupplicant&) = delete;
+    FakeWpaSupplicant& operator=(const FakeWpaSupplicant&) = delete;
+
+    /**
+     * @brief Bind the socket and start answering on a background thread
+     */
+    bool start();
+    void stop();
+
+    const std::string& socket_path() const {
+        return socket_path_;
+    }
+
+    /**
+     * @brief Lines returned by SCAN_RESULTS (after the header line)
+     */
+    void set_scan_results(const std::vector<std::string>& lines);
+
+    /**
+     * @brief Response to STATUS ("wpa_state=COMPLETED\nssid=Home\n...")
+     */
+    void set_status(const std::string& status);
+
+    /**
+     * @brief Whether SCAN is followed by CTRL-EVENT-SCAN-RESULTS (default true)
+     */
+    void set_scan_completes(bool completes);
+
+    /**
+     * @brief Send an event to every attached monitor connection
+     */
+    void send_event(const std::string& event);
+
+    /**
+     * @brief Number of times a command was received
+     */
+    int command_count(const std::string& command) const;
+
+    /**
+     * @brief Wait until a monitor connection has attached
+     */
+    bool wait_for_attach(int timeout_ms = 2000);
+
+    /**
+     * @brief Wait until a command has been received at least count times
+     */
+    bool wait_for_command(const std::string& command, int count, int timeout_ms = 2000);
+
+  private:
+    void run();
+    std::string handle(const std::string& command, const sockaddr_un& from, socklen_t from_len);
+
+    const std::string socket_path_;
+    int fd_ = -1;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    mutable std::mutex mutex_; // Guards the fields below
+    std::condition_variable cv_;
+    std::vector<std::string> scan_results_;
+    std::string status_ = "wpa_state=DISCONNECTED\n";
+    bool scan_completes_ = true;
+    std::map<std::string, int> commands_;
+    std::vector<std::pair<sockaddr_un, socklen_t>> monitors_;
+};
@@ -0,0 +1,214 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_bed_mesh_rasterizer.cpp
+ * @brief Unit tests for the bed mesh software triangle rasterizer
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "bed_mesh_rasterizer.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t BG = 0x282828;
+
+struct TestTarget {
+    std::vector<uint32_t> pixels;
+    std::vector<float> depth;
+    bed_mesh_raster_target_t target;
+
+    TestTarget(int width, int height, bool with_depth, int stride = 0) {
+        stride = stride ? stride : width;
+        pixels.assign(static_cast<size_t>(stride) * height, 0xDEADBEEF);
+        if (with_depth) {
+            depth.resize(static_cast<size_t>(width) * height);
+        }
+        target = {pixels.data(), with_depth ? depth.data() : nullptr, width, height, stride};
+        bed_mesh_raster_clear(&target, BG);
+    }
+
+    uint32_t at(int x, int y) const {
+        return pixels[static_cast<size_t>(y) * target.stride + x] & 0xFFFFFF;
+    }
+};
+
+bed_mesh_raster_vertex_t vertex(int x, int y, float depth, uint8_t r, uint8_t g, uint8_t b) {
+    return {x, y, depth, r, g, b};
+}
+
+} // namespace
+
+TEST_CASE("Bed mesh rasterizer: clear respects stride", "[bed_mesh][rasterizer]") {
+    TestTarget t(5, 3, false, 8);
+    for (int y = 0; y < 3; y++) {
+        for (int x = 0; x < 8; x++) {
+            uint32_t expected = x < 5 ? (0xFF000000u | BG) : 0xDEADBEEF;
+            REQUIRE(t.pixels[static_cast<size_t>(y) * 8 + x] == expected);
+        }
+    }
+}
+
+TEST_CASE("Bed mesh rasterizer: Gouraud interpolation", "[bed_mesh][rasterizer]") {
+    TestTarget t(64, 64, false);
+    auto v0 = vertex(0, 0, 1.0f, 0, 0, 0);
+    auto v1 = vertex(60, 0, 1.0f, 240, 0, 0);
+    auto v2 = vertex(0, 60, 1.0f, 0, 0, 240);
+    REQUIRE(bed_mesh_raster_triangle(&t.target, v0, v1, v2, 255) > 0);
+
+    // Color varies linearly with position: red along X, blue along Y
+    REQUIRE(t.at(0, 0) == 0x000000);
+    REQUIRE(t.at(30, 0) == 0x780000);
+    REQUIRE(t.at(0, 30) == 0x000078);
+    REQUIRE(t.at(15, 15) == 0x3C003C);
+
+    // Outside the hypotenuse stays background
+    REQUIRE(t.at(40, 40) == BG);
+}
+
+TEST_CASE("Bed mesh rasterizer: shared edges cover each pixel exactly once",
+          "[bed_mesh][rasterizer]") {
+    // A quad split along its diagonal, drawn at 50% opacity: a double-covered pixel would be
+    // darker than its neighbours, an uncovered one would stay background
+    TestTarget t(40, 40, false);
+    auto bl = vertex(3, 33, 1.0f, 0, 0, 0);
+    auto br = vertex(35, 30, 1.0f, 0, 0, 0);
+    auto tl = vertex(6, 2, 1.0f, 0, 0, 0);
+    auto tr = vertex(37, 5, 1.0f, 0, 0, 0);
+    size_t covered = bed_mesh_raster_triangle(&t.target, bl, br, tl, 128);
+    covered += bed_mesh_raster_triangle(&t.target, br, tr, tl, 128);
+
+    const uint32_t half = 0x141414; // BG blended 50% toward black
+    size_t half_count = 0;
+    for (int y = 0; y < 40; y++) {
+        for (int x = 0; x < 40; x++) {
+            uint32_t p = t.at(x, y);
+            REQUIRE((p == BG || p == half));
+            half_count += (p == half);
+        }
+    }
+    REQUIRE(half_count == covered);
+}
+
+TEST_CASE("Bed mesh rasterizer: depth buffer makes submission order irrelevant",
+          "[bed_mesh][rasterizer]") {
+    auto near_a = vertex(0, 0, 1.0f, 255, 0, 0);
+    auto near_b = vertex(30, 0, 1.0f, 255, 0, 0);
+    auto near_c = vertex(0, 30, 1.0f, 255, 0, 0);
+    auto far_a = vertex(5, 5, 5.0f, 0, 255, 0);
+    auto far_b = vertex(31, 5, 5.0f, 0, 255, 0);
+    auto far_c = vertex(5, 31, 5.0f, 0, 255, 0);
+
+    TestTarget near_first(32, 32, true);
+    bed_mesh_raster_triangle(&near_first.target, near_a, near_b, near_c, 255);
+    bed_mesh_raster_triangle(&near_first.target, far_a, far_b, far_c, 255);
+
+    TestTarget far_first(32, 32, true);
+    bed_mesh_raster_triangle(&far_first.target, far_a, far_b, far_c, 255);
+    bed_mesh_raster_triangle(&far_first.target, near_a, near_b, near_c, 255);
+
+    REQUIRE(near_first.pixels == far_first.pixels);
+    REQUIRE(near_first.at(10, 10) == 0xFF0000);
+    REQUIRE(near_first.at(20, 8) == 0xFF0000);
+    REQUIRE(near_first.at(6, 28) == 0x00FF00); // Far triangle visible past the near one
+}
+
+TEST_CASE("Bed mesh rasterizer: clips geometry outside the target", "[bed_mesh][rasterizer]") {
+    TestTarget t(16, 16, true);
+    auto v0 = vertex(-100, -50, 1.0f, 10, 20, 30);
+    auto v1 = vertex(200, 8, 1.0f, 10, 20, 30);
+    auto v2 = vertex(-20, 300, 1.0f, 10, 20, 30);
+    REQUIRE(bed_mesh_raster_triangle(&t.target, v0, v1, v2, 255) == 16 * 16);
+    REQUIRE(t.at(0, 0) == 0x0A141E);
+    REQUIRE(t.at(15, 15) == 0x0A141E);
+
+    // Entirely off-target and degenerate triangles draw nothing
+    REQUIRE(bed_mesh_raster_triangle(&t.target, vertex(-10, -10, 0, 0, 0, 0),
+                                     vertex(-1, -10, 0, 0, 0, 0), vertex(-5, -2, 0, 0, 0, 0),
+                                     255) == 0);
+    REQUIRE(bed_mesh_raster_triangle(&t.target, vertex(0, 0, 0, 0, 0, 0),
+                                     vertex(5, 5, 0, 0, 0, 0), vertex(10, 10, 0, 0, 0, 0),
+                                     255) == 0);
+}
+
+TEST_CASE("Bed mesh rasterizer: preview scale floors clipped coordinates",
+          "[bed_mesh][rasterizer]") {
+    // Inside the target both roundings agree; left of/above the origin they must not
+    // collapse onto column 0 the way truncating division would
+    REQUIRE(bed_mesh_raster_scale_coord(10, 10, 2) == 0);
+    REQUIRE(bed_mesh_raster_scale_coord(13, 10, 2) == 1);
+    REQUIRE(bed_mesh_raster_scale_coord(9, 10, 2) == -1);
+    REQUIRE(bed_mesh_raster_scale_coord(8, 10, 2) == -1);
+    REQUIRE(bed_mesh_raster_scale_coord(7, 10, 2) == -2);
+    REQUIRE(bed_mesh_raster_scale_coord(-5, 10, 4) == -4);
+    REQUIRE(bed_mesh_raster_scale_coord(9, 10, 1) == -1);
+
+    SECTION("a quad moved across the clip origin shifts the preview by whole pixels") {
+        // Quad straddling the top-left corner of a clip area at screen (10, 10), drawn at
+        // 1/2 scale. Moving it by one preview pixel (2 screen pixels) must move the
+        // rasterized image by exactly one pixel, including for the clipped vertices.
+        constexpr int ORIGIN = 10;
+        constexpr int SCALE = 2;
+        const int quad_x[4] = {9, 25, 1, 14};
+        const int quad_y[4] = {15, 31, 2, 9};
+
+        auto render = [&](int shift) {
+            auto t = std::make_unique<TestTarget>(12, 12, false);
+            bed_mesh_raster_vertex_t v[4];
+            for (int i = 0; i < 4; i++) {
+                v[i] = vertex(bed_mesh_raster_scale_coord(quad_x[i] + shift, ORIGIN, SCALE),
+                              bed_mesh_raster_scale_coord(quad_y[i] + shift, ORIGIN, SCALE), 1.0f,
+                              200, 100, 50);
+            }
+            bed_mesh_raster_triangle(&t->target, v[0], v[1], v[2], 255);
+            bed_mesh_raster_triangle(&t->target, v[1], v[3], v[2], 255);
+            return t;
+        };
+
+        auto base = render(0);
+        auto moved = render(SCALE);
+        for (int y = 1; y < 12; y++) {
+            for (int x = 1; x < 12; x++) {
+                INFO("x=" << x << " y=" << y);
+                REQUIRE(moved->at(x, y) == base->at(x - 1, y - 1));
+            }
+        }
+    }
+}
+
+TEST_CASE("Bed mesh rasterizer: preview scale follows the frame budget",
+          "[bed_mesh][rasterizer]") {
+    constexpr double OVER_BUDGET_MS = BED_MESH_PREVIEW_BUDGET_MS * 1.5;
+    constexpr double WELL_UNDER_MS =
+        BED_MESH_PREVIEW_BUDGET_MS * BED_MESH_PREVIEW_HEADROOM_RATIO / 2;
+    constexpr double JUST_UNDER_MS = BED_MESH_PREVIEW_BUDGET_MS * 0.9;
+
+    SECTION("a new drag starts at the minimum scale") {
+        REQUIRE(bed_mesh_raster_preview_scale(BED_MESH_PREVIEW_MAX_SCALE, false, OVER_BUDGET_MS) ==
+                BED_MESH_PREVIEW_MIN_SCALE);
+    }
+
+    SECTION("steps down when a frame overruns the budget, never past the maximum") {
+        int scale = bed_mesh_raster_preview_scale(BED_MESH_PREVIEW_MIN_SCALE, true, OVER_BUDGET_MS);
+        REQUIRE(scale == BED_MESH_PREVIEW_MIN_SCALE * 2);
+        REQUIRE(bed_mesh_raster_preview_scale(BED_MESH_PREVIEW_MAX_SCALE, true, OVER_BUDGET_MS) ==
+                BED_MESH_PREVIEW_MAX_SCALE);
+    }
+
+    SECTION("recovers once frames drop back under the budget's headroom") {
+        int scale = bed_mesh_raster_preview_scale(BED_MESH_PREVIEW_MIN_SCALE, true, OVER_BUDGET_MS);
+        REQUIRE(scale == BED_MESH_PREVIEW_MAX_SCALE);
+
+        // Just under budget holds: one step up quadruples the pixel count
+        scale = bed_mesh_raster_preview_scale(scale, true, JUST_UNDER_MS);
+        REQUIRE(scale == BED_MESH_PREVIEW_MAX_SCALE);
+
+        scale = bed_mesh_raster_preview_scale(scale, true, WELL_UNDER_MS);
+        REQUIRE(scale == BED_MESH_PREVIEW_MIN_SCALE);
+        REQUIRE(bed_mesh_raster_preview_scale(scale, true, WELL_UNDER_MS) ==
+                BED_MESH_PREVIEW_MIN_SCALE);
+    }
+}
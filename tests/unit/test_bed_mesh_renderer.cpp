@@ -0,0 +1,190 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_bed_mesh_renderer.cpp
+ * @brief Bed mesh renderer geometry: canvas fit and painter's algorithm order
+ *
+ * Runs the renderer's geometry stages (projection cache, screen fit, draw-order sort)
+ * through bed_mesh_renderer_prepare(), so no LVGL layer is needed.
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "bed_mesh_renderer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+constexpr int CANVAS_WIDTH = 480;
+constexpr int CANVAS_HEIGHT = 320;
+
+// Tilt limits of the widget's drag handler and a spread of spins, including a full turn
+constexpr double TILT_EXTREMES[] = {-90.0, -85.0, -10.0, 0.0};
+constexpr double SPIN_ANGLES[] = {0.0, 45.0, 90.0, 135.0, 180.0, 270.0, 359.0};
+
+struct Bounds {
+    int min_x = INT_MAX, max_x = INT_MIN;
+    int min_y = INT_MAX, max_y = INT_MIN;
+};
+
+// 7x9 bowl with a raised corner, so the surface is neither flat nor symmetric
+struct TestMesh {
+    static constexpr int ROWS = 7;
+    static constexpr int COLS = 9;
+    float heights[ROWS][COLS];
+    const float* rows[ROWS];
+
+    TestMesh() {
+        for (int row = 0; row < ROWS; row++) {
+            for (int col = 0; col < COLS; col++) {
+                float dx = col - (COLS - 1) / 2.0f;
+                float dy = row - (ROWS - 1) / 2.0f;
+                heights[row][col] = 0.01f * (dx * dx + dy * dy) - 0.1f;
+            }
+            rows[row] = heights[row];
+        }
+        heights[ROWS - 1][COLS - 1] = 0.35f;
+    }
+};
+
+using RendererPtr = std::unique_ptr<bed_mesh_renderer_t, decltype(&bed_mesh_renderer_destroy)>;
+
+RendererPtr make_renderer(double angle_x, double angle_z) {
+    static const TestMesh mesh;
+    RendererPtr renderer(bed_mesh_renderer_create(), bed_mesh_renderer_destroy);
+    REQUIRE(renderer != nullptr);
+    REQUIRE(bed_mesh_renderer_set_mesh_data(renderer.get(), mesh.rows, TestMesh::ROWS,
+                                            TestMesh::COLS));
+    bed_mesh_renderer_set_rotation(renderer.get(), angle_x, angle_z);
+    return renderer;
+}
+
+Bounds quad_bounds(const bed_mesh_renderer_t* renderer) {
+    size_t count = 0;
+    const bed_mesh_quad_3d_t* quads = bed_mesh_renderer_get_quads(renderer, &count);
+    REQUIRE(count == static_cast<size_t>((TestMesh::ROWS - 1) * (TestMesh::COLS - 1)));
+
+    Bounds bounds;
+    for (size_t q = 0; q < count; q++) {
+        for (int i = 0; i < 4; i++) {
+            bounds.min_x = std::min(bounds.min_x, quads[q].screen_x[i]);
+            bounds.max_x = std::max(bounds.max_x, quads[q].screen_x[i]);
+            bounds.min_y = std::min(bounds.min_y, quads[q].screen_y[i]);
+            bounds.max_y = std::max(bounds.max_y, quads[q].screen_y[i]);
+        }
+    }
+    return bounds;
+}
+
+// Draw order must be a permutation of all quads with depth never increasing
+void require_back_to_front(const bed_mesh_renderer_t* renderer) {
+    size_t quad_count = 0;
+    size_t order_count = 0;
+    const bed_mesh_quad_3d_t* quads = bed_mesh_renderer_get_quads(renderer, &quad_count);
+    const uint32_t* order = bed_mesh_renderer_get_draw_order(renderer, &order_count);
+    REQUIRE(order_count == quad_count);
+
+    std::vector<uint32_t> sorted(order, order + order_count);
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<uint32_t> expected(quad_count);
+    std::iota(expected.begin(), expected.end(), 0u);
+    REQUIRE(sorted == expected);
+
+    for (size_t i = 1; i < order_count; i++) {
+        INFO("draw position " << i);
+        REQUIRE(quads[order[i - 1]].avg_depth >= quads[order[i]].avg_depth);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Bed mesh renderer: fit keeps the mesh on canvas at the rotation extremes",
+          "[bed_mesh][renderer]") {
+    for (double tilt : TILT_EXTREMES) {
+        for (double spin : SPIN_ANGLES) {
+            INFO("tilt=" << tilt << " spin=" << spin);
+            RendererPtr renderer = make_renderer(tilt, spin);
+            REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+            Bounds bounds = quad_bounds(renderer.get());
+
+            // Inside the canvas...
+            CHECK(bounds.min_x >= 0);
+            CHECK(bounds.max_x < CANVAS_WIDTH);
+            CHECK(bounds.min_y >= 0);
+            CHECK(bounds.max_y < CANVAS_HEIGHT);
+
+            // ...filling it along the limiting axis (95% padding, less rounding)
+            double fill_x = (bounds.max_x - bounds.min_x) / static_cast<double>(CANVAS_WIDTH);
+            double fill_y = (bounds.max_y - bounds.min_y) / static_cast<double>(CANVAS_HEIGHT);
+            CHECK(std::max(fill_x, fill_y) > 0.9);
+
+            // ...and centered
+            CHECK(std::abs((bounds.min_x + bounds.max_x) / 2 - CANVAS_WIDTH / 2) <= 1);
+            CHECK(std::abs((bounds.min_y + bounds.max_y) / 2 - CANVAS_HEIGHT / 2) <= 1);
+        }
+    }
+}
+
+TEST_CASE("Bed mesh renderer: refit follows rotation and canvas changes",
+          "[bed_mesh][renderer]") {
+    RendererPtr renderer = make_renderer(-85.0, 0.0);
+    REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+
+    SECTION("rotating to the other extremes rescales the mesh to fit") {
+        for (double tilt : TILT_EXTREMES) {
+            for (double spin : SPIN_ANGLES) {
+                INFO("tilt=" << tilt << " spin=" << spin);
+                bed_mesh_renderer_set_rotation(renderer.get(), tilt, spin);
+                REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+                Bounds bounds = quad_bounds(renderer.get());
+                int width = bounds.max_x - bounds.min_x;
+                int height = bounds.max_y - bounds.min_y;
+                CHECK(width < CANVAS_WIDTH);
+                CHECK(height < CANVAS_HEIGHT);
+            }
+        }
+    }
+
+    SECTION("a smaller canvas scales the fit down") {
+        Bounds full = quad_bounds(renderer.get());
+        REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH / 2, CANVAS_HEIGHT / 2));
+        Bounds half = quad_bounds(renderer.get());
+        CHECK(half.max_x - half.min_x < CANVAS_WIDTH / 2);
+        CHECK(half.max_y - half.min_y < CANVAS_HEIGHT / 2);
+        CHECK((half.max_x - half.min_x) * 2 == Catch::Approx(full.max_x - full.min_x).margin(2));
+    }
+}
+
+TEST_CASE("Bed mesh renderer: quads are drawn back to front", "[bed_mesh][renderer]") {
+    SECTION("every rotation extreme") {
+        for (double tilt : TILT_EXTREMES) {
+            for (double spin : SPIN_ANGLES) {
+                INFO("tilt=" << tilt << " spin=" << spin);
+                RendererPtr renderer = make_renderer(tilt, spin);
+                REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+                require_back_to_front(renderer.get());
+            }
+        }
+    }
+
+    SECTION("rotation re-sorts the previous order") {
+        RendererPtr renderer = make_renderer(-45.0, 0.0);
+        REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+        size_t count = 0;
+        uint32_t furthest = bed_mesh_renderer_get_draw_order(renderer.get(), &count)[0];
+
+        // Half a turn brings the furthest quad to the front half of the order
+        bed_mesh_renderer_set_rotation(renderer.get(), -45.0, 180.0);
+        REQUIRE(bed_mesh_renderer_prepare(renderer.get(), CANVAS_WIDTH, CANVAS_HEIGHT));
+        require_back_to_front(renderer.get());
+        const uint32_t* order = bed_mesh_renderer_get_draw_order(renderer.get(), &count);
+        size_t position = static_cast<size_t>(std::find(order, order + count, furthest) - order);
+        CHECK(position >= count / 2);
+    }
+}
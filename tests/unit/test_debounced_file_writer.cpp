@@ -0,0 +1,127 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_debounced_file_writer.cpp
+ * @brief Unit tests for coalesced, atomic background file writes
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "debounced_file_writer.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <thread>
+
+namespace {
+
+const char* const TEST_PATH = "/tmp/helix_debounced_writer_test.json";
+
+std::string read_file(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+bool file_exists(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+// Removes the test file before and after each test
+struct TestFile {
+    TestFile() {
+        std::remove(TEST_PATH);
+    }
+    ~TestFile() {
+        std::remove(TEST_PATH);
+    }
+};
+
+} // namespace
+
+TEST_CASE("DebouncedFileWriter: bursts are coalesced into one write", "[file_writer]") {
+    TestFile file;
+    DebouncedFileWriter writer(60000); // Never fires on its own during the test
+    std::atomic<int> produced{0};
+
+    for (int i = 0; i < 10; i++) {
+        writer.schedule(TEST_PATH, [i, &produced] {
+            produced++;
+            return "value " + std::to_string(i);
+        });
+    }
+    REQUIRE(writer.has_pending());
+    REQUIRE_FALSE(file_exists(TEST_PATH));
+
+    REQUIRE(writer.flush());
+    REQUIRE_FALSE(writer.has_pending());
+    REQUIRE(read_file(TEST_PATH) == "value 9");
+    REQUIRE(produced == 1);
+
+    FileWriteStats stats = writer.stats();
+    REQUIRE(stats.requests == 10);
+    REQUIRE(stats.coalesced == 9);
+    REQUIRE(stats.writes == 1);
+    REQUIRE(stats.failures == 0);
+
+    SECTION("Nothing pending: flush() doesn't write") {
+        REQUIRE(writer.flush());
+        REQUIRE(writer.stats().writes == 1);
+    }
+}
+
+TEST_CASE("DebouncedFileWriter: writes in the background after the delay", "[file_writer]") {
+    TestFile file;
+    DebouncedFileWriter writer(20);
+
+    writer.schedule(TEST_PATH, [] { return std::string("background"); });
+    for (int i = 0; i < 200 && writer.has_pending(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    REQUIRE_FALSE(writer.has_pending());
+    // has_pending() turns false when the write starts; flush() waits for it to finish
+    REQUIRE(writer.flush());
+    REQUIRE(read_file(TEST_PATH) == "background");
+    REQUIRE(writer.stats().writes == 1);
+}
+
+TEST_CASE("DebouncedFileWriter: destruction flushes pending writes", "[file_writer]") {
+    TestFile file;
+    {
+        DebouncedFileWriter writer(60000);
+        writer.schedule(TEST_PATH, [] { return std::string("on exit"); });
+    }
+    REQUIRE(read_file(TEST_PATH) == "on exit");
+}
+
+TEST_CASE("DebouncedFileWriter: failures", "[file_writer]") {
+    DebouncedFileWriter writer(60000);
+    std::string failed_path;
+    writer.set_error_callback([&](const std::string& path) { failed_path = path; });
+
+    writer.schedule("/nonexistent-dir/config.json", [] { return std::string("{}"); });
+    REQUIRE_FALSE(writer.flush());
+    REQUIRE(failed_path == "/nonexistent-dir/config.json");
+    REQUIRE(writer.stats().failures == 1);
+}
+
+TEST_CASE("DebouncedFileWriter: atomic replacement", "[file_writer]") {
+    TestFile file;
+
+    REQUIRE(DebouncedFileWriter::write_atomically(TEST_PATH, "first"));
+    chmod(TEST_PATH, 0600);
+    REQUIRE(DebouncedFileWriter::write_atomically(TEST_PATH, "second"));
+
+    REQUIRE(read_file(TEST_PATH) == "second");
+    REQUIRE_FALSE(file_exists(std::string(TEST_PATH) + ".tmp"));
+
+    struct stat st;
+    REQUIRE(stat(TEST_PATH, &st) == 0);
+    REQUIRE((st.st_mode & 0777) == 0600); // Permissions of the replaced file are kept
+}
@@ -563,6 +563,88 @@ TEST_CASE("Geometry Builder: Geometry generation - multiple layers", "[gcode][ge
     REQUIRE(geometry.vertices.size() > 0);
 }
 
+static ToolpathSegment make_extrusion(glm::vec3 start, glm::vec3 end) {
+    ToolpathSegment seg;
+    seg.start = start;
+    seg.end = end;
+    seg.is_extrusion = true;
+    seg.extrusion_amount = 1.0f;
+    seg.width = 0.4f;
+    return seg;
+}
+
+static void require_contiguous_layers(const RibbonGeometry& geometry) {
+    REQUIRE(geometry.strip_layer_index.size() == geometry.strips.size());
+    size_t next_strip = 0;
+    for (size_t layer = 0; layer < geometry.layer_strip_ranges.size(); layer++) {
+        const auto& [first, count] = geometry.layer_strip_ranges[layer];
+        REQUIRE(first == next_strip);
+        for (size_t s = first; s < first + count; s++) {
+            REQUIRE(geometry.strip_layer_index[s] == layer);
+        }
+        next_strip += count;
+    }
+    REQUIRE(next_strip == geometry.strips.size());
+}
+
+TEST_CASE("Geometry Builder: Layer ordering - in-order toolpath", "[gcode][geometry][layers]") {
+    GeometryBuilder builder;
+
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(100, 100, 10);
+
+    for (int i = 0; i < 3; i++) {
+        Layer layer;
+        layer.z_height = 0.2f * (i + 1);
+        layer.segments.push_back(
+            make_extrusion({0, 0, layer.z_height}, {10, 0, layer.z_height}));
+        layer.segments.push_back(
+            make_extrusion({10, 0, layer.z_height}, {10, 10, layer.z_height}));
+        gcode.layers.push_back(layer);
+    }
+
+    SimplificationOptions options;
+    options.enable_merging = false;
+    RibbonGeometry geometry = builder.build(gcode, options);
+
+    REQUIRE(geometry.layer_strip_ranges.size() == 3);
+    REQUIRE(geometry.layer_strip_ranges[1].second > 0);
+    REQUIRE(builder.last_stats().strips_reordered == 0);
+    require_contiguous_layers(geometry);
+}
+
+TEST_CASE("Geometry Builder: Layer ordering - out-of-order strips made contiguous",
+          "[gcode][geometry][layers]") {
+    GeometryBuilder builder;
+
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(100, 100, 10);
+
+    Layer layer1;
+    layer1.z_height = 0.2f;
+    layer1.segments.push_back(make_extrusion({0, 0, 0.2f}, {10, 0, 0.2f}));
+    gcode.layers.push_back(layer1);
+
+    // Second layer ends with a move back at the first layer's Z (e.g. a wipe after Z-hop),
+    // followed by more 0.4mm extrusion: layer 0 strips appear in the middle of layer 1
+    Layer layer2;
+    layer2.z_height = 0.4f;
+    layer2.segments.push_back(make_extrusion({0, 0, 0.4f}, {10, 0, 0.4f}));
+    layer2.segments.push_back(make_extrusion({20, 20, 0.2f}, {30, 20, 0.2f}));
+    layer2.segments.push_back(make_extrusion({40, 40, 0.4f}, {40, 50, 0.4f}));
+    gcode.layers.push_back(layer2);
+
+    SimplificationOptions options;
+    options.enable_merging = false;
+    RibbonGeometry geometry = builder.build(gcode, options);
+
+    REQUIRE(geometry.layer_strip_ranges.size() == 2);
+    REQUIRE(builder.last_stats().strips_reordered > 0);
+    require_contiguous_layers(geometry);
+}
+
 TEST_CASE("Geometry Builder: Geometry generation - very short segment", "[gcode][geometry][generation][edge]") {
     GeometryBuilder builder;
 
@@ -0,0 +1,143 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_gcode_tinygl_renderer.cpp
+ * @brief GCodeTinyGLRenderer geometry submission paths: same frame, frame time
+ *
+ * Drives the shipped renderer (render_offscreen()) rather than a copy of its
+ * submission code, so the comparison covers what the G-code viewer actually draws.
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "../lvgl_test_fixture.h"
+
+#ifdef ENABLE_TINYGL_3D
+
+#include "gcode_camera.h"
+#include "gcode_parser.h"
+#include "gcode_tinygl_renderer.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace gcode;
+
+namespace {
+
+constexpr int VIEW_WIDTH = 400;
+constexpr int VIEW_HEIGHT = 300;
+
+// Zigzag infill: every segment turns 90 degrees, so simplification keeps all of them
+ParsedGCodeFile make_zigzag_model(int layers, int rows) {
+    GCodeParser parser;
+    parser.parse_line("G90");
+    parser.parse_line("M83");
+    for (int layer = 0; layer < layers; layer++) {
+        parser.parse_line("G1 Z" + std::to_string(0.2f * (layer + 1)) + " F600");
+        parser.parse_line("G1 X10 Y10 F6000");
+        for (int row = 0; row < rows; row++) {
+            std::string x = (row % 2 == 0) ? "X90" : "X10";
+            float y = 10.0f + row * 0.5f;
+            parser.parse_line("G1 " + x + " Y" + std::to_string(y) + " E2.5");
+            parser.parse_line("G1 " + x + " Y" + std::to_string(y + 0.5f) + " E0.02");
+        }
+    }
+
+    ParsedGCodeFile file = parser.finalize();
+    file.filename = "zigzag_" + std::to_string(layers) + "x" + std::to_string(rows);
+    return file;
+}
+
+GCodeCamera make_camera(const ParsedGCodeFile& file) {
+    GCodeCamera camera;
+    camera.set_viewport_size(VIEW_WIDTH, VIEW_HEIGHT);
+    camera.fit_to_bounds(file.global_bounding_box);
+    return camera;
+}
+
+std::vector<uint8_t> render_frame(GCodeTinyGLRenderer& renderer, const ParsedGCodeFile& file,
+                                  const GCodeCamera& camera, bool vertex_arrays) {
+    renderer.set_vertex_arrays_enabled(vertex_arrays);
+    REQUIRE(renderer.render_offscreen(file, camera));
+    return renderer.capture_frame();
+}
+
+size_t count_differing_bytes(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    REQUIRE(a.size() == b.size());
+    size_t count = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        count += a[i] != b[i];
+    }
+    return count;
+}
+
+// Mean time per frame, after one untimed frame that builds geometry (and arrays)
+double mean_frame_ms(GCodeTinyGLRenderer& renderer, const ParsedGCodeFile& file,
+                     const GCodeCamera& camera, bool vertex_arrays, int frames) {
+    renderer.set_vertex_arrays_enabled(vertex_arrays);
+    renderer.render_offscreen(file, camera);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        renderer.render_offscreen(file, camera);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / frames;
+}
+
+} // namespace
+
+TEST_CASE_METHOD(LVGLTestFixture, "GCodeTinyGLRenderer: vertex arrays match immediate mode",
+                 "[gcode][tinygl]") {
+    ParsedGCodeFile file = make_zigzag_model(12, 40);
+    GCodeCamera camera = make_camera(file);
+
+    GCodeTinyGLRenderer renderer;
+    renderer.set_viewport_size(VIEW_WIDTH, VIEW_HEIGHT);
+    REQUIRE_FALSE(renderer.is_vertex_arrays_enabled()); // Immediate mode is the default
+
+    SECTION("all layers solid") {
+        auto immediate = render_frame(renderer, file, camera, false);
+        auto arrays = render_frame(renderer, file, camera, true);
+        REQUIRE_FALSE(immediate.empty());
+        REQUIRE(count_differing_bytes(immediate, arrays) == 0);
+    }
+
+    SECTION("ghost layers use the dimmed colors") {
+        renderer.set_print_progress_layer(5);
+        auto immediate = render_frame(renderer, file, camera, false);
+        auto arrays = render_frame(renderer, file, camera, true);
+        REQUIRE(count_differing_bytes(immediate, arrays) == 0);
+    }
+}
+
+TEST_CASE_METHOD(LVGLTestFixture, "GCodeTinyGLRenderer: submission path frame time",
+                 "[gcode][tinygl][performance][.benchmark]") {
+    // About 600k vertices: big enough to time, small enough to stay under the
+    // vertex-array budget (otherwise both runs would use immediate mode)
+    constexpr int FRAMES = 20;
+    ParsedGCodeFile file = make_zigzag_model(60, 60);
+    GCodeCamera camera = make_camera(file);
+
+    GCodeTinyGLRenderer renderer;
+    renderer.set_viewport_size(VIEW_WIDTH, VIEW_HEIGHT);
+
+    double immediate_ms = mean_frame_ms(renderer, file, camera, false, FRAMES);
+    auto immediate = renderer.capture_frame();
+    double arrays_ms = mean_frame_ms(renderer, file, camera, true, FRAMES);
+    auto arrays = renderer.capture_frame();
+
+    std::cout << std::fixed << std::setprecision(2) << "[tinygl benchmark] "
+              << renderer.get_triangle_count() << " triangles, " << VIEW_WIDTH << "x"
+              << VIEW_HEIGHT << ": immediate " << immediate_ms << " ms/frame, vertex arrays "
+              << arrays_ms << " ms/frame (" << (immediate_ms / arrays_ms) << "x)\n";
+
+    // A faster path only counts if it draws the same image
+    REQUIRE(count_differing_bytes(immediate, arrays) == 0);
+}
+
+#endif // ENABLE_TINYGL_3D
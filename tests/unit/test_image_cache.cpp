@@ -0,0 +1,161 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_image_cache.cpp
+ * @brief Unit tests for the decoded image cache, asset resolution and decode counters
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "image_cache.h"
+#include "lvgl/lvgl.h"
+
+#include <filesystem>
+
+namespace {
+
+// Small PNG shipped with the app (tests run from the repository root)
+const char* const TEST_PNG = "A:assets/images/folder.png";
+
+// Rewritten in place, like a re-downloaded thumbnail
+const char* const REWRITTEN_FILE = "/tmp/helix_image_cache_test.png";
+const char* const REWRITTEN_PNG = "A:/tmp/helix_image_cache_test.png";
+
+void write_test_image(const char* asset) {
+    std::filesystem::copy_file(asset, REWRITTEN_FILE,
+                               std::filesystem::copy_options::overwrite_existing);
+}
+
+void flush_cb(lv_display_t* display, const lv_area_t* /*area*/, uint8_t* /*px_map*/) {
+    lv_display_flush_ready(display);
+}
+
+} // namespace
+
+// Test fixture: headless display showing one image
+class ImageCacheTestFixture {
+  public:
+    ImageCacheTestFixture() {
+        lv_init();
+
+        display = lv_display_create(800, 480);
+        alignas(64) static lv_color_t buf1[800 * 10];
+        lv_display_set_buffers(display, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(display, flush_cb);
+
+        screen = lv_obj_create(NULL);
+        lv_screen_load(screen);
+    }
+
+    ~ImageCacheTestFixture() {
+        ImageCache::instance().init(ImageCache::DEFAULT_BUDGET_KB * 1024);
+        ImageCache::instance().drop_all();
+        ImageCache::instance().reset_stats();
+    }
+
+    // Draw the screen again, as when a panel is shown again
+    void redraw() {
+        lv_obj_invalidate(screen);
+        lv_refr_now(display);
+    }
+
+    lv_display_t* display = nullptr;
+    lv_obj_t* screen = nullptr;
+};
+
+TEST_CASE_METHOD(ImageCacheTestFixture, "ImageCache: redraws don't decode cached images",
+                 "[image_cache]") {
+    auto& cache = ImageCache::instance();
+    cache.init(ImageCache::DEFAULT_BUDGET_KB * 1024);
+    cache.drop_all();
+    cache.reset_stats();
+
+    lv_obj_t* img = lv_image_create(screen);
+    lv_image_set_src(img, TEST_PNG);
+    lv_refr_now(display);
+    REQUIRE(cache.stats().decodes == 1);
+
+    redraw();
+    redraw();
+    ImageCache::Stats stats = cache.stats();
+    REQUIRE(stats.decodes == 1);
+    REQUIRE(stats.hits >= 2);
+    REQUIRE(stats.budget_bytes == ImageCache::DEFAULT_BUDGET_KB * 1024);
+
+    SECTION("Dropped images are decoded again") {
+        cache.drop_all();
+        redraw();
+        REQUIRE(cache.stats().decodes == 2);
+    }
+}
+
+TEST_CASE_METHOD(ImageCacheTestFixture, "ImageCache: budget", "[image_cache]") {
+    auto& cache = ImageCache::instance();
+
+    SECTION("Zero disables caching: every draw decodes") {
+        cache.init(0);
+        cache.reset_stats();
+
+        lv_obj_t* img = lv_image_create(screen);
+        lv_image_set_src(img, TEST_PNG);
+        lv_refr_now(display);
+        uint64_t first_frame = cache.stats().decodes; // One per render band the image spans
+        REQUIRE(first_frame >= 1);
+
+        redraw();
+        REQUIRE(cache.stats().decodes == 2 * first_frame);
+        REQUIRE(cache.stats().hits == 0);
+    }
+
+    SECTION("Small budgets are raised to the minimum") {
+        cache.init(1024);
+        REQUIRE(cache.stats().budget_bytes == ImageCache::MIN_BUDGET_KB * 1024);
+    }
+}
+
+TEST_CASE_METHOD(ImageCacheTestFixture, "ImageCache: invalidate() drops a rewritten file",
+                 "[image_cache]") {
+    auto& cache = ImageCache::instance();
+    cache.init(ImageCache::DEFAULT_BUDGET_KB * 1024);
+    cache.drop_all();
+    cache.reset_stats();
+
+    // 200x200, then replaced by a 184x199 image under the same path
+    write_test_image("assets/images/folder.png");
+    lv_obj_t* img = lv_image_create(screen);
+    lv_image_set_src(img, REWRITTEN_PNG);
+    lv_refr_now(display);
+    REQUIRE(cache.stats().decodes == 1);
+    REQUIRE(lv_image_get_src_width(img) == 200);
+
+    write_test_image("assets/images/benchy_thumbnail_white.png");
+
+    SECTION("Without invalidate() the old image is still drawn") {
+        lv_image_set_src(img, REWRITTEN_PNG);
+        redraw();
+        REQUIRE(cache.stats().decodes == 1);
+        REQUIRE(lv_image_get_src_width(img) == 200);
+    }
+
+    SECTION("invalidate() makes the next draw decode the new file") {
+        cache.invalidate(REWRITTEN_PNG);
+        lv_image_set_src(img, REWRITTEN_PNG);
+        redraw();
+        REQUIRE(cache.stats().decodes == 2);
+        REQUIRE(lv_image_get_src_width(img) == 184);
+        REQUIRE(lv_image_get_src_height(img) == 199);
+    }
+
+    lv_obj_delete(img);
+    std::filesystem::remove(REWRITTEN_FILE);
+}
+
+TEST_CASE("ImageCache: resolve() keeps sources without a converted image", "[image_cache]") {
+    auto& cache = ImageCache::instance();
+
+    REQUIRE(cache.resolve("A:assets/images/no-such-image.png") ==
+            "A:assets/images/no-such-image.png");
+    REQUIRE(cache.resolve("A:/tmp/helix_thumbs/123.png") == "A:/tmp/helix_thumbs/123.png");
+    REQUIRE(cache.resolve("A:assets/images/large-extruder-icon.svg") ==
+            "A:assets/images/large-extruder-icon.svg");
+}
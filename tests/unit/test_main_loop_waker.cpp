@@ -0,0 +1,77 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_main_loop_waker.cpp
+ * @brief Unit tests for the event-driven main loop wakeup source
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "main_loop_waker.h"
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_CASE("MainLoopWaker: sleeps until the timeout", "[main_loop]") {
+    auto& waker = MainLoopWaker::instance();
+    REQUIRE(waker.init());
+    MainLoopWakeStats before = waker.get_stats();
+
+    auto start = Clock::now();
+    waker.wait(30);
+    REQUIRE(elapsed_ms(start) >= 25);
+
+    MainLoopWakeStats after = waker.get_stats();
+    REQUIRE(after.waits == before.waits + 1);
+    REQUIRE(after.timer_wakeups == before.timer_wakeups + 1);
+    REQUIRE(after.signal_wakeups == before.signal_wakeups);
+}
+
+TEST_CASE("MainLoopWaker: wake() from another thread ends the sleep", "[main_loop]") {
+    auto& waker = MainLoopWaker::instance();
+    REQUIRE(waker.init());
+    MainLoopWakeStats before = waker.get_stats();
+
+    std::thread background([&waker]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        waker.wake();
+    });
+
+    auto start = Clock::now();
+    waker.wait(5000);
+    int64_t waited = elapsed_ms(start);
+    background.join();
+
+    REQUIRE(waited < 2000);
+    REQUIRE(waker.get_stats().signal_wakeups == before.signal_wakeups + 1);
+}
+
+TEST_CASE("MainLoopWaker: wakeups before the wait are not lost", "[main_loop]") {
+    auto& waker = MainLoopWaker::instance();
+    REQUIRE(waker.init());
+
+    // Work queued between lv_timer_handler() and wait() must end the next wait at once;
+    // repeated wakes coalesce into a single wakeup
+    waker.wake();
+    waker.wake();
+    waker.wake();
+
+    auto start = Clock::now();
+    waker.wait(5000);
+    REQUIRE(elapsed_ms(start) < 2000);
+
+    // The wake was consumed: the following wait sleeps again
+    MainLoopWakeStats before = waker.get_stats();
+    waker.wait(10);
+    REQUIRE(waker.get_stats().timer_wakeups == before.timer_wakeups + 1);
+}
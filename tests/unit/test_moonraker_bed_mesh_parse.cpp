@@ -0,0 +1,119 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_bed_mesh_parse.cpp
+ * @brief Unit tests for bed mesh change detection in MoonrakerClient::parse_bed_mesh()
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "../../include/moonraker_client.h"
+
+#include <memory>
+
+// get_active_bed_mesh()/get_bed_mesh_profiles() are deprecated in favor of MoonrakerAPI,
+// but this exercises the client-side parser directly
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+namespace {
+
+json make_points(float offset) {
+    json points = json::array();
+    for (int row = 0; row < 3; row++) {
+        json r = json::array();
+        for (int col = 0; col < 3; col++) {
+            r.push_back(0.01 * (row * 3 + col) + offset);
+        }
+        points.push_back(r);
+    }
+    return points;
+}
+
+json make_profiles() {
+    json params = {{"min_x", 10.0}, {"max_x", 200.0}, {"min_y", 10.0},
+                   {"max_y", 200.0}, {"x_count", 3},  {"y_count", 3},
+                   {"algo", "bicubic"}};
+    return {{"default", {{"points", make_points(0.0f)}, {"mesh_params", params}}},
+            {"adaptive", {{"points", make_points(0.5f)}, {"mesh_params", params}}}};
+}
+
+json make_bed_mesh(const std::string& profile, float offset) {
+    return {{"profile_name", profile},
+            {"probed_matrix", make_points(offset)},
+            {"mesh_min", {10.0, 10.0}},
+            {"mesh_max", {200.0, 200.0}},
+            {"mesh_params", {{"algo", "bicubic"}}},
+            {"profiles", make_profiles()}};
+}
+
+} // namespace
+
+TEST_CASE("parse_bed_mesh skips unchanged re-emits", "[moonraker][bedmesh][change_detection]") {
+    auto loop = std::make_shared<hv::EventLoop>();
+    MoonrakerClient client(loop);
+
+    REQUIRE(client.parse_bed_mesh(make_bed_mesh("default", 0.0f)));
+    const BedMeshProfile& mesh = client.get_active_bed_mesh();
+    REQUIRE(mesh.x_count == 3);
+    REQUIRE(mesh.y_count == 3);
+    REQUIRE(mesh.content_hash != 0);
+    uint64_t first_hash = mesh.content_hash;
+
+    // Identical payload: nothing re-parsed, hash unchanged
+    REQUIRE_FALSE(client.parse_bed_mesh(make_bed_mesh("default", 0.0f)));
+    REQUIRE(client.get_active_bed_mesh().content_hash == first_hash);
+
+    auto stats = client.get_bed_mesh_stats();
+    REQUIRE(stats.updates == 2);
+    REQUIRE(stats.matrix_unchanged == 1);
+    REQUIRE(stats.profiles_parsed == 1);
+    REQUIRE(client.get_bed_mesh_profiles().size() == 2);
+}
+
+TEST_CASE("parse_bed_mesh reuses parsed profile on profile switch",
+          "[moonraker][bedmesh][change_detection]") {
+    auto loop = std::make_shared<hv::EventLoop>();
+    MoonrakerClient client(loop);
+
+    client.parse_bed_mesh(make_bed_mesh("default", 0.0f));
+    uint64_t default_hash = client.get_active_bed_mesh().content_hash;
+
+    // BED_MESH_PROFILE LOAD=adaptive: matrix equals the stored profile points
+    REQUIRE(client.parse_bed_mesh(make_bed_mesh("adaptive", 0.5f)));
+    const BedMeshProfile& mesh = client.get_active_bed_mesh();
+    REQUIRE(mesh.name == "adaptive");
+    REQUIRE(mesh.content_hash != default_hash);
+    REQUIRE(mesh.probed_matrix[0][0] == Catch::Approx(0.5f));
+
+    auto stats = client.get_bed_mesh_stats();
+    REQUIRE(stats.matrix_reused >= 1);
+    REQUIRE(stats.profiles_parsed == 1); // Profile set unchanged, not re-parsed
+}
+
+TEST_CASE("parse_bed_mesh detects new probe and bounds changes",
+          "[moonraker][bedmesh][change_detection]") {
+    auto loop = std::make_shared<hv::EventLoop>();
+    MoonrakerClient client(loop);
+
+    client.parse_bed_mesh(make_bed_mesh("default", 0.0f));
+    uint64_t hash = client.get_active_bed_mesh().content_hash;
+
+    // Fresh BED_MESH_CALIBRATE: new matrix not matching any stored profile
+    REQUIRE(client.parse_bed_mesh({{"probed_matrix", make_points(0.25f)}}));
+    REQUIRE(client.get_active_bed_mesh().content_hash != hash);
+    REQUIRE(client.get_active_bed_mesh().probed_matrix[0][0] == Catch::Approx(0.25f));
+    hash = client.get_active_bed_mesh().content_hash;
+
+    // Only the bounds change (adaptive mesh area)
+    REQUIRE(client.parse_bed_mesh({{"mesh_min", {50.0, 50.0}}}));
+    REQUIRE(client.get_active_bed_mesh().mesh_min[0] == Catch::Approx(50.0f));
+    REQUIRE(client.get_active_bed_mesh().content_hash != hash);
+    hash = client.get_active_bed_mesh().content_hash;
+
+    // Only the name changes: metadata update, same render content
+    REQUIRE(client.parse_bed_mesh({{"profile_name", "renamed"}}));
+    REQUIRE(client.get_active_bed_mesh().content_hash == hash);
+}
+
+#pragma GCC diagnostic pop
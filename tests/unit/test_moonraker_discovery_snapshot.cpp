@@ -0,0 +1,124 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_discovery_snapshot.cpp
+ * @brief Unit tests for the discovery snapshot cache used for fast reconnects
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "moonraker_discovery_snapshot.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+namespace {
+
+std::string temp_cache_path(const char* name) {
+    return "/tmp/helix_test_" + std::string(name) + "_" + std::to_string(getpid()) + ".json";
+}
+
+DiscoverySnapshot make_snapshot() {
+    DiscoverySnapshot snap;
+    snap.printer_objects = {"toolhead", "extruder", "heater_bed", "bed_mesh", "fan"};
+    snap.hostname = "voron";
+    snap.software_version = "v0.12.0-100";
+    snap.moonraker_version = "v0.9.3";
+    snap.kinematics = "corexy";
+    snap.mcu = "stm32f446xx";
+    snap.mcu_list = {"stm32f446xx", "rp2040"};
+    snap.build_volume.x_min = 0.0f;
+    snap.build_volume.x_max = 350.0f;
+    snap.build_volume.y_min = 0.0f;
+    snap.build_volume.y_max = 350.0f;
+    snap.build_volume.z_max = 340.0f;
+    snap.saved_at = 1700000000;
+    return snap;
+}
+
+} // namespace
+
+TEST_CASE("DiscoverySnapshot: JSON round-trip", "[moonraker][discovery_snapshot]") {
+    DiscoverySnapshot snap = make_snapshot();
+    auto parsed = DiscoverySnapshot::from_json(snap.to_json());
+
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->printer_objects == snap.printer_objects);
+    REQUIRE(parsed->hostname == "voron");
+    REQUIRE(parsed->software_version == "v0.12.0-100");
+    REQUIRE(parsed->moonraker_version == "v0.9.3");
+    REQUIRE(parsed->kinematics == "corexy");
+    REQUIRE(parsed->mcu_list.size() == 2);
+    REQUIRE(parsed->build_volume.x_max == Catch::Approx(350.0f));
+    REQUIRE(parsed->build_volume.z_max == Catch::Approx(340.0f));
+    REQUIRE(parsed->saved_at == 1700000000);
+}
+
+TEST_CASE("DiscoverySnapshot: rejects snapshots without objects",
+          "[moonraker][discovery_snapshot]") {
+    REQUIRE_FALSE(DiscoverySnapshot::from_json(json::object()).has_value());
+    REQUIRE_FALSE(DiscoverySnapshot::from_json({{"printer_objects", json::array()}}).has_value());
+    REQUIRE_FALSE(DiscoverySnapshot::from_json({{"printer_objects", {1, 2}}}).has_value());
+    REQUIRE_FALSE(DiscoverySnapshot::from_json(json("not an object")).has_value());
+}
+
+TEST_CASE("DiscoverySnapshotStore: host key from URL", "[moonraker][discovery_snapshot]") {
+    REQUIRE(DiscoverySnapshotStore::host_key("ws://192.168.1.10:7125/websocket") ==
+            "192.168.1.10:7125");
+    REQUIRE(DiscoverySnapshotStore::host_key("wss://printer.local:443/websocket") ==
+            "printer.local:443");
+    REQUIRE(DiscoverySnapshotStore::host_key("localhost:7125") == "localhost:7125");
+}
+
+TEST_CASE("DiscoverySnapshotStore: store, load and remove per host",
+          "[moonraker][discovery_snapshot]") {
+    std::string path = temp_cache_path("discovery_store");
+    std::remove(path.c_str());
+    DiscoverySnapshotStore store(path);
+
+    REQUIRE(store.enabled());
+    REQUIRE_FALSE(store.load("voron:7125").has_value());
+
+    DiscoverySnapshot voron = make_snapshot();
+    DiscoverySnapshot ender = make_snapshot();
+    ender.hostname = "ender";
+    ender.kinematics = "cartesian";
+    REQUIRE(store.store("voron:7125", voron));
+    REQUIRE(store.store("ender:7125", ender));
+
+    auto loaded = store.load("ender:7125");
+    REQUIRE(loaded.has_value());
+    REQUIRE(loaded->kinematics == "cartesian");
+    REQUIRE(store.load("voron:7125")->hostname == "voron");
+
+    REQUIRE(store.remove("voron:7125"));
+    REQUIRE_FALSE(store.remove("voron:7125"));
+    REQUIRE_FALSE(store.load("voron:7125").has_value());
+    REQUIRE(store.load("ender:7125").has_value());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("DiscoverySnapshotStore: corrupt or disabled cache", "[moonraker][discovery_snapshot]") {
+    std::string path = temp_cache_path("discovery_corrupt");
+    {
+        std::ofstream out(path);
+        out << "{ truncated";
+    }
+
+    DiscoverySnapshotStore store(path);
+    REQUIRE_FALSE(store.load("voron:7125").has_value());
+
+    // A corrupt cache is replaced on the next store
+    REQUIRE(store.store("voron:7125", make_snapshot()));
+    REQUIRE(store.load("voron:7125").has_value());
+    std::remove(path.c_str());
+
+    DiscoverySnapshotStore disabled;
+    REQUIRE_FALSE(disabled.enabled());
+    REQUIRE_FALSE(disabled.store("voron:7125", make_snapshot()));
+    REQUIRE_FALSE(disabled.load("voron:7125").has_value());
+}
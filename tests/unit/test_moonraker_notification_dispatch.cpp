@@ -0,0 +1,220 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_notification_dispatch.cpp
+ * @brief Unit tests for NotificationDispatcher (interned, copy-on-write handler table)
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "moonraker_notification_dispatch.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+static json make_notification(const std::string& method) {
+    return {{"jsonrpc", "2.0"}, {"method", method}, {"params", json::array({json::object()})}};
+}
+
+TEST_CASE("NotificationDispatcher: built-in methods have fixed IDs",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+
+    REQUIRE(dispatcher.lookup("notify_status_update") == NotificationDispatcher::STATUS_UPDATE);
+    REQUIRE(dispatcher.lookup("notify_filelist_changed") ==
+            NotificationDispatcher::FILELIST_CHANGED);
+    REQUIRE(dispatcher.lookup("notify_klippy_ready") == NotificationDispatcher::KLIPPY_READY);
+    REQUIRE(dispatcher.lookup("notify_klippy_disconnected") ==
+            NotificationDispatcher::KLIPPY_DISCONNECTED);
+    REQUIRE(dispatcher.lookup("notify_something_new") == NotificationDispatcher::UNKNOWN_METHOD);
+
+    // Registering a handler interns the method
+    dispatcher.add_method_handler("notify_something_new", "test", [](const json&) {});
+    NotificationMethodId id = dispatcher.lookup("notify_something_new");
+    REQUIRE(id >= NotificationDispatcher::BUILTIN_METHOD_COUNT);
+    REQUIRE(id != NotificationDispatcher::UNKNOWN_METHOD);
+}
+
+TEST_CASE("NotificationDispatcher: status subscribers fan out to status and filelist",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    int status_calls = 0;
+    int gcode_calls = 0;
+
+    dispatcher.add_status_handler(1, [&](const json&) { status_calls++; });
+    dispatcher.add_method_handler("notify_gcode_response", "console",
+                                  [&](const json&) { gcode_calls++; });
+
+    auto dispatch = [&](const std::string& method) {
+        return dispatcher.dispatch(dispatcher.lookup(method), make_notification(method));
+    };
+
+    REQUIRE(dispatch("notify_status_update") == 1);
+    REQUIRE(dispatch("notify_filelist_changed") == 1);
+    REQUIRE(dispatch("notify_gcode_response") == 1);
+    REQUIRE(dispatch("notify_klippy_ready") == 0);
+    REQUIRE(dispatch("notify_unregistered") == 0);
+
+    REQUIRE(status_calls == 2);
+    REQUIRE(gcode_calls == 1);
+    REQUIRE(dispatcher.unknown_count() == 1);
+
+    REQUIRE(dispatcher.dispatch_status(make_notification("notify_status_update")) == 1);
+    REQUIRE(status_calls == 3);
+}
+
+TEST_CASE("NotificationDispatcher: handlers receive the same message object",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    json message = make_notification("notify_status_update");
+    const json* seen_first = nullptr;
+    const json* seen_second = nullptr;
+
+    dispatcher.add_status_handler(1, [&](const json& j) { seen_first = &j; });
+    dispatcher.add_status_handler(2, [&](const json& j) { seen_second = &j; });
+    dispatcher.dispatch(NotificationDispatcher::STATUS_UPDATE, message);
+
+    REQUIRE(seen_first == &message);
+    REQUIRE(seen_second == &message);
+}
+
+TEST_CASE("NotificationDispatcher: registration and removal", "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    int first = 0;
+    int duplicate = 0;
+
+    REQUIRE(dispatcher.add_method_handler("notify_gcode_response", "console",
+                                          [&](const json&) { first++; }));
+    REQUIRE_FALSE(dispatcher.add_method_handler("notify_gcode_response", "console",
+                                                [&](const json&) { duplicate++; }));
+    dispatcher.dispatch(NotificationDispatcher::GCODE_RESPONSE,
+                        make_notification("notify_gcode_response"));
+    REQUIRE(first == 1);
+    REQUIRE(duplicate == 0);
+
+    REQUIRE(dispatcher.remove_method_handler("notify_gcode_response", "console"));
+    REQUIRE_FALSE(dispatcher.remove_method_handler("notify_gcode_response", "console"));
+    REQUIRE_FALSE(dispatcher.remove_method_handler("notify_never_registered", "console"));
+    REQUIRE(dispatcher.dispatch(NotificationDispatcher::GCODE_RESPONSE,
+                                make_notification("notify_gcode_response")) == 0);
+
+    dispatcher.add_status_handler(5, [](const json&) {});
+    REQUIRE(dispatcher.status_handler_count() == 1);
+    REQUIRE(dispatcher.remove_status_handler(5));
+    REQUIRE_FALSE(dispatcher.remove_status_handler(5));
+    REQUIRE(dispatcher.status_handler_count() == 0);
+}
+
+TEST_CASE("NotificationDispatcher: handler may unregister itself during dispatch",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    int calls = 0;
+
+    dispatcher.add_status_handler(1, [&](const json&) {
+        calls++;
+        dispatcher.remove_status_handler(1);
+    });
+    dispatcher.add_status_handler(2, [&](const json&) { calls++; });
+
+    // Both run: dispatch walks the snapshot taken before the removal
+    REQUIRE(dispatcher.dispatch_status(make_notification("notify_status_update")) == 2);
+    REQUIRE(calls == 2);
+    REQUIRE(dispatcher.dispatch_status(make_notification("notify_status_update")) == 1);
+    REQUIRE(calls == 3);
+}
+
+TEST_CASE("NotificationDispatcher: exceptions are contained and counted",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    bool later_ran = false;
+
+    dispatcher.add_method_handler("notify_gcode_response", "throws",
+                                  [](const json&) { throw std::runtime_error("boom"); });
+    dispatcher.add_method_handler("notify_gcode_response", "later",
+                                  [&](const json&) { later_ran = true; });
+
+    REQUIRE_NOTHROW(dispatcher.dispatch(NotificationDispatcher::GCODE_RESPONSE,
+                                        make_notification("notify_gcode_response")));
+    REQUIRE(later_ran);
+
+    bool found = false;
+    for (const auto& method : dispatcher.stats()) {
+        if (method.method != "notify_gcode_response") {
+            continue;
+        }
+        found = true;
+        REQUIRE(method.received == 1);
+        REQUIRE(method.handlers.size() == 2);
+        REQUIRE(method.handlers[0].name == "throws");
+        REQUIRE(method.handlers[0].exceptions == 1);
+        REQUIRE(method.handlers[1].calls == 1);
+    }
+    REQUIRE(found);
+}
+
+TEST_CASE("NotificationDispatcher: stats report status subscribers once",
+          "[moonraker][notification_dispatch]") {
+    NotificationDispatcher dispatcher;
+    dispatcher.add_status_handler(1, [](const json&) {}, "bed_mesh_panel");
+    dispatcher.add_status_handler(2, [](const json&) {});
+
+    dispatcher.dispatch(NotificationDispatcher::STATUS_UPDATE,
+                        make_notification("notify_status_update"));
+    dispatcher.dispatch(NotificationDispatcher::FILELIST_CHANGED,
+                        make_notification("notify_filelist_changed"));
+
+    size_t status_entries = 0;
+    for (const auto& method : dispatcher.stats()) {
+        if (method.method == "notify_status_update") {
+            REQUIRE(method.received == 1);
+            REQUIRE(method.handlers.size() == 2);
+            REQUIRE(method.handlers[0].name == "bed_mesh_panel");
+            REQUIRE(method.handlers[0].calls == 2);
+            REQUIRE(method.handlers[1].name == "subscriber#2");
+            status_entries++;
+        } else if (method.method == "notify_filelist_changed") {
+            REQUIRE(method.received == 1);
+            REQUIRE(method.handlers.empty());
+        } else {
+            // Methods with no traffic and no handlers are omitted
+            FAIL("unexpected stats entry " << method.method);
+        }
+    }
+    REQUIRE(status_entries == 1);
+}
+
+TEST_CASE("NotificationDispatcher: concurrent registration during dispatch",
+          "[moonraker][notification_dispatch][slow]") {
+    NotificationDispatcher dispatcher;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> calls{0};
+
+    std::thread dispatcher_thread([&]() {
+        json message = make_notification("notify_status_update");
+        while (!stop.load()) {
+            dispatcher.dispatch(NotificationDispatcher::STATUS_UPDATE, message);
+        }
+    });
+
+    std::vector<std::thread> registrars;
+    for (int t = 0; t < 4; t++) {
+        registrars.emplace_back([&, t]() {
+            for (uint64_t i = 0; i < 200; i++) {
+                uint64_t id = static_cast<uint64_t>(t) * 1000 + i + 1;
+                dispatcher.add_status_handler(id, [&](const json&) { calls++; });
+                if (i % 2 == 0) {
+                    dispatcher.remove_status_handler(id);
+                }
+            }
+        });
+    }
+    for (auto& thread : registrars) {
+        thread.join();
+    }
+    stop = true;
+    dispatcher_thread.join();
+
+    REQUIRE(dispatcher.status_handler_count() == 400);
+}
@@ -0,0 +1,175 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_request_table.cpp
+ * @brief Unit tests for PendingRequestTable (flat table + timeout wheel)
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "moonraker_request_table.h"
+
+#include <chrono>
+#include <set>
+
+using namespace std::chrono;
+using Clock = PendingRequestTable::Clock;
+
+static PendingRequest make_request(uint64_t id, Clock::time_point sent, uint32_t timeout_ms,
+                                   const std::string& method = "printer.info") {
+    PendingRequest request;
+    request.id = id;
+    request.method = method;
+    request.timestamp = sent;
+    request.timeout_ms = timeout_ms;
+    return request;
+}
+
+TEST_CASE("PendingRequestTable: insert, take and cancel", "[moonraker][request_table]") {
+    PendingRequestTable table;
+    auto now = Clock::now();
+
+    REQUIRE(table.insert(make_request(1, now, 1000)));
+    REQUIRE(table.insert(make_request(2, now, 1000, "server.info")));
+    REQUIRE_FALSE(table.insert(make_request(2, now, 1000))); // Duplicate ID rejected
+    REQUIRE(table.size() == 2);
+
+    auto taken = table.take(2);
+    REQUIRE(taken.has_value());
+    REQUIRE(taken->method == "server.info");
+    REQUIRE_FALSE(table.take(2).has_value());
+
+    REQUIRE(table.cancel(1));
+    REQUIRE_FALSE(table.cancel(1));
+    REQUIRE(table.empty());
+
+    auto stats = table.stats();
+    REQUIRE(stats.registered == 2);
+    REQUIRE(stats.completed == 1);
+    REQUIRE(stats.cancelled == 1);
+    REQUIRE(stats.peak_outstanding == 2);
+}
+
+TEST_CASE("PendingRequestTable: survives growth and colliding IDs",
+          "[moonraker][request_table]") {
+    PendingRequestTable table(50, 4);
+    auto now = Clock::now();
+
+    // Sequential IDs plus IDs that collide modulo every small power of two
+    std::set<uint64_t> ids;
+    for (uint64_t i = 1; i <= 200; i++) {
+        ids.insert(i);
+        ids.insert(i * 1024);
+    }
+    for (uint64_t id : ids) {
+        REQUIRE(table.insert(make_request(id, now, 60000)));
+    }
+    REQUIRE(table.size() == ids.size());
+
+    // Remove every other ID, then verify the rest are still reachable
+    bool remove = true;
+    for (uint64_t id : ids) {
+        if (remove) {
+            REQUIRE(table.take(id).has_value());
+        }
+        remove = !remove;
+    }
+    remove = true;
+    for (uint64_t id : ids) {
+        REQUIRE(table.contains(id) == !remove);
+        remove = !remove;
+    }
+}
+
+TEST_CASE("PendingRequestTable: expires only overdue requests", "[moonraker][request_table]") {
+    PendingRequestTable table(50);
+    auto start = Clock::now();
+
+    table.insert(make_request(1, start, 100));
+    table.insert(make_request(2, start, 5000));
+    table.insert(make_request(3, start, 120000)); // Lands in an upper wheel level
+
+    REQUIRE(table.collect_expired(start + milliseconds(50)).empty());
+
+    auto expired = table.collect_expired(start + milliseconds(200));
+    REQUIRE(expired.size() == 1);
+    REQUIRE(expired[0].id == 1);
+
+    expired = table.collect_expired(start + milliseconds(5001));
+    REQUIRE(expired.size() == 1);
+    REQUIRE(expired[0].id == 2);
+
+    REQUIRE(table.collect_expired(start + milliseconds(119000)).empty());
+    expired = table.collect_expired(start + milliseconds(120500));
+    REQUIRE(expired.size() == 1);
+    REQUIRE(expired[0].id == 3);
+
+    REQUIRE(table.empty());
+    REQUIRE(table.stats().timed_out == 3);
+}
+
+TEST_CASE("PendingRequestTable: completed requests never time out",
+          "[moonraker][request_table]") {
+    PendingRequestTable table(50);
+    auto start = Clock::now();
+
+    table.insert(make_request(7, start, 100));
+    REQUIRE(table.take(7).has_value());
+
+    REQUIRE(table.collect_expired(start + milliseconds(1000)).empty());
+    REQUIRE(table.stats().timed_out == 0);
+}
+
+TEST_CASE("PendingRequestTable: long gaps and far deadlines", "[moonraker][request_table]") {
+    PendingRequestTable table(10);
+    auto start = Clock::now();
+
+    // Far beyond the wheel span at 10ms ticks (~43 minutes)
+    table.insert(make_request(1, start, 4 * 3600 * 1000));
+    table.insert(make_request(2, start, 1000));
+
+    // Single call after a long pause (suspend) must still expire the short one
+    auto expired = table.collect_expired(start + hours(1));
+    REQUIRE(expired.size() == 1);
+    REQUIRE(expired[0].id == 2);
+
+    REQUIRE(table.collect_expired(start + hours(3)).empty());
+    expired = table.collect_expired(start + hours(4) + seconds(1));
+    REQUIRE(expired.size() == 1);
+    REQUIRE(expired[0].id == 1);
+}
+
+TEST_CASE("PendingRequestTable: take_all empties table and wheel", "[moonraker][request_table]") {
+    PendingRequestTable table;
+    auto start = Clock::now();
+
+    for (uint64_t id = 1; id <= 10; id++) {
+        table.insert(make_request(id, start, 100));
+    }
+    REQUIRE(table.take_all().size() == 10);
+    REQUIRE(table.empty());
+    REQUIRE(table.collect_expired(start + seconds(10)).empty());
+}
+
+TEST_CASE("RpcLatencyHistogram: buckets and percentiles", "[moonraker][request_table]") {
+    RpcLatencyHistogram hist;
+    REQUIRE(hist.percentile_ms(0.5) == 0);
+
+    hist.record(0);   // [0,1)
+    hist.record(3);   // [2,4)
+    hist.record(3);   // [2,4)
+    hist.record(900); // [512,1024)
+
+    REQUIRE(hist.count == 4);
+    REQUIRE(hist.buckets[0] == 1);
+    REQUIRE(hist.buckets[2] == 2);
+    REQUIRE(hist.buckets[10] == 1);
+    REQUIRE(hist.max_ms == 900);
+    REQUIRE(hist.mean_ms() == Catch::Approx(226.5));
+    REQUIRE(hist.percentile_ms(0.5) == 4);
+    REQUIRE(hist.percentile_ms(0.99) == 900);
+
+    // Very slow responses land in the overflow bucket
+    hist.record(1000000);
+    REQUIRE(hist.buckets[RpcLatencyHistogram::BUCKET_COUNT - 1] == 1);
+}
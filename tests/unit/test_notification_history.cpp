@@ -10,9 +10,13 @@
 #include "ui_notification_history.h"
 #include "ui_toast.h"
 
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
 #include <thread>
 #include <vector>
-#include <cstring>
 
 // Helper to create a test entry
 static NotificationHistoryEntry make_entry(ToastSeverity severity, const char* message,
@@ -232,6 +236,225 @@ TEST_CASE("NotificationHistory: Filter by severity", "[notification][filter]") {
     REQUIRE(all.size() == 5);
 }
 
+TEST_CASE("NotificationHistory: Query pages and filters in place", "[notification][filter]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    history.clear();
+
+    for (int i = 0; i < 10; i++) {
+        char msg[32];
+        snprintf(msg, sizeof(msg), "Message %d", i);
+        NotificationHistoryEntry entry =
+            make_entry(i % 2 ? ToastSeverity::ERROR : ToastSeverity::INFO, msg);
+        entry.timestamp_ms = 1000 * static_cast<uint64_t>(i);
+        history.add(entry);
+    }
+
+    std::vector<std::string> seen;
+    auto collect = [&seen](const NotificationHistoryEntry& e) { seen.emplace_back(e.message); };
+
+    SECTION("Pages are newest first") {
+        NotificationQuery page;
+        page.offset = 2;
+        page.limit = 3;
+        REQUIRE(history.query(page, collect) == 3);
+        REQUIRE(seen == std::vector<std::string>{"Message 7", "Message 6", "Message 5"});
+    }
+
+    SECTION("Severity filter applies before paging") {
+        NotificationQuery errors;
+        errors.severity = static_cast<int>(ToastSeverity::ERROR);
+        errors.offset = 1;
+        errors.limit = 2;
+        REQUIRE(history.query(errors, collect) == 2);
+        REQUIRE(seen == std::vector<std::string>{"Message 7", "Message 5"});
+        REQUIRE(history.count_matching(errors) == 5);
+    }
+
+    SECTION("Time range and unread") {
+        history.mark_all_read();
+        history.add(make_entry(ToastSeverity::WARNING, "Late"));
+
+        NotificationQuery range;
+        range.since_ms = 3000;
+        range.until_ms = 5000;
+        REQUIRE(history.query(range, collect) == 3);
+
+        NotificationQuery unread;
+        unread.unread_only = true;
+        REQUIRE(history.count_matching(unread) == 1);
+    }
+}
+
+TEST_CASE("NotificationHistory: Unread counts follow overwritten entries", "[notification][unread]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    history.clear();
+
+    history.add(make_entry(ToastSeverity::ERROR, "Oldest"));
+    for (size_t i = 1; i < NotificationHistory::MAX_ENTRIES; i++) {
+        history.add(make_entry(ToastSeverity::INFO, "Filler"));
+    }
+    REQUIRE(history.get_highest_unread_severity() == ToastSeverity::ERROR);
+
+    // Wrapping around drops the only error
+    history.add(make_entry(ToastSeverity::INFO, "Newest"));
+    REQUIRE(history.get_unread_count() == NotificationHistory::MAX_ENTRIES);
+    REQUIRE(history.get_highest_unread_severity() == ToastSeverity::INFO);
+}
+
+// ============================================================================
+// Persistence Tests
+// ============================================================================
+
+namespace {
+
+const char* const LOG_PATH = "/tmp/helix_notification_history_test.log";
+
+size_t count_lines(const char* path) {
+    std::ifstream file(path);
+    std::string line;
+    size_t lines = 0;
+    while (std::getline(file, line)) {
+        lines++;
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("NotificationHistory: Log is replayed on open", "[notification][persistence]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    std::remove(LOG_PATH);
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    REQUIRE(history.count() == 0);
+
+    history.add(make_entry(ToastSeverity::INFO, "Before clear"));
+    history.clear();
+    history.add(make_entry(ToastSeverity::ERROR, "Kept"));
+    history.mark_all_read();
+    history.add(make_entry(ToastSeverity::WARNING, "Unread"));
+    history.close_log();
+
+    NotificationLogStats stats = history.log_stats();
+    REQUIRE(stats.records == 5);
+    REQUIRE(stats.batches >= 1);
+    REQUIRE(stats.batches < stats.records); // Adds in quick succession share an append
+    REQUIRE(count_lines(LOG_PATH) == 5);
+
+    // Not logged: the history is replaced by the log content on open
+    history.add(make_entry(ToastSeverity::INFO, "Not logged"));
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.close_log();
+
+    auto entries = history.get_all();
+    REQUIRE(entries.size() == 2);
+    REQUIRE(std::string(entries[0].message) == "Unread");
+    REQUIRE(std::string(entries[1].message) == "Kept");
+    REQUIRE(entries[1].was_read);
+    REQUIRE(history.get_unread_count() == 1);
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE("NotificationHistory: Replayed entries keep wall-clock timestamps",
+          "[notification][persistence]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    std::remove(LOG_PATH);
+    REQUIRE(history.open_log(LOG_PATH, 10));
+
+    // An hour ago in a previous session: LVGL ticks would have restarted since
+    NotificationHistoryEntry entry = make_entry(ToastSeverity::INFO, "Earlier");
+    entry.timestamp_ms = NotificationHistory::now_ms() - 3600 * 1000;
+    history.add(entry);
+    history.close_log();
+
+    history.clear();
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.close_log();
+
+    auto entries = history.get_all();
+    REQUIRE(entries.size() == 1);
+    REQUIRE(entries[0].timestamp_ms == entry.timestamp_ms);
+
+    NotificationQuery last_day;
+    last_day.since_ms = NotificationHistory::now_ms() - 24 * 3600 * 1000;
+    REQUIRE(history.count_matching(last_day) == 1);
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE("NotificationHistory: Torn last record is skipped", "[notification][persistence]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    {
+        std::ofstream file(LOG_PATH, std::ios::trunc);
+        file << R"({"op":"add","timestamp":5,"severity":"ERROR","title":"T","message":"Whole"})"
+             << "\n"
+             << R"({"op":"add","timestamp":6,"sever)";
+    }
+
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.close_log();
+
+    auto entries = history.get_all();
+    REQUIRE(entries.size() == 1);
+    REQUIRE(entries[0].severity == ToastSeverity::ERROR);
+    REQUIRE(std::string(entries[0].title) == "T");
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE("NotificationHistory: Records with wrong field types are skipped",
+          "[notification][persistence]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    {
+        std::ofstream file(LOG_PATH, std::ios::trunc);
+        file << R"({"op":"add","timestamp":"soon","severity":"INFO","message":"Bad time"})"
+             << "\n"
+             << R"({"op":"add","timestamp":5,"severity":"ERROR","title":7,"message":"Bad title"})"
+             << "\n"
+             << R"({"op":["read"]})"
+             << "\n"
+             << R"({"op":"add","timestamp":6,"severity":"WARNING","message":"Good"})"
+             << "\n";
+    }
+
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.close_log();
+
+    auto entries = history.get_all();
+    REQUIRE(entries.size() == 1);
+    REQUIRE(std::string(entries[0].message) == "Good");
+    REQUIRE(history.get_unread_count() == 1);
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE("NotificationHistory: Log is compacted", "[notification][persistence]") {
+    NotificationHistory& history = NotificationHistory::instance();
+    std::remove(LOG_PATH);
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.clear();
+
+    for (size_t i = 0; i < NotificationHistory::COMPACT_RECORDS + 10; i++) {
+        char msg[32];
+        snprintf(msg, sizeof(msg), "Message %zu", i);
+        history.add(make_entry(ToastSeverity::INFO, msg));
+    }
+    history.close_log();
+
+    REQUIRE(history.log_stats().compactions >= 1);
+    REQUIRE(count_lines(LOG_PATH) < NotificationHistory::COMPACT_RECORDS);
+
+    auto before = history.get_all();
+    REQUIRE(history.open_log(LOG_PATH, 10));
+    history.close_log();
+    auto after = history.get_all();
+    REQUIRE(after.size() == before.size());
+    REQUIRE(std::string(after[0].message) == std::string(before[0].message));
+    REQUIRE(std::string(after.back().message) == std::string(before.back().message));
+
+    std::remove(LOG_PATH);
+}
+
 // ============================================================================
 // Thread Safety Tests
 // ============================================================================
@@ -0,0 +1,216 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_panel_registry.cpp
+ * @brief Unit tests for lazy panel creation, eviction and the startup trace
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "lvgl/lvgl.h"
+#include "startup_trace.h"
+#include "ui_nav.h"
+#include "ui_panel_registry.h"
+
+namespace {
+
+const char* const TEST_PANEL_XML = R"(
+<component>
+  <view extends="lv_obj" width="100%" height="100%">
+    <lv_label name="title" text="Lazy"/>
+  </view>
+</component>
+)";
+
+void flush_cb(lv_display_t* display, const lv_area_t* /*area*/, uint8_t* /*px_map*/) {
+    lv_display_flush_ready(display);
+}
+
+lv_obj_t* create_test_panel(ui_panel_id_t /*panel_id*/) {
+    return PanelRegistry::instance().get("registry_test_panel");
+}
+
+} // namespace
+
+// Test fixture: headless display plus a registered XML component
+class PanelRegistryTestFixture {
+  public:
+    PanelRegistryTestFixture() {
+        lv_init();
+
+        display = lv_display_create(800, 480);
+        alignas(64) static lv_color_t buf1[800 * 10];
+        lv_display_set_buffers(display, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(display, flush_cb);
+
+        ui_nav_init();
+        lv_xml_register_component_from_data("registry_test_panel", TEST_PANEL_XML);
+
+        screen = lv_obj_create(NULL);
+        lv_screen_load(screen);
+    }
+
+    ~PanelRegistryTestFixture() {
+        // Navigation must not keep pointers to the panels deleted below
+        lv_obj_t* no_panels[UI_PANEL_COUNT] = {};
+        ui_nav_set_panel_factory(nullptr);
+        ui_nav_set_panels(no_panels);
+        PanelRegistry::instance().clear();
+    }
+
+    lv_display_t* display = nullptr;
+    lv_obj_t* screen = nullptr;
+};
+
+TEST_CASE_METHOD(PanelRegistryTestFixture, "PanelRegistry: panels are created on first get()",
+                 "[panel_registry]") {
+    auto& registry = PanelRegistry::instance();
+    int setup_calls = 0;
+    registry.add("registry_test_panel", screen, [&](lv_obj_t* obj) {
+        setup_calls++;
+        REQUIRE(lv_obj_find_by_name(obj, "title") != nullptr);
+    });
+
+    REQUIRE(registry.created_count() == 0);
+    REQUIRE(registry.find("registry_test_panel") == nullptr);
+
+    lv_obj_t* panel = registry.get("registry_test_panel");
+    REQUIRE(panel != nullptr);
+    REQUIRE(setup_calls == 1);
+    REQUIRE(lv_obj_has_flag(panel, LV_OBJ_FLAG_HIDDEN));
+    REQUIRE(lv_obj_find_by_name(screen, "registry_test_panel") == panel);
+
+    SECTION("Later calls return the same widget without running setup again") {
+        REQUIRE(registry.get("registry_test_panel") == panel);
+        REQUIRE(setup_calls == 1);
+        REQUIRE(registry.created_count() == 1);
+    }
+
+    SECTION("Unregistered components are not created") {
+        REQUIRE(registry.get("not_registered") == nullptr);
+    }
+}
+
+TEST_CASE_METHOD(PanelRegistryTestFixture, "PanelRegistry: pre-warming creates queued panels",
+                 "[panel_registry]") {
+    auto& registry = PanelRegistry::instance();
+    int setup_calls = 0;
+    registry.add("registry_test_panel", screen, [&](lv_obj_t*) { setup_calls++; });
+
+    registry.prewarm({"registry_test_panel", "registry_test_panel"});
+    REQUIRE(registry.prewarm_next());
+    REQUIRE(registry.find("registry_test_panel") != nullptr);
+    REQUIRE(setup_calls == 1);
+
+    // Duplicates and already created panels are skipped
+    REQUIRE_FALSE(registry.prewarm_next());
+    registry.prewarm({"registry_test_panel"});
+    REQUIRE_FALSE(registry.prewarm_next());
+}
+
+TEST_CASE_METHOD(PanelRegistryTestFixture, "PanelRegistry: eviction", "[panel_registry]") {
+    auto& registry = PanelRegistry::instance();
+    int setup_calls = 0;
+    int evict_calls = 0;
+
+    SECTION("Panels without an evict callback are kept") {
+        registry.add("registry_test_panel", screen, [&](lv_obj_t*) { setup_calls++; });
+        registry.get("registry_test_panel");
+        REQUIRE(registry.evict() == 0);
+        REQUIRE(registry.created_count() == 1);
+    }
+
+    SECTION("Hidden overlays are deleted and recreated on next use") {
+        registry.add(
+            "registry_test_panel", screen, [&](lv_obj_t*) { setup_calls++; },
+            [&] { evict_calls++; });
+        registry.get("registry_test_panel");
+
+        REQUIRE(registry.evict() == 1);
+        REQUIRE(evict_calls == 1);
+        REQUIRE(registry.find("registry_test_panel") == nullptr);
+        REQUIRE(lv_obj_find_by_name(screen, "registry_test_panel") == nullptr);
+
+        REQUIRE(registry.get("registry_test_panel") != nullptr);
+        REQUIRE(setup_calls == 2);
+    }
+
+    SECTION("Visible overlays are kept") {
+        registry.add(
+            "registry_test_panel", screen, [&](lv_obj_t*) { setup_calls++; },
+            [&] { evict_calls++; });
+        lv_obj_t* panel = registry.get("registry_test_panel");
+        lv_obj_remove_flag(panel, LV_OBJ_FLAG_HIDDEN);
+
+        REQUIRE(registry.evict() == 0);
+        REQUIRE(evict_calls == 0);
+        REQUIRE(registry.find("registry_test_panel") == panel);
+    }
+
+    SECTION("Deleting the parent forgets the widget") {
+        lv_obj_t* parent = lv_obj_create(screen);
+        registry.add(
+            "registry_test_panel", parent, [&](lv_obj_t*) { setup_calls++; },
+            [&] { evict_calls++; });
+        registry.get("registry_test_panel");
+
+        lv_obj_delete(parent);
+        REQUIRE(registry.find("registry_test_panel") == nullptr);
+        REQUIRE(registry.evict() == 0);
+    }
+}
+
+TEST_CASE_METHOD(PanelRegistryTestFixture, "Navigation creates lazy main panels on demand",
+                 "[panel_registry][navigation]") {
+    auto& registry = PanelRegistry::instance();
+    int setup_calls = 0;
+    registry.add("registry_test_panel", screen, [&](lv_obj_t*) { setup_calls++; });
+
+    ui_nav_set_active(UI_PANEL_HOME);
+    lv_obj_t* home = lv_obj_create(screen);
+    lv_obj_t* panels[UI_PANEL_COUNT] = {home};
+    ui_nav_set_panels(panels);
+    ui_nav_set_panel_factory(create_test_panel);
+    REQUIRE(setup_calls == 0);
+
+    ui_nav_set_active(UI_PANEL_SETTINGS);
+    REQUIRE(setup_calls == 1);
+    lv_obj_t* settings = registry.find("registry_test_panel");
+    REQUIRE(settings != nullptr);
+    REQUIRE(ui_nav_is_in_stack(settings));
+    REQUIRE(lv_obj_get_parent(settings) == screen);
+
+    // Already created: the factory isn't asked again
+    ui_nav_set_active(UI_PANEL_HOME);
+    ui_nav_set_active(UI_PANEL_SETTINGS);
+    REQUIRE(setup_calls == 1);
+}
+
+TEST_CASE_METHOD(PanelRegistryTestFixture, "StartupTrace: phases and first frame",
+                 "[panel_registry][startup]") {
+    auto& trace = StartupTrace::instance();
+    trace.reset();
+
+    trace.begin("xml_parse");
+    trace.begin("subjects");
+    trace.end();
+    REQUIRE(trace.phases().size() == 2);
+    REQUIRE(trace.phases()[0].name == "xml_parse");
+    REQUIRE(trace.phases()[1].name == "subjects");
+    REQUIRE(trace.summary().find("xml_parse") == 0);
+    REQUIRE(trace.summary().find("(total ") != std::string::npos);
+
+    trace.mark("first_pixel");
+    REQUIRE(trace.milestones().size() == 1);
+    REQUIRE(trace.milestones()[0].name == "first_pixel");
+    REQUIRE(trace.summary().find(", first_pixel at ") != std::string::npos);
+
+    trace.finish_on_first_frame(display);
+    REQUIRE_FALSE(trace.is_finished());
+
+    lv_obj_create(screen);
+    lv_refr_now(display);
+    REQUIRE(trace.is_finished());
+    REQUIRE(trace.phases().size() == 3);
+    REQUIRE(trace.phases()[2].name == "first_flush");
+}
@@ -0,0 +1,91 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_pattern_matcher.cpp
+ * @brief Unit tests for the multi-pattern substring matcher used by PrinterDetector
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "pattern_matcher.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> found_patterns(const PatternMatcher& matcher,
+                                        const std::vector<std::string>& texts) {
+    std::vector<bool> found;
+    for (const auto& text : texts) {
+        matcher.find_all(text, found);
+    }
+    std::vector<std::string> result;
+    for (size_t id = 0; id < matcher.size(); id++) {
+        if (id < found.size() && found[id]) {
+            result.push_back(matcher.pattern(id));
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("PatternMatcher: finds every pattern in one pass", "[pattern_matcher]") {
+    PatternMatcher matcher;
+    matcher.add("he");
+    matcher.add("she");
+    matcher.add("his");
+    matcher.add("hers");
+    matcher.build();
+
+    REQUIRE(found_patterns(matcher, {"ushers"}) == std::vector<std::string>{"he", "she", "hers"});
+    REQUIRE(found_patterns(matcher, {"this"}) == std::vector<std::string>{"his"});
+    REQUIRE(found_patterns(matcher, {"xyz", ""}).empty());
+}
+
+TEST_CASE("PatternMatcher: ignores case and shares IDs", "[pattern_matcher]") {
+    PatternMatcher matcher;
+    size_t qgl = matcher.add("Quad_Gantry_Level");
+    REQUIRE(matcher.add("quad_gantry_level") == qgl);
+    size_t z_tilt = matcher.add("z_tilt");
+    matcher.build();
+
+    REQUIRE(matcher.size() == 2);
+    REQUIRE(matcher.pattern(qgl) == "quad_gantry_level");
+
+    std::vector<bool> found;
+    matcher.find_all("QUAD_GANTRY_LEVEL", found);
+    REQUIRE(found[qgl]);
+    REQUIRE_FALSE(found[z_tilt]);
+
+    // Results accumulate across texts
+    matcher.find_all("z_tilt", found);
+    REQUIRE(found[qgl]);
+    REQUIRE(found[z_tilt]);
+}
+
+TEST_CASE("PatternMatcher: overlapping and nested patterns", "[pattern_matcher]") {
+    PatternMatcher matcher;
+    matcher.add("stepper_z");
+    matcher.add("z1");
+    matcher.add("per_z");
+    matcher.add("aab");
+    matcher.build();
+
+    REQUIRE(found_patterns(matcher, {"stepper_z1"}) ==
+            std::vector<std::string>{"stepper_z", "z1", "per_z"});
+    REQUIRE(found_patterns(matcher, {"aaab"}) == std::vector<std::string>{"aab"});
+}
+
+TEST_CASE("PatternMatcher: empty pattern occurs in every text", "[pattern_matcher]") {
+    PatternMatcher matcher;
+    size_t empty = matcher.add("");
+    size_t fan = matcher.add("fan");
+    matcher.build();
+
+    std::vector<bool> found;
+    matcher.find_all("", found);
+    REQUIRE(found[empty]);
+    REQUIRE_FALSE(found[fan]);
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_pixel_convert.cpp
+ * @brief Bit-exactness tests for the XRGB8888 -> RGB565 framebuffer converter
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "pixel_convert.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+TEST_CASE("pixel_convert: scalar reference truncates each channel", "[pixel_convert]") {
+    const uint32_t src[] = {0x00000000, 0x00FFFFFF, 0x00FF0000, 0x0000FF00,
+                            0x000000FF, 0xFF123456, 0x00070307, 0x00F8FCF8};
+    uint16_t dst[8];
+    pixel_convert_xrgb8888_to_rgb565_scalar(src, dst, 8);
+
+    REQUIRE(dst[0] == 0x0000);
+    REQUIRE(dst[1] == 0xFFFF);
+    REQUIRE(dst[2] == 0xF800);
+    REQUIRE(dst[3] == 0x07E0);
+    REQUIRE(dst[4] == 0x001F);
+    REQUIRE(dst[5] == (((0x12 >> 3) << 11) | ((0x34 >> 2) << 5) | (0x56 >> 3))); // Alpha ignored
+    REQUIRE(dst[6] == 0x0000); // Below one step in every channel
+    REQUIRE(dst[7] == 0xFFFF);
+}
+
+TEST_CASE("pixel_convert: vectorized output matches scalar bit for bit", "[pixel_convert]") {
+    INFO("implementation: " << pixel_convert_implementation());
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<uint32_t> dist;
+
+    // Odd lengths exercise the scalar tail after the 8-pixel vector loop
+    for (size_t count : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(63),
+                         size_t(800 * 3 + 5)}) {
+        std::vector<uint32_t> src(count);
+        for (auto& p : src) {
+            p = dist(rng);
+        }
+
+        std::vector<uint16_t> expected(count + 1, 0xA5A5);
+        std::vector<uint16_t> actual(count + 1, 0xA5A5);
+        pixel_convert_xrgb8888_to_rgb565_scalar(src.data(), expected.data(), count);
+        pixel_convert_xrgb8888_to_rgb565(src.data(), actual.data(), count);
+
+        REQUIRE(std::memcmp(expected.data(), actual.data(), (count + 1) * sizeof(uint16_t)) ==
+                0);
+        REQUIRE(actual[count] == 0xA5A5); // No write past the end
+    }
+}
+
+TEST_CASE("pixel_convert: every channel value converts exactly", "[pixel_convert]") {
+    // Sweep each channel through all 256 values with the other two at edge values
+    std::vector<uint32_t> src;
+    for (uint32_t v = 0; v < 256; v++) {
+        for (uint32_t other : {0x00u, 0x7Fu, 0xFFu}) {
+            src.push_back((v << 16) | (other << 8) | other);
+            src.push_back((other << 16) | (v << 8) | other);
+            src.push_back((other << 16) | (other << 8) | v);
+        }
+    }
+
+    std::vector<uint16_t> expected(src.size());
+    std::vector<uint16_t> actual(src.size());
+    pixel_convert_xrgb8888_to_rgb565_scalar(src.data(), expected.data(), src.size());
+    pixel_convert_xrgb8888_to_rgb565(src.data(), actual.data(), src.size());
+
+    REQUIRE(expected == actual);
+}
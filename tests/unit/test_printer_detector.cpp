@@ -20,6 +20,11 @@
 
 #include "printer_detector.h"
 
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <string>
+
 #include "../catch_amalgamated.hpp"
 
 // ============================================================================
@@ -2020,3 +2025,51 @@ TEST_CASE_METHOD(PrinterDetectorFixture,
         REQUIRE(result.confidence <= 35);
     }
 }
+
+// ============================================================================
+// Performance Tests
+// ============================================================================
+
+TEST_CASE_METHOD(PrinterDetectorFixture, "PrinterDetector: detection time over the full database",
+                 "[printer_detector][performance][.benchmark]") {
+    // A busy Klipper install: every rule in the database is scored against ~300 names
+    PrinterHardwareData hardware{.heaters = {"extruder", "extruder1", "heater_bed"},
+                                 .sensors = {"temperature_sensor chamber",
+                                             "temperature_sensor raspberry_pi",
+                                             "temperature_sensor octopus"},
+                                 .fans = {"fan", "heater_fan hotend_fan", "controller_fan",
+                                          "fan_generic nevermore", "fan_generic bed_fans"},
+                                 .leds = {"neopixel sb_leds", "neopixel chamber"},
+                                 .hostname = "my-printer",
+                                 .printer_objects = {},
+                                 .steppers = {"stepper_x", "stepper_y", "stepper_z",
+                                              "stepper_z1", "stepper_z2", "stepper_z3"},
+                                 .kinematics = "corexy",
+                                 .mcu = "stm32h723xx",
+                                 .mcu_list = {"stm32h723xx", "rp2040"},
+                                 .build_volume = {0.0f, 350.0f, 0.0f, 350.0f, 340.0f}};
+    for (int i = 0; i < 200; i++) {
+        hardware.printer_objects.push_back("gcode_macro USER_MACRO_" + std::to_string(i));
+    }
+    for (int i = 0; i < 100; i++) {
+        hardware.printer_objects.push_back("gcode_button button_" + std::to_string(i));
+    }
+    hardware.printer_objects.push_back("quad_gantry_level");
+
+    auto expected = PrinterDetector::detect(hardware); // Loads the database
+    REQUIRE(expected.detected());
+
+    const int iterations = 200;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        auto result = PrinterDetector::detect(hardware);
+        REQUIRE(result.type_name == expected.type_name);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double us_per_detect =
+        std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+
+    spdlog::info("[PrinterDetector benchmark] {} objects: {:.1f} us/detect ({})",
+                 hardware.printer_objects.size(), us_per_detect, expected.type_name);
+    REQUIRE(us_per_detect > 0.0);
+}
@@ -18,12 +18,18 @@
  * along with HelixScreen. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "../../include/temperature_history.h"
 #include "../../include/ui_temp_graph.h"
 #include "../../include/ui_theme.h"
 #include "lvgl/lvgl.h"
 
 #include "../catch_amalgamated.hpp"
 
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <string>
+
 // Test fixture for temperature graph tests
 class TempGraphTestFixture {
   public:
@@ -638,6 +644,50 @@ TEST_CASE_METHOD(TempGraphTestFixture, "Set point count", "[temp_graph][config]"
     ui_temp_graph_destroy(graph);
 }
 
+TEST_CASE_METHOD(TempGraphTestFixture, "Bind series to temperature history",
+                 "[temp_graph][history]") {
+    auto& history = TemperatureHistory::instance();
+    history.clear();
+    const int64_t t0 = 1'700'000'000'000;
+    for (int i = 0; i < 60; i++) {
+        history.record("extruder", t0 + i * 1000, 2000 + i);
+    }
+
+    ui_temp_graph_t* graph = ui_temp_graph_create(screen);
+    REQUIRE(graph != nullptr);
+    int id = ui_temp_graph_add_series(graph, "Nozzle", lv_color_hex(0xFF5722));
+    REQUIRE(id >= 0);
+
+    SECTION("Binding sizes the chart to two points per bucket") {
+        ui_temp_graph_bind_history(graph, id, "extruder");
+        REQUIRE(graph->point_count >= 2);
+        REQUIRE(graph->point_count % 2 == 0);
+        REQUIRE(graph->series_meta[id].history_points != nullptr);
+    }
+
+    SECTION("Refresh redraws only when the history changed") {
+        ui_temp_graph_bind_history(graph, id, "extruder");
+        REQUIRE_FALSE(ui_temp_graph_refresh_history(graph));
+
+        history.record("extruder", t0 + 60000, 2100);
+        REQUIRE(ui_temp_graph_refresh_history(graph));
+        REQUIRE_FALSE(ui_temp_graph_refresh_history(graph));
+    }
+
+    SECTION("Pushed points are ignored for bound series") {
+        ui_temp_graph_bind_history(graph, id, "extruder");
+        ui_temp_graph_update_series(graph, id, 999.0f);
+        REQUIRE_FALSE(ui_temp_graph_refresh_history(graph));
+    }
+
+    SECTION("Refresh without bound series does nothing") {
+        REQUIRE_FALSE(ui_temp_graph_refresh_history(graph));
+    }
+
+    ui_temp_graph_destroy(graph);
+    history.clear();
+}
+
 TEST_CASE_METHOD(TempGraphTestFixture, "Set series gradient", "[temp_graph][config]") {
     ui_temp_graph_t* graph = ui_temp_graph_create(screen);
     REQUIRE(graph != nullptr);
@@ -805,3 +855,77 @@ TEST_CASE_METHOD(TempGraphTestFixture, "Stress tests", "[temp_graph][stress]") {
 
     ui_temp_graph_destroy(graph);
 }
+
+// ============================================================================
+// Performance Tests
+// ============================================================================
+
+TEST_CASE_METHOD(TempGraphTestFixture, "Temp graph: CPU per sample",
+                 "[temp_graph][performance][.benchmark]") {
+    // Render every sample through a dummy flush so invalidation cost is measured too
+    lv_display_set_flush_cb(lv_display_get_default(),
+                            [](lv_display_t* disp, const lv_area_t*, uint8_t*) {
+                                lv_display_flush_ready(disp);
+                            });
+    lv_screen_load(screen);
+
+    auto& history = TemperatureHistory::instance();
+    const int64_t t0 = 1'700'000'000'000;
+    const int warmup = 300; // Fill the 5 minute window before measuring
+    const int samples = 120;
+
+    for (bool bound : {false, true}) {
+        for (int series_count : {1, 2, 4, 8}) {
+            history.clear();
+            ui_temp_graph_t* graph = ui_temp_graph_create(screen);
+            REQUIRE(graph != nullptr);
+            lv_obj_set_size(ui_temp_graph_get_chart(graph), 480, 240);
+            ui_temp_graph_set_temp_range(graph, 0.0f, 300.0f);
+
+            int ids[UI_TEMP_GRAPH_MAX_SERIES];
+            std::string sensors[UI_TEMP_GRAPH_MAX_SERIES];
+            for (int s = 0; s < series_count; s++) {
+                sensors[s] = "sensor_" + std::to_string(s);
+                ids[s] = ui_temp_graph_add_series(graph, sensors[s].c_str(),
+                                                  lv_color_hex(0x203040u * (s + 1)));
+                REQUIRE(ids[s] >= 0);
+                if (bound) {
+                    ui_temp_graph_bind_history(graph, ids[s], sensors[s].c_str());
+                }
+            }
+
+            auto push_sample = [&](int i) {
+                for (int s = 0; s < series_count; s++) {
+                    int temp_centi = 1500 + s * 100 + (i * 7 + s * 13) % 200;
+                    history.record(sensors[s], t0 + i * 1000, temp_centi);
+                    if (!bound) {
+                        ui_temp_graph_update_series(graph, ids[s], temp_centi / 10.0f);
+                    }
+                }
+                if (bound) {
+                    ui_temp_graph_refresh_history(graph);
+                }
+                lv_refr_now(nullptr);
+            };
+
+            for (int i = 0; i < warmup; i++) {
+                push_sample(i);
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = warmup; i < warmup + samples; i++) {
+                push_sample(i);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            double us_per_sample =
+                std::chrono::duration<double, std::micro>(end - start).count() / samples;
+
+            spdlog::info("[TempGraph benchmark] {} mode, {} series: {:.1f} us/sample",
+                         bound ? "history" : "push", series_count, us_per_sample);
+            REQUIRE(us_per_sample > 0.0);
+
+            ui_temp_graph_destroy(graph);
+        }
+    }
+    history.clear();
+}
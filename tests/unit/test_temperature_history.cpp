@@ -0,0 +1,180 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_temperature_history.cpp
+ * @brief Unit tests for the central temperature history ring buffer
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "temperature_history.h"
+
+#include <vector>
+
+namespace {
+
+constexpr int64_t T0 = 1'700'000'000'000; // Arbitrary wall-clock base (ms)
+
+struct HistoryFixture {
+    HistoryFixture() {
+        TemperatureHistory::instance().clear();
+    }
+    ~HistoryFixture() {
+        TemperatureHistory::instance().clear();
+    }
+
+    TemperatureHistory& history = TemperatureHistory::instance();
+};
+
+} // namespace
+
+TEST_CASE_METHOD(HistoryFixture, "TemperatureHistory: records samples per sensor",
+                 "[temperature_history]") {
+    history.set_target("extruder", 2100);
+    history.record("extruder", T0, 250);
+    history.record("extruder", T0 + 1000, 300);
+    history.record("heater_bed", T0, 220);
+
+    auto samples = history.get_samples("extruder");
+    REQUIRE(samples.size() == 2);
+    REQUIRE(samples[0].timestamp_ms == T0);
+    REQUIRE(samples[0].temp_centi == 250);
+    REQUIRE(samples[0].target_centi == 2100);
+    REQUIRE(samples[1].temp_centi == 300);
+
+    REQUIRE(history.sample_count("heater_bed") == 1);
+    REQUIRE(history.sample_count("chamber") == 0);
+    REQUIRE(history.revision("chamber") == 0);
+}
+
+TEST_CASE_METHOD(HistoryFixture, "TemperatureHistory: coalesces readings within one interval",
+                 "[temperature_history]") {
+    history.record("extruder", T0 + 10, 250);
+    history.record("extruder", T0 + 260, 251);
+    history.record("extruder", T0 + 510, 252);
+    uint64_t before = history.revision("extruder");
+    history.record("extruder", T0 + 760, 253);
+
+    auto samples = history.get_samples("extruder");
+    REQUIRE(samples.size() == 1);
+    REQUIRE(samples[0].temp_centi == 253); // Latest wins
+    REQUIRE(samples[0].timestamp_ms == T0 + 760);
+    REQUIRE(history.revision("extruder") != before);
+
+    // A reading with an older timestamp never reorders the buffer
+    history.record("extruder", T0 - 5000, 100);
+    samples = history.get_samples("extruder");
+    REQUIRE(samples.size() == 1);
+    REQUIRE(samples[0].timestamp_ms == T0 + 760);
+}
+
+TEST_CASE_METHOD(HistoryFixture, "TemperatureHistory: ring buffer keeps the newest samples",
+                 "[temperature_history]") {
+    const size_t extra = 25;
+    for (size_t i = 0; i < TemperatureHistory::CAPACITY + extra; i++) {
+        history.record("heater_bed", T0 + static_cast<int64_t>(i) * 1000, static_cast<int>(i));
+    }
+
+    auto samples = history.get_samples("heater_bed");
+    REQUIRE(samples.size() == TemperatureHistory::CAPACITY);
+    REQUIRE(samples.front().temp_centi == static_cast<int>(extra));
+    REQUIRE(samples.back().temp_centi ==
+            static_cast<int>(TemperatureHistory::CAPACITY + extra - 1));
+    for (size_t i = 1; i < samples.size(); i++) {
+        REQUIRE(samples[i].timestamp_ms > samples[i - 1].timestamp_ms);
+    }
+
+    int64_t oldest = 0;
+    int64_t newest = 0;
+    REQUIRE(history.get_time_range("heater_bed", &oldest, &newest));
+    REQUIRE(oldest == samples.front().timestamp_ms);
+    REQUIRE(newest == samples.back().timestamp_ms);
+}
+
+TEST_CASE_METHOD(HistoryFixture, "TemperatureHistory: decimation keeps min/max per bucket",
+                 "[temperature_history]") {
+    // 10 samples: a spike at t=3s and a dip at t=6s
+    const int temps[] = {200, 201, 202, 900, 203, 204, 10, 205, 206, 207};
+    for (int i = 0; i < 10; i++) {
+        history.record("extruder", T0 + i * 1000, temps[i]);
+    }
+
+    TemperatureBucket buckets[5];
+    REQUIRE(history.decimate("extruder", T0, T0 + 10000, buckets, 5) == 5);
+
+    // Bucket 1 covers t=2s..4s: rising spike, so the minimum comes first
+    REQUIRE(buckets[1].valid);
+    REQUIRE(buckets[1].min_centi == 202);
+    REQUIRE(buckets[1].max_centi == 900);
+    REQUIRE(buckets[1].min_first);
+
+    // Bucket 3 covers t=6s..8s: dip then recovery, minimum first as well
+    REQUIRE(buckets[3].min_centi == 10);
+    REQUIRE(buckets[3].max_centi == 205);
+    REQUIRE(buckets[3].min_first);
+
+    // Bucket 2 covers t=4s..6s: 203 then 204
+    REQUIRE(buckets[2].min_centi == 203);
+    REQUIRE(buckets[2].max_centi == 204);
+
+    // A window extending before the data leaves the leading buckets empty
+    TemperatureBucket wide[4];
+    REQUIRE(history.decimate("extruder", T0 - 10000, T0 + 10000, wide, 4) == 2);
+    REQUIRE_FALSE(wide[0].valid);
+    REQUIRE_FALSE(wide[1].valid);
+    REQUIRE(wide[2].min_centi == 200);
+    REQUIRE(wide[2].max_centi == 900);
+    REQUIRE(wide[3].min_centi == 10);
+    REQUIRE(wide[3].max_centi == 207);
+
+    // Falling temperatures report the maximum first
+    history.record("heater_bed", T0, 600);
+    history.record("heater_bed", T0 + 1000, 400);
+    TemperatureBucket falling;
+    REQUIRE(history.decimate("heater_bed", T0, T0 + 2000, &falling, 1) == 1);
+    REQUIRE(falling.max_centi == 600);
+    REQUIRE(falling.min_centi == 400);
+    REQUIRE_FALSE(falling.min_first);
+
+    REQUIRE(history.decimate("missing", T0, T0 + 10000, buckets, 5) == 0);
+}
+
+TEST_CASE_METHOD(HistoryFixture, "TemperatureHistory: imports Moonraker temperature store",
+                 "[temperature_history]") {
+    // A live sample recorded after the store snapshot must survive the import
+    history.record("extruder", T0 + 2000, 555);
+
+    json store = {
+        {"extruder",
+         {{"temperatures", {21.5, 22.0, 23.25}}, {"targets", {0, 0, 210}}, {"powers", {0, 0, 1}}}},
+        {"heater_bed", {{"temperatures", {60.0, 60.1}}, {"targets", {60, 60}}}},
+        {"temperature_fan exhaust", {{"speeds", {0.5, 0.5}}}}, // No temperatures: skipped
+    };
+    REQUIRE(history.import_temperature_store(store, T0) == 5);
+
+    auto extruder = history.get_samples("extruder");
+    REQUIRE(extruder.size() == 4);
+    REQUIRE(extruder[0].timestamp_ms == T0 - 2000);
+    REQUIRE(extruder[0].temp_centi == 215);
+    REQUIRE(extruder[2].timestamp_ms == T0);
+    REQUIRE(extruder[2].temp_centi == 232);
+    REQUIRE(extruder[2].target_centi == 2100);
+    REQUIRE(extruder[3].temp_centi == 555);
+
+    REQUIRE(history.sample_count("heater_bed") == 2);
+    REQUIRE(history.sample_count("temperature_fan exhaust") == 0);
+
+    // Oversized stores keep only the newest CAPACITY samples
+    json big = json::array();
+    for (size_t i = 0; i < TemperatureHistory::CAPACITY + 10; i++) {
+        big.push_back(static_cast<double>(i));
+    }
+    REQUIRE(history.import_temperature_store({{"heater_bed", {{"temperatures", big}}}}, T0) ==
+            TemperatureHistory::CAPACITY);
+    auto bed = history.get_samples("heater_bed");
+    REQUIRE(bed.size() == TemperatureHistory::CAPACITY);
+    REQUIRE(bed.front().temp_centi == 100);
+    REQUIRE(bed.back().timestamp_ms == T0);
+
+    REQUIRE(history.import_temperature_store(json::array(), T0) == 0);
+}
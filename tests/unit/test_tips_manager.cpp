@@ -12,6 +12,7 @@
 
 #include "../catch_amalgamated.hpp"
 #include "tips_manager.h"
+#include <algorithm>
 #include <fstream>
 #include <thread>
 #include <vector>
@@ -545,6 +546,105 @@ TEST_CASE_METHOD(TipsManagerTestFixture, "TipsManager: get_tip_by_id() returns e
     TearDown();
 }
 
+// ============================================================================
+// Index Queries (no copies)
+// ============================================================================
+
+TEST_CASE_METHOD(TipsManagerTestFixture, "TipsManager: index queries match copying queries", "[tips_manager][index]") {
+    SetUp();
+
+    TipsManager* mgr = TipsManager::get_instance();
+    mgr->init(test_tips_file);
+
+    auto ids_of = [mgr](const std::vector<size_t>& indices) {
+        std::vector<std::string> ids;
+        for (size_t i : indices) {
+            const PrintingTip* tip = mgr->get_tip(i);
+            REQUIRE(tip != nullptr);
+            ids.push_back(tip->id);
+        }
+        return ids;
+    };
+    auto ids_of_tips = [](const std::vector<PrintingTip>& tips) {
+        std::vector<std::string> ids;
+        for (const auto& tip : tips) {
+            ids.push_back(tip.id);
+        }
+        return ids;
+    };
+
+    REQUIRE(ids_of(mgr->get_tip_indices_by_category("test_category_2")) ==
+            std::vector<std::string>{"tip-004", "tip-005"});
+    REQUIRE(ids_of(mgr->get_tip_indices_by_tag("CALIBRATION")) ==
+            ids_of_tips(mgr->get_tips_by_tag("calibration")));
+    REQUIRE(ids_of(mgr->get_tip_indices_by_difficulty("beginner")) ==
+            std::vector<std::string>{"tip-001", "tip-004", "tip-005"});
+    REQUIRE(ids_of(mgr->get_tip_indices_by_priority("Medium")) ==
+            std::vector<std::string>{"tip-002", "tip-005"});
+    REQUIRE(mgr->get_tip_indices_by_tag("no_such_tag").empty());
+    REQUIRE(mgr->get_tip(mgr->get_total_tips()) == nullptr);
+
+    TearDown();
+}
+
+TEST_CASE_METHOD(TipsManagerTestFixture, "TipsManager: search_tip_indices() matches substrings and phrases", "[tips_manager][index][search]") {
+    SetUp();
+
+    TipsManager* mgr = TipsManager::get_instance();
+    mgr->init(test_tips_file);
+
+    std::vector<size_t> results;
+
+    // Part of a word
+    REQUIRE(mgr->search_tip_indices("alibrat", results) == 2);
+
+    // Phrases spanning several words
+    REQUIRE(mgr->search_tip_indices("KEYWORD SPEED", results) == 1);
+    REQUIRE(mgr->get_tip(results[0])->id == "tip-002");
+    REQUIRE(mgr->search_tip_indices("content 4 with", results) == 1);
+    REQUIRE(mgr->get_tip(results[0])->id == "tip-004");
+
+    // Words present in different tips don't make a phrase
+    REQUIRE(mgr->search_tip_indices("speed calibration", results) == 0);
+    REQUIRE(mgr->search_tip_indices("", results) == 0);
+
+    // Same results as the copying search, in database order
+    REQUIRE(mgr->search_tip_indices("test tip", results) == 5);
+    auto tips = mgr->search_by_keyword("test tip");
+    REQUIRE(tips.size() == results.size());
+    for (size_t i = 0; i < tips.size(); i++) {
+        REQUIRE(tips[i].id == mgr->get_tip(results[i])->id);
+    }
+
+    TearDown();
+}
+
+TEST_CASE_METHOD(TipsManagerTestFixture, "TipsManager: get_random_unique_tip_index() covers every tip once", "[tips_manager][index][unique]") {
+    SetUp();
+
+    TipsManager* mgr = TipsManager::get_instance();
+    mgr->init(test_tips_file);
+
+    std::vector<size_t> seen;
+    for (size_t i = 0; i < mgr->get_total_tips(); i++) {
+        size_t index = mgr->get_random_unique_tip_index();
+        REQUIRE(index < mgr->get_total_tips());
+        seen.push_back(index);
+    }
+    std::sort(seen.begin(), seen.end());
+    REQUIRE(std::unique(seen.begin(), seen.end()) == seen.end());
+
+    // Exhausted session starts over
+    REQUIRE(mgr->get_random_unique_tip_index() < mgr->get_total_tips());
+
+    create_empty_tips();
+    mgr->init(empty_tips_file);
+    REQUIRE(mgr->get_random_unique_tip_index() == TipsManager::NO_TIP);
+    REQUIRE(mgr->get_tip(TipsManager::NO_TIP) == nullptr);
+
+    TearDown();
+}
+
 // ============================================================================
 // Thread Safety (Basic Test)
 // ============================================================================
@@ -0,0 +1,97 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_ui_splash_screen.cpp
+ * @brief Unit tests for the in-process splash shown while the UI is built
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "lvgl/lvgl.h"
+#include "ui_splash_screen.h"
+
+namespace {
+
+int g_renders = 0;
+
+void flush_cb(lv_display_t* display, const lv_area_t* /*area*/, uint8_t* /*px_map*/) {
+    lv_display_flush_ready(display);
+}
+
+void render_start_cb(lv_event_t* /*e*/) {
+    g_renders++;
+}
+
+} // namespace
+
+// Test fixture: headless display with an empty screen
+class SplashScreenTestFixture {
+  public:
+    SplashScreenTestFixture() {
+        lv_init();
+
+        display = lv_display_create(800, 480);
+        alignas(64) static lv_color_t buf1[800 * 10];
+        lv_display_set_buffers(display, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(display, flush_cb);
+        lv_display_add_event_cb(display, render_start_cb, LV_EVENT_RENDER_START, nullptr);
+
+        screen = lv_obj_create(NULL);
+        lv_screen_load(screen);
+        lv_refr_now(display);
+        g_renders = 0;
+    }
+
+    ~SplashScreenTestFixture() {
+        lv_obj_clean(lv_display_get_layer_top(display));
+    }
+
+    lv_display_t* display = nullptr;
+    lv_obj_t* screen = nullptr;
+};
+
+TEST_CASE_METHOD(SplashScreenTestFixture, "SplashScreen: covers the screen while the UI is built",
+                 "[splash]") {
+    SplashScreen splash;
+    splash.show(display, true);
+
+    REQUIRE(splash.is_shown());
+    REQUIRE(g_renders == 1); // First frame drawn before show() returns
+    REQUIRE(lv_obj_get_child_count(lv_display_get_layer_top(display)) == 1);
+    REQUIRE(lv_obj_has_flag(screen, LV_OBJ_FLAG_HIDDEN));
+
+    SECTION("Building the UI doesn't redraw anything") {
+        lv_anim_delete_all(); // Only changes to the UI could redraw now
+        int renders = g_renders;
+
+        for (int i = 0; i < 20; i++) {
+            lv_obj_t* label = lv_label_create(screen);
+            lv_label_set_text(label, "panel");
+        }
+        lv_refr_now(display);
+        REQUIRE(g_renders == renders);
+    }
+
+    SECTION("dismiss() shows the screen again") {
+        splash.dismiss();
+        REQUIRE_FALSE(splash.is_shown());
+        REQUIRE_FALSE(lv_obj_has_flag(screen, LV_OBJ_FLAG_HIDDEN));
+
+        lv_obj_t* overlay = lv_obj_get_child(lv_display_get_layer_top(display), 0);
+        REQUIRE(overlay != nullptr);
+        REQUIRE_FALSE(lv_obj_has_flag(overlay, LV_OBJ_FLAG_CLICKABLE)); // Touches reach the UI
+
+        splash.dismiss(); // No-op
+        splash.pump();    // No-op
+    }
+}
+
+TEST_CASE_METHOD(SplashScreenTestFixture, "SplashScreen: unused splash does nothing", "[splash]") {
+    SplashScreen splash;
+    splash.pump();
+    splash.dismiss();
+
+    REQUIRE_FALSE(splash.is_shown());
+    REQUIRE(g_renders == 0);
+    REQUIRE_FALSE(lv_obj_has_flag(screen, LV_OBJ_FLAG_HIDDEN));
+}
@@ -293,6 +293,23 @@ TEST_CASE("UsbManager drive queries", "[usb_manager]") {
         REQUIRE(files.size() == 1);
         REQUIRE(files[0].filename == "test.gcode");
     }
+
+    SECTION("inserted drives are catalogued until removed") {
+        backend->set_mock_files("/media/usb0", {
+            {"/media/usb0/test.gcode", "test.gcode", 100, 1000},
+        });
+        backend->simulate_drive_insert(
+            UsbDrive("/media/usb0", "/dev/sda1", "TEST", 1024, 512));
+
+        for (int i = 0; i < 200 && !manager.catalog().progress("/media/usb0").complete(); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        REQUIRE(manager.catalog().progress("/media/usb0").complete());
+        REQUIRE(manager.catalog().entries("/media/usb0").size() == 1);
+
+        backend->simulate_drive_remove("/media/usb0");
+        REQUIRE(manager.catalog().entries("/media/usb0").empty());
+    }
 }
 
 TEST_CASE("UsbManager event callbacks", "[usb_manager]") {
@@ -0,0 +1,212 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_usb_catalog.cpp
+ * @brief Unit tests for the background USB G-code catalog
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "usb_catalog.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sys/stat.h>
+#include <thread>
+
+using Catch::Approx;
+namespace fs = std::filesystem;
+
+namespace {
+
+const std::string TEST_ROOT = "/tmp/helix_usb_catalog_test";
+const std::string MOUNT = TEST_ROOT + "/usb0";
+const std::string CACHE = TEST_ROOT + "/cache";
+
+void write_gcode(const std::string& name, int minutes) {
+    std::ofstream out(MOUNT + "/" + name);
+    out << "; generated by OrcaSlicer 2.3.1\n";
+    out << "G1 X10 Y10 Z0.2\n";
+    out << "; estimated printing time (normal mode) = " << minutes << "m 0s\n";
+    out << "; total filament used [g] = 12.5\n";
+}
+
+// Lists the .gcode files in MOUNT, optionally waiting until released
+struct TestScanner {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool hold = false;
+    std::atomic<int> scans{0};
+
+    std::vector<UsbGcodeFile> scan(const std::string& mount_path) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return !hold; });
+        }
+        scans++;
+
+        std::vector<UsbGcodeFile> files;
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(mount_path, ec)) {
+            struct stat st;
+            if (entry.path().extension() == ".gcode" && stat(entry.path().c_str(), &st) == 0) {
+                files.emplace_back(entry.path().string(), entry.path().filename().string(),
+                                   static_cast<uint64_t>(st.st_size),
+                                   static_cast<int64_t>(st.st_mtime));
+            }
+        }
+        return files;
+    }
+
+    void set_hold(bool value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            hold = value;
+        }
+        cv.notify_all();
+    }
+};
+
+struct TestDrive {
+    TestDrive() {
+        fs::remove_all(TEST_ROOT);
+        fs::create_directories(MOUNT);
+        write_gcode("benchy.gcode", 36);
+        write_gcode("cube.gcode", 12);
+        drive = UsbDrive(MOUNT, "/dev/sda1", "PRINTS", 1024, 512);
+        drive.uuid = "1234-ABCD";
+    }
+    ~TestDrive() {
+        fs::remove_all(TEST_ROOT);
+    }
+
+    UsbDrive drive;
+};
+
+bool wait_for(const std::function<bool()>& condition) {
+    for (int i = 0; i < 500; i++) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+const UsbCatalogEntry* find(const std::vector<UsbCatalogEntry>& entries,
+                            const std::string& filename) {
+    for (const auto& entry : entries) {
+        if (entry.file.filename == filename) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("UsbCatalog: indexes a drive and fills in metadata", "[usb_catalog]") {
+    TestDrive test;
+    TestScanner scanner;
+    UsbCatalog catalog([&](const std::string& mount) { return scanner.scan(mount); });
+    catalog.set_cache_dir(CACHE);
+
+    std::atomic<int> reports{0};
+    catalog.set_progress_callback([&](const UsbCatalogProgress&) { reports++; });
+
+    catalog.open(test.drive);
+    REQUIRE(wait_for([&] { return catalog.progress(MOUNT).complete(); }));
+
+    UsbCatalogProgress progress = catalog.progress(MOUNT);
+    REQUIRE(progress.files == 2);
+    REQUIRE(progress.metadata_done == 2);
+    REQUIRE_FALSE(progress.from_cache);
+    REQUIRE(reports >= 2); // Walked, complete
+
+    auto entries = catalog.entries(MOUNT);
+    const UsbCatalogEntry* benchy = find(entries, "benchy.gcode");
+    REQUIRE(benchy != nullptr);
+    REQUIRE(benchy->has_metadata);
+    REQUIRE(benchy->metadata.estimated_time_seconds == Approx(36 * 60.0));
+    REQUIRE(benchy->metadata.filament_used_g == Approx(12.5));
+    REQUIRE(benchy->thumbnail_path.empty()); // No thumbnail in the file
+
+    REQUIRE(fs::exists(CACHE + "/1234-ABCD.json"));
+}
+
+TEST_CASE("UsbCatalog: re-inserting a drive uses the saved index", "[usb_catalog]") {
+    TestDrive test;
+    TestScanner scanner;
+    {
+        UsbCatalog first([&](const std::string& mount) { return scanner.scan(mount); });
+        first.set_cache_dir(CACHE);
+        first.open(test.drive);
+        REQUIRE(wait_for([&] { return first.progress(MOUNT).complete(); }));
+        first.close(MOUNT);
+    }
+
+    // Hold the walk so only the saved index is available
+    scanner.set_hold(true);
+
+    UsbCatalog catalog([&](const std::string& mount) { return scanner.scan(mount); });
+    catalog.set_cache_dir(CACHE);
+    catalog.open(test.drive);
+    REQUIRE(wait_for([&] { return catalog.entries(MOUNT).size() == 2; }));
+
+    UsbCatalogProgress progress = catalog.progress(MOUNT);
+    REQUIRE(progress.from_cache);
+    REQUIRE(progress.indexing);
+    REQUIRE(progress.metadata_done == 2);
+    auto entries = catalog.entries(MOUNT);
+    const UsbCatalogEntry* cube = find(entries, "cube.gcode");
+    REQUIRE(cube != nullptr);
+    REQUIRE(cube->metadata.estimated_time_seconds == Approx(12 * 60.0));
+
+    SECTION("Changed files are read again after the walk") {
+        write_gcode("cube.gcode", 120); // One byte longer
+        scanner.set_hold(false);
+        REQUIRE(wait_for([&] {
+            auto current = catalog.entries(MOUNT);
+            const UsbCatalogEntry* e = find(current, "cube.gcode");
+            return e && e->has_metadata && e->metadata.estimated_time_seconds > 119 * 60.0;
+        }));
+        REQUIRE(catalog.progress(MOUNT).complete());
+    }
+
+    scanner.set_hold(false);
+}
+
+TEST_CASE("UsbCatalog: removing the drive cancels its work", "[usb_catalog]") {
+    TestDrive test;
+    TestScanner scanner;
+    UsbCatalog catalog([&](const std::string& mount) { return scanner.scan(mount); });
+
+    scanner.set_hold(true);
+    catalog.open(test.drive);
+    catalog.close(MOUNT);
+    scanner.set_hold(false);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // A walk in progress ends
+    REQUIRE(catalog.entries(MOUNT).empty());
+    REQUIRE_FALSE(catalog.progress(MOUNT).indexing);
+
+    SECTION("The drive can be opened again") {
+        catalog.open(test.drive);
+        REQUIRE(wait_for([&] { return catalog.progress(MOUNT).complete(); }));
+        REQUIRE(catalog.entries(MOUNT).size() == 2);
+    }
+}
+
+TEST_CASE("UsbCatalog: drive keys", "[usb_catalog]") {
+    UsbDrive drive("/media/usb0", "/dev/sda1", "MY DRIVE", 4096, 0);
+    REQUIRE(UsbCatalog::drive_key(drive) == "MY_DRIVE-4096");
+
+    drive.uuid = "1234-ABCD";
+    REQUIRE(UsbCatalog::drive_key(drive) == "1234-ABCD");
+
+    REQUIRE(UsbCatalog::drive_key(UsbDrive()) == ""); // Nothing stable to key on: not saved
+}
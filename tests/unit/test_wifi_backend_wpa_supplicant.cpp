@@ -0,0 +1,131 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_wifi_backend_wpa_supplicant.cpp
+ * @brief wpa_supplicant backend against a local fake control socket
+ */
+
+#include "../catch_amalgamated.hpp"
+
+#ifndef __APPLE__
+
+#include "../fake_wpa_supplicant.h"
+#include "wifi_backend_wpa_supplicant.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+const std::string HOME = "aa:bb:cc:dd:ee:01\t2437\t-45\t[WPA2-PSK-CCMP][ESS]\tHome";
+const std::string CAFE = "aa:bb:cc:dd:ee:03\t2412\t-70\t[ESS]\tCafe";
+
+bool wait_for(const std::function<bool()>& condition, int timeout_ms = 2000) {
+    for (int waited = 0; waited < timeout_ms; waited += 10) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+}
+
+} // namespace
+
+class WpaSupplicantTestFixture {
+  public:
+    WpaSupplicantTestFixture()
+        : wpa("/tmp/helix_fake_wpa_" + std::to_string(getpid())), backend(wpa.socket_path()) {
+        REQUIRE(wpa.start());
+        wpa.set_scan_results({HOME, CAFE});
+
+        backend.register_event_callback("SCAN_COMPLETE",
+                                        [this](const std::string&) { scan_events++; });
+        backend.register_event_callback("CONNECTED",
+                                        [this](const std::string&) { connected_events++; });
+        REQUIRE(backend.start().success());
+        REQUIRE(wpa.wait_for_attach());
+    }
+
+    ~WpaSupplicantTestFixture() {
+        backend.stop();
+        wpa.stop();
+    }
+
+    FakeWpaSupplicant wpa;
+    WifiBackendWpaSupplicant backend;
+    std::atomic<int> scan_events{0};
+    std::atomic<int> connected_events{0};
+};
+
+TEST_CASE_METHOD(WpaSupplicantTestFixture, "WpaSupplicant: requested scan reports networks",
+                 "[wifi][wpa_supplicant]") {
+    REQUIRE(backend.trigger_scan().success());
+    REQUIRE(wait_for([this] { return scan_events == 1; }));
+
+    std::vector<WiFiNetwork> networks;
+    REQUIRE(backend.get_scan_results(networks).success());
+    REQUIRE(networks.size() == 2);
+    REQUIRE(networks[0].ssid == "Home");
+    REQUIRE(networks[1].ssid == "Cafe");
+
+    int requests = wpa.command_count("SCAN_RESULTS");
+    REQUIRE(backend.get_scan_results(networks).success());
+    REQUIRE(wpa.command_count("SCAN_RESULTS") == requests); // Served from the table
+}
+
+TEST_CASE_METHOD(WpaSupplicantTestFixture, "WpaSupplicant: unrequested results only when changed",
+                 "[wifi][wpa_supplicant]") {
+    REQUIRE(backend.trigger_scan().success());
+    REQUIRE(wait_for([this] { return scan_events == 1; }));
+
+    // Another client's scan (or a duplicate event) with the same networks
+    int requests = wpa.command_count("SCAN_RESULTS");
+    wpa.send_event("CTRL-EVENT-SCAN-RESULTS ");
+    REQUIRE(wait_for([&] { return wpa.command_count("SCAN_RESULTS") > requests; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(scan_events == 1);
+
+    wpa.set_scan_results({HOME});
+    wpa.send_event("CTRL-EVENT-SCAN-RESULTS ");
+    REQUIRE(wait_for([this] { return scan_events == 2; }));
+
+    std::vector<WiFiNetwork> networks;
+    REQUIRE(backend.get_scan_results(networks).success());
+    REQUIRE(networks.size() == 1);
+}
+
+TEST_CASE_METHOD(WpaSupplicantTestFixture, "WpaSupplicant: periodic scan runs on the backend",
+                 "[wifi][wpa_supplicant]") {
+    REQUIRE(backend.set_periodic_scan(30));
+    REQUIRE(wpa.wait_for_command("SCAN", 3));
+    REQUIRE(wait_for([this] { return scan_events == 1; })); // First results are new
+
+    REQUIRE(backend.set_periodic_scan(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // A scan already due may run
+    int scans = wpa.command_count("SCAN");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE(wpa.command_count("SCAN") == scans);
+    REQUIRE(scan_events == 1); // Same networks every time
+}
+
+TEST_CASE_METHOD(WpaSupplicantTestFixture, "WpaSupplicant: connection events are dispatched",
+                 "[wifi][wpa_supplicant]") {
+    wpa.send_event("CTRL-EVENT-CONNECTED - Connection to aa:bb:cc:dd:ee:01 completed [id=0]");
+    REQUIRE(wait_for([this] { return connected_events == 1; }));
+
+    wpa.set_status("wpa_state=COMPLETED\nssid=Home\nbssid=aa:bb:cc:dd:ee:01\n"
+                   "ip_address=192.168.1.50\n");
+    WifiBackend::ConnectionStatus status = backend.get_status();
+    REQUIRE(status.connected);
+    REQUIRE(status.ssid == "Home");
+    REQUIRE(status.ip_address == "192.168.1.50");
+    REQUIRE(status.signal_strength == WifiNetworkTable::dbm_to_percentage(-50));
+}
+
+#endif // __APPLE__
@@ -0,0 +1,98 @@
+// Copyright 2025 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_wifi_network_table.cpp
+ * @brief Unit tests for the scan result table behind the wpa_supplicant backend
+ */
+
+#include "../catch_amalgamated.hpp"
+#include "wifi_network_table.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string HEADER = "bssid / frequency / signal level / flags / ssid\n";
+
+std::string results(const std::vector<std::string>& lines) {
+    std::string raw = HEADER;
+    for (const auto& line : lines) {
+        raw += line + "\n";
+    }
+    return raw;
+}
+
+const std::string HOME = "aa:bb:cc:dd:ee:01\t2437\t-45\t[WPA2-PSK-CCMP][ESS]\tHome";
+const std::string HOME_MESH = "aa:bb:cc:dd:ee:02\t5180\t-60\t[WPA2-PSK-CCMP][ESS]\tHome";
+const std::string CAFE = "aa:bb:cc:dd:ee:03\t2412\t-70\t[ESS]\tCafe";
+const std::string HIDDEN = "aa:bb:cc:dd:ee:04\t2412\t-50\t[WPA2-PSK-CCMP][ESS]";
+
+} // namespace
+
+TEST_CASE("WifiNetworkTable: first scan adds every SSID once", "[wifi][network_table]") {
+    WifiNetworkTable table;
+    WifiNetworkDiff diff = table.apply_scan_results(results({HOME, HOME_MESH, CAFE, HIDDEN}));
+
+    REQUIRE(diff.added.size() == 2); // Mesh AP folded into Home, hidden network skipped
+    REQUIRE(diff.changed.empty());
+    REQUIRE(diff.removed.empty());
+
+    auto networks = table.networks();
+    REQUIRE(networks.size() == 2);
+    REQUIRE(networks[0].ssid == "Home"); // Strongest first
+    REQUIRE(networks[0].signal_strength == WifiNetworkTable::dbm_to_percentage(-45));
+    REQUIRE(networks[0].security_type == "WPA2");
+    REQUIRE(networks[1].ssid == "Cafe");
+    REQUIRE_FALSE(networks[1].is_secured);
+}
+
+TEST_CASE("WifiNetworkTable: later scans report only changes", "[wifi][network_table]") {
+    WifiNetworkTable table;
+    table.apply_scan_results(results({HOME, CAFE}));
+
+    SECTION("Identical results are not a change") {
+        REQUIRE(table.apply_scan_results(results({HOME, CAFE})).empty());
+        REQUIRE(table.apply_scan_results(results({CAFE, HOME})).empty()); // Order
+    }
+
+    SECTION("Small signal changes are not reported") {
+        std::string home_weaker = "aa:bb:cc:dd:ee:01\t2437\t-47\t[WPA2-PSK-CCMP][ESS]\tHome";
+        REQUIRE(table.apply_scan_results(results({home_weaker, CAFE})).empty());
+        REQUIRE(table.networks()[0].signal_strength == WifiNetworkTable::dbm_to_percentage(-45));
+    }
+
+    SECTION("Larger signal changes are") {
+        std::string home_weak = "aa:bb:cc:dd:ee:01\t2437\t-80\t[WPA2-PSK-CCMP][ESS]\tHome";
+        WifiNetworkDiff diff = table.apply_scan_results(results({home_weak, CAFE}));
+        REQUIRE(diff.changed.size() == 1);
+        REQUIRE(diff.changed[0].ssid == "Home");
+        REQUIRE(table.networks()[0].ssid == "Cafe"); // Re-sorted
+    }
+
+    SECTION("Networks appear and disappear") {
+        std::string lab = "aa:bb:cc:dd:ee:05\t2462\t-55\t[WPA3-SAE-CCMP][ESS]\tLab";
+        WifiNetworkDiff diff = table.apply_scan_results(results({HOME, lab}));
+        REQUIRE(diff.added.size() == 1);
+        REQUIRE(diff.added[0].ssid == "Lab");
+        REQUIRE(diff.added[0].security_type == "WPA3");
+        REQUIRE(diff.removed == std::vector<std::string>{"Cafe"});
+        REQUIRE(table.size() == 2);
+    }
+
+    SECTION("Empty results remove everything") {
+        WifiNetworkDiff diff = table.apply_scan_results(HEADER);
+        REQUIRE(diff.removed.size() == 2);
+        REQUIRE(table.networks().empty());
+    }
+}
+
+TEST_CASE("WifiNetworkTable: malformed lines are skipped", "[wifi][network_table]") {
+    WifiNetworkTable table;
+    WifiNetworkDiff diff = table.apply_scan_results(
+        results({"garbage", "aa:bb:cc:dd:ee:06\t2412\tstrong\t[ESS]\tBad", HOME}));
+
+    REQUIRE(diff.added.size() == 1);
+    REQUIRE(table.networks()[0].ssid == "Home");
+}